@@ -45,7 +45,7 @@ void AchievementAccessorPostgresql::insertRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "INSERT INTO achievements (epoch_name, login, achievement_name) VALUES("
                    + backbone_transaction.quote(a_epoch_name.c_str()) + ", "
@@ -44,7 +44,7 @@ bool AuthenticationAccessorPostgresql::authenticate(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM users WHERE login = " + backbone_transaction.quote(a_login)
                    + " AND password = " + backbone_transaction.quote(a_password);
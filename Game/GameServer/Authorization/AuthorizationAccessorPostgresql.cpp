@@ -44,7 +44,7 @@ bool AuthorizationAccessorPostgresql::authorizeUserToLand(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM lands WHERE login = " + backbone_transaction.quote(a_login)
                    + " AND land_name = " + backbone_transaction.quote(a_land_name);
@@ -60,7 +60,7 @@ string AuthorizationAccessorPostgresql::getLandNameOfSettlement(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT land_name FROM settlements WHERE settlement_name = " + backbone_transaction.quote(a_settlement_name);
 
@@ -26,7 +26,9 @@
 // SUCH DAMAGE.
 
 #include <Game/GameServer/Building/BuildingAccessorPostgresql.hpp>
+#include <Game/GameServer/Persistence/CursorPostgresql.hpp>
 #include <Game/GameServer/Persistence/TransactionPostgresql.hpp>
+#include <Language/Interface/Arena.hpp>
 
 using namespace GameServer::Common;
 using namespace GameServer::Configuration;
@@ -47,7 +49,7 @@ void BuildingAccessorPostgresql::insertRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "INSERT INTO "
                    + getTableName(a_id_holder)
@@ -66,7 +68,7 @@ void BuildingAccessorPostgresql::deleteRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "DELETE FROM "
                    + getTableName(a_id_holder)
@@ -83,7 +85,7 @@ BuildingWithVolumeRecordShrPtr BuildingAccessorPostgresql::getRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT volume FROM "
                    + getTableName(a_id_holder)
@@ -96,7 +98,9 @@ BuildingWithVolumeRecordShrPtr BuildingAccessorPostgresql::getRecord(
     {
         Volume volume;
         result[0]["volume"].to(volume);
-        return make_shared<BuildingWithVolumeRecord>(a_id_holder, a_key, volume);
+        return boost::allocate_shared<BuildingWithVolumeRecord>(
+            Language::ArenaAllocator<BuildingWithVolumeRecord>(), a_id_holder, a_key, volume
+        );
     }
     else
     {
@@ -110,32 +114,38 @@ BuildingWithVolumeRecordMap BuildingAccessorPostgresql::getRecords(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM "
                    + getTableName(a_id_holder)
                    + " WHERE holder_name = " + backbone_transaction.quote(a_id_holder.getValue2());
 
-    pqxx::result result = backbone_transaction.exec(query);
-
-    BuildingWithVolumeRecordMap records;
-
-    string key;
-    Volume volume;
+    return prepareResultGetRecords(backbone_transaction.exec(query), a_id_holder);
+}
 
-    for (pqxx::result::const_iterator it = result.begin(); it != result.end(); ++it)
-    {
-        it["building_key"].to(key);
-        it["volume"].to(volume);
+void BuildingAccessorPostgresql::visitRecords(
+    ITransactionShrPtr                                 a_transaction,
+    IDHolder                                   const & a_id_holder,
+    unsigned int                               const   a_batch_size,
+    IBatchVisitor<BuildingWithVolumeRecordMap>       & a_visitor
+) const
+{
+    TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
-        BuildingWithVolumeRecordShrPtr record = make_shared<BuildingWithVolumeRecord>(a_id_holder, key, volume);
+    string query = "SELECT * FROM "
+                   + getTableName(a_id_holder)
+                   + " WHERE holder_name = " + backbone_transaction.quote(a_id_holder.getValue2())
+                   + " ORDER BY building_key";
 
-        BuildingWithVolumeRecordPair pair(key, record);
+    CursorPostgresql cursor(backbone_transaction, "buildings_cursor", query);
 
-        records.insert(pair);
+    for (pqxx::result result = cursor.fetch(a_batch_size); !result.empty(); result = cursor.fetch(a_batch_size))
+    {
+        a_visitor.visit(prepareResultGetRecords(result, a_id_holder));
     }
 
-    return records;
+    cursor.close();
 }
 
 void BuildingAccessorPostgresql::increaseVolume(
@@ -146,7 +156,7 @@ void BuildingAccessorPostgresql::increaseVolume(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE "
                    + getTableName(a_id_holder)
@@ -165,7 +175,7 @@ void BuildingAccessorPostgresql::decreaseVolume(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE "
                    + getTableName(a_id_holder)
@@ -176,6 +186,33 @@ void BuildingAccessorPostgresql::decreaseVolume(
     pqxx::result result = backbone_transaction.exec(query);
 }
 
+BuildingWithVolumeRecordMap BuildingAccessorPostgresql::prepareResultGetRecords(
+    pqxx::result const & a_result,
+    IDHolder     const & a_id_holder
+) const
+{
+    BuildingWithVolumeRecordMap records;
+
+    string key;
+    Volume volume;
+
+    for (pqxx::result::const_iterator it = a_result.begin(); it != a_result.end(); ++it)
+    {
+        it["building_key"].to(key);
+        it["volume"].to(volume);
+
+        BuildingWithVolumeRecordShrPtr record = boost::allocate_shared<BuildingWithVolumeRecord>(
+            Language::ArenaAllocator<BuildingWithVolumeRecord>(), a_id_holder, key, volume
+        );
+
+        BuildingWithVolumeRecordPair pair(key, record);
+
+        records.insert(pair);
+    }
+
+    return records;
+}
+
 string BuildingAccessorPostgresql::getTableName(
     IDHolder const & a_id_holder
 ) const
@@ -29,6 +29,7 @@
 #define GAMESERVER_BUILDING_BUILDINGACCESSORPOSTGRESQL_HPP
 
 #include <Game/GameServer/Building/IBuildingAccessor.hpp>
+#include <pqxx/result.hxx>
 #include <string>
 
 namespace GameServer
@@ -103,6 +104,21 @@ public:
         Common::IDHolder                const & a_id_holder
     ) const;
 
+    /**
+     * @brief Visits building with volume records in batches, ordered by the key of the building.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   An identifier of the holder.
+     * @param a_batch_size  The maximum number of records in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitRecords(
+        Persistence::ITransactionShrPtr                                 a_transaction,
+        Common::IDHolder                                        const & a_id_holder,
+        unsigned int                                            const   a_batch_size,
+        Persistence::IBatchVisitor<BuildingWithVolumeRecordMap>       & a_visitor
+    ) const;
+
     /**
      * @brief Increases the volume of building with volume record.
      *
@@ -138,6 +154,19 @@ public:
     ) const;
 
 private:
+    /**
+     * @brief Prepares the result for getRecords* methods.
+     *
+     * @param a_result    A result of the query.
+     * @param a_id_holder The identifier of the holder.
+     *
+     * @return A map of building with volume records.
+     */
+    BuildingWithVolumeRecordMap prepareResultGetRecords(
+        pqxx::result     const & a_result,
+        Common::IDHolder const & a_id_holder
+    ) const;
+
     /**
      * @brief Gets the table name dependant on identifier of a holder.
      *
@@ -26,6 +26,9 @@
 // SUCH DAMAGE.
 
 #include <Game/GameServer/Building/BuildingPersistenceFacade.hpp>
+#include <Game/GameServer/Persistence/BatchVisitors.hpp>
+#include <Language/Interface/Arena.hpp>
+#include <boost/bind.hpp>
 
 using namespace GameServer::Common;
 using namespace GameServer::Configuration;
@@ -109,15 +112,36 @@ BuildingWithVolumeMap BuildingPersistenceFacade::getBuildings(
     IDHolder           const & a_id_holder
 ) const
 {
-    BuildingWithVolumeMap result;
+    return prepareResultGetBuildings(m_accessor->getRecords(a_transaction, a_id_holder));
+}
+
+void BuildingPersistenceFacade::visitBuildings(
+    ITransactionShrPtr                           a_transaction,
+    IDHolder                             const & a_id_holder,
+    unsigned int                         const   a_batch_size,
+    IBatchVisitor<BuildingWithVolumeMap>       & a_visitor
+) const
+{
+    ConvertingBatchVisitor<BuildingWithVolumeRecordMap, BuildingWithVolumeMap> converting_visitor(
+        boost::bind(&BuildingPersistenceFacade::prepareResultGetBuildings, this, _1), a_visitor
+    );
 
-    BuildingWithVolumeRecordMap records = m_accessor->getRecords(a_transaction, a_id_holder);
+    m_accessor->visitRecords(a_transaction, a_id_holder, a_batch_size, converting_visitor);
+}
+
+BuildingWithVolumeMap BuildingPersistenceFacade::prepareResultGetBuildings(
+    BuildingWithVolumeRecordMap const & a_records
+) const
+{
+    BuildingWithVolumeMap result;
 
-    for (BuildingWithVolumeRecordMap::iterator it = records.begin(); it != records.end(); ++it)
+    for (BuildingWithVolumeRecordMap::const_iterator it = a_records.begin(); it != a_records.end(); ++it)
     {
         if (it->second)
         {
-            BuildingWithVolumeShrPtr building = make_shared<BuildingWithVolume>(m_context, *it->second);
+            BuildingWithVolumeShrPtr building = boost::allocate_shared<BuildingWithVolume>(
+                Language::ArenaAllocator<BuildingWithVolume>(), m_context, *it->second
+            );
             BuildingWithVolumePair pair(it->first, building);
             result.insert(pair);
         }
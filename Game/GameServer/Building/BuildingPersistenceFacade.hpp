@@ -110,7 +110,33 @@ public:
         Common::IDHolder                const & a_id_holder
     ) const;
 
+    /**
+     * @brief Visits buildings in batches, ordered by the key of the building.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   The identifier of the holder.
+     * @param a_batch_size  The maximum number of buildings in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitBuildings(
+        Persistence::ITransactionShrPtr                           a_transaction,
+        Common::IDHolder                                  const & a_id_holder,
+        unsigned int                                      const   a_batch_size,
+        Persistence::IBatchVisitor<BuildingWithVolumeMap>       & a_visitor
+    ) const;
+
 private:
+    /**
+     * @brief Prepares the result for getBuildings* methods.
+     *
+     * @param a_records A map of building with volume records.
+     *
+     * @return A map of buildings with volume.
+     */
+    BuildingWithVolumeMap prepareResultGetBuildings(
+        BuildingWithVolumeRecordMap const & a_records
+    ) const;
+
     Server::IContextShrPtr const m_context;
 
     IBuildingAccessorScpPtr m_accessor;
@@ -76,7 +76,6 @@ private:
     ) const;
 
     std::string m_value_id_holder_class;
-    std::string m_value_volume;
     std::string m_holder_name;
     std::string m_key;
 
@@ -58,9 +58,9 @@ bool ExecutorGetBuilding::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_value_id_holder_class = a_request->getParam("idholderclass");
-    m_holder_name = a_request->getParam("holder_name");
-    m_key = a_request->getParam("buildingkey");
+    m_value_id_holder_class = a_request->getParam(Language::PARAM_ID_HOLDER_CLASS);
+    m_holder_name = a_request->getParam(Language::PARAM_HOLDER_NAME);
+    m_key = a_request->getParam(Language::PARAM_BUILDING_KEY);
 
     return true;
 }
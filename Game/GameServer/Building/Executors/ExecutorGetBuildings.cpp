@@ -27,6 +27,7 @@
 
 #include <Game/GameServer/Common/Constants.hpp>
 #include <Game/GameServer/Building/Executors/ExecutorGetBuildings.hpp>
+#include <Language/Interface/Arena.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/lexical_cast.hpp>
@@ -40,10 +41,94 @@ using namespace std;
 namespace Game
 {
 
+namespace
+{
+
+/**
+ * @brief Appends the rows of buildings.
+ *
+ * @param a_rows      The rows.
+ * @param a_buildings The buildings.
+ */
+void appendBuildings(
+    Language::Rows                                    & a_rows,
+    GameServer::Building::BuildingWithVolumeMap const & a_buildings
+)
+{
+    for (GameServer::Building::BuildingWithVolumeMap::const_iterator it = a_buildings.begin();
+         it != a_buildings.end(); ++it)
+    {
+        a_rows.appendText(Language::BUILDING_COLUMN_BUILDINGCLASS, it->second->getBuilding()->getClass());
+        a_rows.appendText(Language::BUILDING_COLUMN_BUILDINGNAME, it->second->getBuilding()->getName());
+        a_rows.appendNumber(Language::BUILDING_COLUMN_VOLUME, it->second->getVolume());
+    }
+}
+
+/**
+ * @brief The visitor writing buildings out in a part of their own as soon as a batch of them has been fetched.
+ */
+class BuildingsWriter
+    : public IBatchVisitor<GameServer::Building::BuildingWithVolumeMap>
+{
+public:
+    explicit BuildingsWriter(
+        Server::IReplyStream & a_reply_stream
+    )
+        : m_reply_stream(a_reply_stream)
+    {
+    }
+
+    virtual void visit(
+        GameServer::Building::BuildingWithVolumeMap const & a_buildings
+    )
+    {
+        Language::ReplyBuilder reply_builder;
+        Language::Rows buildings(Language::BUILDING_ROWS);
+
+        appendBuildings(buildings, a_buildings);
+
+        m_reply_stream.write(
+            reply_builder.buildGetBuildingsReply(REPLY_STATUS_OK, GET_BUILDINGS_BUILDINGS_HAVE_BEEN_GOT, buildings)
+        );
+    }
+
+private:
+    Server::IReplyStream & m_reply_stream;
+};
+
+/**
+ * @brief Visits buildings, writing them out in parts as they are fetched.
+ *
+ * @param a_operator     The operator.
+ * @param a_transaction  The transaction.
+ * @param a_id_holder    The identifier of the holder.
+ * @param a_reply_stream The reply stream.
+ *
+ * @return The exit code.
+ */
+GameServer::Building::GetBuildingsOperatorExitCode visitBuildings(
+    GameServer::Building::IGetBuildingsOperatorShrPtr         a_operator,
+    ITransactionShrPtr                                        a_transaction,
+    GameServer::Common::IDHolder                      const & a_id_holder,
+    Server::IReplyStream                                    & a_reply_stream
+)
+{
+    // The parts are built on the heap, the arena of the request would keep every one of them until the final reply.
+    Language::ArenaScope const heap_scope(NULL);
+
+    BuildingsWriter writer(a_reply_stream);
+
+    return a_operator->visitBuildings(a_transaction, a_id_holder, a_reply_stream.getPartSize(), writer);
+}
+
+} // namespace
+
 ExecutorGetBuildings::ExecutorGetBuildings(
-    Server::IContextShrPtr const a_context
+    Server::IContextShrPtr     const a_context,
+    Server::IReplyStreamShrPtr const a_reply_stream
 )
-    : Executor(a_context)
+    : Executor(a_context),
+      m_reply_stream(a_reply_stream)
 {
 }
 
@@ -58,8 +143,8 @@ bool ExecutorGetBuildings::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_value_id_holder_class = a_request->getParam("idholderclass");
-    m_holder_name = a_request->getParam("holder_name");
+    m_value_id_holder_class = a_request->getParam(Language::PARAM_ID_HOLDER_CLASS);
+    m_holder_name = a_request->getParam(Language::PARAM_HOLDER_NAME);
 
     return true;
 }
@@ -150,7 +235,8 @@ Language::ICommand::Handle ExecutorGetBuildings::perform(
         ITransactionShrPtr transaction = a_persistence->getTransaction(connection);
 
         GameServer::Building::GetBuildingsOperatorExitCode const exit_code =
-            get_buildings_operator->getBuildings(transaction, m_id_holder);
+            m_reply_stream ? visitBuildings(get_buildings_operator, transaction, m_id_holder, *m_reply_stream)
+                           : get_buildings_operator->getBuildings(transaction, m_id_holder);
 
         if (exit_code.ok())
         {
@@ -180,18 +266,9 @@ Language::ICommand::Handle ExecutorGetBuildings::produceReply(
     {
         case GameServer::Building::GET_BUILDINGS_OPERATOR_EXIT_CODE_BUILDINGS_HAVE_BEEN_GOT:
         {
-            Language::ICommand::Objects buildings;
-
-            for (GameServer::Building::BuildingWithVolumeMap::const_iterator it = a_exit_code.m_buildings.begin();
-                 it != a_exit_code.m_buildings.end(); ++it)
-            {
-                // TODO: Translate this automatically!
-                Language::ICommand::Object building;
-                building.insert(std::make_pair("buildingclass", it->second->getBuilding()->getClass()));
-                building.insert(std::make_pair("buildingname", it->second->getBuilding()->getName()));
-                building.insert(std::make_pair("volume", boost::lexical_cast<std::string>(it->second->getVolume())));
-                buildings.push_back(building);
-            }
+            Language::Rows buildings(Language::BUILDING_ROWS);
+
+            appendBuildings(buildings, a_exit_code.m_buildings);
 
             return reply_builder.buildGetBuildingsReply(REPLY_STATUS_OK, GET_BUILDINGS_BUILDINGS_HAVE_BEEN_GOT,
                        buildings);
@@ -30,6 +30,7 @@
 
 #include <Game/GameServer/Common/Executor.hpp>
 #include <Game/GameServer/Building/Operators/GetBuildings/GetBuildingsOperatorExitCode.hpp>
+#include <Server/include/IReplyStream.hpp>
 
 namespace Game
 {
@@ -39,7 +40,8 @@ class ExecutorGetBuildings
 {
 public:
     ExecutorGetBuildings(
-        Server::IContextShrPtr const a_context
+        Server::IContextShrPtr     const a_context,
+        Server::IReplyStreamShrPtr const a_reply_stream
     );
 
 private:
@@ -81,6 +83,8 @@ private:
     unsigned int m_id_holder_class;
 
     GameServer::Common::IDHolder m_id_holder;
+
+    Server::IReplyStreamShrPtr const m_reply_stream;
 };
 
 } // namespace Game
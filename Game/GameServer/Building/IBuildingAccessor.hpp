@@ -29,6 +29,7 @@
 #define GAMESERVER_BUILDING_IBUILDINGACCESSOR_HPP
 
 #include <Game/GameServer/Common/IDHolder.hpp>
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
 #include <Game/GameServer/Persistence/ITransaction.hpp>
 #include <Game/GameServer/Building/BuildingWithVolumeRecord.hpp>
 #include <boost/make_shared.hpp>
@@ -110,6 +111,21 @@ public:
         Common::IDHolder                const & a_id_holder
     ) const = 0;
 
+    /**
+     * @brief Visits building with volume records in batches, ordered by the key of the building.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   An identifier of the holder.
+     * @param a_batch_size  The maximum number of records in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitRecords(
+        Persistence::ITransactionShrPtr                                 a_transaction,
+        Common::IDHolder                                        const & a_id_holder,
+        unsigned int                                            const   a_batch_size,
+        Persistence::IBatchVisitor<BuildingWithVolumeRecordMap>       & a_visitor
+    ) const = 0;
+
     /**
      * @brief Increases the volume of building with volume record.
      *
@@ -25,6 +25,7 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Game/GameServer/Persistence/BatchVisitors.hpp>
 #include <Game/GameServer/Building/Operators/GetBuildings/GetBuildingsOperator.hpp>
 
 using namespace GameServer::Common;
@@ -61,5 +62,28 @@ GetBuildingsOperatorExitCode GetBuildingsOperator::getBuildings(
     }
 }
 
+GetBuildingsOperatorExitCode GetBuildingsOperator::visitBuildings(
+    ITransactionShrPtr                           a_transaction,
+    IDHolder                             const & a_id_holder,
+    unsigned int                         const   a_batch_size,
+    IBatchVisitor<BuildingWithVolumeMap>       & a_visitor
+) const
+{
+    try
+    {
+        CountingBatchVisitor<BuildingWithVolumeMap> counting_visitor(a_visitor);
+
+        m_building_persistence_facade->visitBuildings(a_transaction, a_id_holder, a_batch_size, counting_visitor);
+
+        return (counting_visitor.getCount())
+            ? GetBuildingsOperatorExitCode(GET_BUILDINGS_OPERATOR_EXIT_CODE_BUILDINGS_HAVE_BEEN_GOT)
+            : GetBuildingsOperatorExitCode(GET_BUILDINGS_OPERATOR_EXIT_CODE_UNEXPECTED_ERROR);
+    }
+    catch (...)
+    {
+        return GetBuildingsOperatorExitCode(GET_BUILDINGS_OPERATOR_EXIT_CODE_UNEXPECTED_ERROR);
+    }
+}
+
 } // namespace Building
 } // namespace GameServer
@@ -30,6 +30,7 @@
 
 #include <Game/GameServer/Building/Operators/GetBuildings/GetBuildingsOperatorExitCode.hpp>
 #include <Game/GameServer/Common/IDHolder.hpp>
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
 #include <Game/GameServer/Persistence/ITransaction.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
@@ -60,6 +61,25 @@ public:
         Persistence::ITransactionShrPtr         a_transaction,
         Common::IDHolder                const & a_id_holder
     ) const = 0;
+
+    /**
+     * @brief Visits buildings in batches.
+     *
+     * The exit code carries no buildings, they have been handed over to the visitor already.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   The identifier of the holder.
+     * @param a_batch_size  The maximum number of buildings in a batch.
+     * @param a_visitor     The visitor of the batches.
+     *
+     * @return The exit code.
+     */
+    virtual GetBuildingsOperatorExitCode visitBuildings(
+        Persistence::ITransactionShrPtr                           a_transaction,
+        Common::IDHolder                                  const & a_id_holder,
+        unsigned int                                      const   a_batch_size,
+        Persistence::IBatchVisitor<BuildingWithVolumeMap>       & a_visitor
+    ) const = 0;
 };
 
 /**
@@ -0,0 +1,266 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/AsyncExecutor.hpp>
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/User/User.hpp>
+#include <Game/GameServer/User/UserRecord.hpp>
+#include <Poco/Timestamp.h>
+#include <boost/bind.hpp>
+
+using namespace GameServer::Persistence;
+using namespace GameServer::User;
+using namespace boost;
+using namespace std;
+
+namespace Game
+{
+
+AsyncExecutor::AsyncExecutor(
+    Server::IContextShrPtr  const a_context,
+    IAsyncQueryRunnerShrPtr const a_query_runner
+)
+    : m_context(a_context),
+      m_query_runner(a_query_runner),
+      m_stage(STAGE_AUTHENTICATE),
+      m_deadline(0)
+{
+}
+
+void AsyncExecutor::start(
+    Language::ICommand::Handle         a_request,
+    Completion                 const & a_completion
+)
+{
+    m_completion = a_completion;
+    m_deadline = a_request->getDeadline();
+
+    logExecutorStart();
+
+    if (!getParameters(a_request))
+    {
+        return finish(getBasicReply(REPLY_STATUS_INVALID_REQUEST));
+    }
+
+    if (!processParameters())
+    {
+        return finish(getBasicReply(REPLY_STATUS_INVALID_RANGE));
+    }
+
+    if (deadlineHasPassed())
+    {
+        return finish(getBasicReply(REPLY_STATUS_TIMED_OUT));
+    }
+
+    // A session token stands for the password, the user bound to the session is acting then.
+    if (!a_request->getSessionToken().empty())
+    {
+        m_user = m_context->getSessionManager()->resolve(a_request->getSessionToken(), a_request->getLogin());
+
+        if (!m_user)
+        {
+            return finish(getBasicReply(REPLY_STATUS_UNAUTHENTICATED));
+        }
+
+        return enter(STAGE_FILTER_OUT_NON_MODERATOR);
+    }
+
+    enter(STAGE_AUTHENTICATE);
+}
+
+void AsyncExecutor::runQuery(
+    string             const & a_query,
+    vector<string>     const & a_parameters,
+    AsyncQueryCallback const & a_handler
+)
+{
+    // The pending query holds the executor until its result has been handled.
+    bool const accepted = m_query_runner->run(
+        a_query, a_parameters, m_deadline, bind(&AsyncExecutor::receive, shared_from_this(), a_handler, _1)
+    );
+
+    if (!accepted)
+    {
+        finish(getBasicReply(REPLY_STATUS_SERVER_BUSY));
+    }
+}
+
+void AsyncExecutor::resume(
+    bool const a_passed
+)
+{
+    if (!m_completion)
+    {
+        return;
+    }
+
+    if (!a_passed)
+    {
+        switch (m_stage)
+        {
+            case STAGE_AUTHENTICATE:               return finish(getBasicReply(REPLY_STATUS_UNAUTHENTICATED));
+            case STAGE_GET_ACTING_USER:            return finish(getBasicReply(REPLY_STATUS_ACTING_USER_HAS_NOT_BEEN_GOT));
+            case STAGE_FILTER_OUT_NON_MODERATOR:   return finish(getBasicReply(REPLY_STATUS_NON_MODERATOR_FILTERED_OUT));
+            case STAGE_AUTHORIZE:                  return finish(getBasicReply(REPLY_STATUS_UNAUTHORIZED));
+            case STAGE_EPOCH_IS_ACTIVE:            return finish(getBasicReply(REPLY_STATUS_EPOCH_IS_NOT_ACTIVE));
+            case STAGE_VERIFY_WORLD_CONFIGURATION: return finish(getBasicReply(REPLY_STATUS_ACTION_UNAVAILABLE));
+            default:                               return finish(produceReplyUnexpectedError());
+        }
+    }
+
+    // The next query is not worth sending if the client has given up already.
+    if (deadlineHasPassed())
+    {
+        return finish(getBasicReply(REPLY_STATUS_TIMED_OUT));
+    }
+
+    enter(static_cast<Stage>(m_stage + 1));
+}
+
+void AsyncExecutor::finish(
+    Language::ICommand::Handle const a_reply
+)
+{
+    if (!m_completion)
+    {
+        return;
+    }
+
+    Completion completion;
+    completion.swap(m_completion);
+
+    completion(a_reply);
+}
+
+void AsyncExecutor::enter(
+    Stage const a_stage
+)
+{
+    m_stage = a_stage;
+
+    switch (m_stage)
+    {
+        case STAGE_AUTHENTICATE:               return authenticate();
+        case STAGE_GET_ACTING_USER:            return getActingUser();
+        case STAGE_FILTER_OUT_NON_MODERATOR:   return resume(filterOutNonModerator());
+        case STAGE_AUTHORIZE:                  return authorize();
+        case STAGE_EPOCH_IS_ACTIVE:            return epochIsActive();
+        case STAGE_VERIFY_WORLD_CONFIGURATION: return verifyWorldConfiguration();
+        case STAGE_PERFORM:                    return perform();
+    }
+}
+
+void AsyncExecutor::receive(
+    AsyncQueryCallback const   a_handler,
+    AsyncQueryResult   const & a_result
+)
+{
+    // The query cancelled by its deadline has failed as an unexpected error, the client is told the real cause instead.
+    if (!a_result.m_ok && deadlineHasPassed())
+    {
+        return finish(getBasicReply(REPLY_STATUS_TIMED_OUT));
+    }
+
+    try
+    {
+        a_handler(a_result);
+    }
+    catch (...)
+    {
+        finish(produceReplyUnexpectedError());
+    }
+}
+
+bool AsyncExecutor::deadlineHasPassed() const
+{
+    return m_deadline && static_cast<unsigned long long int>(Poco::Timestamp().epochMicroseconds()) >= m_deadline;
+}
+
+void AsyncExecutor::authenticate()
+{
+    vector<string> parameters;
+    parameters.push_back(m_login);
+    parameters.push_back(m_password);
+
+    runQuery(
+        "SELECT * FROM users WHERE login = $1 AND password = $2",
+        parameters,
+        bind(&AsyncExecutor::onAuthenticated, this, _1)
+    );
+}
+
+void AsyncExecutor::getActingUser()
+{
+    runQuery(
+        "SELECT * FROM users WHERE login = $1",
+        vector<string>(1, m_login),
+        bind(&AsyncExecutor::onActingUserGot, this, _1)
+    );
+}
+
+bool AsyncExecutor::filterOutNonModerator() const
+{
+    return true;
+}
+
+void AsyncExecutor::onAuthenticated(
+    AsyncQueryResult const & a_result
+)
+{
+    resume(a_result.m_ok && !a_result.m_rows.empty());
+}
+
+void AsyncExecutor::onActingUserGot(
+    AsyncQueryResult const & a_result
+)
+{
+    if (!a_result.m_ok || a_result.m_rows.empty())
+    {
+        return resume(false);
+    }
+
+    AsyncRow const & row = a_result.m_rows.front();
+
+    // The booleans arrive in the text format of PostgreSQL.
+    AsyncRow::const_iterator const moderator = row.find("moderator");
+
+    m_user.reset(
+        new User(
+            IUserRecordShrPtr(
+                new UserRecord(
+                    row.find("login")->second,
+                    row.find("password")->second,
+                    moderator != row.end() && moderator->second == "t"
+                )
+            )
+        )
+    );
+
+    resume(true);
+}
+
+} // namespace Game
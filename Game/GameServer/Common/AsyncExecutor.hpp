@@ -0,0 +1,277 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef GAME_ASYNCEXECUTOR_HPP
+#define GAME_ASYNCEXECUTOR_HPP
+
+#include <Game/GameServer/Common/IAsyncExecutor.hpp>
+#include <Game/GameServer/Persistence/IAsyncQueryRunner.hpp>
+#include <Game/GameServer/User/IUser.hpp>
+#include <Server/include/IContext.hpp>
+#include <boost/enable_shared_from_this.hpp>
+
+namespace Game
+{
+
+/**
+ * @brief The base of the asynchronous executors.
+ *
+ * Goes through the same stages as the synchronous executor, but a stage needing the database sends its query and
+ * returns, the handler of the result resumes the executor with the outcome of the stage. The executor keeps itself
+ * alive by the pending query, so it has to be owned by a shared pointer.
+ *
+ * Each query runs in its own implicit transaction, hence only the read-only actions are fit to be migrated.
+ */
+class AsyncExecutor
+    : public IAsyncExecutor,
+      public boost::enable_shared_from_this<AsyncExecutor>
+{
+public:
+    AsyncExecutor(
+        Server::IContextShrPtr                           const a_context,
+        GameServer::Persistence::IAsyncQueryRunnerShrPtr const a_query_runner
+    );
+
+    /**
+     * @brief Starts the action.
+     *
+     * The user is authenticated by the session token of the request if the request carries one.
+     *
+     * @param a_request    The request.
+     * @param a_completion The receiver of the reply.
+     */
+    virtual void start(
+        Language::ICommand::Handle         a_request,
+        Completion                 const & a_completion
+    );
+
+protected:
+    /**
+     * @brief Runs a query on behalf of the executor.
+     *
+     * The reply produced by produceReplyUnexpectedError() finishes the action if the handler throws. The query is
+     * cancelled once the deadline of the request passes, the "timed out" reply finishes the action then. The "server
+     * busy" reply finishes it if the runner rejects the query.
+     *
+     * @param a_query      The query, the parameters are referred to as $1, $2 and so on.
+     * @param a_parameters The parameters of the query.
+     * @param a_handler    The handler of the result.
+     */
+    void runQuery(
+        std::string                                 const & a_query,
+        std::vector<std::string>                    const & a_parameters,
+        GameServer::Persistence::AsyncQueryCallback const & a_handler
+    );
+
+    /**
+     * @brief Resumes the action once the current stage has been finished.
+     *
+     * @param a_passed True if the stage has been passed, false otherwise.
+     */
+    void resume(
+        bool const a_passed
+    );
+
+    /**
+     * @brief Finishes the action.
+     *
+     * @param a_reply The reply.
+     */
+    void finish(
+        Language::ICommand::Handle const a_reply
+    );
+
+private:
+    /**
+     * @brief The stages of the action.
+     */
+    enum Stage
+    {
+        STAGE_AUTHENTICATE,
+        STAGE_GET_ACTING_USER,
+        STAGE_FILTER_OUT_NON_MODERATOR,
+        STAGE_AUTHORIZE,
+        STAGE_EPOCH_IS_ACTIVE,
+        STAGE_VERIFY_WORLD_CONFIGURATION,
+        STAGE_PERFORM
+    };
+
+    /**
+     * @brief Enters a stage.
+     *
+     * @param a_stage The stage.
+     */
+    void enter(
+        Stage const a_stage
+    );
+
+    /**
+     * @brief Passes the result of a query to its handler.
+     *
+     * @param a_handler The handler.
+     * @param a_result  The result.
+     */
+    void receive(
+        GameServer::Persistence::AsyncQueryCallback const a_handler,
+        GameServer::Persistence::AsyncQueryResult   const & a_result
+    );
+
+    /**
+     * @brief Verifies whether the deadline of the request has passed.
+     *
+     * @return True if the request carries a deadline and it has passed, false otherwise.
+     */
+    bool deadlineHasPassed() const;
+
+    /**
+     * @brief Handles the result of the authentication.
+     *
+     * @param a_result The result.
+     */
+    void onAuthenticated(
+        GameServer::Persistence::AsyncQueryResult const & a_result
+    );
+
+    /**
+     * @brief Handles the result of getting the acting user.
+     *
+     * @param a_result The result.
+     */
+    void onActingUserGot(
+        GameServer::Persistence::AsyncQueryResult const & a_result
+    );
+
+    /**
+     * @brief Logs the start of the executor.
+     */
+    virtual void logExecutorStart() const = 0;
+
+    /**
+     * @brief Gets parameters from the request.
+     *
+     * @param a_request The request.
+     *
+     * @return True if all parameters have been got, false otherwise.
+     */
+    virtual bool getParameters(
+       Language::ICommand::Handle a_request
+    ) = 0;
+
+    /**
+     * @brief Process parameters from the request.
+     *
+     * @return True if all parameters have been processed, false otherwise.
+     */
+    virtual bool processParameters() = 0;
+
+    //@{
+    /**
+     * @brief Runs the stage, resume() is to be called once the stage has been finished.
+     */
+    virtual void authenticate();
+    virtual void getActingUser();
+    virtual void authorize() = 0;
+    virtual void epochIsActive() = 0;
+    virtual void verifyWorldConfiguration() = 0;
+    //}@
+
+    /**
+     * @brief Filters out non moderator.
+     *
+     * @return True if user is a moderator or moderator's rights are not required, false otherwise.
+     */
+    virtual bool filterOutNonModerator() const;
+
+    /**
+     * @brief Performs the main operation, finish() is to be called with the reply.
+     */
+    virtual void perform() = 0;
+
+    /**
+     * @brief Produces the basic reply with a given status.
+     *
+     * @param a_status The status of the reply.
+     *
+     * @return The reply.
+     */
+    virtual Language::ICommand::Handle getBasicReply(
+        unsigned int const a_status
+    ) const = 0;
+
+    /**
+     * @brief Produces the reply to an action interrupted by an unexpected error.
+     *
+     * @return The reply.
+     */
+    virtual Language::ICommand::Handle produceReplyUnexpectedError() const = 0;
+
+protected:
+    /**
+     * @brief The login of the user.
+     */
+    std::string m_login;
+
+    /**
+     * @brief The password of the user.
+     */
+    std::string m_password;
+
+    /**
+     * @brief The acting user.
+     */
+    GameServer::User::IUserShrPtr m_user;
+
+    /**
+     * @brief The context of the server.
+     */
+    Server::IContextShrPtr const m_context;
+
+private:
+    /**
+     * @brief The runner of the queries.
+     */
+    GameServer::Persistence::IAsyncQueryRunnerShrPtr const m_query_runner;
+
+    /**
+     * @brief The current stage.
+     */
+    Stage m_stage;
+
+    /**
+     * @brief The receiver of the reply, empty once the action has been finished.
+     */
+    Completion m_completion;
+
+    /**
+     * @brief The deadline of the request in microseconds since the epoch, zero if the request has none.
+     */
+    unsigned long long int m_deadline;
+};
+
+} // namespace Game
+
+#endif // GAME_ASYNCEXECUTOR_HPP
@@ -128,6 +128,9 @@ unsigned short int const REPLY_STATUS_UNAUTHORIZED                 =  7;
 unsigned short int const REPLY_STATUS_EPOCH_IS_NOT_ACTIVE          =  8;
 unsigned short int const REPLY_STATUS_ACTION_UNAVAILABLE           =  9;
 unsigned short int const REPLY_STATUS_OK                           = 10;
+unsigned short int const REPLY_STATUS_SERVER_BUSY                  = 11;
+unsigned short int const REPLY_STATUS_THROTTLED                    = 12;
+unsigned short int const REPLY_STATUS_TIMED_OUT                    = 13;
 //}@
 
 //@{
@@ -313,6 +316,20 @@ std::string const ENGAGE_HUMAN_NOT_ENOUGH_RESOURCES              = "Not enough r
 std::string const ENGAGE_HUMAN_RESOURCES_MISSING_IN_THE_MEANTIME = "Resources missing in the meantime";
 std::string const ENGAGE_HUMAN_TRYING_TO_ENGAGE_ZERO_HUMANS      = "Trying to engage zero humans.";
 std::string const ENGAGE_HUMAN_UNEXPECTED_ERROR                  = "Unexpected error.";
+
+std::string const BATCH_BATCH_HAS_BEEN_COMMITTED   = "Batch has been committed.";
+std::string const BATCH_BATCH_HAS_BEEN_ROLLED_BACK = "Batch has been rolled back.";
+std::string const BATCH_NESTED_BATCH               = "Batches cannot be nested.";
+std::string const BATCH_FOREIGN_USER               = "Commands of a batch must be issued by the user of the batch.";
+
+std::string const SUBSCRIBE_SUBSCRIPTION_HAS_BEEN_MADE = "Subscription has been made.";
+std::string const SUBSCRIBE_UNEXPECTED_ERROR           = "Unexpected error.";
+std::string const SUBSCRIBE_WORLD_DOES_NOT_EXIST       = "World does not exist.";
+
+std::string const LOGIN_SESSION_HAS_BEEN_OPENED     = "Session has been opened.";
+std::string const LOGIN_SESSION_HAS_NOT_BEEN_OPENED = "Session has not been opened.";
+
+std::string const LOGOUT_SESSION_HAS_BEEN_CLOSED = "Session has been closed.";
 //}@
 
 } // namespace Game
@@ -28,7 +28,9 @@
 #include <Game/GameServer/Common/Constants.hpp>
 #include <Game/GameServer/Common/Executor.hpp>
 #include <Game/GameServer/Common/OperatorAbstractFactoryPostgresql.hpp>
+#include <Game/GameServer/Persistence/BatchPersistencePostgresql.hpp>
 #include <Game/GameServer/Persistence/PersistencePostgresql.hpp>
+#include <Poco/Timestamp.h>
 
 using namespace GameServer::Authentication;
 using namespace GameServer::Common;
@@ -41,11 +43,11 @@ namespace Game
 Executor::Executor(
     Server::IContextShrPtr const a_context
 )
-    : m_context(a_context)
+    : m_context(a_context),
+      m_deadline(0)
 {
     if (m_context->getConfigurator()->getPersistence() == "postgresql")
     {
-        m_persistence.reset(new PersistencePostgresql);
         m_operator_abstract_factory.reset(new OperatorAbstractFactoryPostgresql(m_context));
     }
     else
@@ -57,9 +59,68 @@ Executor::Executor(
 Language::ICommand::Handle Executor::execute(
     Language::ICommand::Handle a_request
 )
+{
+    IUserShrPtr acting_user;
+
+    // A session token stands for the password, the user bound to the session is acting then.
+    if (!a_request->getSessionToken().empty())
+    {
+        acting_user = m_context->getSessionManager()->resolve(a_request->getSessionToken(), a_request->getLogin());
+
+        if (!acting_user)
+        {
+            return produceReplyUnauthenticated();
+        }
+    }
+
+    if (!a_request->getDeadline())
+    {
+        IPersistenceShrPtr const persistence(new PersistencePostgresql);
+        Language::ICommand::Handle const reply = execute(a_request, persistence, acting_user);
+
+        // The action has been committed by now, so its indications may be published.
+        publish();
+
+        return reply;
+    }
+
+    // The transactions of a request having a deadline are nested in a single outer one, committed only once the watch
+    // has been disarmed, so the request is either committed as a whole or rolled back as timed out.
+    BatchPersistencePostgresqlShrPtr const persistence(new BatchPersistencePostgresql);
+
+    // The query running when the deadline passes is cancelled, so the worker does not wait for the database.
+    Server::ScopedDeadlineWatch deadline_watch(
+        m_context->getDeadlineWatchdog(), a_request->getDeadline(), persistence->getConnection()
+    );
+
+    Language::ICommand::Handle const reply = execute(a_request, persistence, acting_user);
+
+    // The cancelled query has failed as an unexpected error, the client is told the real cause instead.
+    if (deadline_watch.stop())
+    {
+        persistence->abort();
+
+        return produceReplyTimedOut();
+    }
+
+    persistence->commit();
+
+    // The action has been committed by now, so its indications may be published.
+    publish();
+
+    return reply;
+}
+
+Language::ICommand::Handle Executor::execute(
+    Language::ICommand::Handle a_request,
+    IPersistenceShrPtr         a_persistence,
+    IUserShrPtr                a_acting_user
+)
 {
     logExecutorStart();
 
+    m_deadline = a_request->getDeadline();
+
     if (!serverIsListening())
     {
         return produceReplyServerIsNotListening();
@@ -75,14 +136,26 @@ Language::ICommand::Handle Executor::execute(
         return produceReplyInvalidRange();
     }
 
-    if (!authenticate(m_persistence))
+    if (deadlineHasPassed())
     {
-        return produceReplyUnauthenticated();
+        return produceReplyTimedOut();
     }
 
-    if (!getActingUser(m_persistence))
+    if (a_acting_user)
     {
-        return produceReplyActingUserHasNotBeenGot();
+        m_user = a_acting_user;
+    }
+    else
+    {
+        if (!authenticate(a_persistence))
+        {
+            return produceReplyUnauthenticated();
+        }
+
+        if (!getActingUser(a_persistence))
+        {
+            return produceReplyActingUserHasNotBeenGot();
+        }
     }
 
     if (!filterOutNonModerator())
@@ -90,22 +163,77 @@ Language::ICommand::Handle Executor::execute(
         return produceReplyNonModeratorFilteredOut();
     }
 
-    if (!authorize(m_persistence))
+    if (deadlineHasPassed())
+    {
+        return produceReplyTimedOut();
+    }
+
+    if (!authorize(a_persistence))
     {
         return produceReplyUnauthorized();
     }
 
-    if (!epochIsActive(m_persistence))
+    if (deadlineHasPassed())
+    {
+        return produceReplyTimedOut();
+    }
+
+    if (!epochIsActive(a_persistence))
     {
         return produceReplyEpochIsNotActive();
     }
 
-    if (!verifyWorldConfiguration(m_persistence))
+    if (deadlineHasPassed())
+    {
+        return produceReplyTimedOut();
+    }
+
+    if (!verifyWorldConfiguration(a_persistence))
     {
         return produceReplyActionUnavailable();
     }
 
-    return perform(m_persistence);
+    if (deadlineHasPassed())
+    {
+        return produceReplyTimedOut();
+    }
+
+    return perform(a_persistence);
+}
+
+Language::ICommand::Commands const & Executor::getIndications() const
+{
+    return m_indications;
+}
+
+void Executor::addIndication(
+    Language::ICommand::Handle const a_indication
+) const
+{
+    m_indications.push_back(a_indication);
+}
+
+void Executor::addSubscription(
+    std::string               const a_world_name,
+    Server::ISubscriberShrPtr const a_subscriber
+) const
+{
+    m_subscriptions.push_back(std::make_pair(a_world_name, a_subscriber));
+}
+
+void Executor::publish() const
+{
+    m_context->getSubscriptionRegistry()->publish(m_indications);
+
+    for (std::size_t i = 0; i < m_subscriptions.size(); ++i)
+    {
+        m_context->getSubscriptionRegistry()->subscribe(m_subscriptions[i].first, m_subscriptions[i].second);
+    }
+}
+
+bool Executor::deadlineHasPassed() const
+{
+    return m_deadline && static_cast<unsigned long long int>(Poco::Timestamp().epochMicroseconds()) >= m_deadline;
 }
 
 bool Executor::serverIsListening() const
@@ -217,4 +345,9 @@ Language::ICommand::Handle Executor::produceReplyActionUnavailable() const
     return getBasicReply(REPLY_STATUS_ACTION_UNAVAILABLE);
 }
 
+Language::ICommand::Handle Executor::produceReplyTimedOut() const
+{
+    return getBasicReply(REPLY_STATUS_TIMED_OUT);
+}
+
 } // namespace Game
@@ -33,6 +33,9 @@
 #include <Game/GameServer/Persistence/IPersistence.hpp>
 #include <Game/GameServer/User/IUser.hpp>
 #include <Server/include/IContext.hpp>
+#include <Server/include/ISubscriber.hpp>
+#include <utility>
+#include <vector>
 
 namespace Game
 {
@@ -48,6 +51,11 @@ public:
     /**
      * @brief Executes the action.
      *
+     * The user is authenticated by the session token of the request if the request carries one.
+     * The query running when the deadline of the request passes is cancelled and the "timed out" reply is produced.
+     * The action of a request having a deadline is committed only if the deadline has not passed meanwhile, it is
+     * rolled back otherwise.
+     *
      * @param a_request The request.
      *
      * @return The reply.
@@ -56,7 +64,62 @@ public:
         Language::ICommand::Handle a_request
     );
 
+    /**
+     * @brief Executes the action within a given persistence.
+     *
+     * @param a_request     The request.
+     * @param a_persistence The persistence.
+     * @param a_acting_user The already authenticated acting user, null if the user is to be authenticated.
+     *
+     * @return The reply.
+     */
+    virtual Language::ICommand::Handle execute(
+        Language::ICommand::Handle                  a_request,
+        GameServer::Persistence::IPersistenceShrPtr a_persistence,
+        GameServer::User::IUserShrPtr               a_acting_user
+    );
+
+    /**
+     * @brief Gets the indications produced by the executed action.
+     *
+     * @return The indications.
+     */
+    virtual Language::ICommand::Commands const & getIndications() const;
+
+protected:
+    /**
+     * @brief Adds an indication to be published once the action has been committed.
+     *
+     * @param a_indication The indication.
+     */
+    void addIndication(
+        Language::ICommand::Handle const a_indication
+    ) const;
+
+    /**
+     * @brief Adds a subscription to be made once the action has been committed.
+     *
+     * @param a_world_name The name of the world.
+     * @param a_subscriber The subscriber.
+     */
+    void addSubscription(
+        std::string               const a_world_name,
+        Server::ISubscriberShrPtr const a_subscriber
+    ) const;
+
 private:
+    /**
+     * @brief Publishes the indications and makes the subscriptions of the committed action.
+     */
+    void publish() const;
+
+    /**
+     * @brief Verifies whether the deadline of the request has passed.
+     *
+     * @return True if the request carries a deadline and it has passed, false otherwise.
+     */
+    bool deadlineHasPassed() const;
+
     /**
      * @brief Logs the start of the executor.
      */
@@ -186,16 +249,10 @@ private:
     Language::ICommand::Handle produceReplyUnauthorized()            const;
     Language::ICommand::Handle produceReplyEpochIsNotActive()        const;
     Language::ICommand::Handle produceReplyActionUnavailable()       const;
+    Language::ICommand::Handle produceReplyTimedOut()                const;
     //}@
 
 protected:
-    /**
-     * @brief Persistence.
-     *
-     * TODO: Should be constant again someday.
-     */
-    GameServer::Persistence::IPersistenceShrPtr m_persistence;
-
     /**
      * @brief OperatorAbstractFactory.
      *
@@ -226,6 +283,26 @@ protected:
      * @brief The context of the server.
      */
     Server::IContextShrPtr const m_context;
+
+private:
+    /**
+     * @brief The indications produced by the performed action.
+     *
+     * Mutable, since the indications are produced by the constant perform().
+     */
+    mutable Language::ICommand::Commands m_indications;
+
+    /**
+     * @brief The subscriptions requested by the performed action, by the name of the world.
+     *
+     * Mutable, since the subscriptions are requested by the constant perform().
+     */
+    mutable std::vector<std::pair<std::string, Server::ISubscriberShrPtr> > m_subscriptions;
+
+    /**
+     * @brief The deadline of the request in microseconds since the epoch, zero if the request has none.
+     */
+    unsigned long long int m_deadline;
 };
 
 } // namespace Game
@@ -0,0 +1,78 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef GAME_IASYNCEXECUTOR_HPP
+#define GAME_IASYNCEXECUTOR_HPP
+
+#include <Language/Interface/ICommand.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace Game
+{
+
+/**
+ * @brief The interface of the asynchronous executor.
+ *
+ * The asynchronous executor does not hold a thread while waiting for the database, it is resumed by the results of
+ * its queries instead. It coexists with the synchronous executor, the commands are migrated one by one.
+ */
+class IAsyncExecutor
+    : boost::noncopyable
+{
+public:
+    /**
+     * @brief The receiver of the reply.
+     */
+    typedef boost::function<void (Language::ICommand::Handle)> Completion;
+
+    virtual ~IAsyncExecutor(){};
+
+    /**
+     * @brief Starts the action.
+     *
+     * Returns as soon as the first query has been sent, the completion is called exactly once with the reply, either
+     * from the calling thread or from the thread of the query runner.
+     *
+     * @param a_request    The request.
+     * @param a_completion The receiver of the reply.
+     */
+    virtual void start(
+        Language::ICommand::Handle         a_request,
+        Completion                 const & a_completion
+    ) = 0;
+};
+
+/**
+ * @brief A useful typedef.
+ */
+typedef boost::shared_ptr<IAsyncExecutor> IAsyncExecutorShrPtr;
+
+} // namespace Game
+
+#endif // GAME_IASYNCEXECUTOR_HPP
@@ -28,6 +28,8 @@
 #ifndef GAME_IEXECUTOR_HPP
 #define GAME_IEXECUTOR_HPP
 
+#include <Game/GameServer/Persistence/IPersistence.hpp>
+#include <Game/GameServer/User/IUser.hpp>
 #include <Language/Interface/ICommand.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
@@ -54,6 +56,32 @@ public:
     virtual Language::ICommand::Handle execute(
         Language::ICommand::Handle a_request
     ) = 0;
+
+    /**
+     * @brief Executes the action within a given persistence.
+     *
+     * Used to execute a part of a batch, where the persistence and the acting user are shared.
+     *
+     * @param a_request     The request.
+     * @param a_persistence The persistence.
+     * @param a_acting_user The already authenticated acting user, null if the user is to be authenticated.
+     *
+     * @return The reply.
+     */
+    virtual Language::ICommand::Handle execute(
+        Language::ICommand::Handle                  a_request,
+        GameServer::Persistence::IPersistenceShrPtr a_persistence,
+        GameServer::User::IUserShrPtr               a_acting_user
+    ) = 0;
+
+    /**
+     * @brief Gets the indications produced by the executed action.
+     *
+     * The indications are to be published to the subscribers once the action has been committed.
+     *
+     * @return The indications.
+     */
+    virtual Language::ICommand::Commands const & getIndications() const = 0;
 };
 
 /**
@@ -27,6 +27,7 @@
 
 #include <Game/GameServer/Persistence/TransactionPostgresql.hpp>
 #include <Game/GameServer/Epoch/EpochAccessorPostgresql.hpp>
+#include <Language/Interface/Arena.hpp>
 
 using namespace GameServer::Persistence;
 using namespace boost;
@@ -44,7 +45,7 @@ void EpochAccessorPostgresql::insertRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "INSERT INTO epochs(epoch_name, world_name) VALUES("
                    + backbone_transaction.quote(a_epoch_name) + ", "
@@ -59,7 +60,7 @@ void EpochAccessorPostgresql::deleteRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "DELETE FROM epochs WHERE world_name = "
                    + backbone_transaction.quote(a_world_name);
@@ -73,7 +74,7 @@ IEpochRecordShrPtr EpochAccessorPostgresql::getRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM epochs WHERE world_name = " + backbone_transaction.quote(a_world_name);
 
@@ -96,7 +97,11 @@ IEpochRecordShrPtr EpochAccessorPostgresql::getRecord(
         finished = result[0]["finished"].as(boolean);
         ticks    = result[0]["ticks"   ].as(unsigned_integer);
 
-        return make_shared<EpochRecord>(epoch_name, world_name, active, finished, ticks);
+        return boost::allocate_shared<EpochRecord>(
+
+            Language::ArenaAllocator<EpochRecord>(), epoch_name, world_name, active, finished, ticks
+
+        );
     }
     else
     {
@@ -110,7 +115,7 @@ void EpochAccessorPostgresql::markActive(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE epochs SET active = true WHERE world_name = " + backbone_transaction.quote(a_world_name);
 
@@ -123,7 +128,7 @@ void EpochAccessorPostgresql::markUnactive(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE epochs SET active = false WHERE world_name = " + backbone_transaction.quote(a_world_name);
 
@@ -136,7 +141,7 @@ void EpochAccessorPostgresql::markFinished(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE epochs SET finished = true WHERE world_name = " + backbone_transaction.quote(a_world_name);
 
@@ -149,7 +154,7 @@ void EpochAccessorPostgresql::incrementTicks(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE epochs SET ticks  = ticks + 1 WHERE world_name = " + backbone_transaction.quote(a_world_name);
 
@@ -162,7 +167,7 @@ string EpochAccessorPostgresql::getWorldNameOfLand(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT world_name FROM lands WHERE land_name = " + backbone_transaction.quote(a_land_name);
 
@@ -186,7 +191,7 @@ string EpochAccessorPostgresql::getLandNameOfSettlement(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT land_name FROM settlements WHERE settlement_name = " + backbone_transaction.quote(a_settlement_name);
 
@@ -0,0 +1,169 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/Epoch/Executors/AsyncExecutorGetEpoch.hpp>
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+#include <log4cpp/Category.hh>
+
+using namespace GameServer::Persistence;
+using namespace boost;
+using namespace log4cpp;
+using namespace std;
+
+namespace Game
+{
+
+AsyncExecutorGetEpoch::AsyncExecutorGetEpoch(
+    Server::IContextShrPtr  const a_context,
+    IAsyncQueryRunnerShrPtr const a_query_runner
+)
+    : AsyncExecutor(a_context, a_query_runner)
+{
+}
+
+void AsyncExecutorGetEpoch::logExecutorStart() const
+{
+}
+
+bool AsyncExecutorGetEpoch::getParameters(
+    Language::ICommand::Handle a_request
+)
+{
+    m_login = a_request->getLogin();
+    m_password = a_request->getPassword();
+    m_world_name = a_request->getParam(Language::PARAM_WORLD_NAME);
+
+    return true;
+}
+
+bool AsyncExecutorGetEpoch::processParameters()
+{
+    return true;
+}
+
+bool AsyncExecutorGetEpoch::filterOutNonModerator() const
+{
+    return m_user->isModerator();
+}
+
+void AsyncExecutorGetEpoch::authorize()
+{
+    resume(true);
+}
+
+void AsyncExecutorGetEpoch::epochIsActive()
+{
+    resume(true);
+}
+
+void AsyncExecutorGetEpoch::verifyWorldConfiguration()
+{
+    resume(true);
+}
+
+void AsyncExecutorGetEpoch::perform()
+{
+    // Verify if the world exists.
+    runQuery(
+        "SELECT * FROM worlds WHERE world_name = $1",
+        vector<string>(1, m_world_name),
+        bind(&AsyncExecutorGetEpoch::onWorldGot, this, _1)
+    );
+}
+
+Language::ICommand::Handle AsyncExecutorGetEpoch::getBasicReply(
+    unsigned int const a_status
+) const
+{
+    Language::ReplyBuilder reply_builder;
+
+    return reply_builder.buildGetEpochReply(a_status);
+}
+
+Language::ICommand::Handle AsyncExecutorGetEpoch::produceReplyUnexpectedError() const
+{
+    Language::ReplyBuilder reply_builder;
+
+    return reply_builder.buildGetEpochReply(REPLY_STATUS_OK, GET_EPOCH_UNEXPECTED_ERROR);
+}
+
+void AsyncExecutorGetEpoch::onWorldGot(
+    AsyncQueryResult const & a_result
+)
+{
+    if (!a_result.m_ok)
+    {
+        return finish(produceReplyUnexpectedError());
+    }
+
+    if (a_result.m_rows.empty())
+    {
+        Language::ReplyBuilder reply_builder;
+
+        return finish(reply_builder.buildGetEpochReply(REPLY_STATUS_OK, GET_EPOCH_WORLD_DOES_NOT_EXIST));
+    }
+
+    runQuery(
+        "SELECT * FROM epochs WHERE world_name = $1",
+        vector<string>(1, m_world_name),
+        bind(&AsyncExecutorGetEpoch::onEpochGot, this, _1)
+    );
+}
+
+void AsyncExecutorGetEpoch::onEpochGot(
+    AsyncQueryResult const & a_result
+)
+{
+    if (!a_result.m_ok)
+    {
+        return finish(produceReplyUnexpectedError());
+    }
+
+    Language::ReplyBuilder reply_builder;
+
+    if (a_result.m_rows.empty())
+    {
+        return finish(reply_builder.buildGetEpochReply(REPLY_STATUS_OK, GET_EPOCH_EPOCH_HAS_NOT_BEEN_GOT));
+    }
+
+    AsyncRow const & row = a_result.m_rows.front();
+
+    // The booleans arrive in the text format of PostgreSQL, the reply carries them as in ExecutorGetEpoch.
+    Language::ICommand::Object epoch;
+    epoch.insert(make_pair("epoch_name", row.find("epoch_name")->second));
+    epoch.insert(make_pair("world_name", row.find("world_name")->second));
+    epoch.insert(make_pair("active", string(row.find("active")->second == "t" ? "true" : "false")));
+    epoch.insert(make_pair("finished", string(row.find("finished")->second == "t" ? "true" : "false")));
+    epoch.insert(make_pair("ticks", lexical_cast<string>(lexical_cast<unsigned int>(row.find("ticks")->second))));
+
+    finish(reply_builder.buildGetEpochReply(REPLY_STATUS_OK, GET_EPOCH_EPOCH_HAS_BEEN_GOT, epoch));
+}
+
+} // namespace Game
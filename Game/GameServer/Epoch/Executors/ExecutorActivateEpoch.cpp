@@ -27,6 +27,7 @@
 
 #include <Game/GameServer/Common/Constants.hpp>
 #include <Game/GameServer/Epoch/Executors/ExecutorActivateEpoch.hpp>
+#include <Language/Interface/IndicationBuilder.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
 #include <boost/make_shared.hpp>
 #include <log4cpp/Category.hh>
@@ -57,7 +58,7 @@ bool ExecutorActivateEpoch::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_world_name = a_request->getParam("world_name");
+    m_world_name = a_request->getParam(Language::PARAM_WORLD_NAME);
 
     return true;
 }
@@ -111,6 +112,9 @@ Language::ICommand::Handle ExecutorActivateEpoch::perform(
         if (exit_code.ok())
         {
             transaction->commit();
+
+            Language::IndicationBuilder indication_builder;
+            addIndication(indication_builder.buildEpochActivatedIndication(m_world_name));
         }
 
         return produceReply(exit_code);
@@ -57,8 +57,8 @@ bool ExecutorCreateEpoch::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_world_name = a_request->getParam("world_name");
-    m_epoch_name = a_request->getParam("epoch_name");
+    m_world_name = a_request->getParam(Language::PARAM_WORLD_NAME);
+    m_epoch_name = a_request->getParam(Language::PARAM_EPOCH_NAME);
 
     return true;
 }
@@ -57,7 +57,7 @@ bool ExecutorFinishEpoch::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_world_name = a_request->getParam("world_name");
+    m_world_name = a_request->getParam(Language::PARAM_WORLD_NAME);
 
     return true;
 }
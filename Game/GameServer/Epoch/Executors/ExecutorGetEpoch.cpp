@@ -58,7 +58,7 @@ bool ExecutorGetEpoch::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_world_name = a_request->getParam("world_name");
+    m_world_name = a_request->getParam(Language::PARAM_WORLD_NAME);
 
     return true;
 }
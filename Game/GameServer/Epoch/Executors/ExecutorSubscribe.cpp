@@ -0,0 +1,178 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/Epoch/Executors/ExecutorSubscribe.hpp>
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <log4cpp/Category.hh>
+
+using namespace GameServer::Persistence;
+using namespace log4cpp;
+using namespace std;
+
+namespace Game
+{
+
+ExecutorSubscribe::ExecutorSubscribe(
+    Server::IContextShrPtr    const a_context,
+    Server::ISubscriberShrPtr const a_subscriber
+)
+    : Executor(a_context),
+      m_subscriber(a_subscriber)
+{
+}
+
+void ExecutorSubscribe::logExecutorStart() const
+{
+}
+
+bool ExecutorSubscribe::getParameters(
+    Language::ICommand::Handle a_request
+)
+{
+    m_login = a_request->getLogin();
+    m_password = a_request->getPassword();
+    m_world_name = a_request->getParam(Language::PARAM_WORLD_NAME);
+
+    // Only the front ends provide subscribers, a subscription is not a part of a batch.
+    return m_subscriber ? true : false;
+}
+
+bool ExecutorSubscribe::processParameters()
+{
+    return true;
+}
+
+bool ExecutorSubscribe::authorize(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    // A moderator watches every world, a player only the worlds the lands of the player are in.
+    if (m_user->isModerator())
+    {
+        return true;
+    }
+
+    GameServer::Land::IGetLandsOperatorShrPtr land_operator = m_operator_abstract_factory->createGetLandsOperator();
+
+    // The transaction lifetime.
+    {
+        IConnectionShrPtr connection = a_persistence->getConnection();
+        ITransactionShrPtr transaction = a_persistence->getTransaction(connection);
+
+        GameServer::Land::GetLandsOperatorExitCode const exit_code =
+            land_operator->getLands(transaction, m_user->getLogin());
+
+        for (GameServer::Land::ILandMap::const_iterator it = exit_code.m_lands.begin();
+             it != exit_code.m_lands.end();
+             ++it)
+        {
+            if (it->second->getWorldName() == m_world_name)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
+
+bool ExecutorSubscribe::epochIsActive(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    return true;
+}
+
+bool ExecutorSubscribe::verifyWorldConfiguration(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    return true;
+}
+
+Language::ICommand::Handle ExecutorSubscribe::perform(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    GameServer::Epoch::IGetEpochByWorldNameOperatorShrPtr epoch_operator =
+        m_operator_abstract_factory->createGetEpochByWorldNameOperator();
+
+    // The transaction lifetime.
+    {
+        IConnectionShrPtr connection = a_persistence->getConnection();
+        ITransactionShrPtr transaction = a_persistence->getTransaction(connection);
+
+        GameServer::Epoch::GetEpochByWorldNameOperatorExitCode const exit_code =
+            epoch_operator->getEpochByWorldName(transaction, m_world_name);
+
+        // The world may get its epoch later on, so the subscription is made as long as the world exists. It is made
+        // once the request has been committed, a request rolled back as timed out does not subscribe.
+        if (   exit_code.m_exit_code == GameServer::Epoch::GET_EPOCH_BY_WORLD_NAME_OPERATOR_EXIT_CODE_EPOCH_HAS_BEEN_GOT
+            or exit_code.m_exit_code == GameServer::Epoch::GET_EPOCH_BY_WORLD_NAME_OPERATOR_EXIT_CODE_EPOCH_HAS_NOT_BEEN_GOT)
+        {
+            addSubscription(m_world_name, m_subscriber);
+        }
+
+        return produceReply(exit_code);
+    }
+}
+
+Language::ICommand::Handle ExecutorSubscribe::getBasicReply(
+    unsigned int const a_status
+) const
+{
+    Language::ReplyBuilder reply_builder;
+
+    return reply_builder.buildSubscribeReply(a_status);
+}
+
+Language::ICommand::Handle ExecutorSubscribe::produceReply(
+    GameServer::Epoch::GetEpochByWorldNameOperatorExitCode const & a_exit_code
+) const
+{
+    Language::ReplyBuilder reply_builder;
+
+    switch (a_exit_code.m_exit_code)
+    {
+        case GameServer::Epoch::GET_EPOCH_BY_WORLD_NAME_OPERATOR_EXIT_CODE_EPOCH_HAS_BEEN_GOT:
+        case GameServer::Epoch::GET_EPOCH_BY_WORLD_NAME_OPERATOR_EXIT_CODE_EPOCH_HAS_NOT_BEEN_GOT:
+            return reply_builder.buildSubscribeReply(REPLY_STATUS_OK, SUBSCRIBE_SUBSCRIPTION_HAS_BEEN_MADE);
+
+        case GameServer::Epoch::GET_EPOCH_BY_WORLD_NAME_OPERATOR_EXIT_CODE_UNEXPECTED_ERROR:
+            return reply_builder.buildSubscribeReply(REPLY_STATUS_OK, SUBSCRIBE_UNEXPECTED_ERROR);
+
+        case GameServer::Epoch::GET_EPOCH_BY_WORLD_NAME_OPERATOR_EXIT_CODE_WORLD_DOES_NOT_EXIST:
+            return reply_builder.buildSubscribeReply(REPLY_STATUS_OK, SUBSCRIBE_WORLD_DOES_NOT_EXIST);
+
+        default:
+            return reply_builder.buildSubscribeReply(REPLY_STATUS_OK,
+                       METAMESSAGE_EVEN_MORE_UNEXPECTED_ERROR_UNKNOWN_EXIT_CODE);
+    }
+}
+
+} // namespace Game
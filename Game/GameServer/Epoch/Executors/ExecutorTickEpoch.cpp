@@ -27,7 +27,9 @@
 
 #include <Game/GameServer/Common/Constants.hpp>
 #include <Game/GameServer/Epoch/Executors/ExecutorTickEpoch.hpp>
+#include <Language/Interface/IndicationBuilder.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
+#include <boost/lexical_cast.hpp>
 #include <boost/make_shared.hpp>
 #include <log4cpp/Category.hh>
 
@@ -57,7 +59,7 @@ bool ExecutorTickEpoch::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_world_name = a_request->getParam("world_name");
+    m_world_name = a_request->getParam(Language::PARAM_WORLD_NAME);
 
     return true;
 }
@@ -110,6 +112,11 @@ Language::ICommand::Handle ExecutorTickEpoch::perform(
         if (exit_code.ok())
         {
             transaction->commit();
+
+            Language::IndicationBuilder indication_builder;
+            addIndication(indication_builder.buildTickCompletedIndication(
+                m_world_name, lexical_cast<string>(exit_code.m_ticks)
+            ));
         }
 
         return produceReply(exit_code);
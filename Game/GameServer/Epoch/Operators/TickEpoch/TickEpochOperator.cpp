@@ -94,7 +94,7 @@ TickEpochOperatorExitCode TickEpochOperator::tickEpoch(
         bool const result_tick = m_epoch_persistence_facade->tickEpoch(a_transaction, world->getWorldName());
 
         return (result_turn and result_achievement and result_tick)
-                   ? TickEpochOperatorExitCode(TICK_EPOCH_OPERATOR_EXIT_CODE_EPOCH_HAS_BEEN_TACK)
+                   ? TickEpochOperatorExitCode(TICK_EPOCH_OPERATOR_EXIT_CODE_EPOCH_HAS_BEEN_TACK, epoch->getTicks() + 1)
                    : TickEpochOperatorExitCode(TICK_EPOCH_OPERATOR_EXIT_CODE_EPOCH_HAS_NOT_BEEN_TACK);
     }
     catch (...)
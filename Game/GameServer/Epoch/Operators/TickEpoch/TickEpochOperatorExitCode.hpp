@@ -58,7 +58,23 @@ public:
     TickEpochOperatorExitCode(
         unsigned short int const a_exit_code
     )
-        : m_exit_code(a_exit_code)
+        : m_exit_code(a_exit_code),
+          m_ticks(0)
+    {
+    }
+
+    /**
+     * @brief Constructs the exit code.
+     *
+     * @param a_exit_code The value of the exit code.
+     * @param a_ticks     The number of ticks of the epoch after the tick.
+     */
+    TickEpochOperatorExitCode(
+        unsigned short int const a_exit_code,
+        unsigned int       const a_ticks
+    )
+        : m_exit_code(a_exit_code),
+          m_ticks(a_ticks)
     {
     }
 
@@ -76,6 +92,11 @@ public:
      * @brief The exit code.
      */
     unsigned short int const m_exit_code;
+
+    /**
+     * @brief The number of ticks of the epoch after the tick, zero if the epoch has not been tack.
+     */
+    unsigned int const m_ticks;
 };
 
 } // namespace Epoch
@@ -29,7 +29,6 @@
 #include <Game/GameServer/Human/Executors/ExecutorEngageHuman.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
 #include <boost/make_shared.hpp>
-#include <boost/lexical_cast.hpp>
 #include <log4cpp/Category.hh>
 
 using namespace GameServer::Persistence;
@@ -58,12 +57,11 @@ bool ExecutorEngageHuman::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_value_id_holder_class = a_request->getParam("idholderclass");
-    m_holder_name = a_request->getParam("holder_name");
-    m_key = a_request->getParam("humankey");
-    m_value_volume = a_request->getParam("volume");
+    m_value_id_holder_class = a_request->getParam(Language::PARAM_ID_HOLDER_CLASS);
+    m_holder_name = a_request->getParam(Language::PARAM_HOLDER_NAME);
+    m_key = a_request->getParam(Language::PARAM_HUMAN_KEY);
 
-    return true;
+    return a_request->getNumberParam(Language::PARAM_VOLUME, m_volume);
 }
 
 bool ExecutorEngageHuman::processParameters()
@@ -73,7 +71,6 @@ bool ExecutorEngageHuman::processParameters()
         // TODO: Remove this temporary workaround.
         // m_id_holder_class = boost::lexical_cast<unsigned int>(m_value_id_holder_class);
         m_id_holder_class = 1;
-        m_volume = boost::lexical_cast<unsigned int>(m_value_volume);
 
         m_id_holder.assign(m_id_holder_class, m_holder_name);
 
@@ -27,6 +27,7 @@
 
 #include <Game/GameServer/Common/Constants.hpp>
 #include <Game/GameServer/Human/Executors/ExecutorGetHumans.hpp>
+#include <Language/Interface/Arena.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/lexical_cast.hpp>
@@ -40,10 +41,94 @@ using namespace std;
 namespace Game
 {
 
+namespace
+{
+
+/**
+ * @brief Appends the rows of humans.
+ *
+ * @param a_rows   The rows.
+ * @param a_humans The humans.
+ */
+void appendHumans(
+    Language::Rows                              & a_rows,
+    GameServer::Human::HumanWithVolumeMap const & a_humans
+)
+{
+    for (GameServer::Human::HumanWithVolumeMap::const_iterator it = a_humans.begin(); it != a_humans.end(); ++it)
+    {
+        a_rows.appendText(Language::HUMAN_COLUMN_HUMANCLASS, it->second->getHuman()->getClass());
+        a_rows.appendText(Language::HUMAN_COLUMN_HUMANNAME, it->second->getHuman()->getName());
+        a_rows.appendText(Language::HUMAN_COLUMN_EXPERIENCE, it->second->getHuman()->getExperience());
+        a_rows.appendNumber(Language::HUMAN_COLUMN_VOLUME, it->second->getVolume());
+    }
+}
+
+/**
+ * @brief The visitor writing humans out in a part of their own as soon as a batch of them has been fetched.
+ */
+class HumansWriter
+    : public IBatchVisitor<GameServer::Human::HumanWithVolumeMap>
+{
+public:
+    explicit HumansWriter(
+        Server::IReplyStream & a_reply_stream
+    )
+        : m_reply_stream(a_reply_stream)
+    {
+    }
+
+    virtual void visit(
+        GameServer::Human::HumanWithVolumeMap const & a_humans
+    )
+    {
+        Language::ReplyBuilder reply_builder;
+        Language::Rows humans(Language::HUMAN_ROWS);
+
+        appendHumans(humans, a_humans);
+
+        m_reply_stream.write(
+            reply_builder.buildGetHumansReply(REPLY_STATUS_OK, GET_HUMANS_HUMANS_HAVE_BEEN_GOT, humans)
+        );
+    }
+
+private:
+    Server::IReplyStream & m_reply_stream;
+};
+
+/**
+ * @brief Visits humans, writing them out in parts as they are fetched.
+ *
+ * @param a_operator     The operator.
+ * @param a_transaction  The transaction.
+ * @param a_id_holder    The identifier of the holder.
+ * @param a_reply_stream The reply stream.
+ *
+ * @return The exit code.
+ */
+GameServer::Human::GetHumansOperatorExitCode visitHumans(
+    GameServer::Human::IGetHumansOperatorShrPtr         a_operator,
+    ITransactionShrPtr                                  a_transaction,
+    GameServer::Common::IDHolder                const & a_id_holder,
+    Server::IReplyStream                              & a_reply_stream
+)
+{
+    // The parts are built on the heap, the arena of the request would keep every one of them until the final reply.
+    Language::ArenaScope const heap_scope(NULL);
+
+    HumansWriter writer(a_reply_stream);
+
+    return a_operator->visitHumans(a_transaction, a_id_holder, a_reply_stream.getPartSize(), writer);
+}
+
+} // namespace
+
 ExecutorGetHumans::ExecutorGetHumans(
-    Server::IContextShrPtr const a_context
+    Server::IContextShrPtr     const a_context,
+    Server::IReplyStreamShrPtr const a_reply_stream
 )
-    : Executor(a_context)
+    : Executor(a_context),
+      m_reply_stream(a_reply_stream)
 {
 }
 
@@ -58,8 +143,8 @@ bool ExecutorGetHumans::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_value_id_holder_class = a_request->getParam("idholderclass");
-    m_holder_name = a_request->getParam("holder_name");
+    m_value_id_holder_class = a_request->getParam(Language::PARAM_ID_HOLDER_CLASS);
+    m_holder_name = a_request->getParam(Language::PARAM_HOLDER_NAME);
 
     return true;
 }
@@ -141,7 +226,7 @@ Language::ICommand::Handle ExecutorGetHumans::perform(
     IPersistenceShrPtr a_persistence
 ) const
 {
-    GameServer::Human::IGetHumansOperatorShrPtr dismiss_human_operator =
+    GameServer::Human::IGetHumansOperatorShrPtr get_humans_operator =
         m_operator_abstract_factory->createGetHumansOperator();
 
     // The transaction lifetime.
@@ -150,7 +235,8 @@ Language::ICommand::Handle ExecutorGetHumans::perform(
         ITransactionShrPtr transaction = a_persistence->getTransaction(connection);
 
         GameServer::Human::GetHumansOperatorExitCode const exit_code =
-            dismiss_human_operator->getHumans(transaction, m_id_holder);
+            m_reply_stream ? visitHumans(get_humans_operator, transaction, m_id_holder, *m_reply_stream)
+                           : get_humans_operator->getHumans(transaction, m_id_holder);
 
         if (exit_code.ok())
         {
@@ -180,20 +266,9 @@ Language::ICommand::Handle ExecutorGetHumans::produceReply(
     {
         case GameServer::Human::GET_HUMANS_OPERATOR_EXIT_CODE_HUMANS_HAVE_BEEN_GOT:
         {
-            Language::ICommand::Objects humans;
-
-            for (GameServer::Human::HumanWithVolumeMap::const_iterator it = a_exit_code.m_humans.begin();
-                 it != a_exit_code.m_humans.end(); ++it)
-            {
-                // TODO: Translate this automatically!
-                Language::ICommand::Object human;
-                human.insert(std::make_pair("humanclass", it->second->getHuman()->getClass()));
-                human.insert(std::make_pair("humanname", it->second->getHuman()->getName()));
-                human.insert(std::make_pair("experience", it->second->getHuman()->getExperience()));
-                human.insert(std::make_pair("volume",
-                    boost::lexical_cast<std::string>(it->second->getVolume())));
-                humans.push_back(human);
-            }
+            Language::Rows humans(Language::HUMAN_ROWS);
+
+            appendHumans(humans, a_exit_code.m_humans);
 
             return reply_builder.buildGetHumansReply(REPLY_STATUS_OK, GET_HUMANS_HUMANS_HAVE_BEEN_GOT, humans);
         }
@@ -26,7 +26,9 @@
 // SUCH DAMAGE.
 
 #include <Game/GameServer/Human/HumanAccessorPostgresql.hpp>
+#include <Game/GameServer/Persistence/CursorPostgresql.hpp>
 #include <Game/GameServer/Persistence/TransactionPostgresql.hpp>
+#include <Language/Interface/Arena.hpp>
 
 using namespace GameServer::Common;
 using namespace GameServer::Configuration;
@@ -47,7 +49,7 @@ void HumanAccessorPostgresql::insertRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "INSERT INTO "
                    + getTableName(a_id_holder)
@@ -66,7 +68,7 @@ void HumanAccessorPostgresql::deleteRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "DELETE FROM "
                    + getTableName(a_id_holder)
@@ -83,7 +85,7 @@ HumanWithVolumeRecordShrPtr HumanAccessorPostgresql::getRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT volume FROM "
                    + getTableName(a_id_holder)
@@ -96,7 +98,9 @@ HumanWithVolumeRecordShrPtr HumanAccessorPostgresql::getRecord(
     {
         Volume volume;
         result[0]["volume"].to(volume);
-        return make_shared<HumanWithVolumeRecord>(a_id_holder, a_key, volume);
+        return boost::allocate_shared<HumanWithVolumeRecord>(
+            Language::ArenaAllocator<HumanWithVolumeRecord>(), a_id_holder, a_key, volume
+        );
     }
     else
     {
@@ -110,7 +114,7 @@ HumanWithVolumeRecordMap HumanAccessorPostgresql::getRecords(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM "
                    + getTableName(a_id_holder)
@@ -119,6 +123,31 @@ HumanWithVolumeRecordMap HumanAccessorPostgresql::getRecords(
     return prepareResultGetRecords(backbone_transaction.exec(query), a_id_holder);
 }
 
+void HumanAccessorPostgresql::visitRecords(
+    ITransactionShrPtr                              a_transaction,
+    IDHolder                                const & a_id_holder,
+    unsigned int                            const   a_batch_size,
+    IBatchVisitor<HumanWithVolumeRecordMap>       & a_visitor
+) const
+{
+    TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
+
+    string query = "SELECT * FROM "
+                   + getTableName(a_id_holder)
+                   + " WHERE holder_name = " + backbone_transaction.quote(a_id_holder.getValue2())
+                   + " ORDER BY human_key";
+
+    CursorPostgresql cursor(backbone_transaction, "humans_cursor", query);
+
+    for (pqxx::result result = cursor.fetch(a_batch_size); !result.empty(); result = cursor.fetch(a_batch_size))
+    {
+        a_visitor.visit(prepareResultGetRecords(result, a_id_holder));
+    }
+
+    cursor.close();
+}
+
 void HumanAccessorPostgresql::increaseVolume(
     ITransactionShrPtr         a_transaction,
     IDHolder           const & a_id_holder,
@@ -127,7 +156,7 @@ void HumanAccessorPostgresql::increaseVolume(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE "
                    + getTableName(a_id_holder)
@@ -146,7 +175,7 @@ void HumanAccessorPostgresql::decreaseVolume(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE "
                    + getTableName(a_id_holder)
@@ -164,7 +193,7 @@ Volume HumanAccessorPostgresql::countHumans(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT SUM(volume) AS volume FROM humans_settlement "
                    "WHERE holder_name IN (SELECT settlement_name FROM settlements WHERE land_name = "
@@ -198,7 +227,9 @@ HumanWithVolumeRecordMap HumanAccessorPostgresql::prepareResultGetRecords(
         it["volume"].to(volume);
 
         // Create a corresponding record.
-        HumanWithVolumeRecordShrPtr record = make_shared<HumanWithVolumeRecord>(a_id_holder, key, volume);
+        HumanWithVolumeRecordShrPtr record = boost::allocate_shared<HumanWithVolumeRecord>(
+            Language::ArenaAllocator<HumanWithVolumeRecord>(), a_id_holder, key, volume
+        );
 
         // Create a pair.
         HumanWithVolumeRecordPair pair(key, record);
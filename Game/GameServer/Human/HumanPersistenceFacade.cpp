@@ -26,6 +26,9 @@
 // SUCH DAMAGE.
 
 #include <Game/GameServer/Human/HumanPersistenceFacade.hpp>
+#include <Game/GameServer/Persistence/BatchVisitors.hpp>
+#include <Language/Interface/Arena.hpp>
+#include <boost/bind.hpp>
 
 using namespace GameServer::Common;
 using namespace GameServer::Configuration;
@@ -112,6 +115,20 @@ HumanWithVolumeMap HumanPersistenceFacade::getHumans(
     return prepareResultGetHumans(m_accessor->getRecords(a_transaction, a_id_holder));
 }
 
+void HumanPersistenceFacade::visitHumans(
+    ITransactionShrPtr                        a_transaction,
+    IDHolder                          const & a_id_holder,
+    unsigned int                      const   a_batch_size,
+    IBatchVisitor<HumanWithVolumeMap>       & a_visitor
+) const
+{
+    ConvertingBatchVisitor<HumanWithVolumeRecordMap, HumanWithVolumeMap> converting_visitor(
+        boost::bind(&HumanPersistenceFacade::prepareResultGetHumans, this, _1), a_visitor
+    );
+
+    m_accessor->visitRecords(a_transaction, a_id_holder, a_batch_size, converting_visitor);
+}
+
 Volume HumanPersistenceFacade::countHumans(
     ITransactionShrPtr       a_transaction,
     std::string        const a_land_name
@@ -131,7 +148,9 @@ HumanWithVolumeMap HumanPersistenceFacade::prepareResultGetHumans(
         // Verify if pointer is not null.
         if (it->second)
         {
-            HumanWithVolumeShrPtr human = make_shared<HumanWithVolume>(m_context, *it->second);
+            HumanWithVolumeShrPtr human = boost::allocate_shared<HumanWithVolume>(
+                Language::ArenaAllocator<HumanWithVolume>(), m_context, *it->second
+            );
             HumanWithVolumePair pair(it->first, human);
             result.insert(pair);
         }
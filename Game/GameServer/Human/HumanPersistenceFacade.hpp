@@ -113,6 +113,21 @@ public:
         Common::IDHolder                const & a_id_holder
     ) const;
 
+    /**
+     * @brief Visits humans in batches, ordered by the key of the human.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   The identifier of the holder.
+     * @param a_batch_size  The maximum number of humans in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitHumans(
+        Persistence::ITransactionShrPtr                        a_transaction,
+        Common::IDHolder                               const & a_id_holder,
+        unsigned int                                   const   a_batch_size,
+        Persistence::IBatchVisitor<HumanWithVolumeMap>       & a_visitor
+    ) const;
+
     /**
      * @brief Gets the number of humans of the land.
      *
@@ -30,6 +30,7 @@
 
 #include <Game/GameServer/Common/IDHolder.hpp>
 #include <Game/GameServer/Human/HumanWithVolumeRecord.hpp>
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
 #include <Game/GameServer/Persistence/ITransaction.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/noncopyable.hpp>
@@ -106,6 +107,21 @@ public:
         Common::IDHolder                const & a_id_holder
     ) const = 0;
 
+    /**
+     * @brief Visits human with volume records in batches, ordered by the key of the human.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   An identifier of the holder.
+     * @param a_batch_size  The maximum number of records in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitRecords(
+        Persistence::ITransactionShrPtr                              a_transaction,
+        Common::IDHolder                                     const & a_id_holder,
+        unsigned int                                         const   a_batch_size,
+        Persistence::IBatchVisitor<HumanWithVolumeRecordMap>       & a_visitor
+    ) const = 0;
+
     /**
      * @brief Increases the volume of human with volume record.
      *
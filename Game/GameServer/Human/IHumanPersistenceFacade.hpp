@@ -31,6 +31,7 @@
 #include <Game/GameServer/Common/IDHolder.hpp>
 #include <Game/GameServer/Configuration/Configurator/Human/IHuman.hpp>
 #include <Game/GameServer/Human/HumanWithVolume.hpp>
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
 #include <Game/GameServer/Persistence/ITransaction.hpp>
 #include <boost/noncopyable.hpp>
 #include <string>
@@ -113,6 +114,21 @@ public:
         Common::IDHolder                const & a_id_holder
     ) const = 0;
 
+    /**
+     * @brief Visits humans in batches, ordered by the key of the human.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   The identifier of the holder.
+     * @param a_batch_size  The maximum number of humans in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitHumans(
+        Persistence::ITransactionShrPtr                        a_transaction,
+        Common::IDHolder                               const & a_id_holder,
+        unsigned int                                   const   a_batch_size,
+        Persistence::IBatchVisitor<HumanWithVolumeMap>       & a_visitor
+    ) const = 0;
+
     /**
      * @brief Gets the number of humans of the land.
      *
@@ -25,6 +25,7 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Game/GameServer/Persistence/BatchVisitors.hpp>
 #include <Game/GameServer/Human/Operators/GetHumans/GetHumansOperator.hpp>
 
 using namespace GameServer::Common;
@@ -61,5 +62,28 @@ GetHumansOperatorExitCode GetHumansOperator::getHumans(
     }
 }
 
+GetHumansOperatorExitCode GetHumansOperator::visitHumans(
+    ITransactionShrPtr                        a_transaction,
+    IDHolder                          const & a_id_holder,
+    unsigned int                      const   a_batch_size,
+    IBatchVisitor<HumanWithVolumeMap>       & a_visitor
+) const
+{
+    try
+    {
+        CountingBatchVisitor<HumanWithVolumeMap> counting_visitor(a_visitor);
+
+        m_human_persistence_facade->visitHumans(a_transaction, a_id_holder, a_batch_size, counting_visitor);
+
+        return (counting_visitor.getCount())
+            ? GetHumansOperatorExitCode(GET_HUMANS_OPERATOR_EXIT_CODE_HUMANS_HAVE_BEEN_GOT)
+            : GetHumansOperatorExitCode(GET_HUMANS_OPERATOR_EXIT_CODE_UNEXPECTED_ERROR);
+    }
+    catch (...)
+    {
+        return GetHumansOperatorExitCode(GET_HUMANS_OPERATOR_EXIT_CODE_UNEXPECTED_ERROR);
+    }
+}
+
 } // namespace Human
 } // namespace GameServer
@@ -65,6 +65,25 @@ public:
         Common::IDHolder                const & a_id_holder
     ) const;
 
+    /**
+     * @brief Visits humans in batches.
+     *
+     * The exit code carries no humans, they have been handed over to the visitor already.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   The identifier of the holder.
+     * @param a_batch_size  The maximum number of humans in a batch.
+     * @param a_visitor     The visitor of the batches.
+     *
+     * @return The exit code.
+     */
+    virtual GetHumansOperatorExitCode visitHumans(
+        Persistence::ITransactionShrPtr                        a_transaction,
+        Common::IDHolder                               const & a_id_holder,
+        unsigned int                                   const   a_batch_size,
+        Persistence::IBatchVisitor<HumanWithVolumeMap>       & a_visitor
+    ) const;
+
 private:
     /**
      * @brief The persistence facade of humans.
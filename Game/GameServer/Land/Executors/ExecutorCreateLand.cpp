@@ -57,8 +57,8 @@ bool ExecutorCreateLand::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_world_name = a_request->getParam("world_name");
-    m_land_name = a_request->getParam("land_name");
+    m_world_name = a_request->getParam(Language::PARAM_WORLD_NAME);
+    m_land_name = a_request->getParam(Language::PARAM_LAND_NAME);
 
     return true;
 }
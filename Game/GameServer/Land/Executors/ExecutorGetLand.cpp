@@ -57,7 +57,7 @@ bool ExecutorGetLand::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_land_name = a_request->getParam("land_name");
+    m_land_name = a_request->getParam(Language::PARAM_LAND_NAME);
 
     return true;
 }
@@ -27,6 +27,7 @@
 
 #include <Game/GameServer/Common/Constants.hpp>
 #include <Game/GameServer/Land/Executors/ExecutorGetLands.hpp>
+#include <Language/Interface/Arena.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
 #include <boost/make_shared.hpp>
 #include <log4cpp/Category.hh>
@@ -39,10 +40,92 @@ using namespace std;
 namespace Game
 {
 
+namespace
+{
+
+/**
+ * @brief Appends the rows of lands.
+ *
+ * @param a_rows  The rows.
+ * @param a_lands The lands.
+ */
+void appendLands(
+    Language::Rows                   & a_rows,
+    GameServer::Land::ILandMap const & a_lands
+)
+{
+    for (GameServer::Land::ILandMap::const_iterator it = a_lands.begin(); it != a_lands.end(); ++it)
+    {
+        a_rows.appendText(Language::LAND_COLUMN_LOGIN, it->second->getLogin());
+        a_rows.appendText(Language::LAND_COLUMN_WORLD_NAME, it->second->getWorldName());
+        a_rows.appendText(Language::LAND_COLUMN_LAND_NAME, it->second->getLandName());
+        a_rows.appendBoolean(Language::LAND_COLUMN_GRANTED, it->second->getGranted());
+    }
+}
+
+/**
+ * @brief The visitor writing lands out in a part of their own as soon as a batch of them has been fetched.
+ */
+class LandsWriter
+    : public IBatchVisitor<GameServer::Land::ILandMap>
+{
+public:
+    explicit LandsWriter(
+        Server::IReplyStream & a_reply_stream
+    )
+        : m_reply_stream(a_reply_stream)
+    {
+    }
+
+    virtual void visit(
+        GameServer::Land::ILandMap const & a_lands
+    )
+    {
+        Language::ReplyBuilder reply_builder;
+        Language::Rows lands(Language::LAND_ROWS);
+
+        appendLands(lands, a_lands);
+
+        m_reply_stream.write(reply_builder.buildGetLandsReply(REPLY_STATUS_OK, GET_LANDS_LANDS_HAVE_BEEN_GOT, lands));
+    }
+
+private:
+    Server::IReplyStream & m_reply_stream;
+};
+
+/**
+ * @brief Visits lands, writing them out in parts as they are fetched.
+ *
+ * @param a_operator     The operator.
+ * @param a_transaction  The transaction.
+ * @param a_login        The login of the user.
+ * @param a_reply_stream The reply stream.
+ *
+ * @return The exit code.
+ */
+GameServer::Land::GetLandsOperatorExitCode visitLands(
+    GameServer::Land::IGetLandsOperatorShrPtr         a_operator,
+    ITransactionShrPtr                                a_transaction,
+    string                                    const   a_login,
+    Server::IReplyStream                            & a_reply_stream
+)
+{
+    // The parts are built on the heap, the arena of the request would keep every one of them until the final reply.
+    Language::ArenaScope const heap_scope(NULL);
+
+    LandsWriter writer(a_reply_stream);
+
+    return a_operator->visitLands(a_transaction, a_login, a_reply_stream.getPartSize(), writer);
+}
+
+} // namespace
+
 ExecutorGetLands::ExecutorGetLands(
-    Server::IContextShrPtr const a_context
+    Server::IContextShrPtr     const a_context,
+    Server::IReplyStreamShrPtr const a_reply_stream
 )
-    : Executor(a_context)
+    : Executor(a_context),
+      m_reply_stream(a_reply_stream)
 {
 }
 
@@ -99,7 +182,8 @@ Language::ICommand::Handle ExecutorGetLands::perform(
         ITransactionShrPtr transaction = a_persistence->getTransaction(connection);
 
         GameServer::Land::GetLandsOperatorExitCode const exit_code =
-            land_operator->getLands(transaction, m_user->getLogin());
+            m_reply_stream ? visitLands(land_operator, transaction, m_user->getLogin(), *m_reply_stream)
+                           : land_operator->getLands(transaction, m_user->getLogin());
 
         if (exit_code.ok())
         {
@@ -129,21 +213,9 @@ Language::ICommand::Handle ExecutorGetLands::produceReply(
     {
         case GameServer::Land::GET_LANDS_OPERATOR_EXIT_CODE_LANDS_HAVE_BEEN_GOT:
         {
-            Language::ICommand::Objects lands;
-
-            for (GameServer::Land::ILandMap::const_iterator it = a_exit_code.m_lands.begin();
-                 it != a_exit_code.m_lands.end(); ++it)
-            {
-                // TODO: Translate this automatically!
-                Language::ICommand::Object land;
-                land.insert(std::make_pair("login", it->second->getLogin()));
-                land.insert(std::make_pair("world_name", it->second->getWorldName()));
-                land.insert(std::make_pair("land_name", it->second->getLandName()));
-                std::string granted = it->second->getGranted() ? "true" : "false";
-                land.insert(std::make_pair("granted", granted));
-
-                lands.push_back(land);
-            }
+            Language::Rows lands(Language::LAND_ROWS);
+
+            appendLands(lands, a_exit_code.m_lands);
 
             return reply_builder.buildGetLandsReply(REPLY_STATUS_OK, GET_LANDS_LANDS_HAVE_BEEN_GOT, lands);
         }
@@ -30,6 +30,7 @@
 
 #include <Game/GameServer/Common/Executor.hpp>
 #include <Game/GameServer/Land/Operators/GetLands/GetLandsOperatorExitCode.hpp>
+#include <Server/include/IReplyStream.hpp>
 
 namespace Game
 {
@@ -39,7 +40,8 @@ class ExecutorGetLands
 {
 public:
     ExecutorGetLands(
-        Server::IContextShrPtr const a_context
+        Server::IContextShrPtr     const a_context,
+        Server::IReplyStreamShrPtr const a_reply_stream
     );
 
 private:
@@ -74,6 +76,8 @@ private:
     Language::ICommand::Handle produceReply(
         GameServer::Land::GetLandsOperatorExitCode const & a_exit_code
     ) const;
+
+    Server::IReplyStreamShrPtr const m_reply_stream;
 };
 
 } // namespace Game
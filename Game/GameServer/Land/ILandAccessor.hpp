@@ -29,6 +29,7 @@
 #define GAMESERVER_LAND_ILANDACCESSOR_HPP
 
 #include <Game/GameServer/Land/ILandRecord.hpp>
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
 #include <Game/GameServer/Persistence/ITransaction.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/make_shared.hpp>
@@ -112,6 +113,21 @@ public:
         std::string                     const a_login
     ) const = 0;
 
+    /**
+     * @brief Visits records of the land in batches, ordered by the name of the land.
+     *
+     * @param a_transaction The transaction.
+     * @param a_login       The login of the user.
+     * @param a_batch_size  The maximum number of records in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitRecords(
+        Persistence::ITransactionShrPtr                    a_transaction,
+        std::string                                const   a_login,
+        unsigned int                               const   a_batch_size,
+        Persistence::IBatchVisitor<ILandRecordMap>       & a_visitor
+    ) const = 0;
+
     /**
      * @brief Gets all records of the lands that belong to a given world.
      *
@@ -27,6 +27,7 @@
 
 #include <Game/GameServer/Land/LandAccessorPostgresql.hpp>
 #include <Game/GameServer/Land/LandRecord.hpp>
+#include <Game/GameServer/Persistence/CursorPostgresql.hpp>
 #include <Game/GameServer/Persistence/TransactionPostgresql.hpp>
 
 using namespace GameServer::Persistence;
@@ -46,7 +47,7 @@ void LandAccessorPostgresql::insertRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "INSERT INTO lands(login, world_name, land_name) VALUES("
                    + backbone_transaction.quote(a_login) + ", "
@@ -62,7 +63,7 @@ void LandAccessorPostgresql::deleteRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "DELETE FROM lands WHERE land_name = "
                    + backbone_transaction.quote(a_land_name);
@@ -76,7 +77,7 @@ void LandAccessorPostgresql::deleteRecords(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "DELETE FROM lands WHERE world_name = "
                    + backbone_transaction.quote(a_world_name);
@@ -90,7 +91,7 @@ ILandRecordShrPtr LandAccessorPostgresql::getRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM lands WHERE land_name = "
                    + backbone_transaction.quote(a_land_name);
@@ -104,7 +105,7 @@ ILandRecordMap LandAccessorPostgresql::getRecords(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM lands WHERE login = "
                    + backbone_transaction.quote(a_login);
@@ -112,13 +113,37 @@ ILandRecordMap LandAccessorPostgresql::getRecords(
     return prepareResultGetRecords(backbone_transaction.exec(query));
 }
 
+void LandAccessorPostgresql::visitRecords(
+    ITransactionShrPtr                    a_transaction,
+    string                        const   a_login,
+    unsigned int                  const   a_batch_size,
+    IBatchVisitor<ILandRecordMap>       & a_visitor
+) const
+{
+    TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
+
+    string query = "SELECT * FROM lands WHERE login = "
+                   + backbone_transaction.quote(a_login)
+                   + " ORDER BY land_name";
+
+    CursorPostgresql cursor(backbone_transaction, "lands_cursor", query);
+
+    for (pqxx::result result = cursor.fetch(a_batch_size); !result.empty(); result = cursor.fetch(a_batch_size))
+    {
+        a_visitor.visit(prepareResultGetRecords(result));
+    }
+
+    cursor.close();
+}
+
 ILandRecordMap LandAccessorPostgresql::getRecordsByWorldName(
     ITransactionShrPtr       a_transaction,
     string             const a_world_name
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM lands WHERE world_name = "
                    + backbone_transaction.quote(a_world_name);
@@ -132,7 +157,7 @@ void LandAccessorPostgresql::increaseAge(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE lands SET turns = turns + 1 WHERE land_name = "
                    + backbone_transaction.quote(a_land_name);
@@ -146,7 +171,7 @@ void LandAccessorPostgresql::markGranted(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE lands SET granted = true WHERE land_name = "
                    + backbone_transaction.quote(a_land_name);
@@ -27,6 +27,8 @@
 
 #include <Game/GameServer/Land/Land.hpp>
 #include <Game/GameServer/Land/LandPersistenceFacade.hpp>
+#include <Game/GameServer/Persistence/BatchVisitors.hpp>
+#include <boost/bind.hpp>
 
 using namespace GameServer::Persistence;
 using namespace GameServer::World;
@@ -114,6 +116,20 @@ ILandMap LandPersistenceFacade::getLands(
     return prepareResultGetLands(m_accessor->getRecords(a_transaction, a_login));
 }
 
+void LandPersistenceFacade::visitLands(
+    ITransactionShrPtr              a_transaction,
+    string                  const   a_login,
+    unsigned int            const   a_batch_size,
+    IBatchVisitor<ILandMap>       & a_visitor
+) const
+{
+    ConvertingBatchVisitor<ILandRecordMap, ILandMap> converting_visitor(
+        boost::bind(&LandPersistenceFacade::prepareResultGetLands, this, _1), a_visitor
+    );
+
+    m_accessor->visitRecords(a_transaction, a_login, a_batch_size, converting_visitor);
+}
+
 ILandMap LandPersistenceFacade::getLands(
     ITransactionShrPtr       a_transaction,
     IWorldShrPtr       const a_world
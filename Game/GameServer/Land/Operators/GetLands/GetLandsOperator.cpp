@@ -25,6 +25,7 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Game/GameServer/Persistence/BatchVisitors.hpp>
 #include <Game/GameServer/Land/Operators/GetLands/GetLandsOperator.hpp>
 
 using namespace GameServer::Persistence;
@@ -66,5 +67,28 @@ GetLandsOperatorExitCode GetLandsOperator::getLands(
     }
 }
 
+GetLandsOperatorExitCode GetLandsOperator::visitLands(
+    ITransactionShrPtr              a_transaction,
+    string                  const   a_login,
+    unsigned int            const   a_batch_size,
+    IBatchVisitor<ILandMap>       & a_visitor
+) const
+{
+    try
+    {
+        CountingBatchVisitor<ILandMap> counting_visitor(a_visitor);
+
+        m_land_persistence_facade->visitLands(a_transaction, a_login, a_batch_size, counting_visitor);
+
+        return (counting_visitor.getCount())
+            ? GetLandsOperatorExitCode(GET_LANDS_OPERATOR_EXIT_CODE_LANDS_HAVE_BEEN_GOT)
+            : GetLandsOperatorExitCode(GET_LANDS_OPERATOR_EXIT_CODE_LANDS_HAVE_NOT_BEEN_GOT);
+    }
+    catch (...)
+    {
+        return GetLandsOperatorExitCode(GET_LANDS_OPERATOR_EXIT_CODE_UNEXPECTED_ERROR);
+    }
+}
+
 } // namespace Land
 } // namespace GameServer
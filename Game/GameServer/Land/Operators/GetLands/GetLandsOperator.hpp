@@ -68,6 +68,25 @@ public:
         std::string                     const a_login
     ) const;
 
+    /**
+     * @brief Visits lands in batches.
+     *
+     * The exit code carries no lands, they have been handed over to the visitor already.
+     *
+     * @param a_transaction The transaction.
+     * @param a_login       The login of the user.
+     * @param a_batch_size  The maximum number of lands in a batch.
+     * @param a_visitor     The visitor of the batches.
+     *
+     * @return The exit code.
+     */
+    virtual GetLandsOperatorExitCode visitLands(
+        Persistence::ITransactionShrPtr              a_transaction,
+        std::string                          const   a_login,
+        unsigned int                         const   a_batch_size,
+        Persistence::IBatchVisitor<ILandMap>       & a_visitor
+    ) const;
+
 private:
     /**
      * @brief The persistence facade of lands.
@@ -0,0 +1,748 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Persistence/AsyncQueryRunnerPostgresql.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+#include <stdexcept>
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+namespace
+{
+
+/**
+ * @brief The identifier of the epoll event of waking the thread up, the connections are identified by their indexes.
+ */
+uint64_t const WAKE_UP_ID = ~static_cast<uint64_t>(0);
+
+int const MAX_EVENTS = 64;
+
+/**
+ * @brief The time (in milliseconds) after which a connection that could not be reestablished is retried.
+ */
+int const RESET_RETRY_INTERVAL = 1000;
+
+/**
+ * @brief Verifies whether a deadline has passed.
+ *
+ * @param a_deadline The deadline in microseconds since the epoch, zero if none.
+ * @param a_now      The current time in microseconds since the epoch.
+ *
+ * @return True if there is a deadline and it has passed, false otherwise.
+ */
+bool hasPassed(
+    unsigned long long int const a_deadline,
+    unsigned long long int const a_now
+)
+{
+    return a_deadline && a_deadline <= a_now;
+}
+
+/**
+ * @brief Takes the earlier of two deadlines, zero standing for none.
+ */
+unsigned long long int getEarlier(
+    unsigned long long int const a_first,
+    unsigned long long int const a_second
+)
+{
+    return (!a_first || (a_second && a_second < a_first)) ? a_second : a_first;
+}
+
+/**
+ * @brief Passes the result of a query to its receiver.
+ *
+ * @param a_callback The receiver of the result.
+ * @param a_result   The result.
+ */
+void call(
+    AsyncQueryCallback const & a_callback,
+    AsyncQueryResult   const & a_result
+)
+{
+    // The thread of the runner must survive whatever the receiver does.
+    try
+    {
+        a_callback(a_result);
+    }
+    catch (...)
+    {
+    }
+}
+
+} // namespace
+
+AsyncQueryRunnerPostgresql::AsyncQueryRunnerPostgresql(
+    std::string  const & a_connection_string,
+    unsigned int const   a_connections,
+    unsigned int const   a_max_queries
+)
+    : m_max_queries(a_max_queries),
+      m_stop_requested(false),
+      m_epoll_descriptor(::epoll_create1(EPOLL_CLOEXEC)),
+      m_wake_up_descriptor(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+{
+    epoll_event event = epoll_event();
+    event.events = EPOLLIN;
+    event.data.u64 = WAKE_UP_ID;
+
+    if (m_epoll_descriptor < 0
+        || m_wake_up_descriptor < 0
+        || ::epoll_ctl(m_epoll_descriptor, EPOLL_CTL_ADD, m_wake_up_descriptor, &event) != 0)
+    {
+        disconnect();
+
+        throw std::runtime_error("Could not set up the asynchronous query runner.");
+    }
+
+    for (unsigned int i = 0; i < a_connections; ++i)
+    {
+        Slot slot;
+        slot.m_connection = ::PQconnectdb(a_connection_string.c_str());
+        slot.m_state = SLOT_STATE_IDLE;
+        slot.m_socket = ::PQsocket(slot.m_connection);
+        slot.m_deadline = 0;
+        slot.m_cancelled = false;
+
+        m_slots.push_back(slot);
+
+        event.events = EPOLLIN;
+        event.data.u64 = i;
+
+        if (::PQstatus(slot.m_connection) != CONNECTION_OK
+            || ::PQsetnonblocking(slot.m_connection, 1) != 0
+            || ::epoll_ctl(m_epoll_descriptor, EPOLL_CTL_ADD, slot.m_socket, &event) != 0)
+        {
+            disconnect();
+
+            throw std::runtime_error("Could not connect the asynchronous query runner to the database.");
+        }
+    }
+
+    m_thread.start(*this);
+}
+
+AsyncQueryRunnerPostgresql::~AsyncQueryRunnerPostgresql()
+{
+    stop();
+    disconnect();
+}
+
+bool AsyncQueryRunnerPostgresql::run(
+    std::string              const & a_query,
+    std::vector<std::string> const & a_parameters,
+    unsigned long long int   const   a_deadline,
+    AsyncQueryCallback       const & a_callback
+)
+{
+    Query query;
+    query.m_query = a_query;
+    query.m_parameters = a_parameters;
+    query.m_deadline = a_deadline;
+    query.m_callback = a_callback;
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(m_mutex);
+
+        // A stopped runner would never serve the query, a full one would keep it waiting beyond any use.
+        if (m_stop_requested || m_queries.size() >= m_max_queries)
+        {
+            return false;
+        }
+
+        m_queries.push_back(query);
+    }
+
+    wakeUp();
+
+    return true;
+}
+
+void AsyncQueryRunnerPostgresql::stop()
+{
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(m_mutex);
+
+        if (m_stop_requested)
+        {
+            return;
+        }
+
+        m_stop_requested = true;
+    }
+
+    wakeUp();
+
+    m_thread.join();
+
+    // Nothing is going to be received anymore, the receivers are told so rather than left waiting.
+    std::deque<Query> queries;
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(m_mutex);
+
+        queries.swap(m_queries);
+    }
+
+    failQueries(queries, "The asynchronous query runner has been stopped.");
+
+    for (std::size_t i = 0; i < m_slots.size(); ++i)
+    {
+        if (m_slots[i].m_state == SLOT_STATE_BUSY)
+        {
+            m_slots[i].m_result = AsyncQueryResult();
+            m_slots[i].m_result.m_error = "The asynchronous query runner has been stopped.";
+            finish(i);
+        }
+    }
+}
+
+void AsyncQueryRunnerPostgresql::run()
+{
+    epoll_event events[MAX_EVENTS];
+
+    while (true)
+    {
+        {
+            Poco::ScopedLock<Poco::Mutex> lock(m_mutex);
+
+            if (m_stop_requested)
+            {
+                return;
+            }
+        }
+
+        int const retry_timeout = retryBrokenConnections();
+
+        expireQueries();
+        sendQueries();
+
+        int const deadline_timeout = getDeadlineTimeout();
+        int const timeout = (retry_timeout < 0 || (deadline_timeout >= 0 && deadline_timeout < retry_timeout))
+                          ? deadline_timeout
+                          : retry_timeout;
+
+        int const count = ::epoll_wait(m_epoll_descriptor, events, MAX_EVENTS, timeout);
+
+        for (int i = 0; i < count; ++i)
+        {
+            if (events[i].data.u64 == WAKE_UP_ID)
+            {
+                uint64_t value;
+                while (::read(m_wake_up_descriptor, &value, sizeof(value)) > 0)
+                {
+                }
+
+                continue;
+            }
+
+            std::size_t const slot = static_cast<std::size_t>(events[i].data.u64);
+
+            if (m_slots[slot].m_state == SLOT_STATE_RESETTING)
+            {
+                pollReset(slot);
+
+                continue;
+            }
+
+            if (m_slots[slot].m_state == SLOT_STATE_BROKEN)
+            {
+                continue;
+            }
+
+            if (events[i].events & EPOLLOUT)
+            {
+                flush(slot);
+            }
+
+            if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
+            {
+                receive(slot);
+            }
+        }
+    }
+}
+
+void AsyncQueryRunnerPostgresql::sendQueries()
+{
+    bool usable = false;
+
+    for (std::size_t i = 0; i < m_slots.size(); ++i)
+    {
+        usable = usable || m_slots[i].m_state != SLOT_STATE_BROKEN;
+
+        if (m_slots[i].m_state != SLOT_STATE_IDLE)
+        {
+            continue;
+        }
+
+        Query query;
+
+        {
+            Poco::ScopedLock<Poco::Mutex> lock(m_mutex);
+
+            if (m_queries.empty())
+            {
+                return;
+            }
+
+            query = m_queries.front();
+            m_queries.pop_front();
+        }
+
+        sendQuery(i, query);
+    }
+
+    if (usable)
+    {
+        return;
+    }
+
+    // Nobody is to wait for the database to come back, the queries fail as they would on a broken connection.
+    std::deque<Query> queries;
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(m_mutex);
+
+        queries.swap(m_queries);
+    }
+
+    failQueries(queries, "The connections to the database are broken.");
+}
+
+void AsyncQueryRunnerPostgresql::sendQuery(
+    std::size_t const   a_slot,
+    Query       const & a_query
+)
+{
+    Slot & slot = m_slots[a_slot];
+
+    std::vector<char const *> values;
+
+    for (std::vector<std::string>::const_iterator it = a_query.m_parameters.begin();
+         it != a_query.m_parameters.end();
+         ++it)
+    {
+        values.push_back(it->c_str());
+    }
+
+    slot.m_state = SLOT_STATE_BUSY;
+    slot.m_deadline = a_query.m_deadline;
+    slot.m_cancelled = false;
+    slot.m_callback = a_query.m_callback;
+    slot.m_result = AsyncQueryResult();
+
+    if (!::PQsendQueryParams(
+             slot.m_connection,
+             a_query.m_query.c_str(),
+             static_cast<int>(values.size()),
+             0,
+             values.empty() ? 0 : &values[0],
+             0,
+             0,
+             0
+         ))
+    {
+        slot.m_result.m_error = ::PQerrorMessage(slot.m_connection);
+        finish(a_slot);
+        reconnect(a_slot);
+
+        return;
+    }
+
+    // The query has succeeded unless an error result arrives.
+    slot.m_result.m_ok = true;
+
+    flush(a_slot);
+}
+
+void AsyncQueryRunnerPostgresql::receive(
+    std::size_t const a_slot
+)
+{
+    Slot & slot = m_slots[a_slot];
+
+    if (!::PQconsumeInput(slot.m_connection))
+    {
+        if (slot.m_state == SLOT_STATE_BUSY)
+        {
+            slot.m_result.m_ok = false;
+            slot.m_result.m_error = ::PQerrorMessage(slot.m_connection);
+            finish(a_slot);
+        }
+
+        reconnect(a_slot);
+
+        return;
+    }
+
+    if (slot.m_state != SLOT_STATE_BUSY)
+    {
+        return;
+    }
+
+    while (!::PQisBusy(slot.m_connection))
+    {
+        PGresult * const result = ::PQgetResult(slot.m_connection);
+
+        // The null result closes the results of the query.
+        if (!result)
+        {
+            finish(a_slot);
+
+            return;
+        }
+
+        ExecStatusType const status = ::PQresultStatus(result);
+
+        if (status == PGRES_TUPLES_OK)
+        {
+            int const rows = ::PQntuples(result);
+            int const columns = ::PQnfields(result);
+
+            for (int row = 0; row < rows; ++row)
+            {
+                AsyncRow values;
+
+                for (int column = 0; column < columns; ++column)
+                {
+                    values[::PQfname(result, column)] =
+                        std::string(::PQgetvalue(result, row, column), ::PQgetlength(result, row, column));
+                }
+
+                slot.m_result.m_rows.push_back(values);
+            }
+        }
+        else if (status != PGRES_COMMAND_OK)
+        {
+            slot.m_result.m_ok = false;
+            slot.m_result.m_error = ::PQresultErrorMessage(result);
+        }
+
+        ::PQclear(result);
+    }
+}
+
+void AsyncQueryRunnerPostgresql::flush(
+    std::size_t const a_slot
+)
+{
+    // The socket is waited for to become writable until the whole query has been sent.
+    watch(a_slot, (::PQflush(m_slots[a_slot].m_connection) == 1) ? (EPOLLIN | EPOLLOUT) : EPOLLIN);
+}
+
+void AsyncQueryRunnerPostgresql::finish(
+    std::size_t const a_slot
+)
+{
+    Slot & slot = m_slots[a_slot];
+
+    AsyncQueryCallback callback;
+    AsyncQueryResult result;
+
+    callback.swap(slot.m_callback);
+    std::swap(result, slot.m_result);
+    slot.m_state = SLOT_STATE_IDLE;
+
+    call(callback, result);
+}
+
+void AsyncQueryRunnerPostgresql::expireQueries()
+{
+    unsigned long long int const now = static_cast<unsigned long long int>(Poco::Timestamp().epochMicroseconds());
+
+    std::deque<Query> expired;
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(m_mutex);
+
+        for (std::deque<Query>::iterator it = m_queries.begin(); it != m_queries.end();)
+        {
+            if (hasPassed(it->m_deadline, now))
+            {
+                expired.push_back(*it);
+                it = m_queries.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    failQueries(expired, "The deadline of the query has passed.");
+
+    for (std::size_t i = 0; i < m_slots.size(); ++i)
+    {
+        if (m_slots[i].m_state == SLOT_STATE_BUSY && !m_slots[i].m_cancelled && hasPassed(m_slots[i].m_deadline, now))
+        {
+            cancel(i);
+        }
+    }
+}
+
+int AsyncQueryRunnerPostgresql::getDeadlineTimeout()
+{
+    unsigned long long int deadline = 0;
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(m_mutex);
+
+        for (std::deque<Query>::const_iterator it = m_queries.begin(); it != m_queries.end(); ++it)
+        {
+            deadline = getEarlier(deadline, it->m_deadline);
+        }
+    }
+
+    for (std::vector<Slot>::const_iterator it = m_slots.begin(); it != m_slots.end(); ++it)
+    {
+        if (it->m_state == SLOT_STATE_BUSY && !it->m_cancelled)
+        {
+            deadline = getEarlier(deadline, it->m_deadline);
+        }
+    }
+
+    if (!deadline)
+    {
+        return -1;
+    }
+
+    unsigned long long int const now = static_cast<unsigned long long int>(Poco::Timestamp().epochMicroseconds());
+
+    if (deadline <= now)
+    {
+        return 0;
+    }
+
+    // Rounded up, the thread is not to wake up just before the deadline.
+    return static_cast<int>(
+        std::min<unsigned long long int>((deadline - now + 999) / 1000, std::numeric_limits<int>::max())
+    );
+}
+
+void AsyncQueryRunnerPostgresql::cancel(
+    std::size_t const a_slot
+)
+{
+    Slot & slot = m_slots[a_slot];
+
+    slot.m_cancelled = true;
+
+    PGcancel * const cancel = ::PQgetCancel(slot.m_connection);
+
+    if (!cancel)
+    {
+        return;
+    }
+
+    // The request goes over a connection of its own, the query fails with an error result arriving as usual.
+    char error[256];
+    ::PQcancel(cancel, error, sizeof(error));
+    ::PQfreeCancel(cancel);
+}
+
+void AsyncQueryRunnerPostgresql::failQueries(
+    std::deque<Query> const & a_queries,
+    std::string       const & a_error
+)
+{
+    AsyncQueryResult result;
+    result.m_error = a_error;
+
+    for (std::deque<Query>::const_iterator it = a_queries.begin(); it != a_queries.end(); ++it)
+    {
+        call(it->m_callback, result);
+    }
+}
+
+void AsyncQueryRunnerPostgresql::watch(
+    std::size_t  const a_slot,
+    unsigned int const a_events
+)
+{
+    Slot & slot = m_slots[a_slot];
+    int const socket = ::PQsocket(slot.m_connection);
+
+    if (socket != slot.m_socket)
+    {
+        unwatch(a_slot);
+    }
+
+    if (socket < 0)
+    {
+        return;
+    }
+
+    epoll_event event = epoll_event();
+    event.events = a_events;
+    event.data.u64 = a_slot;
+
+    // A socket closed by libpq has left epoll by itself, even if its number has been taken again.
+    if (::epoll_ctl(m_epoll_descriptor, EPOLL_CTL_MOD, socket, &event) != 0 && errno == ENOENT)
+    {
+        ::epoll_ctl(m_epoll_descriptor, EPOLL_CTL_ADD, socket, &event);
+    }
+
+    slot.m_socket = socket;
+}
+
+void AsyncQueryRunnerPostgresql::unwatch(
+    std::size_t const a_slot
+)
+{
+    Slot & slot = m_slots[a_slot];
+
+    if (slot.m_socket >= 0)
+    {
+        ::epoll_ctl(m_epoll_descriptor, EPOLL_CTL_DEL, slot.m_socket, 0);
+        slot.m_socket = -1;
+    }
+}
+
+void AsyncQueryRunnerPostgresql::reconnect(
+    std::size_t const a_slot
+)
+{
+    Slot & slot = m_slots[a_slot];
+
+    if (::PQstatus(slot.m_connection) == CONNECTION_OK)
+    {
+        return;
+    }
+
+    // The socket is replaced by the reset, the old one leaves epoll while still open.
+    unwatch(a_slot);
+
+    if (!::PQresetStart(slot.m_connection))
+    {
+        slot.m_state = SLOT_STATE_BROKEN;
+        slot.m_broken.update();
+
+        return;
+    }
+
+    // The reset is polled first once the socket is writable, as if the polling had asked for it.
+    slot.m_state = SLOT_STATE_RESETTING;
+    watch(a_slot, EPOLLOUT);
+}
+
+void AsyncQueryRunnerPostgresql::pollReset(
+    std::size_t const a_slot
+)
+{
+    Slot & slot = m_slots[a_slot];
+
+    switch (::PQresetPoll(slot.m_connection))
+    {
+        case PGRES_POLLING_READING:
+            watch(a_slot, EPOLLIN);
+            break;
+
+        case PGRES_POLLING_WRITING:
+            watch(a_slot, EPOLLOUT);
+            break;
+
+        case PGRES_POLLING_OK:
+            ::PQsetnonblocking(slot.m_connection, 1);
+            slot.m_state = SLOT_STATE_IDLE;
+            watch(a_slot, EPOLLIN);
+            break;
+
+        default:
+            unwatch(a_slot);
+            slot.m_state = SLOT_STATE_BROKEN;
+            slot.m_broken.update();
+            break;
+    }
+}
+
+int AsyncQueryRunnerPostgresql::retryBrokenConnections()
+{
+    int timeout = -1;
+
+    for (std::size_t i = 0; i < m_slots.size(); ++i)
+    {
+        if (m_slots[i].m_state != SLOT_STATE_BROKEN)
+        {
+            continue;
+        }
+
+        if (m_slots[i].m_broken.isElapsed(static_cast<Poco::Timestamp::TimeDiff>(RESET_RETRY_INTERVAL) * 1000))
+        {
+            reconnect(i);
+        }
+
+        if (m_slots[i].m_state == SLOT_STATE_BROKEN)
+        {
+            timeout = RESET_RETRY_INTERVAL;
+        }
+    }
+
+    return timeout;
+}
+
+void AsyncQueryRunnerPostgresql::wakeUp()
+{
+    uint64_t const one = 1;
+
+    ssize_t const written = ::write(m_wake_up_descriptor, &one, sizeof(one));
+    (void)written;
+}
+
+void AsyncQueryRunnerPostgresql::disconnect()
+{
+    for (std::vector<Slot>::iterator it = m_slots.begin(); it != m_slots.end(); ++it)
+    {
+        ::PQfinish(it->m_connection);
+    }
+
+    m_slots.clear();
+
+    if (m_wake_up_descriptor >= 0)
+    {
+        ::close(m_wake_up_descriptor);
+        m_wake_up_descriptor = -1;
+    }
+
+    if (m_epoll_descriptor >= 0)
+    {
+        ::close(m_epoll_descriptor);
+        m_epoll_descriptor = -1;
+    }
+}
+
+} // namespace Persistence
+} // namespace GameServer
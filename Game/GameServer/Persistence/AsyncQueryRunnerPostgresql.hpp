@@ -0,0 +1,345 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef GAMESERVER_PERSISTENCE_ASYNCQUERYRUNNERPOSTGRESQL_HPP
+#define GAMESERVER_PERSISTENCE_ASYNCQUERYRUNNERPOSTGRESQL_HPP
+
+#include <Game/GameServer/Persistence/IAsyncQueryRunner.hpp>
+#include <Poco/Mutex.h>
+#include <Poco/Runnable.h>
+#include <Poco/Thread.h>
+#include <Poco/Timestamp.h>
+#include <deque>
+#include <postgresql/libpq-fe.h>
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+/**
+ * @brief The PostgreSQL runner of asynchronous queries.
+ *
+ * Keeps a few non-blocking libpq connections and a thread waiting on their sockets with epoll. A query is sent as
+ * soon as a connection is idle, the queries beyond the connections wait in the order of arrival.
+ *
+ * A broken connection is reestablished by the same thread without blocking it, the other connections go on serving
+ * meanwhile. A connection that could not be reestablished is retried after a while, the waiting queries fail at once
+ * while none of the connections is usable.
+ *
+ * The number of the waiting queries is bounded, the queries beyond it are rejected. A waiting query whose deadline
+ * has passed fails without being sent, a running one is cancelled.
+ */
+class AsyncQueryRunnerPostgresql
+    : public IAsyncQueryRunner,
+      private Poco::Runnable
+{
+public:
+    /**
+     * @brief Constructs the runner, connects to the database and starts the thread.
+     *
+     * @param a_connection_string The libpq connection string.
+     * @param a_connections       The number of connections.
+     * @param a_max_queries       The maximum number of the waiting queries.
+     *
+     * @throw std::runtime_error If a connection could not be established.
+     */
+    AsyncQueryRunnerPostgresql(
+        std::string  const & a_connection_string,
+        unsigned int const   a_connections,
+        unsigned int const   a_max_queries
+    );
+
+    /**
+     * @brief Stops the runner and disconnects from the database.
+     */
+    virtual ~AsyncQueryRunnerPostgresql();
+
+    /**
+     * @brief Runs a query.
+     *
+     * @param a_query      The query, the parameters are referred to as $1, $2 and so on.
+     * @param a_parameters The parameters of the query.
+     * @param a_deadline   The deadline of the query in microseconds since the epoch, zero if the query has none.
+     * @param a_callback   The receiver of the result.
+     *
+     * @return False if the query has been rejected, true otherwise.
+     */
+    virtual bool run(
+        std::string              const & a_query,
+        std::vector<std::string> const & a_parameters,
+        unsigned long long int   const   a_deadline,
+        AsyncQueryCallback       const & a_callback
+    );
+
+    /**
+     * @brief Stops the thread, the queries waiting or running by now fail from the calling thread.
+     */
+    virtual void stop();
+
+private:
+    /**
+     * @brief A query waiting for a connection.
+     */
+    struct Query
+    {
+        std::string m_query;
+
+        std::vector<std::string> m_parameters;
+
+        /**
+         * @brief The deadline in microseconds since the epoch, zero if none.
+         */
+        unsigned long long int m_deadline;
+
+        AsyncQueryCallback m_callback;
+    };
+
+    /**
+     * @brief The states of a connection.
+     */
+    enum SlotState
+    {
+        /**
+         * @brief Ready for a query.
+         */
+        SLOT_STATE_IDLE,
+
+        /**
+         * @brief Running a query.
+         */
+        SLOT_STATE_BUSY,
+
+        /**
+         * @brief Being reestablished, polled whenever its socket gets ready.
+         */
+        SLOT_STATE_RESETTING,
+
+        /**
+         * @brief Could not be reestablished, retried after a while.
+         */
+        SLOT_STATE_BROKEN
+    };
+
+    /**
+     * @brief A connection with the query being run on it.
+     */
+    struct Slot
+    {
+        PGconn * m_connection;
+
+        SlotState m_state;
+
+        /**
+         * @brief The socket of the connection watched by epoll, -1 if none.
+         */
+        int m_socket;
+
+        /**
+         * @brief The moment the connection has last failed to be reestablished.
+         */
+        Poco::Timestamp m_broken;
+
+        /**
+         * @brief The deadline of the query being run in microseconds since the epoch, zero if none.
+         */
+        unsigned long long int m_deadline;
+
+        /**
+         * @brief Whether the query being run has been cancelled already.
+         */
+        bool m_cancelled;
+
+        AsyncQueryCallback m_callback;
+
+        AsyncQueryResult m_result;
+    };
+
+    /**
+     * @brief Sends the waiting queries over the idle connections and waits for the results until stopped.
+     */
+    virtual void run();
+
+    /**
+     * @brief Sends the waiting queries over the idle connections, fails them if none of the connections is usable.
+     */
+    void sendQueries();
+
+    /**
+     * @brief Sends a query over a connection.
+     *
+     * @param a_slot  The index of the connection.
+     * @param a_query The query.
+     */
+    void sendQuery(
+        std::size_t const   a_slot,
+        Query       const & a_query
+    );
+
+    /**
+     * @brief Receives what has arrived over a connection, calls the callback once the result is complete.
+     *
+     * @param a_slot The index of the connection.
+     */
+    void receive(
+        std::size_t const a_slot
+    );
+
+    /**
+     * @brief Flushes what is still to be sent over a connection.
+     *
+     * @param a_slot The index of the connection.
+     */
+    void flush(
+        std::size_t const a_slot
+    );
+
+    /**
+     * @brief Finishes the query being run on a connection, calls its callback.
+     *
+     * @param a_slot The index of the connection.
+     */
+    void finish(
+        std::size_t const a_slot
+    );
+
+    /**
+     * @brief Starts reestablishing a connection if it has been broken.
+     *
+     * @param a_slot The index of the connection.
+     */
+    void reconnect(
+        std::size_t const a_slot
+    );
+
+    /**
+     * @brief Advances reestablishing a connection once its socket has got ready.
+     *
+     * @param a_slot The index of the connection.
+     */
+    void pollReset(
+        std::size_t const a_slot
+    );
+
+    /**
+     * @brief Starts reestablishing the connections which could not be reestablished a while ago.
+     *
+     * @return The time (in milliseconds) to wait for the next retry, -1 if there are no broken connections.
+     */
+    int retryBrokenConnections();
+
+    /**
+     * @brief Fails the waiting queries whose deadlines have passed and cancels the running ones.
+     */
+    void expireQueries();
+
+    /**
+     * @brief Gets the time to wait for the nearest deadline of the queries not expired yet.
+     *
+     * @return The time (in milliseconds) to wait, -1 if none of the queries has a deadline.
+     */
+    int getDeadlineTimeout();
+
+    /**
+     * @brief Cancels the query being run on a connection, its result arrives as an error.
+     *
+     * @param a_slot The index of the connection.
+     */
+    void cancel(
+        std::size_t const a_slot
+    );
+
+    /**
+     * @brief Fails the waiting queries.
+     *
+     * @param a_queries The queries.
+     * @param a_error   The error message.
+     */
+    void failQueries(
+        std::deque<Query> const & a_queries,
+        std::string       const & a_error
+    );
+
+    /**
+     * @brief Wakes the thread up.
+     */
+    void wakeUp();
+
+    /**
+     * @brief Closes the connections and the descriptors.
+     */
+    void disconnect();
+
+    /**
+     * @brief Sets the events of a connection waited for, follows the socket of the connection if it has changed.
+     *
+     * @param a_slot   The index of the connection.
+     * @param a_events The epoll events.
+     */
+    void watch(
+        std::size_t  const a_slot,
+        unsigned int const a_events
+    );
+
+    /**
+     * @brief Stops waiting for the events of a connection.
+     *
+     * @param a_slot The index of the connection.
+     */
+    void unwatch(
+        std::size_t const a_slot
+    );
+
+    std::vector<Slot> m_slots;
+
+    Poco::Mutex m_mutex;
+
+    std::deque<Query> m_queries;
+
+    /**
+     * @brief The maximum number of the waiting queries.
+     */
+    std::size_t const m_max_queries;
+
+    bool m_stop_requested;
+
+    int m_epoll_descriptor;
+
+    int m_wake_up_descriptor;
+
+    Poco::Thread m_thread;
+};
+
+/**
+ * @brief The shared pointer of the PostgreSQL runner of asynchronous queries.
+ */
+typedef boost::shared_ptr<AsyncQueryRunnerPostgresql> AsyncQueryRunnerPostgresqlShrPtr;
+
+} // namespace Persistence
+} // namespace GameServer
+
+#endif // GAMESERVER_PERSISTENCE_ASYNCQUERYRUNNERPOSTGRESQL_HPP
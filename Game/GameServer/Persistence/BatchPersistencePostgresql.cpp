@@ -0,0 +1,107 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Persistence/BatchPersistencePostgresql.hpp>
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+namespace
+{
+
+/**
+ * @brief Releases a nested transaction and counts it if it has not been committed.
+ */
+class NestedTransactionDeleter
+{
+public:
+    explicit NestedTransactionDeleter(
+        unsigned int & a_rollbacks
+    )
+        : m_rollbacks(a_rollbacks)
+    {
+    }
+
+    void operator()(
+        TransactionPostgresql * a_transaction
+    ) const
+    {
+        if (!a_transaction->isCommitted())
+        {
+            ++m_rollbacks;
+        }
+
+        delete a_transaction;
+    }
+
+private:
+    unsigned int & m_rollbacks;
+};
+
+} // namespace
+
+BatchPersistencePostgresql::BatchPersistencePostgresql()
+    : m_connection(new ConnectionPostgresql),
+      m_transaction(m_connection->getBackboneConnection()),
+      m_rollbacks(0)
+{
+}
+
+IConnectionShrPtr BatchPersistencePostgresql::getConnection()
+{
+    return m_connection;
+}
+
+ITransactionShrPtr BatchPersistencePostgresql::getTransaction(
+    IConnectionShrPtr a_connection
+)
+{
+    return ITransactionShrPtr(
+               new TransactionPostgresql(m_transaction.getBackboneTransaction()),
+               NestedTransactionDeleter(m_rollbacks)
+           );
+}
+
+unsigned int BatchPersistencePostgresql::getRollbacks() const
+{
+    return m_rollbacks;
+}
+
+void BatchPersistencePostgresql::commit()
+{
+    m_transaction.commit();
+}
+
+void BatchPersistencePostgresql::abort()
+{
+    m_transaction.abort();
+}
+
+} // namespace Persistence
+} // namespace GameServer
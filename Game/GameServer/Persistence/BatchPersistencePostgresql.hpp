@@ -0,0 +1,119 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef GAMESERVER_PERSISTENCE_BATCHPERSISTENCEPOSTGRESQL_HPP
+#define GAMESERVER_PERSISTENCE_BATCHPERSISTENCEPOSTGRESQL_HPP
+
+#include <Game/GameServer/Persistence/ConnectionPostgresql.hpp>
+#include <Game/GameServer/Persistence/IPersistence.hpp>
+#include <Game/GameServer/Persistence/TransactionPostgresql.hpp>
+#include <boost/noncopyable.hpp>
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+/**
+ * @brief The PostgreSQL persistence of a batch.
+ *
+ * All transactions got from the persistence are nested in a single outer transaction, so that a batch of requests
+ * shares one connection and one transaction. A single request having a deadline is run as a batch of its own, so
+ * that it may be rolled back as a whole once the deadline has passed. A nested transaction released without being committed rolls back to its
+ * savepoint and is counted as a rollback.
+ */
+class BatchPersistencePostgresql
+    : public IPersistence,
+      boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the persistence and begins the outer transaction.
+     */
+    BatchPersistencePostgresql();
+
+    /**
+     * @brief Gets the connection.
+     *
+     * @return The connection.
+     */
+    virtual IConnectionShrPtr getConnection();
+
+    /**
+     * @brief Gets a transaction nested in the outer transaction.
+     *
+     * @param a_connection A connection that transaction bases upon.
+     *
+     * @return The transaction.
+     */
+    virtual ITransactionShrPtr getTransaction(
+        IConnectionShrPtr a_connection
+    );
+
+    /**
+     * @brief Gets the number of nested transactions that have been rolled back.
+     *
+     * @return The number of nested transactions that have been rolled back.
+     */
+    unsigned int getRollbacks() const;
+
+    /**
+     * @brief Commits the outer transaction.
+     */
+    void commit();
+
+    /**
+     * @brief Aborts the outer transaction.
+     */
+    void abort();
+
+private:
+    /**
+     * @brief The connection.
+     */
+    ConnectionPostgresqlShrPtr m_connection;
+
+    /**
+     * @brief The outer transaction.
+     */
+    TransactionPostgresql m_transaction;
+
+    /**
+     * @brief The number of nested transactions that have been rolled back.
+     */
+    unsigned int m_rollbacks;
+};
+
+/**
+ * @brief The shared pointer of the PostgreSQL persistence of a batch.
+ */
+typedef boost::shared_ptr<BatchPersistencePostgresql> BatchPersistencePostgresqlShrPtr;
+
+} // namespace Persistence
+} // namespace GameServer
+
+#endif // GAMESERVER_PERSISTENCE_BATCHPERSISTENCEPOSTGRESQL_HPP
@@ -0,0 +1,136 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef GAMESERVER_PERSISTENCE_BATCHVISITORS_HPP
+#define GAMESERVER_PERSISTENCE_BATCHVISITORS_HPP
+
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
+#include <boost/function.hpp>
+#include <cstddef>
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+/**
+ * @brief The visitor converting the batches before handing them over to another visitor.
+ */
+template <typename SourceBatchType, typename TargetBatchType>
+class ConvertingBatchVisitor
+    : public IBatchVisitor<SourceBatchType>
+{
+public:
+    typedef boost::function<TargetBatchType (SourceBatchType const &)> Converter;
+
+    /**
+     * @brief Constructs the visitor.
+     *
+     * @param a_converter The converter of a batch.
+     * @param a_visitor   The visitor of the converted batches.
+     */
+    ConvertingBatchVisitor(
+        Converter                       const   a_converter,
+        IBatchVisitor<TargetBatchType>        & a_visitor
+    )
+        : m_converter(a_converter),
+          m_visitor(a_visitor)
+    {
+    }
+
+    /**
+     * @brief Converts a batch and hands it over.
+     *
+     * @param a_batch The batch.
+     */
+    virtual void visit(
+        SourceBatchType const & a_batch
+    )
+    {
+        m_visitor.visit(m_converter(a_batch));
+    }
+
+private:
+    Converter const m_converter;
+
+    IBatchVisitor<TargetBatchType> & m_visitor;
+};
+
+/**
+ * @brief The visitor counting the objects of the batches before handing them over to another visitor.
+ */
+template <typename BatchType>
+class CountingBatchVisitor
+    : public IBatchVisitor<BatchType>
+{
+public:
+    /**
+     * @brief Constructs the visitor.
+     *
+     * @param a_visitor The visitor of the batches.
+     */
+    explicit CountingBatchVisitor(
+        IBatchVisitor<BatchType> & a_visitor
+    )
+        : m_visitor(a_visitor),
+          m_count(0)
+    {
+    }
+
+    /**
+     * @brief Counts the objects of a batch and hands it over.
+     *
+     * @param a_batch The batch.
+     */
+    virtual void visit(
+        BatchType const & a_batch
+    )
+    {
+        m_count += a_batch.size();
+        m_visitor.visit(a_batch);
+    }
+
+    /**
+     * @brief Gets the number of the objects visited so far.
+     *
+     * @return The number of the objects.
+     */
+    std::size_t getCount() const
+    {
+        return m_count;
+    }
+
+private:
+    IBatchVisitor<BatchType> & m_visitor;
+
+    std::size_t m_count;
+};
+
+} // namespace Persistence
+} // namespace GameServer
+
+#endif // GAMESERVER_PERSISTENCE_BATCHVISITORS_HPP
@@ -42,5 +42,10 @@ pqxx::connection & ConnectionPostgresql::getBackboneConnection()
     return m_backbone_connection;
 }
 
+void ConnectionPostgresql::cancel()
+{
+    m_backbone_connection.cancel_query();
+}
+
 } // namespace Persistence
 } // namespace GameServer
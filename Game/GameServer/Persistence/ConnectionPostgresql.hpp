@@ -55,6 +55,11 @@ public:
      */
     pqxx::connection & getBackboneConnection();
 
+    /**
+     * @brief Cancels the query being run on the connection.
+     */
+    virtual void cancel();
+
 private:
     /**
      * @brief The backbone connection.
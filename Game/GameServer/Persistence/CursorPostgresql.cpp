@@ -0,0 +1,62 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Persistence/CursorPostgresql.hpp>
+#include <boost/lexical_cast.hpp>
+
+using namespace std;
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+CursorPostgresql::CursorPostgresql(
+    pqxx::dbtransaction       & a_transaction,
+    string              const & a_name,
+    string              const & a_query
+)
+    : m_transaction(a_transaction),
+      m_name(a_name)
+{
+    m_transaction.exec("DECLARE " + m_name + " NO SCROLL CURSOR FOR " + a_query);
+}
+
+pqxx::result CursorPostgresql::fetch(
+    unsigned int const a_count
+)
+{
+    return m_transaction.exec("FETCH FORWARD " + boost::lexical_cast<string>(a_count) + " FROM " + m_name);
+}
+
+void CursorPostgresql::close()
+{
+    m_transaction.exec("CLOSE " + m_name);
+}
+
+} // namespace Persistence
+} // namespace GameServer
@@ -0,0 +1,88 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef GAMESERVER_PERSISTENCE_CURSORPOSTGRESQL_HPP
+#define GAMESERVER_PERSISTENCE_CURSORPOSTGRESQL_HPP
+
+#include <boost/noncopyable.hpp>
+#include <pqxx/result.hxx>
+#include <pqxx/transaction.hxx>
+#include <string>
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+/**
+ * @brief The PostgreSQL server side cursor, the rows of a query are fetched in batches rather than all at once.
+ *
+ * The cursor lives as long as the transaction it has been declared in, the rows fetched so far are not kept.
+ */
+class CursorPostgresql
+    : boost::noncopyable
+{
+public:
+    /**
+     * @brief Declares the cursor.
+     *
+     * @param a_transaction The transaction.
+     * @param a_name        The name of the cursor, unique within the transaction.
+     * @param a_query       The query.
+     */
+    CursorPostgresql(
+        pqxx::dbtransaction       & a_transaction,
+        std::string         const & a_name,
+        std::string         const & a_query
+    );
+
+    /**
+     * @brief Fetches the next batch of the rows.
+     *
+     * @param a_count The maximum number of the rows.
+     *
+     * @return The rows, an empty result once all rows have been fetched.
+     */
+    pqxx::result fetch(
+        unsigned int const a_count
+    );
+
+    /**
+     * @brief Closes the cursor before the end of the transaction.
+     */
+    void close();
+
+private:
+    pqxx::dbtransaction & m_transaction;
+
+    std::string const m_name;
+};
+
+} // namespace Persistence
+} // namespace GameServer
+
+#endif // GAMESERVER_PERSISTENCE_CURSORPOSTGRESQL_HPP
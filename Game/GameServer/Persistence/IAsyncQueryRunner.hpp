@@ -0,0 +1,125 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef GAMESERVER_PERSISTENCE_IASYNCQUERYRUNNER_HPP
+#define GAMESERVER_PERSISTENCE_IASYNCQUERYRUNNER_HPP
+
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+/**
+ * @brief A row of the result of an asynchronous query, the values by the column names.
+ */
+typedef std::map<std::string, std::string> AsyncRow;
+
+/**
+ * @brief The result of an asynchronous query.
+ */
+struct AsyncQueryResult
+{
+    AsyncQueryResult()
+        : m_ok(false)
+    {
+    }
+
+    /**
+     * @brief True if the query has succeeded, false otherwise.
+     */
+    bool m_ok;
+
+    /**
+     * @brief The error message if the query has failed.
+     */
+    std::string m_error;
+
+    /**
+     * @brief The rows returned by the query.
+     */
+    std::vector<AsyncRow> m_rows;
+};
+
+/**
+ * @brief The receiver of the result of an asynchronous query.
+ */
+typedef boost::function<void (AsyncQueryResult const &)> AsyncQueryCallback;
+
+/**
+ * @brief The interface of the runner of asynchronous queries.
+ *
+ * Each query is run in its own implicit transaction, a query does not wait for another one to be finished.
+ */
+class IAsyncQueryRunner
+    : boost::noncopyable
+{
+public:
+    virtual ~IAsyncQueryRunner(){};
+
+    /**
+     * @brief Runs a query.
+     *
+     * Returns at once, the callback is called once the result has arrived, from the thread of the runner.
+     * A query still running when its deadline passes is cancelled and fails.
+     *
+     * @param a_query      The query, the parameters are referred to as $1, $2 and so on.
+     * @param a_parameters The parameters of the query.
+     * @param a_deadline   The deadline of the query in microseconds since the epoch, zero if the query has none.
+     * @param a_callback   The receiver of the result.
+     *
+     * @return False if the query has been rejected, since too many queries are waiting or the runner has been
+     *         stopped, its callback is never called then. True otherwise.
+     */
+    virtual bool run(
+        std::string              const & a_query,
+        std::vector<std::string> const & a_parameters,
+        unsigned long long int   const   a_deadline,
+        AsyncQueryCallback       const & a_callback
+    ) = 0;
+
+    /**
+     * @brief Stops the runner, the queries not finished by then fail, their callbacks are called before it returns.
+     */
+    virtual void stop() = 0;
+};
+
+/**
+ * @brief The shared pointer of the interface of the runner of asynchronous queries.
+ */
+typedef boost::shared_ptr<IAsyncQueryRunner> IAsyncQueryRunnerShrPtr;
+
+} // namespace Persistence
+} // namespace GameServer
+
+#endif // GAMESERVER_PERSISTENCE_IASYNCQUERYRUNNER_HPP
@@ -42,6 +42,13 @@ class IConnection
 {
 public:
     virtual ~IConnection(){};
+
+    /**
+     * @brief Cancels the query being run on the connection.
+     *
+     * May be called from a thread other than the one running the query, which fails then.
+     */
+    virtual void cancel() = 0;
 };
 
 /**
@@ -38,23 +38,38 @@ namespace Persistence
 TransactionPostgresql::TransactionPostgresql(
     pqxx::connection & a_connection
 )
-    : m_backbone_transaction(a_connection)
+    : m_backbone_transaction(new pqxx::transaction<>(a_connection)),
+      m_committed(false)
+{
+}
+
+TransactionPostgresql::TransactionPostgresql(
+    pqxx::dbtransaction & a_transaction
+)
+    : m_backbone_transaction(new pqxx::subtransaction(a_transaction)),
+      m_committed(false)
 {
 }
 
 void TransactionPostgresql::commit()
 {
-    m_backbone_transaction.commit();
+    m_backbone_transaction->commit();
+    m_committed = true;
 }
 
 void TransactionPostgresql::abort()
 {
-    m_backbone_transaction.abort();
+    m_backbone_transaction->abort();
+}
+
+bool TransactionPostgresql::isCommitted() const
+{
+    return m_committed;
 }
 
-pqxx::transaction<> & TransactionPostgresql::getBackboneTransaction()
+pqxx::dbtransaction & TransactionPostgresql::getBackboneTransaction()
 {
-    return m_backbone_transaction;
+    return *m_backbone_transaction;
 }
 
 } // namespace Persistence
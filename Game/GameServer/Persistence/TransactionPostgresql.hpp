@@ -29,7 +29,9 @@
 #define GAMESERVER_PERSISTENCE_TRANSACTIONPOSTGRESQL_HPP
 
 #include <Game/GameServer/Persistence/ITransaction.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <pqxx/connection.hxx>
+#include <pqxx/subtransaction.hxx>
 #include <pqxx/transaction.hxx>
 
 namespace GameServer
@@ -53,6 +55,17 @@ public:
         pqxx::connection & a_connection
     );
 
+    /**
+     * @brief Constructs the transaction nested in another transaction.
+     *
+     * The nested transaction is backed by a savepoint, so aborting it rolls back its own work only.
+     *
+     * @param a_transaction The transaction that transaction is nested in.
+     */
+    explicit TransactionPostgresql(
+        pqxx::dbtransaction & a_transaction
+    );
+
     /**
      * @brief Commits the transaction.
      */
@@ -63,18 +76,30 @@ public:
      */
     virtual void abort();
 
+    /**
+     * @brief Verifies whether the transaction has been committed.
+     *
+     * @return True if the transaction has been committed, false otherwise.
+     */
+    bool isCommitted() const;
+
     /**
      * @brief Gets the backbone transaction.
      *
      * @return The backbone transaction.
      */
-    pqxx::transaction<> & getBackboneTransaction();
+    pqxx::dbtransaction & getBackboneTransaction();
 
 private:
     /**
      * @brief The backbone transaction.
      */
-    pqxx::transaction<> m_backbone_transaction;
+    boost::scoped_ptr<pqxx::dbtransaction> m_backbone_transaction;
+
+    /**
+     * @brief Whether the transaction has been committed.
+     */
+    bool m_committed;
 };
 
 /**
@@ -0,0 +1,190 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/Resource/Executors/AsyncExecutorGetResources.hpp>
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+#include <map>
+
+using namespace GameServer::Persistence;
+using namespace boost;
+using namespace std;
+
+namespace Game
+{
+
+AsyncExecutorGetResources::AsyncExecutorGetResources(
+    Server::IContextShrPtr  const a_context,
+    IAsyncQueryRunnerShrPtr const a_query_runner
+)
+    : AsyncExecutor(a_context, a_query_runner)
+{
+}
+
+void AsyncExecutorGetResources::logExecutorStart() const
+{
+}
+
+bool AsyncExecutorGetResources::getParameters(
+    Language::ICommand::Handle a_request
+)
+{
+    m_login = a_request->getLogin();
+    m_password = a_request->getPassword();
+    m_holder_name = a_request->getParam(Language::PARAM_HOLDER_NAME);
+
+    return true;
+}
+
+bool AsyncExecutorGetResources::processParameters()
+{
+    // Only the settlements hold resources, as in ExecutorGetResources.
+    return true;
+}
+
+void AsyncExecutorGetResources::authorize()
+{
+    runQuery(
+        "SELECT land_name FROM settlements WHERE settlement_name = $1",
+        vector<string>(1, m_holder_name),
+        bind(&AsyncExecutorGetResources::onLandNameGot, this, _1)
+    );
+}
+
+void AsyncExecutorGetResources::epochIsActive()
+{
+    runQuery(
+        "SELECT epochs.active FROM lands JOIN epochs ON epochs.world_name = lands.world_name "
+        "WHERE lands.land_name = $1",
+        vector<string>(1, m_land_name),
+        bind(&AsyncExecutorGetResources::onEpochGot, this, _1)
+    );
+}
+
+void AsyncExecutorGetResources::verifyWorldConfiguration()
+{
+    resume(true);
+}
+
+void AsyncExecutorGetResources::perform()
+{
+    runQuery(
+        "SELECT resource_key, volume FROM resources_settlement WHERE holder_name = $1",
+        vector<string>(1, m_holder_name),
+        bind(&AsyncExecutorGetResources::onResourcesGot, this, _1)
+    );
+}
+
+Language::ICommand::Handle AsyncExecutorGetResources::getBasicReply(
+    unsigned int const a_status
+) const
+{
+    Language::ReplyBuilder reply_builder;
+
+    return reply_builder.buildGetResourcesReply(a_status);
+}
+
+Language::ICommand::Handle AsyncExecutorGetResources::produceReplyUnexpectedError() const
+{
+    Language::ReplyBuilder reply_builder;
+
+    return reply_builder.buildGetResourcesReply(REPLY_STATUS_OK, GET_RESOURCES_UNEXPECTED_ERROR);
+}
+
+void AsyncExecutorGetResources::onLandNameGot(
+    AsyncQueryResult const & a_result
+)
+{
+    if (!a_result.m_ok || a_result.m_rows.empty())
+    {
+        return resume(false);
+    }
+
+    m_land_name = a_result.m_rows.front().find("land_name")->second;
+
+    vector<string> parameters;
+    parameters.push_back(m_user->getLogin());
+    parameters.push_back(m_land_name);
+
+    runQuery(
+        "SELECT land_name FROM lands WHERE login = $1 AND land_name = $2",
+        parameters,
+        bind(&AsyncExecutorGetResources::onLandAuthorized, this, _1)
+    );
+}
+
+void AsyncExecutorGetResources::onLandAuthorized(
+    AsyncQueryResult const & a_result
+)
+{
+    resume(a_result.m_ok && !a_result.m_rows.empty());
+}
+
+void AsyncExecutorGetResources::onEpochGot(
+    AsyncQueryResult const & a_result
+)
+{
+    // The booleans arrive in the text format of PostgreSQL.
+    resume(a_result.m_ok && !a_result.m_rows.empty() && a_result.m_rows.front().find("active")->second == "t");
+}
+
+void AsyncExecutorGetResources::onResourcesGot(
+    AsyncQueryResult const & a_result
+)
+{
+    if (!a_result.m_ok)
+    {
+        return finish(produceReplyUnexpectedError());
+    }
+
+    // Ordered by the key, as the resources of ExecutorGetResources are.
+    map<string, unsigned int> volumes;
+
+    for (vector<AsyncRow>::const_iterator it = a_result.m_rows.begin(); it != a_result.m_rows.end(); ++it)
+    {
+        volumes[it->find("resource_key")->second] = lexical_cast<unsigned int>(it->find("volume")->second);
+    }
+
+    Language::Rows resources(Language::RESOURCE_ROWS);
+
+    for (map<string, unsigned int>::const_iterator it = volumes.begin(); it != volumes.end(); ++it)
+    {
+        resources.appendText(
+            Language::RESOURCE_COLUMN_RESOURCENAME,
+            m_context->getConfiguratorResource()->getResource(it->first)->getName()
+        );
+        resources.appendNumber(Language::RESOURCE_COLUMN_VOLUME, it->second);
+    }
+
+    Language::ReplyBuilder reply_builder;
+
+    finish(reply_builder.buildGetResourcesReply(REPLY_STATUS_OK, GET_RESOURCES_RESOURCES_HAVE_BEEN_GOT, resources));
+}
+
+} // namespace Game
@@ -58,8 +58,8 @@ bool ExecutorGetResources::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_value_id_holder_class = a_request->getParam("idholderclass");
-    m_holder_name = a_request->getParam("holder_name");
+    m_value_id_holder_class = a_request->getParam(Language::PARAM_ID_HOLDER_CLASS);
+    m_holder_name = a_request->getParam(Language::PARAM_HOLDER_NAME);
 
     return true;
 }
@@ -180,16 +180,13 @@ Language::ICommand::Handle ExecutorGetResources::produceReply(
     {
         case GameServer::Resource::GET_RESOURCES_OPERATOR_EXIT_CODE_RESOURCES_HAVE_BEEN_GOT:
         {
-            Language::ICommand::Objects resources;
+            Language::Rows resources(Language::RESOURCE_ROWS);
 
             for (GameServer::Resource::ResourceWithVolumeMap::const_iterator it = a_exit_code.m_resources.begin();
                  it != a_exit_code.m_resources.end(); ++it)
             {
-                // TODO: Translate this automatically!
-                Language::ICommand::Object resource;
-                resource.insert(std::make_pair("resourcename", it->second->getResource()->getName()));
-                resource.insert(std::make_pair("volume", boost::lexical_cast<std::string>(it->second->getVolume())));
-                resources.push_back(resource);
+                resources.appendText(Language::RESOURCE_COLUMN_RESOURCENAME, it->second->getResource()->getName());
+                resources.appendNumber(Language::RESOURCE_COLUMN_VOLUME, it->second->getVolume());
             }
 
             return reply_builder.buildGetResourcesReply(REPLY_STATUS_OK, GET_RESOURCES_RESOURCES_HAVE_BEEN_GOT,
@@ -27,6 +27,7 @@
 
 #include <Game/GameServer/Persistence/TransactionPostgresql.hpp>
 #include <Game/GameServer/Resource/ResourceAccessorPostgresql.hpp>
+#include <Language/Interface/Arena.hpp>
 
 using namespace GameServer::Common;
 using namespace GameServer::Persistence;
@@ -46,7 +47,7 @@ void ResourceAccessorPostgresql::insertRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "INSERT INTO "
                    + getTableName(a_id_holder)
@@ -65,7 +66,7 @@ void ResourceAccessorPostgresql::deleteRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "DELETE FROM "
                    + getTableName(a_id_holder)
@@ -82,7 +83,7 @@ ResourceWithVolumeRecordShrPtr ResourceAccessorPostgresql::getRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT volume FROM "
                    + getTableName(a_id_holder)
@@ -95,7 +96,9 @@ ResourceWithVolumeRecordShrPtr ResourceAccessorPostgresql::getRecord(
     {
         Volume volume;
         result[0]["volume"].to(volume);
-        return make_shared<ResourceWithVolumeRecord>(a_id_holder, a_key, volume);
+        return boost::allocate_shared<ResourceWithVolumeRecord>(
+            Language::ArenaAllocator<ResourceWithVolumeRecord>(), a_id_holder, a_key, volume
+        );
     }
     else
     {
@@ -109,7 +112,7 @@ ResourceWithVolumeRecordMap ResourceAccessorPostgresql::getRecords(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM "
                    + getTableName(a_id_holder)
@@ -130,7 +133,9 @@ ResourceWithVolumeRecordMap ResourceAccessorPostgresql::getRecords(
         it["resource_key"].to(key);
         volume = it["volume"].as(integer);
 
-        ResourceWithVolumeRecordShrPtr record = make_shared<ResourceWithVolumeRecord>(a_id_holder, key, volume);
+        ResourceWithVolumeRecordShrPtr record = boost::allocate_shared<ResourceWithVolumeRecord>(
+            Language::ArenaAllocator<ResourceWithVolumeRecord>(), a_id_holder, key, volume
+        );
 
         ResourceWithVolumeRecordPair pair(key, record);
 
@@ -148,7 +153,7 @@ void ResourceAccessorPostgresql::increaseVolume(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE "
                    + getTableName(a_id_holder)
@@ -167,7 +172,7 @@ void ResourceAccessorPostgresql::decreaseVolume(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "UPDATE "
                    + getTableName(a_id_holder)
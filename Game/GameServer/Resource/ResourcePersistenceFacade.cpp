@@ -26,6 +26,7 @@
 // SUCH DAMAGE.
 
 #include <Game/GameServer/Resource/ResourcePersistenceFacade.hpp>
+#include <Language/Interface/Arena.hpp>
 
 using namespace GameServer::Common;
 using namespace GameServer::Persistence;
@@ -183,7 +184,9 @@ ResourceWithVolumeMap ResourcePersistenceFacade::getResources(
         if (it->second)
         {
 
-            ResourceWithVolumeShrPtr resource = make_shared<ResourceWithVolume>(m_context, *it->second);
+            ResourceWithVolumeShrPtr resource = boost::allocate_shared<ResourceWithVolume>(
+                Language::ArenaAllocator<ResourceWithVolume>(), m_context, *it->second
+            );
             ResourceWithVolumePair pair(it->first, resource);
             resource_map.insert(pair);
         }
@@ -57,8 +57,8 @@ bool ExecutorCreateSettlement::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_land_name = a_request->getParam("land_name");
-    m_settlement_name = a_request->getParam("settlement_name");
+    m_land_name = a_request->getParam(Language::PARAM_LAND_NAME);
+    m_settlement_name = a_request->getParam(Language::PARAM_SETTLEMENT_NAME);
 
     return true;
 }
@@ -57,7 +57,7 @@ bool ExecutorGetSettlement::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_settlement_name = a_request->getParam("settlement_name");
+    m_settlement_name = a_request->getParam(Language::PARAM_SETTLEMENT_NAME);
 
     return true;
 }
@@ -27,6 +27,7 @@
 
 #include <Game/GameServer/Common/Constants.hpp>
 #include <Game/GameServer/Settlement/Executors/ExecutorGetSettlements.hpp>
+#include <Language/Interface/Arena.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
 #include <boost/make_shared.hpp>
 #include <log4cpp/Category.hh>
@@ -39,10 +40,94 @@ using namespace std;
 namespace Game
 {
 
+namespace
+{
+
+/**
+ * @brief Appends the rows of settlements.
+ *
+ * @param a_rows        The rows.
+ * @param a_settlements The settlements.
+ */
+void appendSettlements(
+    Language::Rows                               & a_rows,
+    GameServer::Settlement::ISettlementMap const & a_settlements
+)
+{
+    for (GameServer::Settlement::ISettlementMap::const_iterator it = a_settlements.begin();
+         it != a_settlements.end(); ++it)
+    {
+        a_rows.appendText(Language::SETTLEMENT_COLUMN_LAND_NAME, it->second->getLandName());
+        a_rows.appendText(Language::SETTLEMENT_COLUMN_SETTLEMENT_NAME, it->second->getSettlementName());
+    }
+}
+
+/**
+ * @brief The visitor writing settlements out in a part of their own as soon as a batch of them has been fetched.
+ */
+class SettlementsWriter
+    : public IBatchVisitor<GameServer::Settlement::ISettlementMap>
+{
+public:
+    explicit SettlementsWriter(
+        Server::IReplyStream & a_reply_stream
+    )
+        : m_reply_stream(a_reply_stream)
+    {
+    }
+
+    virtual void visit(
+        GameServer::Settlement::ISettlementMap const & a_settlements
+    )
+    {
+        Language::ReplyBuilder reply_builder;
+        Language::Rows settlements(Language::SETTLEMENT_ROWS);
+
+        appendSettlements(settlements, a_settlements);
+
+        m_reply_stream.write(
+            reply_builder.buildGetSettlementsReply(REPLY_STATUS_OK,
+                GET_SETTLEMENTS_BY_LANDNAME_SETTLEMENTS_HAVE_BEEN_GOT, settlements)
+        );
+    }
+
+private:
+    Server::IReplyStream & m_reply_stream;
+};
+
+/**
+ * @brief Visits settlements, writing them out in parts as they are fetched.
+ *
+ * @param a_operator     The operator.
+ * @param a_transaction  The transaction.
+ * @param a_land_name    The name of the land.
+ * @param a_reply_stream The reply stream.
+ *
+ * @return The exit code.
+ */
+GameServer::Settlement::GetSettlementsOperatorExitCode visitSettlements(
+    GameServer::Settlement::IGetSettlementsOperatorShrPtr         a_operator,
+    ITransactionShrPtr                                            a_transaction,
+    string                                                const   a_land_name,
+    Server::IReplyStream                                        & a_reply_stream
+)
+{
+    // The parts are built on the heap, the arena of the request would keep every one of them until the final reply.
+    Language::ArenaScope const heap_scope(NULL);
+
+    SettlementsWriter writer(a_reply_stream);
+
+    return a_operator->visitSettlements(a_transaction, a_land_name, a_reply_stream.getPartSize(), writer);
+}
+
+} // namespace
+
 ExecutorGetSettlements::ExecutorGetSettlements(
-    Server::IContextShrPtr const a_context
+    Server::IContextShrPtr     const a_context,
+    Server::IReplyStreamShrPtr const a_reply_stream
 )
-    : Executor(a_context)
+    : Executor(a_context),
+      m_reply_stream(a_reply_stream)
 {
 }
 
@@ -57,7 +142,7 @@ bool ExecutorGetSettlements::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_land_name = a_request->getParam("land_name");
+    m_land_name = a_request->getParam(Language::PARAM_LAND_NAME);
 
     return true;
 }
@@ -135,7 +220,8 @@ Language::ICommand::Handle ExecutorGetSettlements::perform(
         ITransactionShrPtr transaction = a_persistence->getTransaction(connection);
 
         GameServer::Settlement::GetSettlementsOperatorExitCode const exit_code =
-            settlement_operator->getSettlements(transaction, m_land_name);
+            m_reply_stream ? visitSettlements(settlement_operator, transaction, m_land_name, *m_reply_stream)
+                           : settlement_operator->getSettlements(transaction, m_land_name);
 
         if (exit_code.ok())
         {
@@ -169,17 +255,9 @@ Language::ICommand::Handle ExecutorGetSettlements::produceReply(
 
         case GameServer::Settlement::GET_SETTLEMENTS_OPERATOR_EXIT_CODE_SETTLEMENTS_HAVE_BEEN_GOT:
         {
-            Language::ICommand::Objects settlements;
-
-            for (GameServer::Settlement::ISettlementMap::const_iterator it = a_exit_code.m_settlements.begin();
-                 it != a_exit_code.m_settlements.end(); ++it)
-            {
-                // TODO: Translate this automatically!
-                Language::ICommand::Object settlement;
-                settlement.insert(std::make_pair("land_name", it->second->getLandName()));
-                settlement.insert(std::make_pair("settlement_name", it->second->getSettlementName()));
-                settlements.push_back(settlement);
-            }
+            Language::Rows settlements(Language::SETTLEMENT_ROWS);
+
+            appendSettlements(settlements, a_exit_code.m_settlements);
 
             return reply_builder.buildGetSettlementsReply(REPLY_STATUS_OK,
                        GET_SETTLEMENTS_BY_LANDNAME_SETTLEMENTS_HAVE_BEEN_GOT, settlements);
@@ -30,6 +30,7 @@
 
 #include <Game/GameServer/Common/Executor.hpp>
 #include <Game/GameServer/Settlement/Operators/GetSettlements/GetSettlementsOperatorExitCode.hpp>
+#include <Server/include/IReplyStream.hpp>
 
 namespace Game
 {
@@ -39,7 +40,8 @@ class ExecutorGetSettlements
 {
 public:
     ExecutorGetSettlements(
-        Server::IContextShrPtr const a_context
+        Server::IContextShrPtr     const a_context,
+        Server::IReplyStreamShrPtr const a_reply_stream
     );
 
 private:
@@ -76,6 +78,8 @@ private:
     ) const;
 
     std::string m_land_name;
+
+    Server::IReplyStreamShrPtr const m_reply_stream;
 };
 
 } // namespace Game
@@ -28,6 +28,7 @@
 #ifndef GAMESERVER_SETTLEMENT_ISETTLEMENTACCESSOR_HPP
 #define GAMESERVER_SETTLEMENT_ISETTLEMENTACCESSOR_HPP
 
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
 #include <Game/GameServer/Persistence/ITransaction.hpp>
 #include <Game/GameServer/Settlement/ISettlementRecord.hpp>
 #include <boost/noncopyable.hpp>
@@ -99,6 +100,21 @@ public:
         Persistence::ITransactionShrPtr       a_transaction,
         std::string                     const a_land_name
     ) const = 0;
+
+    /**
+     * @brief Visits records of the settlement in batches, ordered by the name of the settlement.
+     *
+     * @param a_transaction The transaction.
+     * @param a_land_name   The name of the land.
+     * @param a_batch_size  The maximum number of records in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitRecords(
+        Persistence::ITransactionShrPtr                          a_transaction,
+        std::string                                      const   a_land_name,
+        unsigned int                                     const   a_batch_size,
+        Persistence::IBatchVisitor<ISettlementRecordMap>       & a_visitor
+    ) const = 0;
 };
 
 /**
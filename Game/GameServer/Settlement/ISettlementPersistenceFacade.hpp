@@ -29,6 +29,7 @@
 #define GAMESERVER_SETTLEMENT_ISETTLEMENTPERSISTENCEFACADE_HPP
 
 #include <Game/GameServer/Land/ILand.hpp>
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
 #include <Game/GameServer/Persistence/ITransaction.hpp>
 #include <Game/GameServer/Settlement/Settlement.hpp>
 #include <boost/noncopyable.hpp>
@@ -100,6 +101,21 @@ public:
         Persistence::ITransactionShrPtr       a_transaction,
         Land::ILandShrPtr               const a_land
     ) const = 0;
+
+    /**
+     * @brief Visits settlements in batches, ordered by the name of the settlement.
+     *
+     * @param a_transaction The transaction.
+     * @param a_land        The land.
+     * @param a_batch_size  The maximum number of settlements in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitSettlements(
+        Persistence::ITransactionShrPtr                    a_transaction,
+        Land::ILandShrPtr                          const   a_land,
+        unsigned int                               const   a_batch_size,
+        Persistence::IBatchVisitor<ISettlementMap>       & a_visitor
+    ) const = 0;
 };
 
 /**
@@ -25,6 +25,7 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Game/GameServer/Persistence/BatchVisitors.hpp>
 #include <Game/GameServer/Settlement/Operators/GetSettlements/GetSettlementsOperator.hpp>
 
 using namespace GameServer::Persistence;
@@ -75,5 +76,36 @@ GetSettlementsOperatorExitCode GetSettlementsOperator::getSettlements(
     }
 }
 
+GetSettlementsOperatorExitCode GetSettlementsOperator::visitSettlements(
+    ITransactionShrPtr                    a_transaction,
+    string                        const   a_land_name,
+    unsigned int                  const   a_batch_size,
+    IBatchVisitor<ISettlementMap>       & a_visitor
+) const
+{
+    try
+    {
+        CountingBatchVisitor<ISettlementMap> counting_visitor(a_visitor);
+
+        // Verify if the land exists.
+        ILandShrPtr land = m_land_persistence_facade->getLand(a_transaction, a_land_name);
+
+        if (!land)
+        {
+            return GetSettlementsOperatorExitCode(GET_SETTLEMENTS_OPERATOR_EXIT_CODE_LAND_DOES_NOT_EXIST);
+        }
+
+        m_settlement_persistence_facade->visitSettlements(a_transaction, land, a_batch_size, counting_visitor);
+
+        return (counting_visitor.getCount())
+            ? GetSettlementsOperatorExitCode(GET_SETTLEMENTS_OPERATOR_EXIT_CODE_SETTLEMENTS_HAVE_BEEN_GOT)
+            : GetSettlementsOperatorExitCode(GET_SETTLEMENTS_OPERATOR_EXIT_CODE_SETTLEMENTS_HAVE_NOT_BEEN_GOT);
+    }
+    catch (...)
+    {
+        return GetSettlementsOperatorExitCode(GET_SETTLEMENTS_OPERATOR_EXIT_CODE_UNEXPECTED_ERROR);
+    }
+}
+
 } // namespace Settlement
 } // namespace GameServer
@@ -28,6 +28,7 @@
 #ifndef GAMESERVER_SETTLEMENT_IGETSETTLEMENTSOPERATOR_HPP
 #define GAMESERVER_SETTLEMENT_IGETSETTLEMENTSOPERATOR_HPP
 
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
 #include <Game/GameServer/Persistence/ITransaction.hpp>
 #include <Game/GameServer/Settlement/Operators/GetSettlements/GetSettlementsOperatorExitCode.hpp>
 #include <boost/noncopyable.hpp>
@@ -60,6 +61,25 @@ public:
         Persistence::ITransactionShrPtr       a_transaction,
         std::string                     const a_land_name
     ) const = 0;
+
+    /**
+     * @brief Visits settlements in batches.
+     *
+     * The exit code carries no settlements, they have been handed over to the visitor already.
+     *
+     * @param a_transaction The transaction.
+     * @param a_land_name   The name of the land.
+     * @param a_batch_size  The maximum number of settlements in a batch.
+     * @param a_visitor     The visitor of the batches.
+     *
+     * @return The exit code.
+     */
+    virtual GetSettlementsOperatorExitCode visitSettlements(
+        Persistence::ITransactionShrPtr                    a_transaction,
+        std::string                                const   a_land_name,
+        unsigned int                               const   a_batch_size,
+        Persistence::IBatchVisitor<ISettlementMap>       & a_visitor
+    ) const = 0;
 };
 
 /**
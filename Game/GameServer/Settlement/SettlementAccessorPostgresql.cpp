@@ -25,6 +25,7 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Game/GameServer/Persistence/CursorPostgresql.hpp>
 #include <Game/GameServer/Persistence/TransactionPostgresql.hpp>
 #include <Game/GameServer/Settlement/SettlementAccessorPostgresql.hpp>
 #include <Game/GameServer/Settlement/SettlementRecord.hpp>
@@ -45,7 +46,7 @@ void SettlementAccessorPostgresql::insertRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "INSERT INTO settlements(land_name, settlement_name) VALUES("
                    + backbone_transaction.quote(a_land_name) + ", "
@@ -60,7 +61,7 @@ void SettlementAccessorPostgresql::deleteRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "DELETE FROM settlements WHERE settlement_name = "
                    + backbone_transaction.quote(a_settlement_name);
@@ -74,7 +75,7 @@ ISettlementRecordShrPtr SettlementAccessorPostgresql::getRecord(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM settlements WHERE settlement_name = "
                    + backbone_transaction.quote(a_settlement_name);
@@ -88,13 +89,37 @@ ISettlementRecordMap SettlementAccessorPostgresql::getRecords(
 ) const
 {
     TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
-    pqxx::transaction<> & backbone_transaction = transaction->getBackboneTransaction();
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
 
     string query = "SELECT * FROM settlements WHERE land_name = " + backbone_transaction.quote(a_land_name);
 
     return prepareResultGetRecords(backbone_transaction.exec(query));
 }
 
+void SettlementAccessorPostgresql::visitRecords(
+    ITransactionShrPtr                          a_transaction,
+    string                              const   a_land_name,
+    unsigned int                        const   a_batch_size,
+    IBatchVisitor<ISettlementRecordMap>       & a_visitor
+) const
+{
+    TransactionPostgresqlShrPtr transaction = shared_dynamic_cast<TransactionPostgresql>(a_transaction);
+    pqxx::dbtransaction & backbone_transaction = transaction->getBackboneTransaction();
+
+    string query = "SELECT * FROM settlements WHERE land_name = "
+                   + backbone_transaction.quote(a_land_name)
+                   + " ORDER BY settlement_name";
+
+    CursorPostgresql cursor(backbone_transaction, "settlements_cursor", query);
+
+    for (pqxx::result result = cursor.fetch(a_batch_size); !result.empty(); result = cursor.fetch(a_batch_size))
+    {
+        a_visitor.visit(prepareResultGetRecords(result));
+    }
+
+    cursor.close();
+}
+
 ISettlementRecordShrPtr SettlementAccessorPostgresql::prepareResultGetRecord(
     pqxx::result const & a_result
 ) const
@@ -93,6 +93,21 @@ public:
         std::string                     const a_land_name
     ) const;
 
+    /**
+     * @brief Visits records of the settlement in batches, ordered by the name of the settlement.
+     *
+     * @param a_transaction The transaction.
+     * @param a_land_name   The name of the land.
+     * @param a_batch_size  The maximum number of records in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitRecords(
+        Persistence::ITransactionShrPtr                          a_transaction,
+        std::string                                      const   a_land_name,
+        unsigned int                                     const   a_batch_size,
+        Persistence::IBatchVisitor<ISettlementRecordMap>       & a_visitor
+    ) const;
+
 private:
     /**
      * @brief Prepares the result for getRecord* methods.
@@ -25,7 +25,9 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Game/GameServer/Persistence/BatchVisitors.hpp>
 #include <Game/GameServer/Settlement/SettlementPersistenceFacade.hpp>
+#include <boost/bind.hpp>
 
 using namespace GameServer::Land;
 using namespace GameServer::Persistence;
@@ -107,6 +109,23 @@ ISettlementMap SettlementPersistenceFacade::getSettlements(
     return prepareResultGetSettlements(m_accessor->getRecords(a_transaction, a_land->getLandName()));
 }
 
+void SettlementPersistenceFacade::visitSettlements(
+    ITransactionShrPtr                    a_transaction,
+    ILandShrPtr                   const   a_land,
+    unsigned int                  const   a_batch_size,
+    IBatchVisitor<ISettlementMap>       & a_visitor
+) const
+{
+    ConvertingBatchVisitor<ISettlementRecordMap, ISettlementMap> converting_visitor(
+        boost::bind(&SettlementPersistenceFacade::prepareResultGetSettlements, this, _1), a_visitor
+    );
+
+    if (a_land)
+    {
+        m_accessor->visitRecords(a_transaction, a_land->getLandName(), a_batch_size, converting_visitor);
+    }
+}
+
 ISettlementShrPtr SettlementPersistenceFacade::prepareResultGetSettlement(
     ISettlementRecordShrPtr a_record
 ) const
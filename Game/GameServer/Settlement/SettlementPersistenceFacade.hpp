@@ -106,6 +106,21 @@ public:
         Land::ILandShrPtr               const a_land
     ) const;
 
+    /**
+     * @brief Visits settlements in batches, ordered by the name of the settlement.
+     *
+     * @param a_transaction The transaction.
+     * @param a_land        The land.
+     * @param a_batch_size  The maximum number of settlements in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    virtual void visitSettlements(
+        Persistence::ITransactionShrPtr                    a_transaction,
+        Land::ILandShrPtr                          const   a_land,
+        unsigned int                               const   a_batch_size,
+        Persistence::IBatchVisitor<ISettlementMap>       & a_visitor
+    ) const;
+
 private:
     /**
      * @brief Prepares the result for getSettlement* methods.
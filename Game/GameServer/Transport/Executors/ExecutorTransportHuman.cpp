@@ -29,7 +29,6 @@
 #include <Game/GameServer/Transport/Executors/ExecutorTransportHuman.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
 #include <boost/make_shared.hpp>
-#include <boost/lexical_cast.hpp>
 #include <log4cpp/Category.hh>
 
 using namespace GameServer::Persistence;
@@ -58,26 +57,16 @@ bool ExecutorTransportHuman::getParameters(
 {
     m_login = a_request->getLogin();
     m_password = a_request->getPassword();
-    m_settlement_name_source = a_request->getParam("settlement_name_source");
-    m_settlement_name_destination = a_request->getParam("settlement_name_destination");
-    m_key = a_request->getParam("humankey");
-    m_value_volume = a_request->getParam("volume");
+    m_settlement_name_source = a_request->getParam(Language::PARAM_SETTLEMENT_NAME_SOURCE);
+    m_settlement_name_destination = a_request->getParam(Language::PARAM_SETTLEMENT_NAME_DESTINATION);
+    m_key = a_request->getParam(Language::PARAM_HUMAN_KEY);
 
-    return true;
+    return a_request->getNumberParam(Language::PARAM_VOLUME, m_volume);
 }
 
 bool ExecutorTransportHuman::processParameters()
 {
-    try
-    {
-        m_volume = boost::lexical_cast<unsigned int>(m_value_volume);
-
-        return true;
-    }
-    catch (std::range_error)
-    {
-        return false;
-    }
+    return true;
 }
 
 bool ExecutorTransportHuman::authorize(
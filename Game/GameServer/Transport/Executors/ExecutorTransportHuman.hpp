@@ -78,7 +78,6 @@ private:
     std::string m_key;
     std::string m_settlement_name_destination;
     std::string m_settlement_name_source;
-    std::string m_value_volume;
 
     GameServer::Building::Volume m_volume;
 };
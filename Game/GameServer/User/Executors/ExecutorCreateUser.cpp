@@ -55,8 +55,8 @@ bool ExecutorCreateUser::getParameters(
     Language::ICommand::Handle a_request
 )
 {
-    m_login = a_request->getParam("login");
-    m_password = a_request->getParam("password");
+    m_login = a_request->getParam(Language::PARAM_LOGIN);
+    m_password = a_request->getParam(Language::PARAM_PASSWORD);
 
     return true;
 }
@@ -0,0 +1,113 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/User/Executors/ExecutorLogin.hpp>
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <log4cpp/Category.hh>
+
+using namespace GameServer::Persistence;
+using namespace log4cpp;
+using namespace std;
+
+namespace Game
+{
+
+ExecutorLogin::ExecutorLogin(
+    Server::IContextShrPtr const a_context
+)
+    : Executor(a_context)
+{
+}
+
+void ExecutorLogin::logExecutorStart() const
+{
+}
+
+bool ExecutorLogin::getParameters(
+    Language::ICommand::Handle a_request
+)
+{
+    m_login = a_request->getLogin();
+    m_password = a_request->getPassword();
+
+    return true;
+}
+
+bool ExecutorLogin::processParameters()
+{
+    return true;
+}
+
+bool ExecutorLogin::authorize(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    return true;
+}
+
+bool ExecutorLogin::epochIsActive(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    return true;
+}
+
+bool ExecutorLogin::verifyWorldConfiguration(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    return true;
+}
+
+Language::ICommand::Handle ExecutorLogin::perform(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    Language::ReplyBuilder reply_builder;
+
+    // The user has been authenticated and got by now, so no query is needed.
+    string const session_token = m_context->getSessionManager()->open(m_user);
+
+    if (session_token.empty())
+    {
+        return reply_builder.buildLoginReply(REPLY_STATUS_OK, LOGIN_SESSION_HAS_NOT_BEEN_OPENED);
+    }
+
+    return reply_builder.buildLoginReply(REPLY_STATUS_OK, LOGIN_SESSION_HAS_BEEN_OPENED, session_token);
+}
+
+Language::ICommand::Handle ExecutorLogin::getBasicReply(
+    unsigned int const a_status
+) const
+{
+    Language::ReplyBuilder reply_builder;
+
+    return reply_builder.buildLoginReply(a_status);
+}
+
+} // namespace Game
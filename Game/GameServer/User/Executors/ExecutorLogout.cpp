@@ -0,0 +1,107 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/User/Executors/ExecutorLogout.hpp>
+#include <Language/Interface/ReplyBuilder.hpp>
+
+using namespace GameServer::Persistence;
+
+namespace Game
+{
+
+ExecutorLogout::ExecutorLogout(
+    Server::IContextShrPtr const a_context
+)
+    : Executor(a_context)
+{
+}
+
+void ExecutorLogout::logExecutorStart() const
+{
+}
+
+bool ExecutorLogout::getParameters(
+    Language::ICommand::Handle a_request
+)
+{
+    m_login = a_request->getLogin();
+    m_password = a_request->getPassword();
+    m_session_token = a_request->getSessionToken();
+
+    // Only a request authenticated by its session has a session to close.
+    return !m_session_token.empty();
+}
+
+bool ExecutorLogout::processParameters()
+{
+    return true;
+}
+
+bool ExecutorLogout::authorize(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    return true;
+}
+
+bool ExecutorLogout::epochIsActive(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    return true;
+}
+
+bool ExecutorLogout::verifyWorldConfiguration(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    return true;
+}
+
+Language::ICommand::Handle ExecutorLogout::perform(
+    IPersistenceShrPtr a_persistence
+) const
+{
+    Language::ReplyBuilder reply_builder;
+
+    // The session has been resolved for the login by now, so it is the own session of the user that is closed.
+    m_context->getSessionManager()->close(m_session_token);
+
+    return reply_builder.buildLogoutReply(REPLY_STATUS_OK, LOGOUT_SESSION_HAS_BEEN_CLOSED);
+}
+
+Language::ICommand::Handle ExecutorLogout::getBasicReply(
+    unsigned int const a_status
+) const
+{
+    Language::ReplyBuilder reply_builder;
+
+    return reply_builder.buildLogoutReply(a_status);
+}
+
+} // namespace Game
@@ -64,7 +64,7 @@ private:
 
         GameServer::Persistence::TransactionPostgresqlShrPtr transaction_postgresql =
             boost::shared_dynamic_cast<GameServer::Persistence::TransactionPostgresql>(transaction);
-        pqxx::transaction<> & backbone_transaction = transaction_postgresql->getBackboneTransaction();
+        pqxx::dbtransaction & backbone_transaction = transaction_postgresql->getBackboneTransaction();
 
         try
         {
@@ -0,0 +1,172 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/PersistenceFacadeAbstractFactoryPostgresql.hpp>
+#include <Game/GameServer/Persistence/BatchPersistencePostgresql.hpp>
+#include <Game/GameServerCT/ComponentTest.hpp>
+#include <Server/include/Context.hpp>
+
+using namespace GameServer::Common;
+using namespace GameServer::Persistence;
+using namespace GameServer::World;
+using namespace std;
+
+/**
+ * @brief A test class.
+ */
+class BatchPersistencePostgresqlTest
+    : public ComponentTest
+{
+protected:
+    /**
+     * @brief Constructs the test class.
+     */
+    BatchPersistencePostgresqlTest()
+        : m_context(new Server::Context),
+          m_world_name_1("World1"),
+          m_world_name_2("World2"),
+          m_persistence_facade_abstract_factory(new PersistenceFacadeAbstractFactoryPostgresql(m_context)),
+          m_world_persistence_facade(m_persistence_facade_abstract_factory->createWorldPersistenceFacade())
+    {
+    }
+
+    /**
+     * @brief Creates a world in a transaction nested in the batch.
+     *
+     * @param a_world_name The name of the world.
+     * @param a_commit     Whether the nested transaction is to be committed.
+     */
+    void createWorld(
+        string const a_world_name,
+        bool   const a_commit
+    )
+    {
+        IConnectionShrPtr connection = m_batch_persistence.getConnection();
+        ITransactionShrPtr transaction = m_batch_persistence.getTransaction(connection);
+
+        ASSERT_TRUE(m_world_persistence_facade->createWorld(transaction, a_world_name));
+
+        if (a_commit)
+        {
+            transaction->commit();
+        }
+    }
+
+    /**
+     * @brief Verifies whether a world exists, outside of the batch.
+     *
+     * @param a_world_name The name of the world.
+     *
+     * @return True if the world exists, false otherwise.
+     */
+    bool worldExists(
+        string const a_world_name
+    )
+    {
+        IConnectionShrPtr connection = m_persistence.getConnection();
+        ITransactionShrPtr transaction = m_persistence.getTransaction(connection);
+
+        return m_world_persistence_facade->getWorld(transaction, a_world_name) != NULL;
+    }
+
+    Server::IContextShrPtr const m_context;
+
+    /**
+     * @brief Test constants: the names of the worlds.
+     */
+    string m_world_name_1,
+           m_world_name_2;
+
+    /**
+     * @brief The abstract factory of persistence facades.
+     */
+    IPersistenceFacadeAbstractFactoryShrPtr m_persistence_facade_abstract_factory;
+
+    /**
+     * @brief The persistence facade of worlds.
+     */
+    IWorldPersistenceFacadeShrPtr m_world_persistence_facade;
+
+    /**
+     * @brief The persistence of the batch.
+     */
+    BatchPersistencePostgresql m_batch_persistence;
+};
+
+/**
+ * Component tests of: BatchPersistencePostgresql::getRollbacks.
+ */
+TEST_F(BatchPersistencePostgresqlTest, getRollbacks_NothingRolledBack)
+{
+    createWorld(m_world_name_1, true);
+
+    ASSERT_EQ(0, m_batch_persistence.getRollbacks());
+}
+
+TEST_F(BatchPersistencePostgresqlTest, getRollbacks_NestedTransactionRolledBack)
+{
+    createWorld(m_world_name_1, true);
+    createWorld(m_world_name_2, false);
+
+    ASSERT_EQ(1, m_batch_persistence.getRollbacks());
+}
+
+/**
+ * Component tests of: BatchPersistencePostgresql::commit.
+ */
+TEST_F(BatchPersistencePostgresqlTest, commit_CommittedWorkIsKept)
+{
+    createWorld(m_world_name_1, true);
+    createWorld(m_world_name_2, true);
+    m_batch_persistence.commit();
+
+    ASSERT_TRUE(worldExists(m_world_name_1));
+    ASSERT_TRUE(worldExists(m_world_name_2));
+}
+
+TEST_F(BatchPersistencePostgresqlTest, commit_RolledBackWorkIsDiscarded)
+{
+    createWorld(m_world_name_1, true);
+    createWorld(m_world_name_2, false);
+    m_batch_persistence.commit();
+
+    ASSERT_TRUE(worldExists(m_world_name_1));
+    ASSERT_FALSE(worldExists(m_world_name_2));
+}
+
+/**
+ * Component tests of: BatchPersistencePostgresql::abort.
+ */
+TEST_F(BatchPersistencePostgresqlTest, abort_AllWorkIsDiscarded)
+{
+    createWorld(m_world_name_1, true);
+    createWorld(m_world_name_2, true);
+    m_batch_persistence.abort();
+
+    ASSERT_FALSE(worldExists(m_world_name_1));
+    ASSERT_FALSE(worldExists(m_world_name_2));
+}
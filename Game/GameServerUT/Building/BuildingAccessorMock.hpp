@@ -115,6 +115,24 @@ public:
         )
     );
 
+    /**
+     * @brief Visits building with volume records in batches, ordered by the key of the building.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   An identifier of the holder.
+     * @param a_batch_size  The maximum number of records in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    MOCK_CONST_METHOD4(
+        visitRecords,
+        void(
+            Persistence::ITransactionShrPtr                                 a_transaction,
+            Common::IDHolder                                        const & a_id_holder,
+            unsigned int                                            const   a_batch_size,
+            Persistence::IBatchVisitor<BuildingWithVolumeRecordMap>       & a_visitor
+        )
+    );
+
     /**
      * @brief Increases the volume of building with volume record.
      *
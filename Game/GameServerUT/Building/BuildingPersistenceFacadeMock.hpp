@@ -118,6 +118,24 @@ public:
             Common::IDHolder                const & a_id_holder
         )
     );
+
+    /**
+     * @brief Visits buildings in batches, ordered by the key of the building.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   The identifier of the holder.
+     * @param a_batch_size  The maximum number of buildings in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    MOCK_CONST_METHOD4(
+        visitBuildings,
+        void(
+            Persistence::ITransactionShrPtr                           a_transaction,
+            Common::IDHolder                                  const & a_id_holder,
+            unsigned int                                      const   a_batch_size,
+            Persistence::IBatchVisitor<BuildingWithVolumeMap>       & a_visitor
+        )
+    );
 };
 
 } // namespace Building
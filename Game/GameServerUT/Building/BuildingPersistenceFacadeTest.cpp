@@ -28,6 +28,7 @@
 #include <Game/GameServer/Building/BuildingPersistenceFacade.hpp>
 #include <Game/GameServer/Building/Key.hpp>
 #include <Game/GameServerUT/Building/BuildingAccessorMock.hpp>
+#include <Game/GameServerUT/Persistence/BatchVisitorFake.hpp>
 #include <Game/GameServerUT/Persistence/TransactionDummy.hpp>
 #include <Server/include/Context.hpp>
 
@@ -40,6 +41,8 @@ using namespace std;
 
 using testing::Return;
 using testing::Throw;
+using testing::DoAll;
+using testing::_;
 
 /**
  * @brief A test class.
@@ -392,3 +395,34 @@ TEST_F(BuildingPersistenceFacadeTest, getBuildings_BuildingsArePresent_TwoBuildi
     compareBuilding(buildings[m_key_1], m_key_1, 5);
     compareBuilding(buildings[m_key_2], m_key_2, 9);
 }
+
+TEST_F(BuildingPersistenceFacadeTest, visitBuildings_BuildingsArePresent_TwoBatches)
+{
+    ITransactionShrPtr transaction(new TransactionDummy);
+
+    BuildingAccessorMock * mock = new BuildingAccessorMock;
+
+    BuildingWithVolumeRecordMap batch_1;
+    batch_1.insert(make_pair(m_key_1, make_shared<BuildingWithVolumeRecord>(m_id_holder_1, m_key_1, 5)));
+
+    BuildingWithVolumeRecordMap batch_2;
+    batch_2.insert(make_pair(m_key_2, make_shared<BuildingWithVolumeRecord>(m_id_holder_1, m_key_2, 9)));
+
+    EXPECT_CALL(*mock, visitRecords(transaction, m_id_holder_1, 1, _))
+    .WillOnce(DoAll(VisitBatch(batch_1), VisitBatch(batch_2)));
+
+    IBuildingAccessorAutPtr accessor(mock);
+
+    BuildingPersistenceFacade persistence_facade(m_context, accessor);
+
+    BatchVisitorFake<BuildingWithVolumeMap> visitor;
+
+    persistence_facade.visitBuildings(transaction, m_id_holder_1, 1, visitor);
+
+    ASSERT_EQ(2, visitor.m_batches.size());
+    ASSERT_EQ(1, visitor.m_batches[0].size());
+    ASSERT_EQ(1, visitor.m_batches[1].size());
+
+    compareBuilding(visitor.m_batches[0][m_key_1], m_key_1, 5);
+    compareBuilding(visitor.m_batches[1][m_key_2], m_key_2, 9);
+}
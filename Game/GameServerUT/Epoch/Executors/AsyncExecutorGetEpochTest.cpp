@@ -0,0 +1,275 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/Epoch/Executors/AsyncExecutorGetEpoch.hpp>
+#include <Game/GameServerUT/Persistence/AsyncQueryRunnerFake.hpp>
+#include <Language/Interface/Command.hpp>
+#include <Poco/Timestamp.h>
+#include <Server/include/Context.hpp>
+#include <boost/bind.hpp>
+#include <gmock/gmock.h>
+
+using namespace Game;
+using namespace GameServer::Persistence;
+using namespace std;
+
+/**
+ * @brief A test class.
+ */
+class AsyncExecutorGetEpochTest
+    : public testing::Test
+{
+protected:
+    /**
+     * @brief Constructs a test class.
+     */
+    AsyncExecutorGetEpochTest()
+        : m_context(new Server::Context),
+          m_query_runner(new AsyncQueryRunnerFake),
+          m_request(new Language::Command)
+    {
+        m_request->setID(Language::ID_COMMAND_GET_EPOCH_REQUEST);
+        m_request->setLogin("Login");
+        m_request->setPassword("Password");
+        m_request->setParam("world_name", "World");
+    }
+
+    /**
+     * @brief Prepares the results of the authentication of a user.
+     *
+     * @param a_moderator Whether the user is a moderator.
+     */
+    void authenticate(
+        bool const a_moderator
+    )
+    {
+        AsyncRow user;
+        user["login"] = "Login";
+        user["password"] = "Password";
+        user["moderator"] = a_moderator ? "t" : "f";
+
+        m_query_runner->succeed(vector<AsyncRow>(1, user));
+        m_query_runner->succeed(vector<AsyncRow>(1, user));
+    }
+
+    /**
+     * @brief Executes the request.
+     */
+    void execute()
+    {
+        IAsyncExecutorShrPtr executor(new AsyncExecutorGetEpoch(m_context, m_query_runner));
+
+        executor->start(m_request, boost::bind(&AsyncExecutorGetEpochTest::complete, this, _1));
+    }
+
+    /**
+     * @brief Receives the reply.
+     *
+     * @param a_reply The reply.
+     */
+    void complete(
+        Language::ICommand::Handle a_reply
+    )
+    {
+        m_replies.push_back(a_reply);
+    }
+
+    Server::IContextShrPtr m_context;
+
+    boost::shared_ptr<AsyncQueryRunnerFake> m_query_runner;
+
+    Language::ICommand::Handle m_request;
+
+    Language::ICommand::Commands m_replies;
+};
+
+TEST_F(AsyncExecutorGetEpochTest, EpochIsGot)
+{
+    authenticate(true);
+
+    AsyncRow world;
+    world["world_name"] = "World";
+    m_query_runner->succeed(vector<AsyncRow>(1, world));
+
+    AsyncRow epoch;
+    epoch["epoch_name"] = "Epoch";
+    epoch["world_name"] = "World";
+    epoch["active"] = "t";
+    epoch["finished"] = "f";
+    epoch["ticks"] = "7";
+    m_query_runner->succeed(vector<AsyncRow>(1, epoch));
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_OK, m_replies.front()->getCode());
+    ASSERT_EQ(GET_EPOCH_EPOCH_HAS_BEEN_GOT, m_replies.front()->getMessage());
+    ASSERT_EQ(1U, m_replies.front()->getObjects().size());
+
+    Language::ICommand::Object const & object = m_replies.front()->getObjects().front();
+
+    ASSERT_EQ("Epoch", object.find("epoch_name")->second);
+    ASSERT_EQ("World", object.find("world_name")->second);
+    ASSERT_EQ("true", object.find("active")->second);
+    ASSERT_EQ("false", object.find("finished")->second);
+    ASSERT_EQ("7", object.find("ticks")->second);
+}
+
+TEST_F(AsyncExecutorGetEpochTest, QueriesAreParameterized)
+{
+    authenticate(true);
+    m_query_runner->succeed(vector<AsyncRow>(1, AsyncRow()));
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(4U, m_query_runner->m_parameters.size());
+    ASSERT_EQ(2U, m_query_runner->m_parameters[0].size());
+    ASSERT_EQ("Login", m_query_runner->m_parameters[0][0]);
+    ASSERT_EQ("Password", m_query_runner->m_parameters[0][1]);
+    ASSERT_EQ(vector<string>(1, "Login"), m_query_runner->m_parameters[1]);
+    ASSERT_EQ(vector<string>(1, "World"), m_query_runner->m_parameters[2]);
+    ASSERT_EQ(vector<string>(1, "World"), m_query_runner->m_parameters[3]);
+}
+
+TEST_F(AsyncExecutorGetEpochTest, EpochIsNotGot)
+{
+    authenticate(true);
+    m_query_runner->succeed(vector<AsyncRow>(1, AsyncRow()));
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_OK, m_replies.front()->getCode());
+    ASSERT_EQ(GET_EPOCH_EPOCH_HAS_NOT_BEEN_GOT, m_replies.front()->getMessage());
+}
+
+TEST_F(AsyncExecutorGetEpochTest, WorldDoesNotExist)
+{
+    authenticate(true);
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_OK, m_replies.front()->getCode());
+    ASSERT_EQ(GET_EPOCH_WORLD_DOES_NOT_EXIST, m_replies.front()->getMessage());
+    ASSERT_EQ(3U, m_query_runner->m_queries.size());
+}
+
+TEST_F(AsyncExecutorGetEpochTest, FailedQueryIsUnexpectedError)
+{
+    authenticate(true);
+    m_query_runner->fail();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_OK, m_replies.front()->getCode());
+    ASSERT_EQ(GET_EPOCH_UNEXPECTED_ERROR, m_replies.front()->getMessage());
+}
+
+TEST_F(AsyncExecutorGetEpochTest, UnknownUserIsUnauthenticated)
+{
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_UNAUTHENTICATED, m_replies.front()->getCode());
+    ASSERT_EQ(1U, m_query_runner->m_queries.size());
+}
+
+TEST_F(AsyncExecutorGetEpochTest, FailedAuthenticationIsUnauthenticated)
+{
+    m_query_runner->fail();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_UNAUTHENTICATED, m_replies.front()->getCode());
+}
+
+TEST_F(AsyncExecutorGetEpochTest, NonModeratorIsFilteredOut)
+{
+    authenticate(false);
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_NON_MODERATOR_FILTERED_OUT, m_replies.front()->getCode());
+    ASSERT_EQ(2U, m_query_runner->m_queries.size());
+}
+
+TEST_F(AsyncExecutorGetEpochTest, ExpiredRequestIsTimedOut)
+{
+    m_request->setDeadline(1);
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_TIMED_OUT, m_replies.front()->getCode());
+    ASSERT_TRUE(m_query_runner->m_queries.empty());
+}
+
+TEST_F(AsyncExecutorGetEpochTest, UnknownSessionIsUnauthenticated)
+{
+    m_request->setSessionToken("Token");
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_UNAUTHENTICATED, m_replies.front()->getCode());
+    ASSERT_TRUE(m_query_runner->m_queries.empty());
+}
+
+TEST_F(AsyncExecutorGetEpochTest, DeadlineIsPassedToQueries)
+{
+    // A minute ahead.
+    unsigned long long int const deadline =
+        static_cast<unsigned long long int>(Poco::Timestamp().epochMicroseconds()) + 60000000ULL;
+
+    m_request->setDeadline(deadline);
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(vector<unsigned long long int>(1, deadline), m_query_runner->m_deadlines);
+}
+
+TEST_F(AsyncExecutorGetEpochTest, RejectedQueryIsServerBusy)
+{
+    authenticate(true);
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_SERVER_BUSY, m_replies.front()->getCode());
+    ASSERT_EQ(3U, m_query_runner->m_queries.size());
+}
@@ -111,6 +111,24 @@ public:
         )
     );
 
+    /**
+     * @brief Visits human with volume records in batches, ordered by the key of the human.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   An identifier of the holder.
+     * @param a_batch_size  The maximum number of records in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    MOCK_CONST_METHOD4(
+        visitRecords,
+        void(
+            Persistence::ITransactionShrPtr                              a_transaction,
+            Common::IDHolder                                     const & a_id_holder,
+            unsigned int                                         const   a_batch_size,
+            Persistence::IBatchVisitor<HumanWithVolumeRecordMap>       & a_visitor
+        )
+    );
+
     /**
      * @brief Increases the volume of human with volume record.
      *
@@ -119,6 +119,24 @@ public:
         )
     );
 
+    /**
+     * @brief Visits humans in batches, ordered by the key of the human.
+     *
+     * @param a_transaction The transaction.
+     * @param a_id_holder   The identifier of the holder.
+     * @param a_batch_size  The maximum number of humans in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    MOCK_CONST_METHOD4(
+        visitHumans,
+        void(
+            GameServer::Persistence::ITransactionShrPtr                        a_transaction,
+            GameServer::Common::IDHolder                               const & a_id_holder,
+            unsigned int                                               const   a_batch_size,
+            GameServer::Persistence::IBatchVisitor<HumanWithVolumeMap>       & a_visitor
+        )
+    );
+
     /**
      * @brief Gets the number of humans of the land.
      *
@@ -28,6 +28,7 @@
 #include <Game/GameServer/Human/HumanPersistenceFacade.hpp>
 #include <Game/GameServer/Human/Key.hpp>
 #include <Game/GameServerUT/Human/HumanAccessorMock.hpp>
+#include <Game/GameServerUT/Persistence/BatchVisitorFake.hpp>
 #include <Game/GameServerUT/Persistence/TransactionDummy.hpp>
 #include <Server/include/Context.hpp>
 
@@ -41,6 +42,7 @@ using namespace std;
 using testing::Return;
 using testing::Throw;
 using testing::_;
+using testing::DoAll;
 
 /**
  * @brief A test class.
@@ -450,3 +452,39 @@ TEST_F(HumanPersistenceFacadeTest, getHumans_AllHumans_HumansArePresent_TwoHuman
     compareHuman(humans[KEY_WORKER_MINER_NOVICE], KEY_WORKER_MINER_NOVICE, 5);
     compareHuman(humans[KEY_WORKER_FARMER_ADVANCED], KEY_WORKER_FARMER_ADVANCED, 9);
 }
+
+TEST_F(HumanPersistenceFacadeTest, visitHumans_HumansArePresent_TwoBatches)
+{
+    ITransactionShrPtr transaction(new TransactionDummy);
+
+    // Mocks setup: HumanAccessorMock.
+    HumanAccessorMock * mock = new HumanAccessorMock;
+
+    HumanWithVolumeRecordMap batch_1;
+    batch_1.insert(make_pair(KEY_WORKER_MINER_NOVICE, make_shared<HumanWithVolumeRecord>(m_id_holder, KEY_WORKER_MINER_NOVICE, 5)));
+
+    HumanWithVolumeRecordMap batch_2;
+    batch_2.insert(make_pair(KEY_WORKER_FARMER_ADVANCED, make_shared<HumanWithVolumeRecord>(m_id_holder, KEY_WORKER_FARMER_ADVANCED, 9)));
+
+    EXPECT_CALL(*mock, visitRecords(_, m_id_holder, 1, _))
+    .WillOnce(DoAll(VisitBatch(batch_1), VisitBatch(batch_2)));
+
+    // Mocks setup: Wrapping around.
+    IHumanAccessorAutPtr accessor(mock);
+
+    // Preconditions.
+    HumanPersistenceFacade persistence_facade(m_context, accessor);
+
+    BatchVisitorFake<HumanWithVolumeMap> visitor;
+
+    // Test commands.
+    persistence_facade.visitHumans(transaction, m_id_holder, 1, visitor);
+
+    // Test assertions.
+    ASSERT_EQ(2, visitor.m_batches.size());
+    ASSERT_EQ(1, visitor.m_batches[0].size());
+    ASSERT_EQ(1, visitor.m_batches[1].size());
+
+    compareHuman(visitor.m_batches[0][KEY_WORKER_MINER_NOVICE], KEY_WORKER_MINER_NOVICE, 5);
+    compareHuman(visitor.m_batches[1][KEY_WORKER_FARMER_ADVANCED], KEY_WORKER_FARMER_ADVANCED, 9);
+}
@@ -121,6 +121,24 @@ public:
         )
     );
 
+    /**
+     * @brief Visits records of the land in batches, ordered by the name of the land.
+     *
+     * @param a_transaction The transaction.
+     * @param a_login       The login of the user.
+     * @param a_batch_size  The maximum number of records in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    MOCK_CONST_METHOD4(
+        visitRecords,
+        void(
+            Persistence::ITransactionShrPtr                    a_transaction,
+            std::string                                const   a_login,
+            unsigned int                               const   a_batch_size,
+            Persistence::IBatchVisitor<ILandRecordMap>       & a_visitor
+        )
+    );
+
     /**
      * @brief Gets all records of the lands that belong to a given world.
      *
@@ -28,6 +28,7 @@
 #include <Game/GameServer/Land/LandPersistenceFacade.hpp>
 #include <Game/GameServer/Land/LandRecord.hpp>
 #include <Game/GameServerUT/Land/LandAccessorMock.hpp>
+#include <Game/GameServerUT/Persistence/BatchVisitorFake.hpp>
 #include <Game/GameServerUT/Persistence/PersistenceDummy.hpp>
 
 using namespace GameServer::Land;
@@ -37,6 +38,8 @@ using namespace std;
 
 using testing::Return;
 using testing::Throw;
+using testing::DoAll;
+using testing::_;
 
 /**
  * @brief A test class.
@@ -284,6 +287,37 @@ TEST_F(LandPersistenceFacadeTest, getLands_LandsDoExist_ManyLands)
     compareLand(lands[m_land_name_2], m_login_1, m_world_name_2, m_land_name_2, 1, true);
 }
 
+TEST_F(LandPersistenceFacadeTest, visitLands_LandsDoExist_ManyBatches)
+{
+    ITransactionShrPtr transaction(new TransactionDummy);
+
+    LandAccessorMock * mock = new LandAccessorMock;
+
+    ILandRecordMap batch_1;
+    batch_1.insert(make_pair(m_land_name_1, ILandRecordShrPtr(new LandRecord(m_login_1, m_world_name_1, m_land_name_1, 1, false))));
+
+    ILandRecordMap batch_2;
+    batch_2.insert(make_pair(m_land_name_2, ILandRecordShrPtr(new LandRecord(m_login_1, m_world_name_2, m_land_name_2, 1, true))));
+
+    EXPECT_CALL(*mock, visitRecords(transaction, m_login_1, 1, _))
+    .WillOnce(DoAll(VisitBatch(batch_1), VisitBatch(batch_2)));
+
+    ILandAccessorAutPtr accessor(mock);
+
+    LandPersistenceFacade persistence_facade(accessor);
+
+    BatchVisitorFake<ILandMap> visitor;
+
+    persistence_facade.visitLands(transaction, m_login_1, 1, visitor);
+
+    ASSERT_EQ(2, visitor.m_batches.size());
+    ASSERT_EQ(1, visitor.m_batches[0].size());
+    ASSERT_EQ(1, visitor.m_batches[1].size());
+
+    compareLand(visitor.m_batches[0][m_land_name_1], m_login_1, m_world_name_1, m_land_name_1, 1, false);
+    compareLand(visitor.m_batches[1][m_land_name_2], m_login_1, m_world_name_2, m_land_name_2, 1, true);
+}
+
 TEST_F(LandPersistenceFacadeTest, markGranted)
 {
     ITransactionShrPtr transaction(new TransactionDummy);
@@ -0,0 +1,115 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef GAMESERVER_PERSISTENCE_ASYNCQUERYRUNNERFAKE_HPP
+#define GAMESERVER_PERSISTENCE_ASYNCQUERYRUNNERFAKE_HPP
+
+#include <Game/GameServer/Persistence/IAsyncQueryRunner.hpp>
+#include <deque>
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+/**
+ * @brief A fake runner answering the queries at once with the prepared results, in the order of the queries.
+ *
+ * Records the queries, their parameters and deadlines. Rejects the queries once the prepared results have run out.
+ */
+class AsyncQueryRunnerFake
+    : public IAsyncQueryRunner
+{
+public:
+    virtual bool run(
+        std::string              const & a_query,
+        std::vector<std::string> const & a_parameters,
+        unsigned long long int   const   a_deadline,
+        AsyncQueryCallback       const & a_callback
+    )
+    {
+        m_queries.push_back(a_query);
+        m_parameters.push_back(a_parameters);
+        m_deadlines.push_back(a_deadline);
+
+        if (m_results.empty())
+        {
+            return false;
+        }
+
+        AsyncQueryResult const result = m_results.front();
+        m_results.pop_front();
+
+        a_callback(result);
+
+        return true;
+    }
+
+    virtual void stop()
+    {
+    }
+
+    /**
+     * @brief Prepares a successful result.
+     *
+     * @param a_rows The rows of the result.
+     */
+    void succeed(
+        std::vector<AsyncRow> const & a_rows = std::vector<AsyncRow>()
+    )
+    {
+        AsyncQueryResult result;
+        result.m_ok = true;
+        result.m_rows = a_rows;
+
+        m_results.push_back(result);
+    }
+
+    /**
+     * @brief Prepares a failed result.
+     */
+    void fail()
+    {
+        AsyncQueryResult result;
+        result.m_error = "Error.";
+
+        m_results.push_back(result);
+    }
+
+    std::deque<AsyncQueryResult> m_results;
+
+    std::vector<std::string> m_queries;
+
+    std::vector<std::vector<std::string> > m_parameters;
+
+    std::vector<unsigned long long int> m_deadlines;
+};
+
+} // namespace Persistence
+} // namespace GameServer
+
+#endif // GAMESERVER_PERSISTENCE_ASYNCQUERYRUNNERFAKE_HPP
@@ -0,0 +1,72 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef GAMESERVER_PERSISTENCE_BATCHVISITORFAKE_HPP
+#define GAMESERVER_PERSISTENCE_BATCHVISITORFAKE_HPP
+
+#include <Game/GameServer/Persistence/IBatchVisitor.hpp>
+#include <gmock/gmock.h>
+#include <vector>
+
+namespace GameServer
+{
+namespace Persistence
+{
+
+/**
+ * @brief A fake visitor keeping the batches it has been handed over, in their order.
+ */
+template <typename BatchType>
+class BatchVisitorFake
+    : public IBatchVisitor<BatchType>
+{
+public:
+    virtual void visit(
+        BatchType const & a_batch
+    )
+    {
+        m_batches.push_back(a_batch);
+    }
+
+    /**
+     * @brief The batches visited so far.
+     */
+    std::vector<BatchType> m_batches;
+};
+
+/**
+ * @brief The action of a mocked visitRecords method handing a batch over to the visitor, its fourth argument.
+ */
+ACTION_P(VisitBatch, a_batch)
+{
+    arg3.visit(a_batch);
+}
+
+} // namespace Persistence
+} // namespace GameServer
+
+#endif // GAMESERVER_PERSISTENCE_BATCHVISITORFAKE_HPP
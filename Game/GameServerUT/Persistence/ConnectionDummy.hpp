@@ -41,6 +41,10 @@ namespace Persistence
 class ConnectionDummy
     : public IConnection
 {
+public:
+    virtual void cancel()
+    {
+    }
 };
 
 /**
@@ -0,0 +1,285 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/Resource/Executors/AsyncExecutorGetResources.hpp>
+#include <Game/GameServer/Resource/Key.hpp>
+#include <Game/GameServerUT/Persistence/AsyncQueryRunnerFake.hpp>
+#include <Language/Interface/Command.hpp>
+#include <Server/include/Context.hpp>
+#include <boost/bind.hpp>
+#include <gmock/gmock.h>
+
+using namespace Game;
+using namespace GameServer::Persistence;
+using namespace std;
+
+/**
+ * @brief A test class.
+ */
+class AsyncExecutorGetResourcesTest
+    : public testing::Test
+{
+protected:
+    /**
+     * @brief Constructs a test class.
+     */
+    AsyncExecutorGetResourcesTest()
+        : m_context(new Server::Context),
+          m_query_runner(new AsyncQueryRunnerFake),
+          m_request(new Language::Command)
+    {
+        m_request->setID(Language::ID_COMMAND_GET_RESOURCES_REQUEST);
+        m_request->setLogin("Login");
+        m_request->setPassword("Password");
+        m_request->setParam(Language::PARAM_ID_HOLDER_CLASS, "1");
+        m_request->setParam(Language::PARAM_HOLDER_NAME, "Settlement");
+    }
+
+    /**
+     * @brief Prepares the results of the authentication of the user.
+     */
+    void authenticate()
+    {
+        AsyncRow user;
+        user["login"] = "Login";
+        user["password"] = "Password";
+        user["moderator"] = "f";
+
+        m_query_runner->succeed(vector<AsyncRow>(1, user));
+        m_query_runner->succeed(vector<AsyncRow>(1, user));
+    }
+
+    /**
+     * @brief Prepares the results of the authorization of the user to the settlement.
+     */
+    void authorize()
+    {
+        AsyncRow land;
+        land["land_name"] = "Land";
+
+        m_query_runner->succeed(vector<AsyncRow>(1, land));
+        m_query_runner->succeed(vector<AsyncRow>(1, land));
+    }
+
+    /**
+     * @brief Prepares the result of the verification of the epoch.
+     *
+     * @param a_active Whether the epoch is active.
+     */
+    void epoch(
+        bool const a_active
+    )
+    {
+        AsyncRow epoch;
+        epoch["active"] = a_active ? "t" : "f";
+
+        m_query_runner->succeed(vector<AsyncRow>(1, epoch));
+    }
+
+    /**
+     * @brief Executes the request.
+     */
+    void execute()
+    {
+        IAsyncExecutorShrPtr executor(new AsyncExecutorGetResources(m_context, m_query_runner));
+
+        executor->start(m_request, boost::bind(&AsyncExecutorGetResourcesTest::complete, this, _1));
+    }
+
+    /**
+     * @brief Receives the reply.
+     *
+     * @param a_reply The reply.
+     */
+    void complete(
+        Language::ICommand::Handle a_reply
+    )
+    {
+        m_replies.push_back(a_reply);
+    }
+
+    Server::IContextShrPtr m_context;
+
+    boost::shared_ptr<AsyncQueryRunnerFake> m_query_runner;
+
+    Language::ICommand::Handle m_request;
+
+    Language::ICommand::Commands m_replies;
+};
+
+TEST_F(AsyncExecutorGetResourcesTest, ResourcesAreGot)
+{
+    authenticate();
+    authorize();
+    epoch(true);
+
+    vector<AsyncRow> resources(2);
+    resources[0]["resource_key"] = GameServer::Resource::KEY_RESOURCE_WOOD;
+    resources[0]["volume"] = "20";
+    resources[1]["resource_key"] = GameServer::Resource::KEY_RESOURCE_COAL;
+    resources[1]["volume"] = "10";
+    m_query_runner->succeed(resources);
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_OK, m_replies.front()->getCode());
+    ASSERT_EQ(GET_RESOURCES_RESOURCES_HAVE_BEEN_GOT, m_replies.front()->getMessage());
+
+    Language::Rows const & rows = m_replies.front()->getRows();
+
+    ASSERT_EQ(2U, rows.getRowCount());
+    ASSERT_EQ(
+        m_context->getConfiguratorResource()->getResource(GameServer::Resource::KEY_RESOURCE_COAL)->getName(),
+        rows.getValue(0, Language::RESOURCE_COLUMN_RESOURCENAME)
+    );
+    ASSERT_EQ("10", rows.getValue(0, Language::RESOURCE_COLUMN_VOLUME));
+    ASSERT_EQ(
+        m_context->getConfiguratorResource()->getResource(GameServer::Resource::KEY_RESOURCE_WOOD)->getName(),
+        rows.getValue(1, Language::RESOURCE_COLUMN_RESOURCENAME)
+    );
+    ASSERT_EQ("20", rows.getValue(1, Language::RESOURCE_COLUMN_VOLUME));
+}
+
+TEST_F(AsyncExecutorGetResourcesTest, QueriesAreParameterized)
+{
+    authenticate();
+    authorize();
+    epoch(true);
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(6U, m_query_runner->m_parameters.size());
+    ASSERT_EQ(vector<string>(1, "Settlement"), m_query_runner->m_parameters[2]);
+    ASSERT_EQ(2U, m_query_runner->m_parameters[3].size());
+    ASSERT_EQ("Login", m_query_runner->m_parameters[3][0]);
+    ASSERT_EQ("Land", m_query_runner->m_parameters[3][1]);
+    ASSERT_EQ(vector<string>(1, "Land"), m_query_runner->m_parameters[4]);
+    ASSERT_EQ(vector<string>(1, "Settlement"), m_query_runner->m_parameters[5]);
+}
+
+TEST_F(AsyncExecutorGetResourcesTest, NoResourcesAreGot)
+{
+    authenticate();
+    authorize();
+    epoch(true);
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_OK, m_replies.front()->getCode());
+    ASSERT_EQ(GET_RESOURCES_RESOURCES_HAVE_BEEN_GOT, m_replies.front()->getMessage());
+    ASSERT_EQ(0U, m_replies.front()->getRows().getRowCount());
+}
+
+TEST_F(AsyncExecutorGetResourcesTest, UnknownSettlementIsUnauthorized)
+{
+    authenticate();
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_UNAUTHORIZED, m_replies.front()->getCode());
+    ASSERT_EQ(3U, m_query_runner->m_queries.size());
+}
+
+TEST_F(AsyncExecutorGetResourcesTest, SettlementOfAnotherUserIsUnauthorized)
+{
+    authenticate();
+
+    AsyncRow land;
+    land["land_name"] = "Land";
+    m_query_runner->succeed(vector<AsyncRow>(1, land));
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_UNAUTHORIZED, m_replies.front()->getCode());
+    ASSERT_EQ(4U, m_query_runner->m_queries.size());
+}
+
+TEST_F(AsyncExecutorGetResourcesTest, InactiveEpochIsReported)
+{
+    authenticate();
+    authorize();
+    epoch(false);
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_EPOCH_IS_NOT_ACTIVE, m_replies.front()->getCode());
+    ASSERT_EQ(5U, m_query_runner->m_queries.size());
+}
+
+TEST_F(AsyncExecutorGetResourcesTest, MissingEpochIsReportedAsInactive)
+{
+    authenticate();
+    authorize();
+    m_query_runner->succeed();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_EPOCH_IS_NOT_ACTIVE, m_replies.front()->getCode());
+}
+
+TEST_F(AsyncExecutorGetResourcesTest, FailedQueryIsUnexpectedError)
+{
+    authenticate();
+    authorize();
+    epoch(true);
+    m_query_runner->fail();
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_OK, m_replies.front()->getCode());
+    ASSERT_EQ(GET_RESOURCES_UNEXPECTED_ERROR, m_replies.front()->getMessage());
+}
+
+TEST_F(AsyncExecutorGetResourcesTest, UnknownResourceIsUnexpectedError)
+{
+    authenticate();
+    authorize();
+    epoch(true);
+
+    AsyncRow resource;
+    resource["resource_key"] = "unknown";
+    resource["volume"] = "1";
+    m_query_runner->succeed(vector<AsyncRow>(1, resource));
+
+    execute();
+
+    ASSERT_EQ(1U, m_replies.size());
+    ASSERT_EQ(REPLY_STATUS_OK, m_replies.front()->getCode());
+    ASSERT_EQ(GET_RESOURCES_UNEXPECTED_ERROR, m_replies.front()->getMessage());
+}
@@ -108,6 +108,24 @@ public:
             Land::ILandShrPtr               const a_land
         )
     );
+
+    /**
+     * @brief Visits settlements in batches, ordered by the name of the settlement.
+     *
+     * @param a_transaction The transaction.
+     * @param a_land        The land.
+     * @param a_batch_size  The maximum number of settlements in a batch.
+     * @param a_visitor     The visitor of the batches.
+     */
+    MOCK_CONST_METHOD4(
+        visitSettlements,
+        void(
+            Persistence::ITransactionShrPtr                    a_transaction,
+            Land::ILandShrPtr                          const   a_land,
+            unsigned int                               const   a_batch_size,
+            Persistence::IBatchVisitor<ISettlementMap>       & a_visitor
+        )
+    );
 };
 
 } // namespace Settlement
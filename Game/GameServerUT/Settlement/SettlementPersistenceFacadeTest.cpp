@@ -28,6 +28,7 @@
 #include <Game/GameServer/Land/Land.hpp>
 #include <Game/GameServer/Settlement/SettlementPersistenceFacade.hpp>
 #include <Game/GameServer/Settlement/SettlementRecord.hpp>
+#include <Game/GameServerUT/Persistence/BatchVisitorFake.hpp>
 #include <Game/GameServerUT/Persistence/TransactionDummy.hpp>
 #include <Game/GameServerUT/Settlement/Operators/CreateSettlement/BehaviourGiveGrantMock.hpp>
 #include <Game/GameServerUT/Settlement/SettlementAccessorMock.hpp>
@@ -41,6 +42,7 @@ using namespace std;
 using testing::Return;
 using testing::Throw;
 using testing::_;
+using testing::DoAll;
 
 /**
  * @brief A test class.
@@ -283,3 +285,54 @@ TEST_F(SettlementPersistenceFacadeTest, getSettlements_SettlementsDoExist_ManySe
     compareSettlement(settlements[m_settlement_name_1], m_land_name_2, m_settlement_name_1);
     compareSettlement(settlements[m_settlement_name_2], m_land_name_2, m_settlement_name_2);
 }
+
+TEST_F(SettlementPersistenceFacadeTest, visitSettlements_LandDoesNotExist)
+{
+    ITransactionShrPtr transaction(new TransactionDummy);
+
+    SettlementAccessorMock * mock = new SettlementAccessorMock;
+
+    EXPECT_CALL(*mock, visitRecords(_, _, _, _))
+    .Times(0);
+
+    ISettlementAccessorAutPtr accessor(mock);
+
+    SettlementPersistenceFacade persistence_facade(accessor);
+
+    BatchVisitorFake<ISettlementMap> visitor;
+
+    persistence_facade.visitSettlements(transaction, ILandShrPtr(), 1, visitor);
+
+    ASSERT_TRUE(visitor.m_batches.empty());
+}
+
+TEST_F(SettlementPersistenceFacadeTest, visitSettlements_SettlementsDoExist_ManyBatches)
+{
+    ITransactionShrPtr transaction(new TransactionDummy);
+
+    SettlementAccessorMock * mock = new SettlementAccessorMock;
+
+    ISettlementRecordMap batch_1;
+    batch_1.insert(make_pair(m_settlement_name_1, ISettlementRecordShrPtr(new SettlementRecord(m_land_name_1, m_settlement_name_1))));
+
+    ISettlementRecordMap batch_2;
+    batch_2.insert(make_pair(m_settlement_name_2, ISettlementRecordShrPtr(new SettlementRecord(m_land_name_1, m_settlement_name_2))));
+
+    EXPECT_CALL(*mock, visitRecords(transaction, m_land_name_1, 1, _))
+    .WillOnce(DoAll(VisitBatch(batch_1), VisitBatch(batch_2)));
+
+    ISettlementAccessorAutPtr accessor(mock);
+
+    SettlementPersistenceFacade persistence_facade(accessor);
+
+    BatchVisitorFake<ISettlementMap> visitor;
+
+    persistence_facade.visitSettlements(transaction, m_land_1, 1, visitor);
+
+    ASSERT_EQ(2, visitor.m_batches.size());
+    ASSERT_EQ(1, visitor.m_batches[0].size());
+    ASSERT_EQ(1, visitor.m_batches[1].size());
+
+    compareSettlement(visitor.m_batches[0][m_settlement_name_1], m_land_name_1, m_settlement_name_1);
+    compareSettlement(visitor.m_batches[1][m_settlement_name_2], m_land_name_1, m_settlement_name_2);
+}
@@ -0,0 +1,193 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Arena.hpp>
+#include <algorithm>
+
+namespace Language
+{
+
+namespace
+{
+
+/**
+ * @brief The types of the strictest alignment.
+ */
+union MaxAlign
+{
+    long double m_long_double;
+    long long int m_long_long_int;
+    void * m_pointer;
+    void (*m_function)();
+};
+
+/**
+ * @brief The alignment of every allocation.
+ */
+std::size_t const ALIGNMENT = sizeof(MaxAlign);
+
+/**
+ * @brief The current arena of the thread.
+ */
+__thread Arena * CURRENT_ARENA = 0;
+
+} // namespace
+
+Arena::Arena(
+    std::size_t const a_block_size
+)
+    : m_block_size(a_block_size),
+      m_block(0),
+      m_offset(0),
+      m_allocation_count(0),
+      m_allocated_size(0),
+      m_live_count(1)
+{
+}
+
+Arena::~Arena()
+{
+    // An object outliving its arena would be freed into released memory, the blocks are leaked instead.
+    if (m_live_count.value() > 1)
+    {
+        return;
+    }
+
+    for (std::vector<Block>::iterator it = m_blocks.begin(); it != m_blocks.end(); ++it)
+    {
+        ::operator delete(it->m_data);
+    }
+}
+
+void * Arena::allocate(
+    std::size_t const a_size
+)
+{
+    std::size_t const size = (a_size + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+
+    // The blocks kept from the previous requests are filled in turn before a new one is allocated.
+    while (m_block < m_blocks.size() and m_blocks[m_block].m_size - m_offset < size)
+    {
+        ++m_block;
+        m_offset = 0;
+    }
+
+    if (m_block == m_blocks.size())
+    {
+        Block const block = { 0, std::max(m_block_size, size) };
+        m_blocks.push_back(block);
+        m_blocks.back().m_data = static_cast<char *>(::operator new(block.m_size));
+        m_offset = 0;
+    }
+
+    void * const memory = m_blocks[m_block].m_data + m_offset;
+    m_offset += size;
+
+    ++m_allocation_count;
+    m_allocated_size += size;
+    ++m_live_count;
+
+    return memory;
+}
+
+void Arena::deallocate()
+{
+    // The last object of an abandoned arena destroys it.
+    if (--m_live_count == 0)
+    {
+        delete this;
+    }
+}
+
+void Arena::abandon()
+{
+    if (--m_live_count == 0)
+    {
+        delete this;
+    }
+}
+
+bool Arena::reset()
+{
+    if (m_live_count.value() > 1)
+    {
+        return false;
+    }
+
+    // The regular blocks are kept in place, the oversized ones are freed.
+    std::size_t kept = 0;
+
+    for (std::size_t i = 0; i < m_blocks.size(); ++i)
+    {
+        if (m_blocks[i].m_size > m_block_size)
+        {
+            ::operator delete(m_blocks[i].m_data);
+        }
+        else
+        {
+            m_blocks[kept++] = m_blocks[i];
+        }
+    }
+
+    m_blocks.resize(kept);
+    m_block = 0;
+    m_offset = 0;
+    m_allocation_count = 0;
+    m_allocated_size = 0;
+
+    return true;
+}
+
+std::size_t Arena::getAllocationCount() const
+{
+    return m_allocation_count;
+}
+
+std::size_t Arena::getAllocatedSize() const
+{
+    return m_allocated_size;
+}
+
+Arena * Arena::getCurrent()
+{
+    return CURRENT_ARENA;
+}
+
+ArenaScope::ArenaScope(
+    Arena * a_arena
+)
+    : m_previous(CURRENT_ARENA)
+{
+    CURRENT_ARENA = a_arena;
+}
+
+ArenaScope::~ArenaScope()
+{
+    CURRENT_ARENA = m_previous;
+}
+
+} // namespace Language
@@ -0,0 +1,329 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef LANGUAGE_ARENA_HPP
+#define LANGUAGE_ARENA_HPP
+
+#include <Poco/AtomicCounter.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace Language
+{
+
+/**
+ * @brief The monotonic arena of a request.
+ *
+ * The objects living as long as the request are bump-allocated from blocks kept from one request to the next, and
+ * given back all at once by a reset. Freeing an object only counts it out, so a reset never rewinds the arena under
+ * an object that has outlived its request: the arena goes on bumping instead, until a later reset finds it empty.
+ *
+ * An arena made on the heap is given up by abandon() rather than deleted, so that it lives on until its last object
+ * has been freed: the objects keep a plain pointer to their arena.
+ *
+ * The arena is filled by one thread at a time, the objects may be freed from any thread.
+ */
+class Arena
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs an arena.
+     *
+     * @param a_block_size The size of a block.
+     */
+    explicit Arena(
+        std::size_t const a_block_size = 16384
+    );
+
+    /**
+     * @brief Destructs the arena, leaving its blocks in place if any of its objects is still alive.
+     */
+    ~Arena();
+
+    /**
+     * @brief Gives up an arena made on the heap, it is destroyed once none of its objects is alive.
+     */
+    void abandon();
+
+    /**
+     * @brief Allocates memory aligned for any object.
+     *
+     * @param a_size The size of the memory.
+     *
+     * @return The memory.
+     *
+     * @throw std::bad_alloc If a block could not be allocated.
+     */
+    void * allocate(
+        std::size_t const a_size
+    );
+
+    /**
+     * @brief Counts the memory out, it is reclaimed by the reset.
+     */
+    void deallocate();
+
+    /**
+     * @brief Rewinds the arena, unless any of its objects is still alive.
+     *
+     * The blocks larger than the regular ones, allocated for exceptionally large objects, are freed.
+     *
+     * @return True if the arena has been rewound, false otherwise.
+     */
+    bool reset();
+
+    /**
+     * @brief Gets the number of the allocations since the last rewind.
+     *
+     * @return The number of the allocations.
+     */
+    std::size_t getAllocationCount() const;
+
+    /**
+     * @brief Gets the number of the bytes allocated since the last rewind.
+     *
+     * @return The number of the bytes.
+     */
+    std::size_t getAllocatedSize() const;
+
+    /**
+     * @brief Gets the arena the calling thread allocates the objects of its request from.
+     *
+     * @return The arena, null if none.
+     */
+    static Arena * getCurrent();
+
+private:
+    struct Block
+    {
+        char * m_data;
+
+        std::size_t m_size;
+    };
+
+    /**
+     * @brief The size of a regular block.
+     */
+    std::size_t const m_block_size;
+
+    /**
+     * @brief The blocks, the regular ones first.
+     */
+    std::vector<Block> m_blocks;
+
+    /**
+     * @brief The block being filled.
+     */
+    std::size_t m_block;
+
+    /**
+     * @brief The offset of the free space in the block being filled.
+     */
+    std::size_t m_offset;
+
+    /**
+     * @brief The number of the allocations since the last rewind.
+     */
+    std::size_t m_allocation_count;
+
+    /**
+     * @brief The number of the bytes allocated since the last rewind.
+     */
+    std::size_t m_allocated_size;
+
+    /**
+     * @brief The number of the objects still alive, plus one until the arena is abandoned.
+     */
+    Poco::AtomicCounter m_live_count;
+};
+
+typedef boost::shared_ptr<Arena> ArenaShrPtr;
+
+/**
+ * @brief Makes an arena the current one of the calling thread for the lifetime of the scope.
+ */
+class ArenaScope
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Makes an arena the current one.
+     *
+     * @param a_arena The arena, null to allocate from the heap.
+     */
+    explicit ArenaScope(
+        Arena * a_arena
+    );
+
+    /**
+     * @brief Restores the arena that has been the current one before.
+     */
+    ~ArenaScope();
+
+private:
+    Arena * const m_previous;
+};
+
+/**
+ * @brief The allocator of the objects from an arena, from the heap if there is none.
+ *
+ * Meant for boost::allocate_shared, so that an object and its reference count take a single bump of the arena.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+    typedef T value_type;
+    typedef T * pointer;
+    typedef T const * const_pointer;
+    typedef T & reference;
+    typedef T const & const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+        typedef ArenaAllocator<U> other;
+    };
+
+    /**
+     * @brief Constructs the allocator from the current arena of the calling thread.
+     */
+    ArenaAllocator()
+        : m_arena(Arena::getCurrent())
+    {
+    }
+
+    explicit ArenaAllocator(
+        Arena * a_arena
+    )
+        : m_arena(a_arena)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(
+        ArenaAllocator<U> const & a_other
+    )
+        : m_arena(a_other.getArena())
+    {
+    }
+
+    Arena * getArena() const
+    {
+        return m_arena;
+    }
+
+    pointer address(
+        reference a_value
+    ) const
+    {
+        return &a_value;
+    }
+
+    const_pointer address(
+        const_reference a_value
+    ) const
+    {
+        return &a_value;
+    }
+
+    pointer allocate(
+        size_type   const a_count,
+        void const *      = 0
+    )
+    {
+        std::size_t const size = a_count * sizeof(T);
+
+        return static_cast<pointer>(m_arena ? m_arena->allocate(size) : ::operator new(size));
+    }
+
+    void deallocate(
+        pointer         a_pointer,
+        size_type const
+    )
+    {
+        if (m_arena)
+        {
+            m_arena->deallocate();
+        }
+        else
+        {
+            ::operator delete(a_pointer);
+        }
+    }
+
+    size_type max_size() const
+    {
+        return static_cast<size_type>(-1) / sizeof(T);
+    }
+
+    void construct(
+        pointer         a_pointer,
+        const_reference a_value
+    )
+    {
+        new (a_pointer) T(a_value);
+    }
+
+    void destroy(
+        pointer a_pointer
+    )
+    {
+        a_pointer->~T();
+    }
+
+private:
+    Arena * m_arena;
+};
+
+template <typename T, typename U>
+bool operator==(
+    ArenaAllocator<T> const & a_left,
+    ArenaAllocator<U> const & a_right
+)
+{
+    return a_left.getArena() == a_right.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(
+    ArenaAllocator<T> const & a_left,
+    ArenaAllocator<U> const & a_right
+)
+{
+    return a_left.getArena() != a_right.getArena();
+}
+
+} // namespace Language
+
+#endif // LANGUAGE_ARENA_HPP
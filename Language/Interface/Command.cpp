@@ -25,13 +25,67 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Language/Interface/Arena.hpp>
 #include <Language/Interface/Command.hpp>
+#include <boost/make_shared.hpp>
+#include <limits>
+#include <stdexcept>
 
 namespace Language
 {
 
+namespace
+{
+
+/**
+ * @brief Parses a number sent as text, the digits only, with no sign and no spaces.
+ *
+ * @param a_text  The text.
+ * @param a_value The number, if parsed.
+ *
+ * @return True if the text is a number within the range of the value, false otherwise.
+ */
+bool parseNumber(
+    std::string  const & a_text,
+    unsigned int       & a_value
+)
+{
+    if (a_text.empty())
+    {
+        return false;
+    }
+
+    unsigned int value = 0;
+
+    for (std::string::const_iterator it = a_text.begin(); it != a_text.end(); ++it)
+    {
+        if (*it < '0' || *it > '9')
+        {
+            return false;
+        }
+
+        unsigned int const digit = static_cast<unsigned int>(*it - '0');
+
+        if (value > (std::numeric_limits<unsigned int>::max() - digit) / 10)
+        {
+            return false;
+        }
+
+        value = value * 10 + digit;
+    }
+
+    a_value = value;
+
+    return true;
+}
+
+} // namespace
+
 Command::Command()
     : m_id(0),
+      m_timeout(0),
+      m_deadline(0),
+      m_param_count(0),
       m_code(0)
 {
 }
@@ -72,11 +126,66 @@ void Command::setPassword(
     m_password = a_password;
 }
 
+std::string Command::getSessionToken() const
+{
+    return m_session_token;
+}
+
+void Command::setSessionToken(
+    std::string const a_session_token
+)
+{
+    m_session_token = a_session_token;
+}
+
+unsigned int Command::getTimeout() const
+{
+    return m_timeout;
+}
+
+void Command::setTimeout(
+    unsigned int const a_timeout
+)
+{
+    m_timeout = a_timeout;
+}
+
+unsigned long long int Command::getDeadline() const
+{
+    return m_deadline;
+}
+
+void Command::setDeadline(
+    unsigned long long int const a_deadline
+)
+{
+    m_deadline = a_deadline;
+}
+
+std::string Command::getIdempotencyKey() const
+{
+    return m_idempotency_key;
+}
+
+void Command::setIdempotencyKey(
+    std::string const a_idempotency_key
+)
+{
+    m_idempotency_key = a_idempotency_key;
+}
+
 std::string Command::getParam(
     std::string const a_param_name
 ) const
 {
-    return m_parameters.at(a_param_name);
+    ParamKey param_key;
+
+    if (!findParamKey(a_param_name, param_key))
+    {
+        throw std::out_of_range(a_param_name);
+    }
+
+    return getParam(param_key);
 }
 
 void Command::setParam(
@@ -84,7 +193,89 @@ void Command::setParam(
     std::string const a_param_value
 )
 {
-    m_parameters[a_param_name] = a_param_value;
+    ParamKey param_key;
+
+    if (!findParamKey(a_param_name, param_key))
+    {
+        throw std::out_of_range(a_param_name);
+    }
+
+    setParam(param_key, a_param_value);
+}
+
+std::string const & Command::getParam(
+    ParamKey const a_param_key
+) const
+{
+    return findParam(a_param_key).m_value;
+}
+
+void Command::setParam(
+    ParamKey    const   a_param_key,
+    std::string const & a_param_value
+)
+{
+    Param * param = m_params;
+
+    while (param != m_params + m_param_count && param->m_key != a_param_key)
+    {
+        ++param;
+    }
+
+    if (param == m_params + m_param_count)
+    {
+        if (m_param_count == MAX_PARAMS)
+        {
+            throw std::length_error(getParamName(a_param_key));
+        }
+
+        ++m_param_count;
+        param->m_key = a_param_key;
+    }
+
+    param->m_value = a_param_value;
+
+    switch (getParamType(a_param_key))
+    {
+        case PARAM_TYPE_NUMBER:
+            param->m_parsed = parseNumber(a_param_value, param->m_typed_value);
+            break;
+
+        case PARAM_TYPE_BOOLEAN:
+            param->m_typed_value = (a_param_value != "0");
+            param->m_parsed = true;
+            break;
+
+        default:
+            param->m_parsed = false;
+            break;
+    }
+}
+
+bool Command::getNumberParam(
+    ParamKey     const   a_param_key,
+    unsigned int       & a_value
+) const
+{
+    Param const & param = findParam(a_param_key);
+
+    if (getParamType(a_param_key) != PARAM_TYPE_NUMBER || !param.m_parsed)
+    {
+        return false;
+    }
+
+    a_value = param.m_typed_value;
+
+    return true;
+}
+
+bool Command::getBooleanParam(
+    ParamKey const a_param_key
+) const
+{
+    Param const & param = findParam(a_param_key);
+
+    return param.m_parsed ? (param.m_typed_value != 0) : (param.m_value != "0");
 }
 
 unsigned short int Command::getCode() const
@@ -113,6 +304,25 @@ void Command::setMessage(
 
 ICommand::Objects const & Command::getObjects() const
 {
+    std::size_t const row_count = m_rows.getRowCount();
+
+    if (m_objects.empty() && row_count)
+    {
+        m_objects.reserve(row_count);
+
+        for (std::size_t row = 0; row < row_count; ++row)
+        {
+            Object object;
+
+            for (unsigned int column = 0; column < m_rows.getColumnCount(); ++column)
+            {
+                object.insert(std::make_pair(m_rows.getKey(column), m_rows.getValue(row, column)));
+            }
+
+            m_objects.push_back(object);
+        }
+    }
+
     return m_objects;
 }
 
@@ -123,4 +333,49 @@ void Command::addObject(
     m_objects.push_back(a_object);
 }
 
+Rows const & Command::getRows() const
+{
+    return m_rows;
+}
+
+void Command::setRows(
+    Rows const & a_rows
+)
+{
+    m_objects.clear();
+    m_rows = a_rows;
+}
+
+ICommand::Commands const & Command::getCommands() const
+{
+    return m_commands;
+}
+
+void Command::addCommand(
+    Handle const a_command
+)
+{
+    m_commands.push_back(a_command);
+}
+
+Command::Param const & Command::findParam(
+    ParamKey const a_param_key
+) const
+{
+    for (unsigned int i = 0; i < m_param_count; ++i)
+    {
+        if (m_params[i].m_key == a_param_key)
+        {
+            return m_params[i];
+        }
+    }
+
+    throw std::out_of_range(getParamName(a_param_key));
+}
+
+ICommand::Handle createCommand()
+{
+    return boost::allocate_shared<Command>(ArenaAllocator<Command>());
+}
+
 } // namespace Language
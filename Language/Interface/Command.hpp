@@ -88,6 +88,70 @@ public:
         std::string const a_password
     );
 
+    /**
+     * @brief Gets the session token of the user.
+     *
+     * @return The session token of the user, an empty string if not set.
+     */
+    virtual std::string getSessionToken() const;
+
+    /**
+     * @brief Sets the session token of the user.
+     *
+     * @param a_session_token The session token of the user.
+     */
+    virtual void setSessionToken(
+        std::string const a_session_token
+    );
+
+    /**
+     * @brief Gets the time the client is willing to wait for the reply.
+     *
+     * @return The timeout (in milliseconds), 0 if not set.
+     */
+    virtual unsigned int getTimeout() const;
+
+    /**
+     * @brief Sets the time the client is willing to wait for the reply.
+     *
+     * @param a_timeout The timeout (in milliseconds), 0 if not set.
+     */
+    virtual void setTimeout(
+        unsigned int const a_timeout
+    );
+
+    /**
+     * @brief Gets the moment after which the reply is of no use to the client.
+     *
+     * @return The deadline (in microseconds since the epoch), 0 if none.
+     */
+    virtual unsigned long long int getDeadline() const;
+
+    /**
+     * @brief Sets the moment after which the reply is of no use to the client.
+     *
+     * @param a_deadline The deadline (in microseconds since the epoch), 0 if none.
+     */
+    virtual void setDeadline(
+        unsigned long long int const a_deadline
+    );
+
+    /**
+     * @brief Gets the key by which the retries of the request are recognized.
+     *
+     * @return The idempotency key, an empty string if not set.
+     */
+    virtual std::string getIdempotencyKey() const;
+
+    /**
+     * @brief Sets the key by which the retries of the request are recognized.
+     *
+     * @param a_idempotency_key The idempotency key, an empty string if not set.
+     */
+    virtual void setIdempotencyKey(
+        std::string const a_idempotency_key
+    );
+
     /**
      * @brief Gets the value of the parameter.
      *
@@ -106,12 +170,68 @@ public:
      *
      * @param a_param_name  The name of the parameter.
      * @param a_param_value The value of the parameter.
+     *
+     * @throw std::out_of_range If the parameter does not belong to the schema.
      */
     virtual void setParam(
         std::string const a_param_name,
         std::string const a_param_value
     );
 
+    /**
+     * @brief Gets the value of the parameter by its key, with no lookup by name and no copy.
+     *
+     * @param a_param_key The key of the parameter.
+     *
+     * @return The value of the parameter, valid as long as the command is not modified.
+     *
+     * @throw std::out_of_range If no such parameter is present.
+     */
+    virtual std::string const & getParam(
+        ParamKey const a_param_key
+    ) const;
+
+    /**
+     * @brief Sets the parameter by its key.
+     *
+     * @param a_param_key   The key of the parameter.
+     * @param a_param_value The value of the parameter.
+     *
+     * @throw std::length_error If the command carries the most parameters already.
+     */
+    virtual void setParam(
+        ParamKey    const   a_param_key,
+        std::string const & a_param_value
+    );
+
+    /**
+     * @brief Gets the value of a numeric parameter, parsed once when the parameter has been set.
+     *
+     * @param a_param_key The key of the parameter.
+     * @param a_value     The value of the parameter, if it is a number.
+     *
+     * @return True if the value is a number, false otherwise.
+     *
+     * @throw std::out_of_range If no such parameter is present.
+     */
+    virtual bool getNumberParam(
+        ParamKey     const   a_param_key,
+        unsigned int       & a_value
+    ) const;
+
+    /**
+     * @brief Gets the value of a boolean parameter, any value but "0" is true.
+     *
+     * @param a_param_key The key of the parameter.
+     *
+     * @return The value of the parameter.
+     *
+     * @throw std::out_of_range If no such parameter is present.
+     */
+    virtual bool getBooleanParam(
+        ParamKey const a_param_key
+    ) const;
+
     /**
      * @brief Gets the exit code of the command.
      *
@@ -147,7 +267,7 @@ public:
     /**
      * @brief Gets the objects.
      *
-     * @return The objects.
+     * @return The objects, made of the rows if the command carries rows.
      */
     virtual Objects const & getObjects() const;
 
@@ -160,6 +280,38 @@ public:
         Object const & a_object
     );
 
+    /**
+     * @brief Gets the objects of a collection reply stored by column.
+     *
+     * @return The rows, with no columns if the command carries its objects one by one.
+     */
+    virtual Rows const & getRows() const;
+
+    /**
+     * @brief Sets the objects of a collection reply stored by column, in place of the objects added one by one.
+     *
+     * @param a_rows The rows.
+     */
+    virtual void setRows(
+        Rows const & a_rows
+    );
+
+    /**
+     * @brief Gets the sub-commands of a batch command.
+     *
+     * @return The sub-commands, in order.
+     */
+    virtual Commands const & getCommands() const;
+
+    /**
+     * @brief Appends a sub-command to a batch command.
+     *
+     * @param a_command The sub-command.
+     */
+    virtual void addCommand(
+        Handle const a_command
+    );
+
 private:
     /**
      * @brief The identifier of the command.
@@ -177,9 +329,67 @@ private:
     std::string m_password;
 
     /**
-     * @brief The map of parameters.
+     * @brief The session token of the user, an empty string if not set.
+     */
+    std::string m_session_token;
+
+    /**
+     * @brief The time (in milliseconds) the client is willing to wait for the reply, 0 if not set.
      */
-    std::map<std::string, std::string> m_parameters;
+    unsigned int m_timeout;
+
+    /**
+     * @brief The deadline (in microseconds since the epoch), 0 if none.
+     */
+    unsigned long long int m_deadline;
+
+    /**
+     * @brief The idempotency key of the request, an empty string if not set.
+     */
+    std::string m_idempotency_key;
+
+    /**
+     * @brief A parameter of the schema, stored in place.
+     *
+     * The text is kept as it is sent, the numbers and the booleans are parsed into the typed value as they are set.
+     */
+    struct Param
+    {
+        ParamKey m_key;
+
+        std::string m_value;
+
+        /**
+         * @brief The number, or one or zero for a boolean, valid if the value has been parsed.
+         */
+        unsigned int m_typed_value;
+
+        bool m_parsed;
+    };
+
+    /**
+     * @brief Finds a parameter of the schema.
+     *
+     * @throw std::out_of_range If no such parameter is present.
+     */
+    Param const & findParam(
+        ParamKey const a_param_key
+    ) const;
+
+    /**
+     * @brief The most parameters any command of the schema carries.
+     */
+    static unsigned int const MAX_PARAMS = 4;
+
+    /**
+     * @brief The parameters of the schema, in the order they have been set.
+     */
+    Param m_params[MAX_PARAMS];
+
+    /**
+     * @brief The number of the parameters of the schema.
+     */
+    unsigned int m_param_count;
 
     /**
      * @brief The exit code of the command.
@@ -192,11 +402,28 @@ private:
     std::string m_message;
 
     /**
-     * @brief The objects.
+     * @brief The objects, made of the rows on demand if the command carries rows.
      */
-    Objects m_objects;
+    mutable Objects m_objects;
+
+    /**
+     * @brief The objects of a collection reply stored by column.
+     */
+    Rows m_rows;
+
+    /**
+     * @brief The sub-commands.
+     */
+    Commands m_commands;
 };
 
+/**
+ * @brief Creates a command in the current arena of the calling thread, on the heap if there is none.
+ *
+ * @return The command, with its reference count in the same allocation.
+ */
+ICommand::Handle createCommand();
+
 } // namespace Language
 
 #endif // LANGUAGE_COMMAND_HPP
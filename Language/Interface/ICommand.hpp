@@ -28,6 +28,8 @@
 #ifndef LANGUAGE_ICOMMAND_HPP
 #define LANGUAGE_ICOMMAND_HPP
 
+#include <Language/Interface/ParamKey.hpp>
+#include <Language/Interface/Rows.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
 #include <string>
@@ -98,6 +100,17 @@ unsigned short int const ID_COMMAND_TICK_EPOCH_REPLY           = 59;
 unsigned short int const ID_COMMAND_GET_EPOCH_REPLY            = 60;
 unsigned short int const ID_COMMAND_TRANSPORT_HUMAN_REPLY      = 61;
 unsigned short int const ID_COMMAND_TRANSPORT_RESOURCE_REPLY   = 62;
+unsigned short int const ID_COMMAND_BATCH_REQUEST              = 63;
+unsigned short int const ID_COMMAND_BATCH_REPLY                = 64;
+unsigned short int const ID_COMMAND_SUBSCRIBE_REQUEST          = 65;
+unsigned short int const ID_COMMAND_SUBSCRIBE_REPLY            = 66;
+unsigned short int const ID_COMMAND_EPOCH_ACTIVATED_INDICATION = 67;
+unsigned short int const ID_COMMAND_EPOCH_DEACTIVATED_INDICATION = 68;
+unsigned short int const ID_COMMAND_TICK_COMPLETED_INDICATION  = 69;
+unsigned short int const ID_COMMAND_LOGIN_REQUEST              = 70;
+unsigned short int const ID_COMMAND_LOGIN_REPLY                = 71;
+unsigned short int const ID_COMMAND_LOGOUT_REQUEST             = 72;
+unsigned short int const ID_COMMAND_LOGOUT_REPLY               = 73;
 
 class ICommand
 {
@@ -105,6 +118,7 @@ public:
     typedef boost::shared_ptr<ICommand> Handle;
     typedef std::map<std::string, std::string> Object;
     typedef std::vector<Object> Objects;
+    typedef std::vector<Handle> Commands;
 
     virtual ~ICommand(){}
 
@@ -156,6 +170,70 @@ public:
         std::string const a_password
     ) = 0;
 
+    /**
+     * @brief Gets the session token of the user.
+     *
+     * @return The session token of the user, an empty string if not set.
+     */
+    virtual std::string getSessionToken() const = 0;
+
+    /**
+     * @brief Sets the session token of the user.
+     *
+     * @param a_session_token The session token of the user.
+     */
+    virtual void setSessionToken(
+        std::string const a_session_token
+    ) = 0;
+
+    /**
+     * @brief Gets the time the client is willing to wait for the reply.
+     *
+     * @return The timeout (in milliseconds), 0 if not set.
+     */
+    virtual unsigned int getTimeout() const = 0;
+
+    /**
+     * @brief Sets the time the client is willing to wait for the reply.
+     *
+     * @param a_timeout The timeout (in milliseconds), 0 if not set.
+     */
+    virtual void setTimeout(
+        unsigned int const a_timeout
+    ) = 0;
+
+    /**
+     * @brief Gets the moment after which the reply is of no use to the client.
+     *
+     * @return The deadline (in microseconds since the epoch), 0 if none.
+     */
+    virtual unsigned long long int getDeadline() const = 0;
+
+    /**
+     * @brief Sets the moment after which the reply is of no use to the client.
+     *
+     * @param a_deadline The deadline (in microseconds since the epoch), 0 if none.
+     */
+    virtual void setDeadline(
+        unsigned long long int const a_deadline
+    ) = 0;
+
+    /**
+     * @brief Gets the key by which the retries of the request are recognized.
+     *
+     * @return The idempotency key, an empty string if not set.
+     */
+    virtual std::string getIdempotencyKey() const = 0;
+
+    /**
+     * @brief Sets the key by which the retries of the request are recognized.
+     *
+     * @param a_idempotency_key The idempotency key, an empty string if not set.
+     */
+    virtual void setIdempotencyKey(
+        std::string const a_idempotency_key
+    ) = 0;
+
     /**
      * @brief Gets the value of the parameter.
      *
@@ -174,12 +252,68 @@ public:
      *
      * @param a_param_name  The name of the parameter.
      * @param a_param_value The value of the parameter.
+     *
+     * @throw std::out_of_range If the parameter does not belong to the schema.
      */
     virtual void setParam(
         std::string const a_param_name,
         std::string const a_param_value
     ) = 0;
 
+    /**
+     * @brief Gets the value of the parameter by its key, with no lookup by name and no copy.
+     *
+     * @param a_param_key The key of the parameter.
+     *
+     * @return The value of the parameter, valid as long as the command is not modified.
+     *
+     * @throw std::out_of_range If no such parameter is present.
+     */
+    virtual std::string const & getParam(
+        ParamKey const a_param_key
+    ) const = 0;
+
+    /**
+     * @brief Sets the parameter by its key.
+     *
+     * @param a_param_key   The key of the parameter.
+     * @param a_param_value The value of the parameter.
+     *
+     * @throw std::length_error If the command carries the most parameters already.
+     */
+    virtual void setParam(
+        ParamKey    const   a_param_key,
+        std::string const & a_param_value
+    ) = 0;
+
+    /**
+     * @brief Gets the value of a numeric parameter, parsed once when the parameter has been set.
+     *
+     * @param a_param_key The key of the parameter.
+     * @param a_value     The value of the parameter, if it is a number.
+     *
+     * @return True if the value is a number, false otherwise.
+     *
+     * @throw std::out_of_range If no such parameter is present.
+     */
+    virtual bool getNumberParam(
+        ParamKey     const   a_param_key,
+        unsigned int       & a_value
+    ) const = 0;
+
+    /**
+     * @brief Gets the value of a boolean parameter, any value but "0" is true.
+     *
+     * @param a_param_key The key of the parameter.
+     *
+     * @return The value of the parameter.
+     *
+     * @throw std::out_of_range If no such parameter is present.
+     */
+    virtual bool getBooleanParam(
+        ParamKey const a_param_key
+    ) const = 0;
+
     /**
      * @brief Gets the exit code of the command.
      *
@@ -215,7 +349,7 @@ public:
     /**
      * @brief Gets the objects.
      *
-     * @return The objects.
+     * @return The objects, made of the rows if the command carries rows.
      */
     virtual Objects const & getObjects() const = 0;
 
@@ -227,6 +361,38 @@ public:
     virtual void addObject(
         Object const & a_object
     ) = 0;
+
+    /**
+     * @brief Gets the objects of a collection reply stored by column.
+     *
+     * @return The rows, with no columns if the command carries its objects one by one.
+     */
+    virtual Rows const & getRows() const = 0;
+
+    /**
+     * @brief Sets the objects of a collection reply stored by column, in place of the objects added one by one.
+     *
+     * @param a_rows The rows.
+     */
+    virtual void setRows(
+        Rows const & a_rows
+    ) = 0;
+
+    /**
+     * @brief Gets the sub-commands of a batch command.
+     *
+     * @return The sub-commands, in order.
+     */
+    virtual Commands const & getCommands() const = 0;
+
+    /**
+     * @brief Appends a sub-command to a batch command.
+     *
+     * @param a_command The sub-command.
+     */
+    virtual void addCommand(
+        Handle const a_command
+    ) = 0;
 };
 
 } // namespace Language
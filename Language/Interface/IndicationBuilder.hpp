@@ -0,0 +1,88 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef LANGUAGE_INDICATIONBUILDER_HPP
+#define LANGUAGE_INDICATIONBUILDER_HPP
+
+#include <Language/Interface/ICommand.hpp>
+#include <boost/noncopyable.hpp>
+#include <Poco/SharedPtr.h>
+
+namespace Language
+{
+
+/**
+ * @brief Builds indications, the commands the server pushes to the subscribers on its own.
+ */
+class IndicationBuilder
+    : boost::noncopyable
+{
+public:
+    /**
+     * Handle to IndicationBuilder object
+     */
+    typedef Poco::SharedPtr<IndicationBuilder> Handle;
+
+    /**
+     * @brief Builds EpochActivatedIndication.
+     *
+     * @param a_world_name The name of the world.
+     *
+     * @return EpochActivatedIndication
+     */
+    ICommand::Handle buildEpochActivatedIndication(
+        std::string const a_world_name
+    ) const;
+
+    /**
+     * @brief Builds EpochDeactivatedIndication.
+     *
+     * @param a_world_name The name of the world.
+     *
+     * @return EpochDeactivatedIndication
+     */
+    ICommand::Handle buildEpochDeactivatedIndication(
+        std::string const a_world_name
+    ) const;
+
+    /**
+     * @brief Builds TickCompletedIndication.
+     *
+     * @param a_world_name The name of the world.
+     * @param a_ticks      The number of ticks of the epoch after the completed tick.
+     *
+     * @return TickCompletedIndication
+     */
+    ICommand::Handle buildTickCompletedIndication(
+        std::string const a_world_name,
+        std::string const a_ticks
+    ) const;
+};
+
+} // namespace Language
+
+#endif // LANGUAGE_INDICATIONBUILDER_HPP
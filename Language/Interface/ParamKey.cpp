@@ -0,0 +1,119 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/ParamKey.hpp>
+
+namespace Language
+{
+
+namespace
+{
+
+/**
+ * @brief The names of the parameters, ordered by key.
+ */
+char const * const PARAM_NAMES[PARAM_COUNT] =
+{
+    "atomic",
+    "buildingkey",
+    "epoch_name",
+    "holder_name",
+    "humankey",
+    "idholderclass",
+    "land_name",
+    "login",
+    "password",
+    "resourcekey",
+    "session_token",
+    "settlement_name",
+    "settlement_name_destination",
+    "settlement_name_source",
+    "ticks",
+    "volume",
+    "world_name"
+};
+
+/**
+ * @brief The types of the values of the parameters, ordered by key.
+ *
+ * The holder class is text, the clients send the names of the classes there.
+ */
+ParamType const PARAM_TYPES[PARAM_COUNT] =
+{
+    PARAM_TYPE_BOOLEAN,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_NUMBER,
+    PARAM_TYPE_NUMBER,
+    PARAM_TYPE_TEXT
+};
+
+} // namespace
+
+char const * getParamName(
+    ParamKey const a_param_key
+)
+{
+    return PARAM_NAMES[a_param_key];
+}
+
+ParamType getParamType(
+    ParamKey const a_param_key
+)
+{
+    return PARAM_TYPES[a_param_key];
+}
+
+bool findParamKey(
+    std::string const & a_param_name,
+    ParamKey          & a_param_key
+)
+{
+    for (unsigned int i = 0; i < PARAM_COUNT; ++i)
+    {
+        if (a_param_name == PARAM_NAMES[i])
+        {
+            a_param_key = static_cast<ParamKey>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace Language
@@ -0,0 +1,112 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef LANGUAGE_PARAMKEY_HPP
+#define LANGUAGE_PARAMKEY_HPP
+
+#include <string>
+
+namespace Language
+{
+
+/**
+ * @brief The keys of the parameters of the commands.
+ *
+ * The single schema of the parameters: a command stores the parameters of the schema in place, addressed by their
+ * keys, and the names are used on the wire only.
+ */
+enum ParamKey
+{
+    PARAM_ATOMIC,
+    PARAM_BUILDING_KEY,
+    PARAM_EPOCH_NAME,
+    PARAM_HOLDER_NAME,
+    PARAM_HUMAN_KEY,
+    PARAM_ID_HOLDER_CLASS,
+    PARAM_LAND_NAME,
+    PARAM_LOGIN,
+    PARAM_PASSWORD,
+    PARAM_RESOURCE_KEY,
+    PARAM_SESSION_TOKEN,
+    PARAM_SETTLEMENT_NAME,
+    PARAM_SETTLEMENT_NAME_DESTINATION,
+    PARAM_SETTLEMENT_NAME_SOURCE,
+    PARAM_TICKS,
+    PARAM_VOLUME,
+    PARAM_WORLD_NAME,
+
+    PARAM_COUNT
+};
+
+/**
+ * @brief The types of the values of the parameters.
+ */
+enum ParamType
+{
+    PARAM_TYPE_TEXT,
+    PARAM_TYPE_NUMBER,
+    PARAM_TYPE_BOOLEAN
+};
+
+/**
+ * @brief Gets the name of a parameter.
+ *
+ * @param a_param_key The key of the parameter.
+ *
+ * @return The name of the parameter.
+ */
+char const * getParamName(
+    ParamKey const a_param_key
+);
+
+/**
+ * @brief Gets the type of the value of a parameter.
+ *
+ * @param a_param_key The key of the parameter.
+ *
+ * @return The type of the value of the parameter.
+ */
+ParamType getParamType(
+    ParamKey const a_param_key
+);
+
+/**
+ * @brief Finds the key of a parameter by its name.
+ *
+ * @param a_param_name The name of the parameter.
+ * @param a_param_key  The key of the parameter, if found.
+ *
+ * @return True if the parameter belongs to the schema, false otherwise.
+ */
+bool findParamKey(
+    std::string const & a_param_name,
+    ParamKey          & a_param_key
+);
+
+} // namespace Language
+
+#endif // LANGUAGE_PARAMKEY_HPP
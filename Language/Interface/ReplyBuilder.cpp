@@ -35,7 +35,7 @@ ICommand::Handle ReplyBuilder::buildEchoReply(
     unsigned short int const a_code
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(32);
     command->setCode(a_code);
     return command;
@@ -45,7 +45,7 @@ ICommand::Handle ReplyBuilder::buildErrorReply(
     unsigned short int const a_code
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(33);
     command->setCode(a_code);
     return command;
@@ -56,7 +56,7 @@ ICommand::Handle ReplyBuilder::buildCreateLandReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(34);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -68,7 +68,7 @@ ICommand::Handle ReplyBuilder::buildDeleteLandReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(35);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -80,7 +80,7 @@ ICommand::Handle ReplyBuilder::buildGetLandReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(36);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -103,7 +103,7 @@ ICommand::Handle ReplyBuilder::buildGetLandsReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(37);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -124,12 +124,23 @@ ICommand::Handle ReplyBuilder::buildGetLandsReply(
     return command;
 }
 
+ICommand::Handle ReplyBuilder::buildGetLandsReply(
+    unsigned short int const   a_code,
+    std::string        const   a_message,
+    Rows               const & a_rows
+) const
+{
+    ICommand::Handle command = buildGetLandsReply(a_code, a_message);
+    command->setRows(a_rows);
+    return command;
+}
+
 ICommand::Handle ReplyBuilder::buildCreateSettlementReply(
     unsigned short int const a_code,
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(38);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -141,7 +152,7 @@ ICommand::Handle ReplyBuilder::buildDeleteSettlementReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(39);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -153,7 +164,7 @@ ICommand::Handle ReplyBuilder::buildGetSettlementReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(40);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -176,7 +187,7 @@ ICommand::Handle ReplyBuilder::buildGetSettlementsReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(41);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -197,12 +208,23 @@ ICommand::Handle ReplyBuilder::buildGetSettlementsReply(
     return command;
 }
 
+ICommand::Handle ReplyBuilder::buildGetSettlementsReply(
+    unsigned short int const   a_code,
+    std::string        const   a_message,
+    Rows               const & a_rows
+) const
+{
+    ICommand::Handle command = buildGetSettlementsReply(a_code, a_message);
+    command->setRows(a_rows);
+    return command;
+}
+
 ICommand::Handle ReplyBuilder::buildBuildBuildingReply(
     unsigned short int const a_code,
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(42);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -214,7 +236,7 @@ ICommand::Handle ReplyBuilder::buildDestroyBuildingReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(43);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -226,7 +248,7 @@ ICommand::Handle ReplyBuilder::buildGetBuildingReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(44);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -249,7 +271,7 @@ ICommand::Handle ReplyBuilder::buildGetBuildingsReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(45);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -270,12 +292,23 @@ ICommand::Handle ReplyBuilder::buildGetBuildingsReply(
     return command;
 }
 
+ICommand::Handle ReplyBuilder::buildGetBuildingsReply(
+    unsigned short int const   a_code,
+    std::string        const   a_message,
+    Rows               const & a_rows
+) const
+{
+    ICommand::Handle command = buildGetBuildingsReply(a_code, a_message);
+    command->setRows(a_rows);
+    return command;
+}
+
 ICommand::Handle ReplyBuilder::buildDismissHumanReply(
     unsigned short int const a_code,
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(46);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -287,7 +320,7 @@ ICommand::Handle ReplyBuilder::buildEngageHumanReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(47);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -299,7 +332,7 @@ ICommand::Handle ReplyBuilder::buildGetHumanReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(48);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -322,7 +355,7 @@ ICommand::Handle ReplyBuilder::buildGetHumansReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(49);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -343,12 +376,23 @@ ICommand::Handle ReplyBuilder::buildGetHumansReply(
     return command;
 }
 
+ICommand::Handle ReplyBuilder::buildGetHumansReply(
+    unsigned short int const   a_code,
+    std::string        const   a_message,
+    Rows               const & a_rows
+) const
+{
+    ICommand::Handle command = buildGetHumansReply(a_code, a_message);
+    command->setRows(a_rows);
+    return command;
+}
+
 ICommand::Handle ReplyBuilder::buildGetResourceReply(
     unsigned short int const a_code,
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(50);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -371,7 +415,7 @@ ICommand::Handle ReplyBuilder::buildGetResourcesReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(51);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -392,12 +436,23 @@ ICommand::Handle ReplyBuilder::buildGetResourcesReply(
     return command;
 }
 
+ICommand::Handle ReplyBuilder::buildGetResourcesReply(
+    unsigned short int const   a_code,
+    std::string        const   a_message,
+    Rows               const & a_rows
+) const
+{
+    ICommand::Handle command = buildGetResourcesReply(a_code, a_message);
+    command->setRows(a_rows);
+    return command;
+}
+
 ICommand::Handle ReplyBuilder::buildCreateUserReply(
     unsigned short int const a_code,
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(52);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -409,7 +464,7 @@ ICommand::Handle ReplyBuilder::buildCreateWorldReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(53);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -421,7 +476,7 @@ ICommand::Handle ReplyBuilder::buildCreateEpochReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(54);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -433,7 +488,7 @@ ICommand::Handle ReplyBuilder::buildDeleteEpochReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(55);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -445,7 +500,7 @@ ICommand::Handle ReplyBuilder::buildActivateEpochReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(56);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -457,7 +512,7 @@ ICommand::Handle ReplyBuilder::buildDeactivateEpochReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(57);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -469,7 +524,7 @@ ICommand::Handle ReplyBuilder::buildFinishEpochReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(58);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -481,7 +536,7 @@ ICommand::Handle ReplyBuilder::buildTickEpochReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(59);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -493,7 +548,7 @@ ICommand::Handle ReplyBuilder::buildGetEpochReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(60);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -516,7 +571,7 @@ ICommand::Handle ReplyBuilder::buildTransportHumanReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(61);
     command->setCode(a_code);
     command->setMessage(a_message);
@@ -528,11 +583,125 @@ ICommand::Handle ReplyBuilder::buildTransportResourceReply(
     std::string        const a_message
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(62);
     command->setCode(a_code);
     command->setMessage(a_message);
     return command;
 }
 
+ICommand::Handle ReplyBuilder::buildBatchReply(
+    unsigned short int const a_code,
+    std::string        const a_message
+) const
+{
+    ICommand::Handle command = createCommand();
+    command->setID(64);
+    command->setCode(a_code);
+    command->setMessage(a_message);
+    return command;
+}
+
+ICommand::Handle ReplyBuilder::buildBatchReply(
+    unsigned short int   const   a_code,
+    std::string          const   a_message,
+    ICommand::Commands   const & a_commands
+) const
+{
+    ICommand::Handle command = createCommand();
+    command->setID(64);
+    command->setCode(a_code);
+    command->setMessage(a_message);
+    for (ICommand::Commands::const_iterator it = a_commands.begin(); it != a_commands.end(); ++it)
+    {
+        command->addCommand(*it);
+    }
+    return command;
+}
+
+ICommand::Handle ReplyBuilder::buildSubscribeReply(
+    unsigned short int const a_code,
+    std::string        const a_message
+) const
+{
+    ICommand::Handle command = createCommand();
+    command->setID(66);
+    command->setCode(a_code);
+    command->setMessage(a_message);
+    return command;
+}
+
+ICommand::Handle ReplyBuilder::buildLoginReply(
+    unsigned short int const a_code,
+    std::string        const a_message,
+    std::string        const a_session_token
+) const
+{
+    ICommand::Handle command = createCommand();
+    command->setID(71);
+    command->setCode(a_code);
+    command->setMessage(a_message);
+    command->setParam(PARAM_SESSION_TOKEN, a_session_token);
+    return command;
+}
+
+ICommand::Handle ReplyBuilder::buildLogoutReply(
+    unsigned short int const a_code,
+    std::string        const a_message
+) const
+{
+    ICommand::Handle command = createCommand();
+    command->setID(73);
+    command->setCode(a_code);
+    command->setMessage(a_message);
+    return command;
+}
+
+ICommand::Handle ReplyBuilder::buildBasicReply(
+    unsigned short int const a_request_id,
+    unsigned short int const a_code,
+    std::string        const a_message
+) const
+{
+    switch (a_request_id)
+    {
+        case ID_COMMAND_ECHO_REQUEST:               return buildEchoReply(a_code);
+        case ID_COMMAND_ERROR_REQUEST:              return buildErrorReply(a_code);
+        case ID_COMMAND_CREATE_LAND_REQUEST:        return buildCreateLandReply(a_code, a_message);
+        case ID_COMMAND_DELETE_LAND_REQUEST:        return buildDeleteLandReply(a_code, a_message);
+        case ID_COMMAND_GET_LAND_REQUEST:           return buildGetLandReply(a_code, a_message);
+        case ID_COMMAND_GET_LANDS_REQUEST:          return buildGetLandsReply(a_code, a_message);
+        case ID_COMMAND_CREATE_SETTLEMENT_REQUEST:  return buildCreateSettlementReply(a_code, a_message);
+        case ID_COMMAND_DELETE_SETTLEMENT_REQUEST:  return buildDeleteSettlementReply(a_code, a_message);
+        case ID_COMMAND_GET_SETTLEMENT_REQUEST:     return buildGetSettlementReply(a_code, a_message);
+        case ID_COMMAND_GET_SETTLEMENTS_REQUEST:    return buildGetSettlementsReply(a_code, a_message);
+        case ID_COMMAND_BUILD_BUILDING_REQUEST:     return buildBuildBuildingReply(a_code, a_message);
+        case ID_COMMAND_DESTROY_BUILDING_REQUEST:   return buildDestroyBuildingReply(a_code, a_message);
+        case ID_COMMAND_GET_BUILDING_REQUEST:       return buildGetBuildingReply(a_code, a_message);
+        case ID_COMMAND_GET_BUILDINGS_REQUEST:      return buildGetBuildingsReply(a_code, a_message);
+        case ID_COMMAND_DISMISS_HUMAN_REQUEST:      return buildDismissHumanReply(a_code, a_message);
+        case ID_COMMAND_ENGAGE_HUMAN_REQUEST:       return buildEngageHumanReply(a_code, a_message);
+        case ID_COMMAND_GET_HUMAN_REQUEST:          return buildGetHumanReply(a_code, a_message);
+        case ID_COMMAND_GET_HUMANS_REQUEST:         return buildGetHumansReply(a_code, a_message);
+        case ID_COMMAND_GET_RESOURCE_REQUEST:       return buildGetResourceReply(a_code, a_message);
+        case ID_COMMAND_GET_RESOURCES_REQUEST:      return buildGetResourcesReply(a_code, a_message);
+        case ID_COMMAND_CREATE_USER_REQUEST:        return buildCreateUserReply(a_code, a_message);
+        case ID_COMMAND_CREATE_WORLD_REQUEST:       return buildCreateWorldReply(a_code, a_message);
+        case ID_COMMAND_CREATE_EPOCH_REQUEST:       return buildCreateEpochReply(a_code, a_message);
+        case ID_COMMAND_DELETE_EPOCH_REQUEST:       return buildDeleteEpochReply(a_code, a_message);
+        case ID_COMMAND_ACTIVATE_EPOCH_REQUEST:     return buildActivateEpochReply(a_code, a_message);
+        case ID_COMMAND_DEACTIVATE_EPOCH_REQUEST:   return buildDeactivateEpochReply(a_code, a_message);
+        case ID_COMMAND_FINISH_EPOCH_REQUEST:       return buildFinishEpochReply(a_code, a_message);
+        case ID_COMMAND_TICK_EPOCH_REQUEST:         return buildTickEpochReply(a_code, a_message);
+        case ID_COMMAND_GET_EPOCH_REQUEST:          return buildGetEpochReply(a_code, a_message);
+        case ID_COMMAND_TRANSPORT_HUMAN_REQUEST:    return buildTransportHumanReply(a_code, a_message);
+        case ID_COMMAND_TRANSPORT_RESOURCE_REQUEST: return buildTransportResourceReply(a_code, a_message);
+        case ID_COMMAND_BATCH_REQUEST:              return buildBatchReply(a_code, a_message);
+        case ID_COMMAND_SUBSCRIBE_REQUEST:          return buildSubscribeReply(a_code, a_message);
+        case ID_COMMAND_LOGIN_REQUEST:              return buildLoginReply(a_code, a_message);
+        case ID_COMMAND_LOGOUT_REQUEST:             return buildLogoutReply(a_code, a_message);
+        default:                                    return buildErrorReply(a_code);
+    }
+}
+
 } // namespace Language
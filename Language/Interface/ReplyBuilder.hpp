@@ -79,6 +79,12 @@ public:
         ICommand::Objects  const & a_objects
     ) const;
 
+    ICommand::Handle buildGetLandsReply(
+        unsigned short int const   a_code,
+        std::string        const   a_message,
+        Rows               const & a_rows
+    ) const;
+
     ICommand::Handle buildCreateSettlementReply(
         unsigned short int const a_code,
         std::string        const a_message = ""
@@ -111,6 +117,12 @@ public:
         ICommand::Objects  const & a_objects
     ) const;
 
+    ICommand::Handle buildGetSettlementsReply(
+        unsigned short int const   a_code,
+        std::string        const   a_message,
+        Rows               const & a_rows
+    ) const;
+
     ICommand::Handle buildBuildBuildingReply(
         unsigned short int const a_code,
         std::string        const a_message = ""
@@ -143,6 +155,12 @@ public:
         ICommand::Objects  const & a_objects
     ) const;
 
+    ICommand::Handle buildGetBuildingsReply(
+        unsigned short int const   a_code,
+        std::string        const   a_message,
+        Rows               const & a_rows
+    ) const;
+
     ICommand::Handle buildDismissHumanReply(
         unsigned short int const a_code,
         std::string        const a_message = ""
@@ -175,6 +193,12 @@ public:
         ICommand::Objects  const & a_objects
     ) const;
 
+    ICommand::Handle buildGetHumansReply(
+        unsigned short int const   a_code,
+        std::string        const   a_message,
+        Rows               const & a_rows
+    ) const;
+
     ICommand::Handle buildGetResourceReply(
         unsigned short int const a_code,
         std::string        const a_message = ""
@@ -197,6 +221,12 @@ public:
         ICommand::Objects  const & a_objects
     ) const;
 
+    ICommand::Handle buildGetResourcesReply(
+        unsigned short int const   a_code,
+        std::string        const   a_message,
+        Rows               const & a_rows
+    ) const;
+
     ICommand::Handle buildCreateUserReply(
         unsigned short int const a_code,
         std::string        const a_message = ""
@@ -257,6 +287,50 @@ public:
         unsigned short int const a_code,
         std::string        const a_message = ""
     ) const;
+
+    ICommand::Handle buildBatchReply(
+        unsigned short int const a_code,
+        std::string        const a_message = ""
+    ) const;
+
+    ICommand::Handle buildBatchReply(
+        unsigned short int   const   a_code,
+        std::string          const   a_message,
+        ICommand::Commands   const & a_commands
+    ) const;
+
+    ICommand::Handle buildSubscribeReply(
+        unsigned short int const a_code,
+        std::string        const a_message = ""
+    ) const;
+
+    ICommand::Handle buildLoginReply(
+        unsigned short int const a_code,
+        std::string        const a_message = "",
+        std::string        const a_session_token = ""
+    ) const;
+
+    ICommand::Handle buildLogoutReply(
+        unsigned short int const a_code,
+        std::string        const a_message = ""
+    ) const;
+
+    /**
+     * @brief Builds the basic reply to a request of a given identifier.
+     *
+     * Used to answer requests that have been turned away before reaching their executors.
+     *
+     * @param a_request_id The identifier of the request.
+     * @param a_code       The exit code of the reply.
+     * @param a_message    The status message of the reply.
+     *
+     * @return The reply, the error reply if the identifier is not an identifier of a request.
+     */
+    ICommand::Handle buildBasicReply(
+        unsigned short int const a_request_id,
+        unsigned short int const a_code,
+        std::string        const a_message = ""
+    ) const;
 };
 
 } // namespace Language
@@ -33,14 +33,14 @@ namespace Language
 
 ICommand::Handle RequestBuilder::buildEchoRequest() const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(1);
     return command;
 }
 
 ICommand::Handle RequestBuilder::buildErrorRequest() const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(2);
     return command;
 }
@@ -52,12 +52,12 @@ ICommand::Handle RequestBuilder::buildCreateLandRequest(
     std::string const a_land_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(3);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("world_name", a_world_name);
-    command->setParam("land_name", a_land_name);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
+    command->setParam(PARAM_LAND_NAME, a_land_name);
     return command;
 }
 
@@ -67,11 +67,11 @@ ICommand::Handle RequestBuilder::buildDeleteLandRequest(
     std::string const a_land_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(4);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("land_name", a_land_name);
+    command->setParam(PARAM_LAND_NAME, a_land_name);
     return command;
 }
 
@@ -81,11 +81,11 @@ ICommand::Handle RequestBuilder::buildGetLandRequest(
     std::string const a_land_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(5);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("land_name", a_land_name);
+    command->setParam(PARAM_LAND_NAME, a_land_name);
     return command;
 }
 
@@ -94,7 +94,7 @@ ICommand::Handle RequestBuilder::buildGetLandsRequest(
     std::string const a_password
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(6);
     command->setLogin(a_login);
     command->setPassword(a_password);
@@ -108,12 +108,12 @@ ICommand::Handle RequestBuilder::buildCreateSettlementRequest(
     std::string const a_settlement_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(7);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("land_name", a_land_name);
-    command->setParam("settlement_name", a_settlement_name);
+    command->setParam(PARAM_LAND_NAME, a_land_name);
+    command->setParam(PARAM_SETTLEMENT_NAME, a_settlement_name);
     return command;
 }
 
@@ -123,11 +123,11 @@ ICommand::Handle RequestBuilder::buildDeleteSettlementRequest(
     std::string const a_settlement_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(8);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("settlement_name", a_settlement_name);
+    command->setParam(PARAM_SETTLEMENT_NAME, a_settlement_name);
     return command;
 }
 
@@ -137,11 +137,11 @@ ICommand::Handle RequestBuilder::buildGetSettlementRequest(
     std::string const a_settlement_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(9);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("settlement_name", a_settlement_name);
+    command->setParam(PARAM_SETTLEMENT_NAME, a_settlement_name);
     return command;
 }
 
@@ -151,11 +151,11 @@ ICommand::Handle RequestBuilder::buildGetSettlementsRequest(
     std::string const a_land_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(10);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("land_name", a_land_name);
+    command->setParam(PARAM_LAND_NAME, a_land_name);
     return command;
 }
 
@@ -168,14 +168,14 @@ ICommand::Handle RequestBuilder::buildBuildBuildingRequest(
     std::string const a_volume
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(11);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
-    command->setParam("buildingkey", a_building_key);
-    command->setParam("volume", a_volume);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
+    command->setParam(PARAM_BUILDING_KEY, a_building_key);
+    command->setParam(PARAM_VOLUME, a_volume);
     return command;
 }
 
@@ -188,14 +188,14 @@ ICommand::Handle RequestBuilder::buildDestroyBuildingRequest(
     std::string const a_volume
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(12);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
-    command->setParam("buildingkey", a_building_key);
-    command->setParam("volume", a_volume);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
+    command->setParam(PARAM_BUILDING_KEY, a_building_key);
+    command->setParam(PARAM_VOLUME, a_volume);
     return command;
 }
 
@@ -207,13 +207,13 @@ ICommand::Handle RequestBuilder::buildGetBuildingRequest(
     std::string const a_building_key
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(13);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
-    command->setParam("buildingkey", a_building_key);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
+    command->setParam(PARAM_BUILDING_KEY, a_building_key);
     return command;
 }
 
@@ -224,12 +224,12 @@ ICommand::Handle RequestBuilder::buildGetBuildingsRequest(
     std::string const a_holder_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(14);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
     return command;
 }
 
@@ -242,14 +242,14 @@ ICommand::Handle RequestBuilder::buildDismissHumanRequest(
     std::string const a_volume
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(15);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
-    command->setParam("humankey", a_human_key);
-    command->setParam("volume", a_volume);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
+    command->setParam(PARAM_HUMAN_KEY, a_human_key);
+    command->setParam(PARAM_VOLUME, a_volume);
     return command;
 }
 
@@ -262,14 +262,14 @@ ICommand::Handle RequestBuilder::buildEngageHumanRequest(
     std::string const a_volume
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(16);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
-    command->setParam("humankey", a_human_key);
-    command->setParam("volume", a_volume);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
+    command->setParam(PARAM_HUMAN_KEY, a_human_key);
+    command->setParam(PARAM_VOLUME, a_volume);
     return command;
 }
 
@@ -281,13 +281,13 @@ ICommand::Handle RequestBuilder::buildGetHumanRequest(
     std::string const a_human_key
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(17);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
-    command->setParam("humankey", a_human_key);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
+    command->setParam(PARAM_HUMAN_KEY, a_human_key);
     return command;
 }
 
@@ -298,12 +298,12 @@ ICommand::Handle RequestBuilder::buildGetHumansRequest(
     std::string const a_holder_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(18);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
     return command;
 }
 
@@ -315,13 +315,13 @@ ICommand::Handle RequestBuilder::buildGetResourceRequest(
     std::string const a_resource_key
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(19);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
-    command->setParam("resourcekey", a_resource_key);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
+    command->setParam(PARAM_RESOURCE_KEY, a_resource_key);
     return command;
 }
 
@@ -332,12 +332,12 @@ ICommand::Handle RequestBuilder::buildGetResourcesRequest(
     std::string const a_holder_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(20);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("idholderclass", a_id_holder_class);
-    command->setParam("holder_name", a_holder_name);
+    command->setParam(PARAM_ID_HOLDER_CLASS, a_id_holder_class);
+    command->setParam(PARAM_HOLDER_NAME, a_holder_name);
     return command;
 }
 
@@ -346,10 +346,10 @@ ICommand::Handle RequestBuilder::buildCreateUserRequest(
     std::string const a_password
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(21);
-    command->setParam("login", a_login);
-    command->setParam("password", a_password);
+    command->setParam(PARAM_LOGIN, a_login);
+    command->setParam(PARAM_PASSWORD, a_password);
     return command;
 }
 
@@ -359,11 +359,11 @@ ICommand::Handle RequestBuilder::buildCreateWorldRequest(
     std::string const a_world_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(22);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("world_name", a_world_name);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
     return command;
 }
 
@@ -374,12 +374,12 @@ ICommand::Handle RequestBuilder::buildCreateEpochRequest(
     std::string const a_epoch_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(23);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("world_name", a_world_name);
-    command->setParam("epoch_name", a_epoch_name);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
+    command->setParam(PARAM_EPOCH_NAME, a_epoch_name);
     return command;
 }
 
@@ -389,11 +389,11 @@ ICommand::Handle RequestBuilder::buildDeleteEpochRequest(
     std::string const a_world_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(24);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("world_name", a_world_name);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
     return command;
 }
 
@@ -403,11 +403,11 @@ ICommand::Handle RequestBuilder::buildActivateEpochRequest(
     std::string const a_world_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(25);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("world_name", a_world_name);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
     return command;
 }
 
@@ -417,11 +417,11 @@ ICommand::Handle RequestBuilder::buildDeactivateEpochRequest(
     std::string const a_world_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(26);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("world_name", a_world_name);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
     return command;
 }
 
@@ -431,11 +431,11 @@ ICommand::Handle RequestBuilder::buildFinishEpochRequest(
     std::string const a_world_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(27);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("world_name", a_world_name);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
     return command;
 }
 
@@ -445,11 +445,11 @@ ICommand::Handle RequestBuilder::buildTickEpochRequest(
     std::string const a_world_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(28);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("world_name", a_world_name);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
     return command;
 }
 
@@ -459,11 +459,11 @@ ICommand::Handle RequestBuilder::buildGetEpochRequest(
     std::string const a_world_name
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(29);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("world_name", a_world_name);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
     return command;
 }
 
@@ -476,14 +476,14 @@ ICommand::Handle RequestBuilder::buildTransportHumanRequest(
     std::string const a_volume
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(30);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("settlement_name_source", a_settlement_name_source);
-    command->setParam("settlement_name_destination", a_settlement_name_destination);
-    command->setParam("humankey", a_human_key);
-    command->setParam("volume", a_volume);
+    command->setParam(PARAM_SETTLEMENT_NAME_SOURCE, a_settlement_name_source);
+    command->setParam(PARAM_SETTLEMENT_NAME_DESTINATION, a_settlement_name_destination);
+    command->setParam(PARAM_HUMAN_KEY, a_human_key);
+    command->setParam(PARAM_VOLUME, a_volume);
     return command;
 }
 
@@ -496,14 +496,71 @@ ICommand::Handle RequestBuilder::buildTransportResourceRequest(
     std::string const a_volume
 ) const
 {
-    ICommand::Handle command(new Command);
+    ICommand::Handle command = createCommand();
     command->setID(31);
     command->setLogin(a_login);
     command->setPassword(a_password);
-    command->setParam("settlement_name_source", a_settlement_name_source);
-    command->setParam("settlement_name_destination", a_settlement_name_destination);
-    command->setParam("resourcekey", a_resource_key);
-    command->setParam("volume", a_volume);
+    command->setParam(PARAM_SETTLEMENT_NAME_SOURCE, a_settlement_name_source);
+    command->setParam(PARAM_SETTLEMENT_NAME_DESTINATION, a_settlement_name_destination);
+    command->setParam(PARAM_RESOURCE_KEY, a_resource_key);
+    command->setParam(PARAM_VOLUME, a_volume);
+    return command;
+}
+
+ICommand::Handle RequestBuilder::buildBatchRequest(
+    std::string        const   a_login,
+    std::string        const   a_password,
+    std::string        const   a_atomic,
+    ICommand::Commands const & a_commands
+) const
+{
+    ICommand::Handle command = createCommand();
+    command->setID(63);
+    command->setLogin(a_login);
+    command->setPassword(a_password);
+    command->setParam(PARAM_ATOMIC, a_atomic);
+    for (ICommand::Commands::const_iterator it = a_commands.begin(); it != a_commands.end(); ++it)
+    {
+        command->addCommand(*it);
+    }
+    return command;
+}
+
+ICommand::Handle RequestBuilder::buildSubscribeRequest(
+    std::string const a_login,
+    std::string const a_password,
+    std::string const a_world_name
+) const
+{
+    ICommand::Handle command = createCommand();
+    command->setID(65);
+    command->setLogin(a_login);
+    command->setPassword(a_password);
+    command->setParam(PARAM_WORLD_NAME, a_world_name);
+    return command;
+}
+
+ICommand::Handle RequestBuilder::buildLoginRequest(
+    std::string const a_login,
+    std::string const a_password
+) const
+{
+    ICommand::Handle command = createCommand();
+    command->setID(70);
+    command->setLogin(a_login);
+    command->setPassword(a_password);
+    return command;
+}
+
+ICommand::Handle RequestBuilder::buildLogoutRequest(
+    std::string const a_login,
+    std::string const a_session_token
+) const
+{
+    ICommand::Handle command = createCommand();
+    command->setID(72);
+    command->setLogin(a_login);
+    command->setSessionToken(a_session_token);
     return command;
 }
 
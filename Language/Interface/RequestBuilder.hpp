@@ -550,6 +550,72 @@ public:
         std::string const a_resource_key,
         std::string const a_volume
     ) const;
+
+    /**
+     * @brief Builds BatchRequest.
+     *
+     * The sub-commands are executed in order within a single transaction.
+     *
+     * @param a_login    The login of the user.
+     * @param a_password The password of the user.
+     * @param a_atomic   "1" to roll the whole batch back on the first failure, "0" to execute it best-effort.
+     * @param a_commands The sub-commands.
+     *
+     * @return BatchRequest
+     */
+    ICommand::Handle buildBatchRequest(
+        std::string        const   a_login,
+        std::string        const   a_password,
+        std::string        const   a_atomic,
+        ICommand::Commands const & a_commands
+    ) const;
+
+    /**
+     * @brief Builds SubscribeRequest.
+     *
+     * The connection the request arrives on is kept registered for the indications of the world.
+     *
+     * @param a_login      The login of the user.
+     * @param a_password   The password of the user.
+     * @param a_world_name The name of the world.
+     *
+     * @return SubscribeRequest
+     */
+    ICommand::Handle buildSubscribeRequest(
+        std::string const a_login,
+        std::string const a_password,
+        std::string const a_world_name
+    ) const;
+
+    /**
+     * @brief Builds LoginRequest.
+     *
+     * The reply carries a session token to be sent instead of the password in the subsequent requests.
+     *
+     * @param a_login    The login of the user.
+     * @param a_password The password of the user.
+     *
+     * @return LoginRequest
+     */
+    ICommand::Handle buildLoginRequest(
+        std::string const a_login,
+        std::string const a_password
+    ) const;
+
+    /**
+     * @brief Builds LogoutRequest.
+     *
+     * Closes the session, its token is not accepted anymore.
+     *
+     * @param a_login         The login of the user.
+     * @param a_session_token The session token of the user.
+     *
+     * @return LogoutRequest
+     */
+    ICommand::Handle buildLogoutRequest(
+        std::string const a_login,
+        std::string const a_session_token
+    ) const;
 };
 
 } // namespace Language
@@ -0,0 +1,197 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Rows.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace Language
+{
+
+namespace
+{
+
+char const * const BUILDING_KEYS[] = { "buildingclass", "buildingname", "volume" };
+char const * const HUMAN_KEYS[] = { "experience", "humanclass", "humanname", "volume" };
+char const * const LAND_KEYS[] = { "granted", "land_name", "login", "world_name" };
+char const * const RESOURCE_KEYS[] = { "resourcename", "volume" };
+char const * const SETTLEMENT_KEYS[] = { "land_name", "settlement_name" };
+
+} // namespace
+
+RowSchema const BUILDING_ROWS = { BUILDING_KEYS, sizeof(BUILDING_KEYS) / sizeof(BUILDING_KEYS[0]) };
+RowSchema const HUMAN_ROWS = { HUMAN_KEYS, sizeof(HUMAN_KEYS) / sizeof(HUMAN_KEYS[0]) };
+RowSchema const LAND_ROWS = { LAND_KEYS, sizeof(LAND_KEYS) / sizeof(LAND_KEYS[0]) };
+RowSchema const RESOURCE_ROWS = { RESOURCE_KEYS, sizeof(RESOURCE_KEYS) / sizeof(RESOURCE_KEYS[0]) };
+RowSchema const SETTLEMENT_ROWS = { SETTLEMENT_KEYS, sizeof(SETTLEMENT_KEYS) / sizeof(SETTLEMENT_KEYS[0]) };
+
+Rows::Rows()
+    : m_schema(0)
+{
+}
+
+Rows::Rows(
+    RowSchema const & a_schema
+)
+    : m_schema(&a_schema),
+      m_columns(a_schema.m_column_count)
+{
+}
+
+void Rows::reserve(
+    std::size_t const a_row_count,
+    std::size_t const a_value_size
+)
+{
+    for (std::vector<Column>::iterator it = m_columns.begin(); it != m_columns.end(); ++it)
+    {
+        it->m_text.reserve(a_row_count * a_value_size);
+        it->m_ends.reserve(a_row_count);
+    }
+}
+
+void Rows::clear()
+{
+    for (std::vector<Column>::iterator it = m_columns.begin(); it != m_columns.end(); ++it)
+    {
+        it->m_text.clear();
+        it->m_ends.clear();
+    }
+}
+
+void Rows::appendText(
+    unsigned int const   a_column,
+    std::string  const & a_value
+)
+{
+    Column & column = m_columns.at(a_column);
+    column.m_text.append(a_value);
+    column.m_ends.push_back(column.m_text.size());
+}
+
+void Rows::appendNumber(
+    unsigned int           const a_column,
+    unsigned long long int const a_value
+)
+{
+    // Written backwards into a local buffer, so that no temporary string is made.
+    char digits[20];
+    char * begin = digits + sizeof(digits);
+    unsigned long long int value = a_value;
+
+    do
+    {
+        *--begin = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    while (value);
+
+    Column & column = m_columns.at(a_column);
+    column.m_text.append(begin, digits + sizeof(digits));
+    column.m_ends.push_back(column.m_text.size());
+}
+
+void Rows::appendBoolean(
+    unsigned int const a_column,
+    bool         const a_value
+)
+{
+    Column & column = m_columns.at(a_column);
+    column.m_text.append(a_value ? "true" : "false");
+    column.m_ends.push_back(column.m_text.size());
+}
+
+unsigned int Rows::getColumnCount() const
+{
+    return m_columns.size();
+}
+
+char const * Rows::getKey(
+    unsigned int const a_column
+) const
+{
+    return m_schema->m_keys[a_column];
+}
+
+bool Rows::findColumn(
+    char const   * a_key,
+    unsigned int & a_column
+) const
+{
+    for (unsigned int i = 0; i < m_columns.size(); ++i)
+    {
+        if (std::strcmp(m_schema->m_keys[i], a_key) == 0)
+        {
+            a_column = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::size_t Rows::getRowCount() const
+{
+    if (m_columns.empty())
+    {
+        return 0;
+    }
+
+    std::size_t row_count = m_columns.front().m_ends.size();
+
+    for (std::vector<Column>::const_iterator it = m_columns.begin(); it != m_columns.end(); ++it)
+    {
+        row_count = std::min(row_count, it->m_ends.size());
+    }
+
+    return row_count;
+}
+
+Rows::Cell Rows::getCell(
+    std::size_t  const a_row,
+    unsigned int const a_column
+) const
+{
+    Column const & column = m_columns[a_column];
+    std::size_t const begin = a_row ? column.m_ends[a_row - 1] : 0;
+
+    Cell const cell = { column.m_text.data() + begin, column.m_ends[a_row] - begin };
+
+    return cell;
+}
+
+std::string Rows::getValue(
+    std::size_t  const a_row,
+    unsigned int const a_column
+) const
+{
+    Cell const cell = getCell(a_row, a_column);
+
+    return std::string(cell.m_data, cell.m_size);
+}
+
+} // namespace Language
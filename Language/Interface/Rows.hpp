@@ -0,0 +1,275 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef LANGUAGE_ROWS_HPP
+#define LANGUAGE_ROWS_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Language
+{
+
+/**
+ * @brief The keys shared by all the rows of a reply type, ordered by name as the fields of an object are.
+ */
+struct RowSchema
+{
+    char const * const * m_keys;
+
+    unsigned int m_column_count;
+};
+
+/**
+ * @brief The columns of the rows of the get_buildings reply.
+ */
+enum BuildingColumn
+{
+    BUILDING_COLUMN_BUILDINGCLASS,
+    BUILDING_COLUMN_BUILDINGNAME,
+    BUILDING_COLUMN_VOLUME
+};
+
+/**
+ * @brief The columns of the rows of the get_humans reply.
+ */
+enum HumanColumn
+{
+    HUMAN_COLUMN_EXPERIENCE,
+    HUMAN_COLUMN_HUMANCLASS,
+    HUMAN_COLUMN_HUMANNAME,
+    HUMAN_COLUMN_VOLUME
+};
+
+/**
+ * @brief The columns of the rows of the get_lands reply.
+ */
+enum LandColumn
+{
+    LAND_COLUMN_GRANTED,
+    LAND_COLUMN_LAND_NAME,
+    LAND_COLUMN_LOGIN,
+    LAND_COLUMN_WORLD_NAME
+};
+
+/**
+ * @brief The columns of the rows of the get_resources reply.
+ */
+enum ResourceColumn
+{
+    RESOURCE_COLUMN_RESOURCENAME,
+    RESOURCE_COLUMN_VOLUME
+};
+
+/**
+ * @brief The columns of the rows of the get_settlements reply.
+ */
+enum SettlementColumn
+{
+    SETTLEMENT_COLUMN_LAND_NAME,
+    SETTLEMENT_COLUMN_SETTLEMENT_NAME
+};
+
+extern RowSchema const BUILDING_ROWS;
+extern RowSchema const HUMAN_ROWS;
+extern RowSchema const LAND_ROWS;
+extern RowSchema const RESOURCE_ROWS;
+extern RowSchema const SETTLEMENT_ROWS;
+
+/**
+ * @brief The rows of a collection reply, stored by column.
+ *
+ * The keys live once in the schema, and the values of a column are packed one after another into a single text with
+ * the ends of the values kept aside, so the rows take O(columns) allocations instead of O(rows * fields). The values
+ * are typed when appended and kept as the text they are sent as.
+ */
+class Rows
+{
+public:
+    /**
+     * @brief A value, valid as long as the rows are not modified.
+     */
+    struct Cell
+    {
+        char const * m_data;
+
+        std::size_t m_size;
+    };
+
+    /**
+     * @brief Constructs rows with no columns.
+     */
+    Rows();
+
+    /**
+     * @brief Constructs empty rows of a schema.
+     *
+     * @param a_schema The schema, which has to outlive the rows.
+     */
+    explicit Rows(
+        RowSchema const & a_schema
+    );
+
+    /**
+     * @brief Reserves the room for a number of rows.
+     *
+     * @param a_row_count  The number of rows.
+     * @param a_value_size The expected size of a value.
+     */
+    void reserve(
+        std::size_t const a_row_count,
+        std::size_t const a_value_size
+    );
+
+    /**
+     * @brief Drops all the rows, the room they have taken is kept for the rows appended afterwards.
+     */
+    void clear();
+
+    /**
+     * @brief Appends a text to a column.
+     *
+     * @param a_column The column.
+     * @param a_value  The text.
+     */
+    void appendText(
+        unsigned int const   a_column,
+        std::string  const & a_value
+    );
+
+    /**
+     * @brief Appends a number to a column.
+     *
+     * @param a_column The column.
+     * @param a_value  The number.
+     */
+    void appendNumber(
+        unsigned int           const a_column,
+        unsigned long long int const a_value
+    );
+
+    /**
+     * @brief Appends a flag to a column, as "true" or "false".
+     *
+     * @param a_column The column.
+     * @param a_value  The flag.
+     */
+    void appendBoolean(
+        unsigned int const a_column,
+        bool         const a_value
+    );
+
+    /**
+     * @brief Gets the number of the columns.
+     *
+     * @return The number of the columns.
+     */
+    unsigned int getColumnCount() const;
+
+    /**
+     * @brief Gets the key of a column.
+     *
+     * @param a_column The column.
+     *
+     * @return The key of the column.
+     */
+    char const * getKey(
+        unsigned int const a_column
+    ) const;
+
+    /**
+     * @brief Finds a column by its key.
+     *
+     * @param a_key    The key.
+     * @param a_column The column, if found.
+     *
+     * @return True if the schema has such a key, false otherwise.
+     */
+    bool findColumn(
+        char const   * a_key,
+        unsigned int & a_column
+    ) const;
+
+    /**
+     * @brief Gets the number of the rows, the ones having a value in every column.
+     *
+     * @return The number of the rows.
+     */
+    std::size_t getRowCount() const;
+
+    /**
+     * @brief Gets a value with no copy.
+     *
+     * @param a_row    The row.
+     * @param a_column The column.
+     *
+     * @return The value.
+     */
+    Cell getCell(
+        std::size_t  const a_row,
+        unsigned int const a_column
+    ) const;
+
+    /**
+     * @brief Gets a value.
+     *
+     * @param a_row    The row.
+     * @param a_column The column.
+     *
+     * @return The value.
+     */
+    std::string getValue(
+        std::size_t  const a_row,
+        unsigned int const a_column
+    ) const;
+
+private:
+    /**
+     * @brief The values of a column, packed.
+     */
+    struct Column
+    {
+        std::string m_text;
+
+        std::vector<std::size_t> m_ends;
+    };
+
+    /**
+     * @brief The schema, null if none.
+     */
+    RowSchema const * m_schema;
+
+    /**
+     * @brief The columns, ordered as the keys of the schema.
+     */
+    std::vector<Column> m_columns;
+};
+
+} // namespace Language
+
+#endif // LANGUAGE_ROWS_HPP
@@ -0,0 +1,179 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Arena.hpp>
+#include <Language/Interface/Command.hpp>
+#include <gtest/gtest.h>
+#include <algorithm>
+
+TEST(ArenaTest, AllocationsAreAlignedAndDistinct)
+{
+    Language::Arena arena(1024);
+
+    char * first = static_cast<char *>(arena.allocate(1));
+    char * second = static_cast<char *>(arena.allocate(1));
+
+    ASSERT_NE(first, second);
+    ASSERT_EQ(0U, reinterpret_cast<std::size_t>(first) % sizeof(void *));
+    ASSERT_EQ(0U, reinterpret_cast<std::size_t>(second) % sizeof(void *));
+    ASSERT_EQ(2U, arena.getAllocationCount());
+
+    arena.deallocate();
+    arena.deallocate();
+}
+
+TEST(ArenaTest, ResetRewindsEmptyArena)
+{
+    Language::Arena arena(1024);
+
+    void * first = arena.allocate(100);
+    arena.deallocate();
+
+    ASSERT_TRUE(arena.reset());
+    ASSERT_EQ(0U, arena.getAllocationCount());
+    ASSERT_EQ(0U, arena.getAllocatedSize());
+    ASSERT_EQ(first, arena.allocate(100));
+
+    arena.deallocate();
+}
+
+TEST(ArenaTest, ResetDoesNotRewindUnderLiveObject)
+{
+    Language::Arena arena(1024);
+
+    void * first = arena.allocate(100);
+
+    ASSERT_FALSE(arena.reset());
+    ASSERT_NE(first, arena.allocate(100));
+
+    arena.deallocate();
+    arena.deallocate();
+
+    ASSERT_TRUE(arena.reset());
+}
+
+TEST(ArenaTest, AllocationsLargerThanBlockAreServed)
+{
+    Language::Arena arena(64);
+
+    char * memory = static_cast<char *>(arena.allocate(1000));
+    std::fill(memory, memory + 1000, 'x');
+    arena.deallocate();
+
+    ASSERT_TRUE(arena.reset());
+}
+
+TEST(ArenaTest, BlocksAreKeptAcrossResets)
+{
+    Language::Arena arena(64);
+
+    void * first = arena.allocate(48);
+    void * second = arena.allocate(48);
+    arena.deallocate();
+    arena.deallocate();
+    arena.reset();
+
+    ASSERT_EQ(first, arena.allocate(48));
+    ASSERT_EQ(second, arena.allocate(48));
+
+    arena.deallocate();
+    arena.deallocate();
+}
+
+TEST(ArenaTest, CommandIsCreatedOnHeapWithoutScope)
+{
+    ASSERT_TRUE(Language::Arena::getCurrent() == 0);
+
+    Language::ICommand::Handle command = Language::createCommand();
+    command->setMessage("Message");
+
+    ASSERT_STREQ("Message", command->getMessage().c_str());
+}
+
+TEST(ArenaTest, CommandIsCreatedInCurrentArena)
+{
+    Language::Arena arena(1024);
+
+    {
+        Language::ArenaScope const arenaScope(&arena);
+
+        ASSERT_EQ(&arena, Language::Arena::getCurrent());
+
+        Language::ICommand::Handle command = Language::createCommand();
+        command->setID(Language::ID_COMMAND_ECHO_REPLY);
+
+        ASSERT_EQ(1U, arena.getAllocationCount());
+        ASSERT_FALSE(arena.reset());
+    }
+
+    ASSERT_TRUE(Language::Arena::getCurrent() == 0);
+    ASSERT_TRUE(arena.reset());
+}
+
+TEST(ArenaTest, ScopesNest)
+{
+    Language::Arena outer(1024);
+    Language::Arena inner(1024);
+
+    Language::ArenaScope const outerScope(&outer);
+
+    {
+        Language::ArenaScope const innerScope(&inner);
+
+        ASSERT_EQ(&inner, Language::Arena::getCurrent());
+    }
+
+    ASSERT_EQ(&outer, Language::Arena::getCurrent());
+}
+
+TEST(ArenaTest, AbandonedArenaIsDestroyedByItsLastObject)
+{
+    Language::Arena * arena = new Language::Arena(1024);
+
+    Language::ICommand::Handle command;
+
+    {
+        Language::ArenaScope const arenaScope(arena);
+        command = Language::createCommand();
+        command->setMessage("Outliving");
+    }
+
+    arena->abandon();
+
+    ASSERT_STREQ("Outliving", command->getMessage().c_str());
+
+    command.reset();
+}
+
+TEST(ArenaTest, AbandonedEmptyArenaIsDestroyedAtOnce)
+{
+    Language::Arena * arena = new Language::Arena(1024);
+
+    arena->allocate(16);
+    arena->deallocate();
+    arena->abandon();
+}
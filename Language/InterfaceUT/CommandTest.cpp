@@ -77,6 +77,50 @@ TEST_F(CommandTest, SetPasswordSetsProperValue)
     ASSERT_STREQ("Password", m_command.getPassword().c_str());
 }
 
+TEST_F(CommandTest, GetSessionTokenReturnsProperInitialValue)
+{
+    ASSERT_STREQ("", m_command.getSessionToken().c_str());
+}
+
+TEST_F(CommandTest, SetSessionTokenSetsProperValue)
+{
+    m_command.setSessionToken("Token");
+    ASSERT_STREQ("Token", m_command.getSessionToken().c_str());
+}
+
+TEST_F(CommandTest, GetTimeoutReturnsProperInitialValue)
+{
+    ASSERT_EQ(0U, m_command.getTimeout());
+}
+
+TEST_F(CommandTest, SetTimeoutSetsProperValue)
+{
+    m_command.setTimeout(5000);
+    ASSERT_EQ(5000U, m_command.getTimeout());
+}
+
+TEST_F(CommandTest, GetDeadlineReturnsProperInitialValue)
+{
+    ASSERT_EQ(0ULL, m_command.getDeadline());
+}
+
+TEST_F(CommandTest, SetDeadlineSetsProperValue)
+{
+    m_command.setDeadline(1234567890123ULL);
+    ASSERT_EQ(1234567890123ULL, m_command.getDeadline());
+}
+
+TEST_F(CommandTest, GetIdempotencyKeyReturnsProperInitialValue)
+{
+    ASSERT_TRUE(m_command.getIdempotencyKey().empty());
+}
+
+TEST_F(CommandTest, SetIdempotencyKeySetsProperValue)
+{
+    m_command.setIdempotencyKey("Key");
+    ASSERT_STREQ("Key", m_command.getIdempotencyKey().c_str());
+}
+
 TEST_F(CommandTest, GetParamThrowsIfParamDoesNotExist)
 {
     ASSERT_THROW(m_command.getParam("non_existent"), std::out_of_range);
@@ -84,8 +128,106 @@ TEST_F(CommandTest, GetParamThrowsIfParamDoesNotExist)
 
 TEST_F(CommandTest, GetParamReturnsPropverValueOfParam)
 {
-    m_command.setParam("existent", "value");
-    ASSERT_STREQ("value", m_command.getParam("existent").c_str());
+    m_command.setParam("world_name", "World");
+    ASSERT_STREQ("World", m_command.getParam("world_name").c_str());
+}
+
+TEST_F(CommandTest, SetParamThrowsIfParamDoesNotBelongToSchema)
+{
+    ASSERT_THROW(m_command.setParam("non_existent", "value"), std::out_of_range);
+}
+
+TEST_F(CommandTest, GetParamByKeyThrowsIfParamDoesNotExist)
+{
+    ASSERT_THROW(m_command.getParam(Language::PARAM_WORLD_NAME), std::out_of_range);
+}
+
+TEST_F(CommandTest, GetParamByKeyReturnsValueSetByName)
+{
+    m_command.setParam("world_name", "World");
+    ASSERT_STREQ("World", m_command.getParam(Language::PARAM_WORLD_NAME).c_str());
+}
+
+TEST_F(CommandTest, GetParamByNameReturnsValueSetByKey)
+{
+    m_command.setParam(Language::PARAM_WORLD_NAME, "World");
+    ASSERT_STREQ("World", m_command.getParam("world_name").c_str());
+}
+
+TEST_F(CommandTest, SetParamByKeyOverwritesValue)
+{
+    m_command.setParam(Language::PARAM_VOLUME, "1");
+    m_command.setParam(Language::PARAM_VOLUME, "2");
+    ASSERT_STREQ("2", m_command.getParam(Language::PARAM_VOLUME).c_str());
+}
+
+TEST_F(CommandTest, SetParamByKeyThrowsBeyondFixedLayout)
+{
+    m_command.setParam(Language::PARAM_LOGIN, "Login");
+    m_command.setParam(Language::PARAM_HOLDER_NAME, "Settlement");
+    m_command.setParam(Language::PARAM_HUMAN_KEY, "Key");
+    m_command.setParam(Language::PARAM_VOLUME, "1");
+    m_command.setParam(Language::PARAM_VOLUME, "2");
+
+    ASSERT_THROW(m_command.setParam(Language::PARAM_WORLD_NAME, "World"), std::length_error);
+    ASSERT_STREQ("2", m_command.getParam(Language::PARAM_VOLUME).c_str());
+}
+
+TEST_F(CommandTest, GetNumberParamReturnsParsedValue)
+{
+    unsigned int value = 0;
+
+    m_command.setParam(Language::PARAM_VOLUME, "4294967295");
+    ASSERT_TRUE(m_command.getNumberParam(Language::PARAM_VOLUME, value));
+    ASSERT_EQ(4294967295U, value);
+    ASSERT_STREQ("4294967295", m_command.getParam(Language::PARAM_VOLUME).c_str());
+}
+
+TEST_F(CommandTest, GetNumberParamRejectsValueThatIsNotNumber)
+{
+    unsigned int value = 7;
+
+    m_command.setParam(Language::PARAM_VOLUME, "");
+    ASSERT_FALSE(m_command.getNumberParam(Language::PARAM_VOLUME, value));
+    m_command.setParam(Language::PARAM_VOLUME, "-1");
+    ASSERT_FALSE(m_command.getNumberParam(Language::PARAM_VOLUME, value));
+    m_command.setParam(Language::PARAM_VOLUME, "1a");
+    ASSERT_FALSE(m_command.getNumberParam(Language::PARAM_VOLUME, value));
+    m_command.setParam(Language::PARAM_VOLUME, "4294967296");
+    ASSERT_FALSE(m_command.getNumberParam(Language::PARAM_VOLUME, value));
+    ASSERT_EQ(7U, value);
+}
+
+TEST_F(CommandTest, GetNumberParamRejectsTextParam)
+{
+    unsigned int value = 0;
+
+    m_command.setParam(Language::PARAM_WORLD_NAME, "1");
+    ASSERT_FALSE(m_command.getNumberParam(Language::PARAM_WORLD_NAME, value));
+}
+
+TEST_F(CommandTest, GetNumberParamThrowsIfParamDoesNotExist)
+{
+    unsigned int value = 0;
+
+    ASSERT_THROW(m_command.getNumberParam(Language::PARAM_VOLUME, value), std::out_of_range);
+}
+
+TEST_F(CommandTest, GetBooleanParamReturnsParsedValue)
+{
+    m_command.setParam(Language::PARAM_ATOMIC, "0");
+    ASSERT_FALSE(m_command.getBooleanParam(Language::PARAM_ATOMIC));
+    m_command.setParam(Language::PARAM_ATOMIC, "1");
+    ASSERT_TRUE(m_command.getBooleanParam(Language::PARAM_ATOMIC));
+}
+
+TEST_F(CommandTest, FindParamKeyFindsParamsOfSchemaOnly)
+{
+    Language::ParamKey param_key;
+
+    ASSERT_TRUE(Language::findParamKey("settlement_name_source", param_key));
+    ASSERT_EQ(Language::PARAM_SETTLEMENT_NAME_SOURCE, param_key);
+    ASSERT_FALSE(Language::findParamKey("existent", param_key));
 }
 
 TEST_F(CommandTest, GetCodeReturnsProperInitialValue)
@@ -143,3 +285,49 @@ TEST_F(CommandTest, AddObjectInsertsObjectProperly)
     m_command.addObject(land);
     ASSERT_FALSE(m_command.getObjects().empty());
 }
+
+TEST_F(CommandTest, GetRowsReturnsProperInitialValue)
+{
+    ASSERT_EQ(0, m_command.getRows().getColumnCount());
+    ASSERT_EQ(0, m_command.getRows().getRowCount());
+}
+
+TEST_F(CommandTest, SetRowsMakesObjectsOfTheRows)
+{
+    Language::Rows resources(Language::RESOURCE_ROWS);
+    resources.appendText(Language::RESOURCE_COLUMN_RESOURCENAME, "coal");
+    resources.appendNumber(Language::RESOURCE_COLUMN_VOLUME, 5);
+    m_command.setRows(resources);
+    ASSERT_EQ(1, m_command.getRows().getRowCount());
+    ASSERT_EQ(1, m_command.getObjects().size());
+    ASSERT_STREQ("coal", m_command.getObjects().front().at("resourcename").c_str());
+    ASSERT_STREQ("5", m_command.getObjects().front().at("volume").c_str());
+}
+
+TEST_F(CommandTest, SetRowsReplacesObjects)
+{
+    Language::ICommand::Object resource;
+    resource.insert(std::make_pair("resourcename", "iron"));
+    resource.insert(std::make_pair("volume", "1"));
+    m_command.addObject(resource);
+    m_command.setRows(Language::Rows(Language::RESOURCE_ROWS));
+    ASSERT_TRUE(m_command.getObjects().empty());
+}
+
+TEST_F(CommandTest, GetCommandsReturnsProperInitialValue)
+{
+    ASSERT_TRUE(m_command.getCommands().empty());
+}
+
+TEST_F(CommandTest, AddCommandAppendsCommandsInOrder)
+{
+    Language::ICommand::Handle first(new Language::Command);
+    first->setID(Language::ID_COMMAND_ECHO_REQUEST);
+    Language::ICommand::Handle second(new Language::Command);
+    second->setID(Language::ID_COMMAND_ERROR_REQUEST);
+    m_command.addCommand(first);
+    m_command.addCommand(second);
+    ASSERT_EQ(2, m_command.getCommands().size());
+    ASSERT_EQ(Language::ID_COMMAND_ECHO_REQUEST, m_command.getCommands().at(0)->getID());
+    ASSERT_EQ(Language::ID_COMMAND_ERROR_REQUEST, m_command.getCommands().at(1)->getID());
+}
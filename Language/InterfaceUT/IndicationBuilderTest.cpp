@@ -0,0 +1,86 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/IndicationBuilder.hpp>
+#include <gtest/gtest.h>
+
+class IndicationBuilderTest
+    : public ::testing::Test
+{
+protected:
+    /**
+     * @brief The indication builder to be tested.
+     */
+    Language::IndicationBuilder m_indication_builder;
+};
+
+TEST_F(IndicationBuilderTest, BuildEpochActivatedIndicationSetsProperID)
+{
+    ASSERT_EQ(
+        Language::ID_COMMAND_EPOCH_ACTIVATED_INDICATION,
+        m_indication_builder.buildEpochActivatedIndication("World")->getID()
+    );
+}
+
+TEST_F(IndicationBuilderTest, BuildEpochActivatedIndicationSetsProperWorldName)
+{
+    ASSERT_STREQ(
+        "World",
+        m_indication_builder.buildEpochActivatedIndication("World")->getParam("world_name").c_str()
+    );
+}
+
+TEST_F(IndicationBuilderTest, BuildEpochDeactivatedIndicationSetsProperID)
+{
+    ASSERT_EQ(
+        Language::ID_COMMAND_EPOCH_DEACTIVATED_INDICATION,
+        m_indication_builder.buildEpochDeactivatedIndication("World")->getID()
+    );
+}
+
+TEST_F(IndicationBuilderTest, BuildEpochDeactivatedIndicationSetsProperWorldName)
+{
+    ASSERT_STREQ(
+        "World",
+        m_indication_builder.buildEpochDeactivatedIndication("World")->getParam("world_name").c_str()
+    );
+}
+
+TEST_F(IndicationBuilderTest, BuildTickCompletedIndicationSetsProperID)
+{
+    ASSERT_EQ(
+        Language::ID_COMMAND_TICK_COMPLETED_INDICATION,
+        m_indication_builder.buildTickCompletedIndication("World", "7")->getID()
+    );
+}
+
+TEST_F(IndicationBuilderTest, BuildTickCompletedIndicationSetsProperParams)
+{
+    Language::ICommand::Handle indication = m_indication_builder.buildTickCompletedIndication("World", "7");
+    ASSERT_STREQ("World", indication->getParam("world_name").c_str());
+    ASSERT_STREQ("7", indication->getParam("ticks").c_str());
+}
@@ -360,6 +360,55 @@ TEST_F(ReplyBuilderTestBuildGetLandsReplyWithObjects, SetsProperObjects)
     ASSERT_STREQ("false", object.at("granted").c_str());
 }
 
+class ReplyBuilderTestBuildGetLandsReplyWithRows
+    : public ::testing::Test
+{
+protected:
+    ReplyBuilderTestBuildGetLandsReplyWithRows()
+    {
+        Language::ReplyBuilder reply_builder;
+        Language::Rows lands(Language::LAND_ROWS);
+        lands.appendText(Language::LAND_COLUMN_LOGIN, "Login1");
+        lands.appendText(Language::LAND_COLUMN_WORLD_NAME, "World1");
+        lands.appendText(Language::LAND_COLUMN_LAND_NAME, "Land1");
+        lands.appendBoolean(Language::LAND_COLUMN_GRANTED, false);
+        lands.appendText(Language::LAND_COLUMN_LOGIN, "Login2");
+        lands.appendText(Language::LAND_COLUMN_WORLD_NAME, "World2");
+        lands.appendText(Language::LAND_COLUMN_LAND_NAME, "Land2");
+        lands.appendBoolean(Language::LAND_COLUMN_GRANTED, true);
+        m_command = reply_builder.buildGetLandsReply(1, "Message", lands);
+    }
+
+    Language::ICommand::Handle m_command;
+};
+
+TEST_F(ReplyBuilderTestBuildGetLandsReplyWithRows, SetsProperID)
+{
+    ASSERT_EQ(37, m_command->getID());
+}
+
+TEST_F(ReplyBuilderTestBuildGetLandsReplyWithRows, SetsProperRows)
+{
+    ASSERT_EQ(2, m_command->getRows().getRowCount());
+    ASSERT_EQ("Land2", m_command->getRows().getValue(1, Language::LAND_COLUMN_LAND_NAME));
+}
+
+TEST_F(ReplyBuilderTestBuildGetLandsReplyWithRows, SetsProperObjects)
+{
+    Language::ICommand::Objects objects = m_command->getObjects();
+    ASSERT_EQ(2, objects.size());
+    Language::ICommand::Object object = objects.front();
+    ASSERT_STREQ("Login1", object.at("login").c_str());
+    ASSERT_STREQ("World1", object.at("world_name").c_str());
+    ASSERT_STREQ("Land1", object.at("land_name").c_str());
+    ASSERT_STREQ("false", object.at("granted").c_str());
+    object = objects.back();
+    ASSERT_STREQ("Login2", object.at("login").c_str());
+    ASSERT_STREQ("World2", object.at("world_name").c_str());
+    ASSERT_STREQ("Land2", object.at("land_name").c_str());
+    ASSERT_STREQ("true", object.at("granted").c_str());
+}
+
 TEST_F(ReplyBuilderTest, BuildCreateSettlementReplyReturnsNotNull)
 {
     ASSERT_TRUE(m_command_create_settlement_reply.get());
@@ -1520,3 +1569,109 @@ TEST_F(ReplyBuilderTest, BuildTransportResourceReplySetsProperMessage)
 {
     ASSERT_STREQ("Message", m_command_transport_resource_reply->getMessage().c_str());
 }
+
+TEST_F(ReplyBuilderTest, BuildBatchReplySetsProperReplyID)
+{
+    ASSERT_EQ(64, m_reply_builder.buildBatchReply(1, "Message")->getID());
+}
+
+TEST_F(ReplyBuilderTest, BuildBatchReplySetsProperCode)
+{
+    ASSERT_EQ(1, m_reply_builder.buildBatchReply(1, "Message")->getCode());
+}
+
+TEST_F(ReplyBuilderTest, BuildBatchReplySetsProperMessage)
+{
+    ASSERT_STREQ("Message", m_reply_builder.buildBatchReply(1, "Message")->getMessage().c_str());
+}
+
+TEST_F(ReplyBuilderTest, BuildBatchReplySetsProperCommands)
+{
+    Language::ICommand::Commands commands;
+    commands.push_back(m_reply_builder.buildEchoReply(1));
+    commands.push_back(m_reply_builder.buildTransportResourceReply(1, "Message"));
+    Language::ICommand::Handle reply = m_reply_builder.buildBatchReply(1, "Message", commands);
+    ASSERT_EQ(2, reply->getCommands().size());
+    ASSERT_EQ(Language::ID_COMMAND_ECHO_REPLY, reply->getCommands().at(0)->getID());
+    ASSERT_EQ(Language::ID_COMMAND_TRANSPORT_RESOURCE_REPLY, reply->getCommands().at(1)->getID());
+}
+
+TEST_F(ReplyBuilderTest, BuildBasicReplySetsProperReplyID)
+{
+    for (unsigned short int id = Language::ID_COMMAND_ECHO_REQUEST; id <= Language::ID_COMMAND_TRANSPORT_RESOURCE_REQUEST; ++id)
+    {
+        ASSERT_EQ(id + 31, m_reply_builder.buildBasicReply(id, 1)->getID());
+    }
+}
+
+TEST_F(ReplyBuilderTest, BuildBasicReplySetsProperBatchReplyID)
+{
+    ASSERT_EQ(Language::ID_COMMAND_BATCH_REPLY, m_reply_builder.buildBasicReply(Language::ID_COMMAND_BATCH_REQUEST, 1)->getID());
+}
+
+TEST_F(ReplyBuilderTest, BuildSubscribeReplySetsProperFields)
+{
+    Language::ICommand::Handle reply = m_reply_builder.buildSubscribeReply(1, "Message");
+    ASSERT_EQ(66, reply->getID());
+    ASSERT_EQ(1, reply->getCode());
+    ASSERT_STREQ("Message", reply->getMessage().c_str());
+}
+
+TEST_F(ReplyBuilderTest, BuildBasicReplySetsProperSubscribeReplyID)
+{
+    ASSERT_EQ(
+        Language::ID_COMMAND_SUBSCRIBE_REPLY,
+        m_reply_builder.buildBasicReply(Language::ID_COMMAND_SUBSCRIBE_REQUEST, 1)->getID()
+    );
+}
+
+TEST_F(ReplyBuilderTest, BuildLoginReplySetsProperFields)
+{
+    Language::ICommand::Handle reply = m_reply_builder.buildLoginReply(1, "Message", "Token");
+    ASSERT_EQ(71, reply->getID());
+    ASSERT_EQ(1, reply->getCode());
+    ASSERT_STREQ("Message", reply->getMessage().c_str());
+    ASSERT_STREQ("Token", reply->getParam("session_token").c_str());
+}
+
+TEST_F(ReplyBuilderTest, BuildBasicReplySetsProperLoginReplyID)
+{
+    ASSERT_EQ(
+        Language::ID_COMMAND_LOGIN_REPLY,
+        m_reply_builder.buildBasicReply(Language::ID_COMMAND_LOGIN_REQUEST, 1)->getID()
+    );
+}
+
+TEST_F(ReplyBuilderTest, BuildLogoutReplySetsProperFields)
+{
+    Language::ICommand::Handle reply = m_reply_builder.buildLogoutReply(1, "Message");
+    ASSERT_EQ(73, reply->getID());
+    ASSERT_EQ(1, reply->getCode());
+    ASSERT_STREQ("Message", reply->getMessage().c_str());
+}
+
+TEST_F(ReplyBuilderTest, BuildBasicReplySetsProperLogoutReplyID)
+{
+    ASSERT_EQ(
+        Language::ID_COMMAND_LOGOUT_REPLY,
+        m_reply_builder.buildBasicReply(Language::ID_COMMAND_LOGOUT_REQUEST, 1)->getID()
+    );
+}
+
+TEST_F(ReplyBuilderTest, BuildBasicReplySetsProperCode)
+{
+    ASSERT_EQ(1, m_reply_builder.buildBasicReply(Language::ID_COMMAND_GET_RESOURCES_REQUEST, 1)->getCode());
+}
+
+TEST_F(ReplyBuilderTest, BuildBasicReplySetsProperMessage)
+{
+    ASSERT_STREQ(
+        "Message",
+        m_reply_builder.buildBasicReply(Language::ID_COMMAND_GET_RESOURCES_REQUEST, 1, "Message")->getMessage().c_str()
+    );
+}
+
+TEST_F(ReplyBuilderTest, BuildBasicReplyReturnsErrorReplyForUnknownRequest)
+{
+    ASSERT_EQ(Language::ID_COMMAND_ERROR_REPLY, m_reply_builder.buildBasicReply(Language::ID_COMMAND_ECHO_REPLY, 1)->getID());
+}
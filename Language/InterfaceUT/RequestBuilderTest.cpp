@@ -1022,3 +1022,45 @@ TEST_F(RequestBuilderTest, BuildTransportResourceRequestSetsProperVolume)
 {
     ASSERT_STREQ("100", m_command_transport_resource->getParam("volume").c_str());
 }
+
+TEST_F(RequestBuilderTest, BuildBatchRequestSetsProperFields)
+{
+    Language::ICommand::Commands commands;
+    commands.push_back(m_command_transport_human);
+    commands.push_back(m_command_transport_resource);
+    Language::ICommand::Handle batch = m_request_builder.buildBatchRequest("Login", "Password", "1", commands);
+    ASSERT_EQ(63, batch->getID());
+    ASSERT_STREQ("Login", batch->getLogin().c_str());
+    ASSERT_STREQ("Password", batch->getPassword().c_str());
+    ASSERT_STREQ("1", batch->getParam("atomic").c_str());
+    ASSERT_EQ(2, batch->getCommands().size());
+    ASSERT_EQ(30, batch->getCommands().at(0)->getID());
+    ASSERT_EQ(31, batch->getCommands().at(1)->getID());
+}
+
+TEST_F(RequestBuilderTest, BuildSubscribeRequestSetsProperFields)
+{
+    Language::ICommand::Handle subscribe = m_request_builder.buildSubscribeRequest("Login", "Password", "World");
+    ASSERT_EQ(65, subscribe->getID());
+    ASSERT_STREQ("Login", subscribe->getLogin().c_str());
+    ASSERT_STREQ("Password", subscribe->getPassword().c_str());
+    ASSERT_STREQ("World", subscribe->getParam("world_name").c_str());
+}
+
+TEST_F(RequestBuilderTest, BuildLoginRequestSetsProperFields)
+{
+    Language::ICommand::Handle login = m_request_builder.buildLoginRequest("Login", "Password");
+    ASSERT_EQ(70, login->getID());
+    ASSERT_STREQ("Login", login->getLogin().c_str());
+    ASSERT_STREQ("Password", login->getPassword().c_str());
+    ASSERT_STREQ("", login->getSessionToken().c_str());
+}
+
+TEST_F(RequestBuilderTest, BuildLogoutRequestSetsProperFields)
+{
+    Language::ICommand::Handle logout = m_request_builder.buildLogoutRequest("Login", "Token");
+    ASSERT_EQ(72, logout->getID());
+    ASSERT_STREQ("Login", logout->getLogin().c_str());
+    ASSERT_STREQ("", logout->getPassword().c_str());
+    ASSERT_STREQ("Token", logout->getSessionToken().c_str());
+}
@@ -0,0 +1,142 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Rows.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+TEST(RowsTest, DefaultRowsHaveNoColumns)
+{
+    Language::Rows rows;
+    ASSERT_EQ(0, rows.getColumnCount());
+    ASSERT_EQ(0, rows.getRowCount());
+}
+
+TEST(RowsTest, RowsTakeTheColumnsOfTheSchema)
+{
+    Language::Rows rows(Language::HUMAN_ROWS);
+    ASSERT_EQ(4, rows.getColumnCount());
+    ASSERT_STREQ("experience", rows.getKey(Language::HUMAN_COLUMN_EXPERIENCE));
+    ASSERT_STREQ("humanclass", rows.getKey(Language::HUMAN_COLUMN_HUMANCLASS));
+    ASSERT_STREQ("humanname", rows.getKey(Language::HUMAN_COLUMN_HUMANNAME));
+    ASSERT_STREQ("volume", rows.getKey(Language::HUMAN_COLUMN_VOLUME));
+}
+
+TEST(RowsTest, KeysOfEverySchemaAreOrderedByName)
+{
+    Language::RowSchema const schemas[] =
+    {
+        Language::BUILDING_ROWS,
+        Language::HUMAN_ROWS,
+        Language::LAND_ROWS,
+        Language::RESOURCE_ROWS,
+        Language::SETTLEMENT_ROWS
+    };
+
+    for (unsigned int i = 0; i < sizeof(schemas) / sizeof(schemas[0]); ++i)
+    {
+        for (unsigned int column = 1; column < schemas[i].m_column_count; ++column)
+        {
+            ASSERT_LT(std::string(schemas[i].m_keys[column - 1]), std::string(schemas[i].m_keys[column]));
+        }
+    }
+}
+
+TEST(RowsTest, AppendedValuesAreKeptInOrder)
+{
+    Language::Rows rows(Language::RESOURCE_ROWS);
+    rows.appendText(Language::RESOURCE_COLUMN_RESOURCENAME, "coal");
+    rows.appendText(Language::RESOURCE_COLUMN_RESOURCENAME, "");
+    rows.appendText(Language::RESOURCE_COLUMN_RESOURCENAME, "iron");
+    rows.appendNumber(Language::RESOURCE_COLUMN_VOLUME, 0);
+    rows.appendNumber(Language::RESOURCE_COLUMN_VOLUME, 18446744073709551615ULL);
+    rows.appendNumber(Language::RESOURCE_COLUMN_VOLUME, 42);
+    ASSERT_EQ(3, rows.getRowCount());
+    ASSERT_EQ("coal", rows.getValue(0, Language::RESOURCE_COLUMN_RESOURCENAME));
+    ASSERT_EQ("", rows.getValue(1, Language::RESOURCE_COLUMN_RESOURCENAME));
+    ASSERT_EQ("iron", rows.getValue(2, Language::RESOURCE_COLUMN_RESOURCENAME));
+    ASSERT_EQ("0", rows.getValue(0, Language::RESOURCE_COLUMN_VOLUME));
+    ASSERT_EQ("18446744073709551615", rows.getValue(1, Language::RESOURCE_COLUMN_VOLUME));
+    ASSERT_EQ("42", rows.getValue(2, Language::RESOURCE_COLUMN_VOLUME));
+}
+
+TEST(RowsTest, BooleansAreAppendedAsText)
+{
+    Language::Rows rows(Language::LAND_ROWS);
+    rows.appendBoolean(Language::LAND_COLUMN_GRANTED, true);
+    rows.appendBoolean(Language::LAND_COLUMN_GRANTED, false);
+    ASSERT_EQ("true", rows.getValue(0, Language::LAND_COLUMN_GRANTED));
+    ASSERT_EQ("false", rows.getValue(1, Language::LAND_COLUMN_GRANTED));
+}
+
+TEST(RowsTest, GetCellReturnsTheValueWithNoCopy)
+{
+    Language::Rows rows(Language::SETTLEMENT_ROWS);
+    rows.appendText(Language::SETTLEMENT_COLUMN_LAND_NAME, "Land");
+    rows.appendText(Language::SETTLEMENT_COLUMN_LAND_NAME, "Other");
+    Language::Rows::Cell const cell = rows.getCell(1, Language::SETTLEMENT_COLUMN_LAND_NAME);
+    ASSERT_EQ("Other", std::string(cell.m_data, cell.m_size));
+}
+
+TEST(RowsTest, RowCountCountsRowsHavingAValueInEveryColumn)
+{
+    Language::Rows rows(Language::SETTLEMENT_ROWS);
+    rows.appendText(Language::SETTLEMENT_COLUMN_LAND_NAME, "Land");
+    rows.appendText(Language::SETTLEMENT_COLUMN_LAND_NAME, "Land");
+    rows.appendText(Language::SETTLEMENT_COLUMN_SETTLEMENT_NAME, "Settlement");
+    ASSERT_EQ(1, rows.getRowCount());
+}
+
+TEST(RowsTest, ClearDropsRowsAndKeepsColumns)
+{
+    Language::Rows rows(Language::SETTLEMENT_ROWS);
+    rows.appendText(Language::SETTLEMENT_COLUMN_LAND_NAME, "Land");
+    rows.appendText(Language::SETTLEMENT_COLUMN_SETTLEMENT_NAME, "Settlement");
+    rows.clear();
+    ASSERT_EQ(0, rows.getRowCount());
+    ASSERT_EQ(2, rows.getColumnCount());
+    rows.appendText(Language::SETTLEMENT_COLUMN_LAND_NAME, "Other");
+    rows.appendText(Language::SETTLEMENT_COLUMN_SETTLEMENT_NAME, "Another");
+    ASSERT_EQ(1, rows.getRowCount());
+    ASSERT_EQ("Other", rows.getValue(0, Language::SETTLEMENT_COLUMN_LAND_NAME));
+}
+
+TEST(RowsTest, FindColumnFindsColumnByKey)
+{
+    Language::Rows rows(Language::BUILDING_ROWS);
+    unsigned int column = 0;
+    ASSERT_TRUE(rows.findColumn("volume", column));
+    ASSERT_EQ(Language::BUILDING_COLUMN_VOLUME, column);
+    ASSERT_FALSE(rows.findColumn("humanclass", column));
+}
+
+TEST(RowsTest, ThrowsOnUnknownColumn)
+{
+    Language::Rows rows(Language::RESOURCE_ROWS);
+    ASSERT_THROW(rows.appendText(2, "x"), std::out_of_range);
+}
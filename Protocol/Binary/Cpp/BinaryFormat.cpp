@@ -0,0 +1,77 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Protocol/Binary/Cpp/BinaryFormat.hpp>
+#include <exception>
+
+namespace Protocol
+{
+
+void appendVarint(
+    unsigned long long int const   aValue,
+    std::vector<char>            & aBuffer
+)
+{
+    unsigned long long int value = aValue;
+
+    while (value >= 0x80)
+    {
+        aBuffer.push_back(static_cast<char>((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+
+    aBuffer.push_back(static_cast<char>(value));
+}
+
+unsigned long long int readVarint(
+    char const * & aBegin,
+    char const *   aEnd
+)
+{
+    unsigned long long int value = 0;
+
+    for (unsigned int shift = 0; aBegin != aEnd; shift += 7)
+    {
+        unsigned char const byte = static_cast<unsigned char>(*aBegin++);
+
+        // The tenth byte may carry the top bit only.
+        if (shift == 63 and byte > 1) throw std::exception();
+
+        value |= static_cast<unsigned long long int>(byte & 0x7F) << shift;
+
+        if (not (byte & 0x80))
+        {
+            return value;
+        }
+
+        if (shift == 63) throw std::exception();
+    }
+
+    throw std::exception();
+}
+
+} // namespace Protocol
@@ -0,0 +1,99 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef PROTOCOL_BINARYFORMAT_HPP
+#define PROTOCOL_BINARYFORMAT_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace Protocol
+{
+
+/**
+ * @brief The tags of the fields of a binary message.
+ *
+ * A binary message is a sequence of fields, each one a tag, the length of the value and the value. Tags and lengths
+ * are unsigned LEB128 varints: seven bits per byte, least significant group first, the high bit set on all bytes
+ * but the last. Numeric values are varints as well, texts are raw bytes.
+ *
+ * The identifier comes first, the rest of the fields are interpreted according to it. The fields follow the order
+ * of the XML elements, the first occurrence of a field counts and unknown tags are skipped, so the format may grow.
+ *
+ * The params are carried by the index of the name in the shape of the message (see MessageShape), followed by the
+ * value. An object is a sequence of fields of its own, tagged by the index of the name of the field in the shape.
+ * A command nested in a batch is a complete message.
+ */
+enum BinaryTag
+{
+    BINARY_TAG_ID              = 1,
+    BINARY_TAG_LOGIN           = 2,
+    BINARY_TAG_PASSWORD        = 3,
+    BINARY_TAG_SESSION_TOKEN   = 4,
+    BINARY_TAG_TIMEOUT         = 5,
+    BINARY_TAG_IDEMPOTENCY_KEY = 6,
+    BINARY_TAG_CODE            = 7,
+    BINARY_TAG_MESSAGE         = 8,
+    BINARY_TAG_PARAM           = 9,
+    BINARY_TAG_OBJECT          = 10,
+    BINARY_TAG_COMMAND         = 11
+};
+
+/**
+ * @brief The deepest nesting of commands accepted by the decoder.
+ */
+unsigned int const BINARY_MAX_DEPTH = 8;
+
+/**
+ * @brief Appends a varint.
+ *
+ * @param aValue  The value.
+ * @param aBuffer The buffer.
+ */
+void appendVarint(
+    unsigned long long int const   aValue,
+    std::vector<char>            & aBuffer
+);
+
+/**
+ * @brief Reads a varint.
+ *
+ * @param aBegin The beginning of the varint, moved past it.
+ * @param aEnd   The end of the data.
+ *
+ * @return The value.
+ *
+ * @throw std::exception If the varint is truncated or does not fit 64 bits.
+ */
+unsigned long long int readVarint(
+    char const * & aBegin,
+    char const *   aEnd
+);
+
+} // namespace Protocol
+
+#endif // PROTOCOL_BINARYFORMAT_HPP
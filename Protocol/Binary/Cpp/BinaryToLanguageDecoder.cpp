@@ -0,0 +1,358 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Command.hpp>
+#include <Protocol/Binary/Cpp/BinaryFormat.hpp>
+#include <Protocol/Binary/Cpp/BinaryToLanguageDecoder.hpp>
+#include <Protocol/Xml/Cpp/MessageShape.hpp>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Protocol
+{
+
+namespace
+{
+
+/**
+ * @brief A field of a message, the value pointing into the content.
+ */
+struct Field
+{
+    unsigned long long int mTag;
+
+    char const * mBegin;
+
+    char const * mEnd;
+};
+
+/**
+ * @brief Reads the next field.
+ *
+ * @param aBegin The beginning of the field, moved past it.
+ * @param aEnd   The end of the enclosing value.
+ * @param aField The field.
+ *
+ * @return False if there are no more fields, true otherwise.
+ *
+ * @throw std::exception If the field is truncated.
+ */
+bool readField(
+    char  const * & aBegin,
+    char  const *   aEnd,
+    Field         & aField
+)
+{
+    if (aBegin == aEnd)
+    {
+        return false;
+    }
+
+    aField.mTag = readVarint(aBegin, aEnd);
+    unsigned long long int const length = readVarint(aBegin, aEnd);
+
+    if (length > static_cast<unsigned long long int>(aEnd - aBegin)) throw std::exception();
+
+    aField.mBegin = aBegin;
+    aField.mEnd = aBegin + length;
+    aBegin = aField.mEnd;
+
+    return true;
+}
+
+/**
+ * @brief Reads the numeric value of a field.
+ *
+ * @param aField The field.
+ * @param aMax   The greatest value allowed.
+ *
+ * @throw std::exception If the value is not a single varint, or if it is out of range.
+ */
+unsigned long long int readNumber(
+    Field                  const & aField,
+    unsigned long long int const   aMax
+)
+{
+    char const * it = aField.mBegin;
+    unsigned long long int const value = readVarint(it, aField.mEnd);
+
+    if (it != aField.mEnd or value > aMax) throw std::exception();
+
+    return value;
+}
+
+std::string readText(
+    Field const & aField
+)
+{
+    return std::string(aField.mBegin, aField.mEnd);
+}
+
+/**
+ * @brief Reads an object, the fields of the shape only.
+ *
+ * @throw std::exception If the object is truncated or if a field of the shape is missing.
+ */
+Language::ICommand::Object readObject(
+    MessageShape const & aShape,
+    Field        const & aObject
+)
+{
+    Language::ICommand::Object object;
+
+    unsigned int count = 0;
+
+    while (aShape.mObjectFields[count])
+    {
+        ++count;
+    }
+
+    char const * it = aObject.mBegin;
+    Field field;
+
+    while (readField(it, aObject.mEnd, field))
+    {
+        if (field.mTag < count)
+        {
+            object.insert(std::make_pair(aShape.mObjectFields[field.mTag], readText(field)));
+        }
+    }
+
+    if (object.size() != count) throw std::exception();
+
+    return object;
+}
+
+/**
+ * @brief Reads a message, nested messages included.
+ *
+ * @param aField    The value of the message.
+ * @param aDepth    The nesting of the message, 0 at the top level.
+ * @param aLogin    The login inherited from the enclosing batch request, if the message carries none.
+ * @param aPassword The password inherited from the enclosing batch request, if the message carries none.
+ *
+ * @throw std::exception If the message is truncated, nested too deep, or if it is not valid.
+ */
+Language::ICommand::Handle readMessage(
+    Field        const & aField,
+    unsigned int const   aDepth,
+    std::string  const & aLogin,
+    std::string  const & aPassword
+)
+{
+    if (aDepth > BINARY_MAX_DEPTH) throw std::exception();
+
+    char const * it = aField.mBegin;
+    Field field;
+
+    if (not readField(it, aField.mEnd, field) or field.mTag != BINARY_TAG_ID) throw std::exception();
+
+    MessageShape const * shape =
+        findMessageShape(readNumber(field, std::numeric_limits<unsigned short int>::max()));
+
+    if (not shape) throw std::exception();
+
+    Language::ICommand::Handle command = Language::createCommand();
+    command->setID(shape->mId);
+
+    unsigned int fieldCount = 0;
+
+    while (shape->mFields[fieldCount])
+    {
+        ++fieldCount;
+    }
+
+    bool const reply = shape->mKind == MESSAGE_KIND_BARE_REPLY
+                       or shape->mKind == MESSAGE_KIND_REPLY
+                       or shape->mKind == MESSAGE_KIND_BATCH_REPLY;
+
+    bool const batch = shape->mKind == MESSAGE_KIND_BATCH_REQUEST or shape->mKind == MESSAGE_KIND_BATCH_REPLY;
+
+    // The first occurrence of a field counts, as with the XML elements.
+    unsigned int seen = 0;
+    unsigned int seenParams = 0;
+
+    std::string login;
+    std::string password;
+    std::string sessionToken;
+    std::vector<Field> nested;
+
+    while (readField(it, aField.mEnd, field))
+    {
+        unsigned int const bit = (field.mTag < BINARY_TAG_PARAM) ? (1U << field.mTag) : 0;
+
+        if (seen & bit)
+        {
+            continue;
+        }
+
+        seen |= bit;
+
+        switch (field.mTag)
+        {
+            case BINARY_TAG_LOGIN:         login = readText(field);        break;
+            case BINARY_TAG_PASSWORD:      password = readText(field);     break;
+            case BINARY_TAG_SESSION_TOKEN: sessionToken = readText(field); break;
+
+            case BINARY_TAG_TIMEOUT:
+                if (aDepth == 0)
+                {
+                    command->setTimeout(readNumber(field, std::numeric_limits<unsigned int>::max()));
+                }
+                break;
+
+            case BINARY_TAG_IDEMPOTENCY_KEY:
+                if (aDepth == 0)
+                {
+                    command->setIdempotencyKey(readText(field));
+                }
+                break;
+
+            case BINARY_TAG_CODE:
+                if (reply)
+                {
+                    command->setCode(readNumber(field, std::numeric_limits<unsigned short int>::max()));
+                }
+                break;
+
+            case BINARY_TAG_MESSAGE:
+                if (reply and shape->mKind != MESSAGE_KIND_BARE_REPLY)
+                {
+                    command->setMessage(readText(field));
+                }
+                break;
+
+            case BINARY_TAG_PARAM:
+            {
+                char const * value = field.mBegin;
+                unsigned long long int const index = readVarint(value, field.mEnd);
+
+                if (index < fieldCount and not (seenParams & (1U << index)))
+                {
+                    seenParams |= 1U << index;
+                    command->setParam(shape->mFields[index], std::string(value, field.mEnd));
+                }
+                break;
+            }
+
+            case BINARY_TAG_OBJECT:
+                // A single object is carried unless the message has a container.
+                if (shape->mObject and (shape->mContainer or command->getObjects().empty()))
+                {
+                    command->addObject(readObject(*shape, field));
+                }
+                break;
+
+            case BINARY_TAG_COMMAND:
+                if (batch)
+                {
+                    nested.push_back(field);
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    // The session token takes the place of the password.
+    unsigned int const credentials =
+        (1U << BINARY_TAG_LOGIN) | (1U << BINARY_TAG_PASSWORD) | (1U << BINARY_TAG_SESSION_TOKEN);
+
+    bool const hasUser = (seen & credentials) != 0;
+
+    if (    hasUser
+        and not (    (seen & (1U << BINARY_TAG_LOGIN))
+                 and (seen & ((1U << BINARY_TAG_PASSWORD) | (1U << BINARY_TAG_SESSION_TOKEN)))))
+    {
+        throw std::exception();
+    }
+
+    if (shape->mKind == MESSAGE_KIND_REQUEST or shape->mKind == MESSAGE_KIND_BATCH_REQUEST)
+    {
+        command->setLogin(hasUser ? login : aLogin);
+        command->setPassword(hasUser ? password : aPassword);
+    }
+
+    if (aDepth == 0 and (seen & (1U << BINARY_TAG_SESSION_TOKEN)))
+    {
+        command->setSessionToken(sessionToken);
+    }
+
+    if (reply)
+    {
+        if (not (seen & (1U << BINARY_TAG_CODE))) throw std::exception();
+
+        if (shape->mKind != MESSAGE_KIND_BARE_REPLY and not (seen & (1U << BINARY_TAG_MESSAGE))) throw std::exception();
+    }
+
+    if (seenParams != (1U << fieldCount) - 1) throw std::exception();
+
+    // The messages nested in a batch request act on behalf of the user of the batch unless they carry their own.
+    bool const inherits = shape->mKind == MESSAGE_KIND_BATCH_REQUEST;
+
+    for (std::vector<Field>::const_iterator nestedIt = nested.begin(); nestedIt != nested.end(); ++nestedIt)
+    {
+        command->addCommand(
+            readMessage(
+                *nestedIt,
+                aDepth + 1,
+                inherits ? command->getLogin() : std::string(),
+                inherits ? command->getPassword() : std::string()
+            )
+        );
+    }
+
+    return command;
+}
+
+} // namespace
+
+Language::ICommand::Handle BinaryToLanguageDecoder::decode(
+    char        const * aContent,
+    std::size_t const   aLength
+) const
+{
+    Field message;
+    message.mTag = 0;
+    message.mBegin = aContent;
+    message.mEnd = aContent + aLength;
+
+    return readMessage(message, 0, std::string(), std::string());
+}
+
+Language::ICommand::Handle BinaryToLanguageDecoder::decode(
+    Payload const & aPayload
+) const
+{
+    std::string const & content = aPayload.getContent();
+
+    return decode(content.data(), content.size());
+}
+
+} // namespace Protocol
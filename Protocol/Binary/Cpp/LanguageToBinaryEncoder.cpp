@@ -0,0 +1,276 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Protocol/Binary/Cpp/BinaryFormat.hpp>
+#include <Protocol/Binary/Cpp/LanguageToBinaryEncoder.hpp>
+#include <Protocol/Xml/Cpp/MessageShape.hpp>
+#include <algorithm>
+#include <string>
+
+namespace Protocol
+{
+
+namespace
+{
+
+void appendNumber(
+    unsigned int           const   aTag,
+    unsigned long long int const   aValue,
+    std::vector<char>            & aBuffer
+)
+{
+    appendVarint(aTag, aBuffer);
+
+    // The length of the varint, known up front.
+    unsigned int length = 1;
+
+    for (unsigned long long int value = aValue; value >= 0x80; value >>= 7)
+    {
+        ++length;
+    }
+
+    appendVarint(length, aBuffer);
+    appendVarint(aValue, aBuffer);
+}
+
+void appendText(
+    unsigned int      const   aTag,
+    char              const * aText,
+    std::size_t       const   aLength,
+    std::vector<char>       & aBuffer
+)
+{
+    appendVarint(aTag, aBuffer);
+    appendVarint(aLength, aBuffer);
+    aBuffer.insert(aBuffer.end(), aText, aText + aLength);
+}
+
+void appendText(
+    unsigned int      const   aTag,
+    std::string       const & aText,
+    std::vector<char>       & aBuffer
+)
+{
+    appendText(aTag, aText.data(), aText.size(), aBuffer);
+}
+
+/**
+ * @brief Prefixes the value appended since a given offset with its length.
+ *
+ * Nested values are appended first and moved by the few bytes of their length afterwards, so no temporary buffer
+ * is needed.
+ */
+void prefixLength(
+    std::size_t       const   aOffset,
+    std::vector<char>       & aBuffer
+)
+{
+    std::vector<char> length;
+    appendVarint(aBuffer.size() - aOffset, length);
+    aBuffer.insert(aBuffer.begin() + aOffset, length.begin(), length.end());
+}
+
+/**
+ * @brief Appends an object, the fields of the shape only.
+ */
+void appendObject(
+    MessageShape               const & aShape,
+    Language::ICommand::Object const & aObject,
+    std::vector<char>                & aBuffer
+)
+{
+    appendVarint(BINARY_TAG_OBJECT, aBuffer);
+    std::size_t const offset = aBuffer.size();
+
+    for (unsigned int i = 0; aShape.mObjectFields[i]; ++i)
+    {
+        Language::ICommand::Object::const_iterator const it = aObject.find(aShape.mObjectFields[i]);
+
+        if (it != aObject.end())
+        {
+            appendText(i, it->second, aBuffer);
+        }
+    }
+
+    prefixLength(offset, aBuffer);
+}
+
+/**
+ * @brief Appends the rows as objects, the fields of the shape only.
+ *
+ * The columns of the fields are looked up once for all the rows.
+ */
+void appendRows(
+    MessageShape      const & aShape,
+    Language::Rows    const & aRows,
+    std::vector<char>       & aBuffer
+)
+{
+    unsigned int const MISSING = ~0u;
+    unsigned int columns[sizeof(aShape.mObjectFields) / sizeof(aShape.mObjectFields[0])];
+
+    for (unsigned int i = 0; aShape.mObjectFields[i]; ++i)
+    {
+        if (not aRows.findColumn(aShape.mObjectFields[i], columns[i]))
+        {
+            columns[i] = MISSING;
+        }
+    }
+
+    // A single object is carried unless the message has a container.
+    std::size_t const count = aShape.mContainer ? aRows.getRowCount() : std::min<std::size_t>(aRows.getRowCount(), 1);
+
+    for (std::size_t row = 0; row < count; ++row)
+    {
+        appendVarint(BINARY_TAG_OBJECT, aBuffer);
+        std::size_t const offset = aBuffer.size();
+
+        for (unsigned int i = 0; aShape.mObjectFields[i]; ++i)
+        {
+            if (columns[i] != MISSING)
+            {
+                Language::Rows::Cell const cell = aRows.getCell(row, columns[i]);
+                appendText(i, cell.m_data, cell.m_size, aBuffer);
+            }
+        }
+
+        prefixLength(offset, aBuffer);
+    }
+}
+
+/**
+ * @brief Appends a message, nested messages included.
+ *
+ * @param aTopLevel Whether the message is not nested in a batch.
+ *
+ * @throw std::exception If the identifier is unknown, or if a param is missing.
+ */
+void appendMessage(
+    Language::ICommand::Handle         aCommand,
+    bool                       const   aTopLevel,
+    std::vector<char>                & aBuffer
+)
+{
+    MessageShape const * shape = findMessageShape(aCommand->getID());
+
+    if (not shape) throw std::exception();
+
+    appendNumber(BINARY_TAG_ID, shape->mId, aBuffer);
+
+    // The session token takes the place of the password, as in the XML.
+    if (shape->mKind == MESSAGE_KIND_REQUEST or shape->mKind == MESSAGE_KIND_BATCH_REQUEST)
+    {
+        appendText(BINARY_TAG_LOGIN, aCommand->getLogin(), aBuffer);
+
+        if (aTopLevel and not aCommand->getSessionToken().empty())
+        {
+            appendText(BINARY_TAG_SESSION_TOKEN, aCommand->getSessionToken(), aBuffer);
+        }
+        else
+        {
+            appendText(BINARY_TAG_PASSWORD, aCommand->getPassword(), aBuffer);
+        }
+    }
+
+    if (aTopLevel and aCommand->getTimeout())
+    {
+        appendNumber(BINARY_TAG_TIMEOUT, aCommand->getTimeout(), aBuffer);
+    }
+
+    if (aTopLevel and not aCommand->getIdempotencyKey().empty())
+    {
+        appendText(BINARY_TAG_IDEMPOTENCY_KEY, aCommand->getIdempotencyKey(), aBuffer);
+    }
+
+    bool const reply = shape->mKind == MESSAGE_KIND_BARE_REPLY
+                       or shape->mKind == MESSAGE_KIND_REPLY
+                       or shape->mKind == MESSAGE_KIND_BATCH_REPLY;
+
+    if (reply)
+    {
+        appendNumber(BINARY_TAG_CODE, aCommand->getCode(), aBuffer);
+
+        if (shape->mKind != MESSAGE_KIND_BARE_REPLY)
+        {
+            appendText(BINARY_TAG_MESSAGE, aCommand->getMessage(), aBuffer);
+        }
+    }
+
+    for (unsigned int i = 0; shape->mFields[i]; ++i)
+    {
+        std::string const value = aCommand->getParam(shape->mFields[i]);
+
+        appendVarint(BINARY_TAG_PARAM, aBuffer);
+        std::size_t const offset = aBuffer.size();
+        appendVarint(i, aBuffer);
+        aBuffer.insert(aBuffer.end(), value.begin(), value.end());
+        prefixLength(offset, aBuffer);
+    }
+
+    // The rows are written as they are stored, never made into objects.
+    if (shape->mObject and aCommand->getRows().getColumnCount())
+    {
+        appendRows(*shape, aCommand->getRows(), aBuffer);
+    }
+    else if (shape->mObject and not aCommand->getObjects().empty())
+    {
+        Language::ICommand::Objects const & objects = aCommand->getObjects();
+
+        // A single object is carried unless the message has a container.
+        Language::ICommand::Objects::const_iterator const end = shape->mContainer ? objects.end() : objects.begin() + 1;
+
+        for (Language::ICommand::Objects::const_iterator it = objects.begin(); it != end; ++it)
+        {
+            appendObject(*shape, *it, aBuffer);
+        }
+    }
+
+    if (shape->mKind == MESSAGE_KIND_BATCH_REQUEST or shape->mKind == MESSAGE_KIND_BATCH_REPLY)
+    {
+        Language::ICommand::Commands const & commands = aCommand->getCommands();
+
+        for (Language::ICommand::Commands::const_iterator it = commands.begin(); it != commands.end(); ++it)
+        {
+            appendVarint(BINARY_TAG_COMMAND, aBuffer);
+            std::size_t const offset = aBuffer.size();
+            appendMessage(*it, false, aBuffer);
+            prefixLength(offset, aBuffer);
+        }
+    }
+}
+
+} // namespace
+
+void LanguageToBinaryEncoder::encode(
+    Language::ICommand::Handle   aCommand,
+    std::vector<char>          & aBuffer
+) const
+{
+    appendMessage(aCommand, true, aBuffer);
+}
+
+} // namespace Protocol
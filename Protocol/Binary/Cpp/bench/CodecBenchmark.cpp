@@ -0,0 +1,285 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <Poco/Timestamp.h>
+#include <Protocol/Binary/Cpp/BinaryToLanguageDecoder.hpp>
+#include <Protocol/Binary/Cpp/LanguageToBinaryEncoder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToPayloadEncoder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToProtocolTranslator.hpp>
+#include <Protocol/Xml/Cpp/Payload.hpp>
+#include <Protocol/Xml/Cpp/PayloadToLanguageDecoder.hpp>
+#include <Protocol/Xml/Cpp/PayloadToProtocolTranslator.hpp>
+#include <Protocol/Xml/Cpp/ProtocolToLanguageTranslator.hpp>
+#include <boost/lexical_cast.hpp>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Measures the encode and decode throughput of the binary codec against the XML translators.
+ *
+ * Usage: codecbench <objects per reply> <iterations>
+ *
+ * Each collection reply is built with the given number of objects and goes through every codec: the XML built as
+ * a DOM, the XML written and parsed directly, and the binary format. The figures tell what a connection gains
+ * by negotiating the binary codec.
+ */
+
+namespace
+{
+
+struct Sample
+{
+    std::string mName;
+
+    Language::ICommand::Handle mCommand;
+};
+
+enum Codec
+{
+    CODEC_XML_DOM,
+    CODEC_XML_DIRECT,
+    CODEC_BINARY
+};
+
+char const * const CODEC_NAMES[] = {"xml dom", "xml direct", "binary"};
+
+Language::ICommand::Objects createObjects(
+    char const * const * aKeys,
+    std::size_t  const   aNumberOfKeys,
+    unsigned int const   aNumberOfObjects
+)
+{
+    Language::ICommand::Objects objects;
+
+    for (unsigned int i = 0; i < aNumberOfObjects; ++i)
+    {
+        Language::ICommand::Object object;
+
+        for (std::size_t j = 0; j < aNumberOfKeys; ++j)
+        {
+            object.insert(std::make_pair(aKeys[j], std::string(aKeys[j]) + boost::lexical_cast<std::string>(i % 16)));
+        }
+
+        objects.push_back(object);
+    }
+
+    return objects;
+}
+
+std::vector<Sample> createSamples(
+    unsigned int const aNumberOfObjects
+)
+{
+    static char const * const HUMAN_KEYS[] = {"humanclass", "humanname", "experience", "volume"};
+    static char const * const BUILDING_KEYS[] = {"buildingclass", "buildingname", "volume"};
+    static char const * const RESOURCE_KEYS[] = {"resourcename", "volume"};
+    static char const * const LAND_KEYS[] = {"login", "world_name", "land_name", "granted"};
+    static char const * const SETTLEMENT_KEYS[] = {"land_name", "settlement_name"};
+
+    Language::ReplyBuilder replyBuilder;
+    std::vector<Sample> samples;
+
+    Sample sample;
+
+    sample.mName = "get_humans";
+    sample.mCommand = replyBuilder.buildGetHumansReply(1, "", createObjects(HUMAN_KEYS, 4, aNumberOfObjects));
+    samples.push_back(sample);
+
+    sample.mName = "get_buildings";
+    sample.mCommand = replyBuilder.buildGetBuildingsReply(1, "", createObjects(BUILDING_KEYS, 3, aNumberOfObjects));
+    samples.push_back(sample);
+
+    sample.mName = "get_resources";
+    sample.mCommand = replyBuilder.buildGetResourcesReply(1, "", createObjects(RESOURCE_KEYS, 2, aNumberOfObjects));
+    samples.push_back(sample);
+
+    sample.mName = "get_lands";
+    sample.mCommand = replyBuilder.buildGetLandsReply(1, "", createObjects(LAND_KEYS, 4, aNumberOfObjects));
+    samples.push_back(sample);
+
+    sample.mName = "get_settlements";
+    sample.mCommand =
+        replyBuilder.buildGetSettlementsReply(1, "", createObjects(SETTLEMENT_KEYS, 2, aNumberOfObjects));
+    samples.push_back(sample);
+
+    return samples;
+}
+
+std::string encode(
+    Codec                      const aCodec,
+    Language::ICommand::Handle const aCommand
+)
+{
+    switch (aCodec)
+    {
+        case CODEC_XML_DOM:
+        {
+            Protocol::LanguageToProtocolTranslator languageToProtocolTranslator;
+
+            return Protocol::Payload(languageToProtocolTranslator.translate(aCommand)).getContent();
+        }
+
+        case CODEC_XML_DIRECT:
+        {
+            Protocol::LanguageToPayloadEncoder languageToPayloadEncoder;
+            std::vector<char> buffer;
+            languageToPayloadEncoder.encode(aCommand, buffer);
+
+            return std::string(buffer.begin(), buffer.end());
+        }
+
+        default:
+        {
+            Protocol::LanguageToBinaryEncoder languageToBinaryEncoder;
+            std::vector<char> buffer;
+            languageToBinaryEncoder.encode(aCommand, buffer);
+
+            return std::string(buffer.begin(), buffer.end());
+        }
+    }
+}
+
+Language::ICommand::Handle decode(
+    Codec             const   aCodec,
+    Protocol::Payload const & aPayload
+)
+{
+    switch (aCodec)
+    {
+        case CODEC_XML_DOM:
+        {
+            Protocol::PayloadToProtocolTranslator payloadToProtocolTranslator;
+            Protocol::ProtocolToLanguageTranslator protocolToLanguageTranslator;
+
+            return protocolToLanguageTranslator.translate(payloadToProtocolTranslator.translate(aPayload));
+        }
+
+        case CODEC_XML_DIRECT:
+        {
+            Protocol::PayloadToLanguageDecoder payloadToLanguageDecoder(Protocol::DECODING_MODE_FAST);
+
+            return payloadToLanguageDecoder.decode(aPayload);
+        }
+
+        default:
+        {
+            Protocol::BinaryToLanguageDecoder binaryToLanguageDecoder;
+
+            return binaryToLanguageDecoder.decode(aPayload);
+        }
+    }
+}
+
+/**
+ * @brief Turns the time spent on the iterations to megabytes of content per second.
+ */
+double toThroughput(
+    std::size_t               const aLength,
+    unsigned int              const aIterations,
+    Poco::Timestamp::TimeDiff const aElapsed
+)
+{
+    return aElapsed ? static_cast<double>(aLength) * aIterations / aElapsed : 0.0;
+}
+
+} // namespace
+
+int main(
+    int     aNumberOfArguments,
+    char ** aArguments
+)
+{
+    if (aNumberOfArguments != 3)
+    {
+        std::cerr << "Usage: " << aArguments[0] << " <objects per reply> <iterations>" << std::endl;
+        return 1;
+    }
+
+    unsigned int const numberOfObjects = boost::lexical_cast<unsigned int>(aArguments[1]);
+    unsigned int const iterations = boost::lexical_cast<unsigned int>(aArguments[2]);
+
+    if (iterations == 0)
+    {
+        std::cerr << "The number of iterations has to be positive." << std::endl;
+        return 1;
+    }
+
+    std::vector<Sample> const samples = createSamples(numberOfObjects);
+    Codec const codecs[] = {CODEC_XML_DOM, CODEC_XML_DIRECT, CODEC_BINARY};
+
+    std::cout << std::left
+              << std::setw(16) << "reply"
+              << std::setw(12) << "codec"
+              << std::setw(12) << "wire [B]"
+              << std::setw(14) << "encode [us]"
+              << std::setw(14) << "decode [us]"
+              << std::setw(16) << "encode [MB/s]"
+              << std::setw(16) << "decode [MB/s]"
+              << std::endl;
+
+    for (std::vector<Sample>::const_iterator it = samples.begin(); it != samples.end(); ++it)
+    {
+        for (std::size_t i = 0; i < sizeof(codecs) / sizeof(codecs[0]); ++i)
+        {
+            std::string content;
+
+            Poco::Timestamp encodeStart;
+
+            for (unsigned int j = 0; j < iterations; ++j)
+            {
+                content = encode(codecs[i], it->mCommand);
+            }
+
+            Poco::Timestamp::TimeDiff const encodeElapsed = encodeStart.elapsed();
+            Protocol::Payload const payload(content.data(), content.length());
+            Language::ICommand::Handle command;
+
+            Poco::Timestamp decodeStart;
+
+            for (unsigned int j = 0; j < iterations; ++j)
+            {
+                command = decode(codecs[i], payload);
+            }
+
+            Poco::Timestamp::TimeDiff const decodeElapsed = decodeStart.elapsed();
+
+            std::cout << std::setw(16) << it->mName
+                      << std::setw(12) << CODEC_NAMES[codecs[i]]
+                      << std::setw(12) << content.length()
+                      << std::setw(14) << static_cast<double>(encodeElapsed) / iterations
+                      << std::setw(14) << static_cast<double>(decodeElapsed) / iterations
+                      << std::setw(16) << std::setprecision(4) << toThroughput(content.length(), iterations, encodeElapsed)
+                      << std::setw(16) << std::setprecision(4) << toThroughput(content.length(), iterations, decodeElapsed)
+                      << std::endl;
+        }
+    }
+
+    return 0;
+}
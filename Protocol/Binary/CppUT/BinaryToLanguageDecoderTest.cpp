@@ -0,0 +1,290 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Command.hpp>
+#include <Protocol/Binary/Cpp/BinaryFormat.hpp>
+#include <Protocol/Binary/Cpp/BinaryToLanguageDecoder.hpp>
+#include <Protocol/Binary/Cpp/LanguageToBinaryEncoder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToProtocolTranslator.hpp>
+#include <Protocol/Xml/Cpp/MessageShape.hpp>
+#include <Protocol/Xml/Cpp/ProtocolToLanguageTranslator.hpp>
+#include <boost/lexical_cast.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+class BinaryToLanguageDecoderTest
+    : public ::testing::Test
+{
+protected:
+    /**
+     * @brief Builds a command of the given identifier, every element of its message set.
+     */
+    Language::ICommand::Handle createSample(
+        unsigned short int const aId,
+        bool               const aTopLevel = true
+    ) const
+    {
+        Protocol::MessageShape const & shape = *Protocol::findMessageShape(aId);
+        std::string const suffix = boost::lexical_cast<std::string>(aId);
+
+        Language::ICommand::Handle command(new Language::Command);
+        command->setID(aId);
+        command->setLogin("Login" + suffix);
+        command->setPassword("Password" + suffix);
+
+        if (aTopLevel)
+        {
+            // Both the password and the session token make it to the wire.
+            if (aId % 2)
+            {
+                command->setSessionToken("Token" + suffix);
+            }
+
+            command->setTimeout(1000U * aId);
+            command->setIdempotencyKey("Key" + suffix);
+        }
+
+        command->setCode(aId);
+        command->setMessage("Message <" + suffix + ">");
+
+        for (char const * const * field = shape.mFields; *field; ++field)
+        {
+            command->setParam(*field, std::string(*field) + suffix);
+        }
+
+        if (shape.mObject)
+        {
+            for (unsigned int i = 0; i < (shape.mContainer ? 3U : 1U); ++i)
+            {
+                Language::ICommand::Object object;
+
+                for (char const * const * field = shape.mObjectFields; *field; ++field)
+                {
+                    object.insert(std::make_pair(*field, std::string(*field) + boost::lexical_cast<std::string>(i)));
+                }
+
+                command->addObject(object);
+            }
+        }
+
+        if (shape.mKind == Protocol::MESSAGE_KIND_BATCH_REQUEST)
+        {
+            command->addCommand(createSample(Language::ID_COMMAND_CREATE_LAND_REQUEST, false));
+            command->addCommand(createSample(Language::ID_COMMAND_GET_LANDS_REQUEST, false));
+        }
+
+        if (shape.mKind == Protocol::MESSAGE_KIND_BATCH_REPLY)
+        {
+            command->addCommand(createSample(Language::ID_COMMAND_ECHO_REPLY, false));
+            command->addCommand(createSample(Language::ID_COMMAND_GET_LANDS_REPLY, false));
+        }
+
+        return command;
+    }
+
+    Language::ICommand::Handle roundTrip(
+        Language::ICommand::Handle aCommand
+    ) const
+    {
+        std::vector<char> buffer;
+        mEncoder.encode(aCommand, buffer);
+
+        return mDecoder.decode(&buffer[0], buffer.size());
+    }
+
+    Language::ICommand::Handle decode(
+        std::string const & aContent
+    ) const
+    {
+        return mDecoder.decode(aContent.data(), aContent.size());
+    }
+
+    void expectIdentical(
+        Language::ICommand::Handle aExpected,
+        Language::ICommand::Handle aActual
+    ) const
+    {
+        EXPECT_EQ(aExpected->getID(), aActual->getID());
+        EXPECT_EQ(aExpected->getLogin(), aActual->getLogin());
+        EXPECT_EQ(aExpected->getPassword(), aActual->getPassword());
+        EXPECT_EQ(aExpected->getSessionToken(), aActual->getSessionToken());
+        EXPECT_EQ(aExpected->getTimeout(), aActual->getTimeout());
+        EXPECT_EQ(aExpected->getIdempotencyKey(), aActual->getIdempotencyKey());
+        EXPECT_EQ(aExpected->getCode(), aActual->getCode());
+        EXPECT_EQ(aExpected->getMessage(), aActual->getMessage());
+        EXPECT_TRUE(aExpected->getObjects() == aActual->getObjects());
+
+        Protocol::MessageShape const & shape = *Protocol::findMessageShape(aExpected->getID());
+
+        for (char const * const * field = shape.mFields; *field; ++field)
+        {
+            EXPECT_EQ(aExpected->getParam(*field), aActual->getParam(*field));
+        }
+
+        ASSERT_EQ(aExpected->getCommands().size(), aActual->getCommands().size());
+
+        for (size_t i = 0; i < aExpected->getCommands().size(); ++i)
+        {
+            expectIdentical(aExpected->getCommands()[i], aActual->getCommands()[i]);
+        }
+    }
+
+    Protocol::LanguageToBinaryEncoder mEncoder;
+    Protocol::BinaryToLanguageDecoder mDecoder;
+};
+
+TEST_F(BinaryToLanguageDecoderTest, EveryCommandRoundTripsAsThroughTheXml)
+{
+    Protocol::LanguageToProtocolTranslator languageToProtocolTranslator;
+    Protocol::ProtocolToLanguageTranslator protocolToLanguageTranslator;
+
+    for (unsigned short int id = 1; Protocol::findMessageShape(id); ++id)
+    {
+        SCOPED_TRACE(id);
+
+        Language::ICommand::Handle const command = createSample(id);
+
+        expectIdentical(
+            protocolToLanguageTranslator.translate(languageToProtocolTranslator.translate(command)),
+            roundTrip(command)
+        );
+    }
+}
+
+TEST_F(BinaryToLanguageDecoderTest, DecodesFromPayload)
+{
+    std::vector<char> buffer;
+    mEncoder.encode(createSample(Language::ID_COMMAND_GET_LAND_REQUEST), buffer);
+
+    expectIdentical(roundTrip(createSample(Language::ID_COMMAND_GET_LAND_REQUEST)),
+                    mDecoder.decode(Protocol::Payload(&buffer[0], buffer.size())));
+}
+
+TEST_F(BinaryToLanguageDecoderTest, NestedRequestsWithoutUserInheritTheUserOfTheBatch)
+{
+    Language::ICommand::Handle const command =
+        decode(std::string("\x01\x01\x3F" "\x02\x01L" "\x03\x01P" "\x09\x02\x00\x31" "\x0B\x03\x01\x01\x06", 18));
+
+    ASSERT_EQ(1, command->getCommands().size());
+    ASSERT_EQ("L", command->getCommands().front()->getLogin());
+    ASSERT_EQ("P", command->getCommands().front()->getPassword());
+}
+
+TEST_F(BinaryToLanguageDecoderTest, NestedMessagesIgnoreTimeoutAndIdempotencyKey)
+{
+    Language::ICommand::Handle const command =
+        decode(std::string("\x01\x01\x40" "\x07\x01\x01" "\x08\x00" "\x0B\x09\x01\x01\x20\x07\x01\x01\x05\x01\x07", 19));
+
+    ASSERT_EQ(1, command->getCommands().size());
+    ASSERT_EQ(0, command->getCommands().front()->getTimeout());
+}
+
+TEST_F(BinaryToLanguageDecoderTest, SkipsUnknownTags)
+{
+    Language::ICommand::Handle const command = decode(std::string("\x01\x01\x20" "\x7F\x02xx" "\x07\x01\x02", 10));
+
+    ASSERT_EQ(32, command->getID());
+    ASSERT_EQ(2, command->getCode());
+}
+
+TEST_F(BinaryToLanguageDecoderTest, FirstOccurrenceOfFieldCounts)
+{
+    Language::ICommand::Handle const command = decode(std::string("\x01\x01\x20" "\x07\x01\x02" "\x07\x01\x03", 9));
+
+    ASSERT_EQ(2, command->getCode());
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnEmptyContent)
+{
+    ASSERT_THROW(decode(""), std::exception);
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnTruncatedField)
+{
+    ASSERT_THROW(decode(std::string("\x01\x01\x20" "\x07\x02\x01", 6)), std::exception);
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnIdentifierNotFirst)
+{
+    ASSERT_THROW(decode(std::string("\x07\x01\x01" "\x01\x01\x20", 6)), std::exception);
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnUnknownIdentifier)
+{
+    ASSERT_THROW(decode(std::string("\x01\x01\x00", 3)), std::exception);
+    ASSERT_THROW(decode(std::string("\x01\x03\x81\x80\x04", 5)), std::exception);
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnTrailingBytesOfNumber)
+{
+    ASSERT_THROW(decode(std::string("\x01\x02\x01\x00", 4)), std::exception);
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnMissingParam)
+{
+    ASSERT_THROW(decode(std::string("\x01\x01\x04" "\x02\x01L" "\x03\x01P", 9)), std::exception);
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnMissingCode)
+{
+    ASSERT_THROW(decode(std::string("\x01\x01\x20", 3)), std::exception);
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnMissingMessage)
+{
+    ASSERT_THROW(decode(std::string("\x01\x01\x22" "\x07\x01\x01", 6)), std::exception);
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnLoginWithoutPasswordOrSessionToken)
+{
+    ASSERT_THROW(decode(std::string("\x01\x01\x06" "\x02\x01L", 6)), std::exception);
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnIncompleteObject)
+{
+    ASSERT_THROW(
+        decode(std::string("\x01\x01\x33" "\x07\x01\x01" "\x08\x00" "\x0A\x06\x00\x04" "coal", 16)),
+        std::exception
+    );
+}
+
+TEST_F(BinaryToLanguageDecoderTest, ThrowsOnNestingTooDeep)
+{
+    std::string content("\x01\x01\x20\x07\x01\x01", 6);
+
+    for (unsigned int i = 0; i <= Protocol::BINARY_MAX_DEPTH; ++i)
+    {
+        std::vector<char> length;
+        Protocol::appendVarint(content.size(), length);
+
+        content = std::string("\x01\x01\x40\x07\x01\x01\x08\x00\x0B", 9) + std::string(length.begin(), length.end())
+                + content;
+    }
+
+    ASSERT_THROW(decode(content), std::exception);
+}
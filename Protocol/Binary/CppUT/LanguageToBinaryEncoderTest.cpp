@@ -0,0 +1,257 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Command.hpp>
+#include <Protocol/Binary/Cpp/BinaryFormat.hpp>
+#include <Protocol/Binary/Cpp/LanguageToBinaryEncoder.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+class LanguageToBinaryEncoderTest
+    : public ::testing::Test
+{
+protected:
+    std::string encode(
+        Language::ICommand::Handle aCommand
+    ) const
+    {
+        std::vector<char> buffer;
+        mEncoder.encode(aCommand, buffer);
+
+        return std::string(buffer.begin(), buffer.end());
+    }
+
+    Protocol::LanguageToBinaryEncoder mEncoder;
+};
+
+TEST_F(LanguageToBinaryEncoderTest, VarintsTakeSevenBitsPerByte)
+{
+    std::vector<char> buffer;
+
+    Protocol::appendVarint(0, buffer);
+    Protocol::appendVarint(127, buffer);
+    Protocol::appendVarint(128, buffer);
+    Protocol::appendVarint(300, buffer);
+
+    ASSERT_EQ(std::string("\x00\x7F\x80\x01\xAC\x02", 6), std::string(buffer.begin(), buffer.end()));
+}
+
+TEST_F(LanguageToBinaryEncoderTest, VarintsRoundTripUpTo64Bits)
+{
+    unsigned long long int const values[] = {0ULL, 1ULL, 127ULL, 128ULL, 16384ULL, 0xFFFFFFFFULL, ~0ULL};
+
+    for (std::size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+    {
+        std::vector<char> buffer;
+        Protocol::appendVarint(values[i], buffer);
+
+        char const * it = &buffer[0];
+        ASSERT_EQ(values[i], Protocol::readVarint(it, &buffer[0] + buffer.size()));
+        ASSERT_EQ(&buffer[0] + buffer.size(), it);
+    }
+}
+
+TEST_F(LanguageToBinaryEncoderTest, ReadingThrowsOnTruncatedVarint)
+{
+    char const data[] = "\x80\x80";
+    char const * it = data;
+
+    ASSERT_THROW(Protocol::readVarint(it, data + 2), std::exception);
+}
+
+TEST_F(LanguageToBinaryEncoderTest, ReadingThrowsOnVarintBeyond64Bits)
+{
+    char const data[] = "\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\xFF\x02";
+    char const * it = data;
+
+    ASSERT_THROW(Protocol::readVarint(it, data + 10), std::exception);
+}
+
+TEST_F(LanguageToBinaryEncoderTest, EncodesBareRequest)
+{
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(1);
+
+    ASSERT_EQ(std::string("\x01\x01\x01", 3), encode(command));
+}
+
+TEST_F(LanguageToBinaryEncoderTest, EncodesRequest)
+{
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(4);
+    command->setLogin("Login");
+    command->setPassword("Pass");
+    command->setParam("land_name", "Land");
+
+    ASSERT_EQ(
+        std::string("\x01\x01\x04" "\x02\x05Login" "\x03\x04Pass" "\x09\x05\x00Land", 23),
+        encode(command)
+    );
+}
+
+TEST_F(LanguageToBinaryEncoderTest, SessionTokenTakesThePlaceOfThePassword)
+{
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(6);
+    command->setLogin("L");
+    command->setPassword("P");
+    command->setSessionToken("T");
+
+    ASSERT_EQ(std::string("\x01\x01\x06" "\x02\x01L" "\x04\x01T", 9), encode(command));
+}
+
+TEST_F(LanguageToBinaryEncoderTest, EncodesTimeoutAndIdempotencyKey)
+{
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(1);
+    command->setTimeout(300);
+    command->setIdempotencyKey("K");
+
+    ASSERT_EQ(std::string("\x01\x01\x01" "\x05\x02\xAC\x02" "\x06\x01K", 10), encode(command));
+}
+
+TEST_F(LanguageToBinaryEncoderTest, EncodesBareReply)
+{
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(32);
+    command->setCode(1);
+
+    ASSERT_EQ(std::string("\x01\x01\x20" "\x07\x01\x01", 6), encode(command));
+}
+
+TEST_F(LanguageToBinaryEncoderTest, EncodesObjectsByTheIndexOfTheirFields)
+{
+    Language::ICommand::Object object;
+    object.insert(std::make_pair("resourcename", "coal"));
+    object.insert(std::make_pair("volume", "5"));
+
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(51);
+    command->setCode(1);
+    command->setMessage("");
+    command->addObject(object);
+    command->addObject(object);
+
+    std::string const encodedObject("\x0A\x09" "\x00\x04" "coal" "\x01\x01" "5", 11);
+
+    ASSERT_EQ(std::string("\x01\x01\x33" "\x07\x01\x01" "\x08\x00", 8) + encodedObject + encodedObject, encode(command));
+}
+
+TEST_F(LanguageToBinaryEncoderTest, EncodesRowsByTheIndexOfTheirFields)
+{
+    Language::Rows humans(Language::HUMAN_ROWS);
+
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        humans.appendText(Language::HUMAN_COLUMN_EXPERIENCE, "N");
+        humans.appendText(Language::HUMAN_COLUMN_HUMANCLASS, "W");
+        humans.appendText(Language::HUMAN_COLUMN_HUMANNAME, "B");
+        humans.appendNumber(Language::HUMAN_COLUMN_VOLUME, 7);
+    }
+
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(49);
+    command->setCode(1);
+    command->setMessage("");
+    command->setRows(humans);
+
+    std::string const encodedObject("\x0A\x0C" "\x00\x01W" "\x01\x01" "B" "\x02\x01N" "\x03\x01" "7", 14);
+
+    ASSERT_EQ(
+        std::string("\x01\x01\x31" "\x07\x01\x01" "\x08\x00", 8) + encodedObject + encodedObject,
+        encode(command)
+    );
+}
+
+TEST_F(LanguageToBinaryEncoderTest, EncodesTheFirstObjectOfSingleObjectReply)
+{
+    Language::ICommand::Object object;
+    object.insert(std::make_pair("resourcename", "coal"));
+    object.insert(std::make_pair("volume", "5"));
+
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(50);
+    command->setCode(1);
+    command->setMessage("");
+    command->addObject(object);
+    command->addObject(object);
+
+    ASSERT_EQ(
+        std::string("\x01\x01\x32" "\x07\x01\x01" "\x08\x00" "\x0A\x09" "\x00\x04" "coal" "\x01\x01" "5", 19),
+        encode(command)
+    );
+}
+
+TEST_F(LanguageToBinaryEncoderTest, EncodesNestedCommands)
+{
+    Language::ICommand::Handle nested(new Language::Command);
+    nested->setID(32);
+    nested->setCode(1);
+
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(64);
+    command->setCode(1);
+    command->setMessage("M");
+    command->addCommand(nested);
+
+    ASSERT_EQ(
+        std::string("\x01\x01\x40" "\x07\x01\x01" "\x08\x01M" "\x0B\x06" "\x01\x01\x20" "\x07\x01\x01", 17),
+        encode(command)
+    );
+}
+
+TEST_F(LanguageToBinaryEncoderTest, AppendsToBuffer)
+{
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(1);
+
+    std::vector<char> buffer(1, 'x');
+    mEncoder.encode(command, buffer);
+
+    ASSERT_EQ(std::string("x\x01\x01\x01", 4), std::string(buffer.begin(), buffer.end()));
+}
+
+TEST_F(LanguageToBinaryEncoderTest, ThrowsOnUnknownIdentifier)
+{
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(0);
+
+    std::vector<char> buffer;
+
+    ASSERT_THROW(mEncoder.encode(command, buffer), std::exception);
+}
+
+TEST_F(LanguageToBinaryEncoderTest, ThrowsOnMissingParam)
+{
+    Language::ICommand::Handle command(new Language::Command);
+    command->setID(4);
+
+    std::vector<char> buffer;
+
+    ASSERT_THROW(mEncoder.encode(command, buffer), std::exception);
+}
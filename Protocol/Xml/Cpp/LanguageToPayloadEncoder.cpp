@@ -0,0 +1,415 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Protocol/Xml/Cpp/LanguageToPayloadEncoder.hpp>
+#include <Protocol/Xml/Cpp/MessageShape.hpp>
+#include <boost/lexical_cast.hpp>
+#include <cstring>
+
+namespace Protocol
+{
+
+namespace
+{
+
+/**
+ * @brief The document type declaration of every message, as set by MessageBuilder.
+ */
+char const DOCUMENT_TYPE[] = "<!DOCTYPE message SYSTEM \"Protocol.dtd\">";
+
+/**
+ * @brief The objects of a command carrying rows.
+ */
+Language::ICommand::Objects const NO_OBJECTS;
+
+/**
+ * @brief The writer of canonical XML, appending to a buffer.
+ *
+ * Follows the output of Poco::XML::XMLWriter with the CANONICAL option: no whitespace between the elements, and the
+ * elements with no content written as empty element tags.
+ */
+class XmlWriter
+{
+public:
+    explicit XmlWriter(
+        std::vector<char> & aBuffer
+    )
+        : mBuffer(aBuffer)
+    {
+    }
+
+    void writeMarkup(
+        char const * aMarkup
+    )
+    {
+        append(aMarkup, std::strlen(aMarkup));
+    }
+
+    void writeStartElement(
+        char const * aName
+    )
+    {
+        writeMarkup("<");
+        writeMarkup(aName);
+        writeMarkup(">");
+    }
+
+    void writeEndElement(
+        char const * aName
+    )
+    {
+        writeMarkup("</");
+        writeMarkup(aName);
+        writeMarkup(">");
+    }
+
+    void writeEmptyElement(
+        char const * aName
+    )
+    {
+        writeMarkup("<");
+        writeMarkup(aName);
+        writeMarkup("/>");
+    }
+
+    /**
+     * @brief Writes an element holding a text.
+     *
+     * @throw std::exception If the text carries a control character not allowed in XML.
+     */
+    void writeTextElement(
+        char        const * aName,
+        std::string const & aText
+    )
+    {
+        writeTextElement(aName, aText.data(), aText.size());
+    }
+
+    /**
+     * @brief Writes an element holding a text given by its characters.
+     *
+     * @throw std::exception If the text carries a control character not allowed in XML.
+     */
+    void writeTextElement(
+        char        const * aName,
+        char        const * aText,
+        std::size_t const   aLength
+    )
+    {
+        if (not aLength)
+        {
+            writeEmptyElement(aName);
+            return;
+        }
+
+        writeStartElement(aName);
+        writeText(aText, aLength);
+        writeEndElement(aName);
+    }
+
+private:
+    /**
+     * @brief Writes a text, escaped the way Poco::XML::XMLWriter escapes it.
+     *
+     * The runs of characters needing no escaping are copied at once.
+     *
+     * @throw std::exception If the text carries a control character not allowed in XML.
+     */
+    void writeText(
+        char        const * aText,
+        std::size_t const   aLength
+    )
+    {
+        char const * run = aText;
+        char const * const end = run + aLength;
+
+        for (char const * it = run; it != end; ++it)
+        {
+            char const * escaped = 0;
+
+            switch (*it)
+            {
+                case '"':  escaped = "&quot;"; break;
+                case '\'': escaped = "&apos;"; break;
+                case '&':  escaped = "&amp;";  break;
+                case '<':  escaped = "&lt;";   break;
+                case '>':  escaped = "&gt;";   break;
+
+                case '\t':
+                case '\n':
+                case '\r':
+                    break;
+
+                default:
+                    if (*it >= 0 and *it < 32) throw std::exception();
+                    break;
+            }
+
+            if (escaped)
+            {
+                append(run, it - run);
+                writeMarkup(escaped);
+                run = it + 1;
+            }
+        }
+
+        append(run, end - run);
+    }
+
+    void append(
+        char        const * aData,
+        std::size_t const   aLength
+    )
+    {
+        mBuffer.insert(mBuffer.end(), aData, aData + aLength);
+    }
+
+    std::vector<char> & mBuffer;
+};
+
+void writeMessage(
+    XmlWriter                  & aWriter,
+    Language::ICommand::Handle   aCommand
+);
+
+/**
+ * @brief Writes an object, its fields in the order of the names.
+ */
+void writeObject(
+    XmlWriter                        & aWriter,
+    char                       const * aName,
+    Language::ICommand::Object const & aObject
+)
+{
+    if (aObject.empty())
+    {
+        aWriter.writeEmptyElement(aName);
+        return;
+    }
+
+    aWriter.writeStartElement(aName);
+
+    for (Language::ICommand::Object::const_iterator it = aObject.begin(); it != aObject.end(); ++it)
+    {
+        aWriter.writeTextElement(it->first.c_str(), it->second);
+    }
+
+    aWriter.writeEndElement(aName);
+}
+
+/**
+ * @brief Writes a row as an object, its fields in the order of the keys, which are ordered by name.
+ */
+void writeRow(
+    XmlWriter                & aWriter,
+    char               const * aName,
+    Language::Rows     const & aRows,
+    std::size_t        const   aRow
+)
+{
+    aWriter.writeStartElement(aName);
+
+    for (unsigned int column = 0; column < aRows.getColumnCount(); ++column)
+    {
+        Language::Rows::Cell const cell = aRows.getCell(aRow, column);
+        aWriter.writeTextElement(aRows.getKey(column), cell.m_data, cell.m_size);
+    }
+
+    aWriter.writeEndElement(aName);
+}
+
+/**
+ * @brief Writes the element specific to a message.
+ */
+void writeSpecific(
+    XmlWriter                        & aWriter,
+    MessageShape               const & aShape,
+    Language::ICommand::Handle         aCommand
+)
+{
+    // The rows are written as they are stored, never made into objects.
+    Language::Rows const & rows = aCommand->getRows();
+    bool const columnar = rows.getColumnCount();
+
+    Language::ICommand::Objects const & objects = columnar ? NO_OBJECTS : aCommand->getObjects();
+    Language::ICommand::Commands const & commands = aCommand->getCommands();
+
+    std::size_t const count = columnar ? rows.getRowCount() : objects.size();
+
+    bool const batch = aShape.mKind == MESSAGE_KIND_BATCH_REPLY;
+
+    // A single object is carried only if there is one.
+    bool const object = not aShape.mContainer and aShape.mObject and count;
+
+    if (not (aShape.mFields[0] or aShape.mContainer or object or batch))
+    {
+        aWriter.writeEmptyElement(aShape.mSpecific);
+        return;
+    }
+
+    aWriter.writeStartElement(aShape.mSpecific);
+
+    for (char const * const * field = aShape.mFields; *field; ++field)
+    {
+        aWriter.writeTextElement(*field, aCommand->getParam(*field));
+    }
+
+    if (aShape.mContainer)
+    {
+        if (not count)
+        {
+            aWriter.writeEmptyElement(aShape.mContainer);
+        }
+        else
+        {
+            aWriter.writeStartElement(aShape.mContainer);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (columnar)
+                {
+                    writeRow(aWriter, aShape.mObject, rows, i);
+                }
+                else
+                {
+                    writeObject(aWriter, aShape.mObject, objects[i]);
+                }
+            }
+
+            aWriter.writeEndElement(aShape.mContainer);
+        }
+    }
+
+    if (object)
+    {
+        if (columnar)
+        {
+            writeRow(aWriter, aShape.mObject, rows, 0);
+        }
+        else
+        {
+            writeObject(aWriter, aShape.mObject, objects.front());
+        }
+    }
+
+    if (batch)
+    {
+        if (commands.empty())
+        {
+            aWriter.writeEmptyElement("messages");
+        }
+        else
+        {
+            aWriter.writeStartElement("messages");
+
+            for (Language::ICommand::Commands::const_iterator it = commands.begin(); it != commands.end(); ++it)
+            {
+                writeMessage(aWriter, *it);
+            }
+
+            aWriter.writeEndElement("messages");
+        }
+    }
+
+    aWriter.writeEndElement(aShape.mSpecific);
+}
+
+/**
+ * @brief Writes the message of a reply or an indication, nested messages included.
+ *
+ * @throw std::exception If the command is neither a reply nor an indication.
+ */
+void writeMessage(
+    XmlWriter                  & aWriter,
+    Language::ICommand::Handle   aCommand
+)
+{
+    MessageShape const * shape = findMessageShape(aCommand->getID());
+
+    if (not shape) throw std::exception();
+
+    bool const reply = shape->mKind == MESSAGE_KIND_BARE_REPLY
+                       or shape->mKind == MESSAGE_KIND_REPLY
+                       or shape->mKind == MESSAGE_KIND_BATCH_REPLY;
+
+    if (not (reply or shape->mKind == MESSAGE_KIND_INDICATION)) throw std::exception();
+
+    aWriter.writeStartElement("message");
+
+    // The timeout and the idempotency key follow the identifier, as appended by LanguageToProtocolTranslator.
+    aWriter.writeStartElement("header");
+    aWriter.writeTextElement("id", boost::lexical_cast<std::string>(shape->mId));
+
+    if (aCommand->getTimeout())
+    {
+        aWriter.writeTextElement("timeout", boost::lexical_cast<std::string>(aCommand->getTimeout()));
+    }
+
+    if (not aCommand->getIdempotencyKey().empty())
+    {
+        aWriter.writeTextElement("idempotency_key", aCommand->getIdempotencyKey());
+    }
+
+    aWriter.writeEndElement("header");
+
+    if (reply)
+    {
+        aWriter.writeStartElement("reply");
+        aWriter.writeTextElement("code", boost::lexical_cast<std::string>(aCommand->getCode()));
+
+        if (shape->mKind != MESSAGE_KIND_BARE_REPLY)
+        {
+            aWriter.writeTextElement("message", aCommand->getMessage());
+        }
+
+        writeSpecific(aWriter, *shape, aCommand);
+        aWriter.writeEndElement("reply");
+    }
+    else
+    {
+        aWriter.writeStartElement("indication");
+        writeSpecific(aWriter, *shape, aCommand);
+        aWriter.writeEndElement("indication");
+    }
+
+    aWriter.writeEndElement("message");
+}
+
+} // namespace
+
+void LanguageToPayloadEncoder::encode(
+    Language::ICommand::Handle   aCommand,
+    std::vector<char>          & aBuffer
+) const
+{
+    XmlWriter writer(aBuffer);
+
+    writer.writeMarkup(DOCUMENT_TYPE);
+    writeMessage(writer, aCommand);
+}
+
+} // namespace Protocol
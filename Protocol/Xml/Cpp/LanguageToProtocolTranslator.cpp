@@ -25,6 +25,9 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Poco/AutoPtr.h>
+#include <Poco/DOM/Element.h>
+#include <Poco/DOM/Text.h>
 #include <Protocol/Xml/Cpp/LanguageToProtocolTranslator.hpp>
 #include <Protocol/Xml/Cpp/MessageFactory.hpp>
 #include <boost/assert.hpp>
@@ -38,6 +41,54 @@ namespace Protocol
 Message::Handle LanguageToProtocolTranslator::translate(
     Language::ICommand::Handle a_command
 ) const
+{
+    Message::Handle const message = translateCommand(a_command);
+    Poco::XML::Element * header = message->documentElement()->getChildElement("header");
+    Poco::XML::Element * user = header->getChildElement("user");
+
+    if (user and not a_command->getSessionToken().empty())
+    {
+        Poco::XML::Element * password = user->getChildElement("password");
+
+        Poco::AutoPtr<Poco::XML::Element> session_token = message->createElement("session_token");
+        Poco::AutoPtr<Poco::XML::Text> value = message->createTextNode(a_command->getSessionToken());
+        session_token->appendChild(value);
+
+        if (password)
+        {
+            user->replaceChild(session_token, password);
+        }
+        else
+        {
+            user->appendChild(session_token);
+        }
+    }
+
+    if (a_command->getTimeout())
+    {
+        Poco::AutoPtr<Poco::XML::Element> timeout = message->createElement("timeout");
+        Poco::AutoPtr<Poco::XML::Text> value =
+            message->createTextNode(boost::lexical_cast<std::string>(a_command->getTimeout()));
+        timeout->appendChild(value);
+
+        header->appendChild(timeout);
+    }
+
+    if (!a_command->getIdempotencyKey().empty())
+    {
+        Poco::AutoPtr<Poco::XML::Element> idempotency_key = message->createElement("idempotency_key");
+        Poco::AutoPtr<Poco::XML::Text> value = message->createTextNode(a_command->getIdempotencyKey());
+        idempotency_key->appendChild(value);
+
+        header->appendChild(idempotency_key);
+    }
+
+    return message;
+}
+
+Message::Handle LanguageToProtocolTranslator::translateCommand(
+    Language::ICommand::Handle a_command
+) const
 {
     MessageFactory message_factory;
 
@@ -53,22 +104,22 @@ Message::Handle LanguageToProtocolTranslator::translate(
             return message_factory.createCreateLandRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("world_name"),
-                       a_command->getParam("land_name")
+                       a_command->getParam(Language::PARAM_WORLD_NAME),
+                       a_command->getParam(Language::PARAM_LAND_NAME)
                    );
 
         case Language::ID_COMMAND_DELETE_LAND_REQUEST:
             return message_factory.createDeleteLandRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("land_name")
+                       a_command->getParam(Language::PARAM_LAND_NAME)
                    );
 
         case Language::ID_COMMAND_GET_LAND_REQUEST:
             return message_factory.createGetLandRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("land_name")
+                       a_command->getParam(Language::PARAM_LAND_NAME)
                    );
 
         case Language::ID_COMMAND_GET_LANDS_REQUEST:
@@ -81,203 +132,230 @@ Message::Handle LanguageToProtocolTranslator::translate(
             return message_factory.createCreateSettlementRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("land_name"),
-                       a_command->getParam("settlement_name")
+                       a_command->getParam(Language::PARAM_LAND_NAME),
+                       a_command->getParam(Language::PARAM_SETTLEMENT_NAME)
                    );
 
         case Language::ID_COMMAND_DELETE_SETTLEMENT_REQUEST:
             return message_factory.createDeleteSettlementRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("settlement_name")
+                       a_command->getParam(Language::PARAM_SETTLEMENT_NAME)
                    );
 
         case Language::ID_COMMAND_GET_SETTLEMENT_REQUEST:
             return message_factory.createGetSettlementRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("settlement_name")
+                       a_command->getParam(Language::PARAM_SETTLEMENT_NAME)
                    );
 
         case Language::ID_COMMAND_GET_SETTLEMENTS_REQUEST:
             return message_factory.createGetSettlementsRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("land_name")
+                       a_command->getParam(Language::PARAM_LAND_NAME)
                    );
 
         case Language::ID_COMMAND_BUILD_BUILDING_REQUEST:
             return message_factory.createBuildBuildingRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name"),
-                       a_command->getParam("buildingkey"),
-                       a_command->getParam("volume")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME),
+                       a_command->getParam(Language::PARAM_BUILDING_KEY),
+                       a_command->getParam(Language::PARAM_VOLUME)
                    );
 
         case Language::ID_COMMAND_DESTROY_BUILDING_REQUEST:
             return message_factory.createDestroyBuildingRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name"),
-                       a_command->getParam("buildingkey"),
-                       a_command->getParam("volume")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME),
+                       a_command->getParam(Language::PARAM_BUILDING_KEY),
+                       a_command->getParam(Language::PARAM_VOLUME)
                    );
 
         case Language::ID_COMMAND_GET_BUILDING_REQUEST:
             return message_factory.createGetBuildingRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name"),
-                       a_command->getParam("buildingkey")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME),
+                       a_command->getParam(Language::PARAM_BUILDING_KEY)
                    );
 
         case Language::ID_COMMAND_GET_BUILDINGS_REQUEST:
             return message_factory.createGetBuildingsRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME)
                    );
 
         case Language::ID_COMMAND_DISMISS_HUMAN_REQUEST:
             return message_factory.createDismissHumanRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name"),
-                       a_command->getParam("humankey"),
-                       a_command->getParam("volume")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME),
+                       a_command->getParam(Language::PARAM_HUMAN_KEY),
+                       a_command->getParam(Language::PARAM_VOLUME)
                    );
 
         case Language::ID_COMMAND_ENGAGE_HUMAN_REQUEST:
             return message_factory.createEngageHumanRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name"),
-                       a_command->getParam("humankey"),
-                       a_command->getParam("volume")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME),
+                       a_command->getParam(Language::PARAM_HUMAN_KEY),
+                       a_command->getParam(Language::PARAM_VOLUME)
                    );
 
         case Language::ID_COMMAND_GET_HUMAN_REQUEST:
             return message_factory.createGetHumanRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name"),
-                       a_command->getParam("humankey")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME),
+                       a_command->getParam(Language::PARAM_HUMAN_KEY)
                    );
 
         case Language::ID_COMMAND_GET_HUMANS_REQUEST:
             return message_factory.createGetHumansRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME)
                    );
 
         case Language::ID_COMMAND_GET_RESOURCE_REQUEST:
             return message_factory.createGetResourceRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name"),
-                       a_command->getParam("resourcekey")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME),
+                       a_command->getParam(Language::PARAM_RESOURCE_KEY)
                    );
 
         case Language::ID_COMMAND_GET_RESOURCES_REQUEST:
             return message_factory.createGetResourcesRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("idholderclass"),
-                       a_command->getParam("holder_name")
+                       a_command->getParam(Language::PARAM_ID_HOLDER_CLASS),
+                       a_command->getParam(Language::PARAM_HOLDER_NAME)
                    );
 
         case Language::ID_COMMAND_CREATE_USER_REQUEST:
             return message_factory.createCreateUserRequest(
-                       a_command->getParam("login"),
-                       a_command->getParam("password")
+                       a_command->getParam(Language::PARAM_LOGIN),
+                       a_command->getParam(Language::PARAM_PASSWORD)
                    );
 
         case Language::ID_COMMAND_CREATE_WORLD_REQUEST:
             return message_factory.createCreateWorldRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("world_name")
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
                    );
 
         case Language::ID_COMMAND_CREATE_EPOCH_REQUEST:
             return message_factory.createCreateEpochRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("world_name"),
-                       a_command->getParam("epoch_name")
+                       a_command->getParam(Language::PARAM_WORLD_NAME),
+                       a_command->getParam(Language::PARAM_EPOCH_NAME)
                    );
 
         case Language::ID_COMMAND_DELETE_EPOCH_REQUEST:
             return message_factory.createDeleteEpochRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("world_name")
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
                    );
 
         case Language::ID_COMMAND_ACTIVATE_EPOCH_REQUEST:
             return message_factory.createActivateEpochRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("world_name")
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
                    );
 
         case Language::ID_COMMAND_DEACTIVATE_EPOCH_REQUEST:
             return message_factory.createDeactivateEpochRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("world_name")
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
                    );
 
         case Language::ID_COMMAND_FINISH_EPOCH_REQUEST:
             return message_factory.createFinishEpochRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("world_name")
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
                    );
 
         case Language::ID_COMMAND_TICK_EPOCH_REQUEST:
             return message_factory.createTickEpochRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("world_name")
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
                    );
 
         case Language::ID_COMMAND_GET_EPOCH_REQUEST:
             return message_factory.createGetEpochRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("world_name")
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
                    );
 
         case Language::ID_COMMAND_TRANSPORT_HUMAN_REQUEST:
             return message_factory.createTransportHumanRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("settlement_name_source"),
-                       a_command->getParam("settlement_name_destination"),
-                       a_command->getParam("humankey"),
-                       a_command->getParam("volume")
+                       a_command->getParam(Language::PARAM_SETTLEMENT_NAME_SOURCE),
+                       a_command->getParam(Language::PARAM_SETTLEMENT_NAME_DESTINATION),
+                       a_command->getParam(Language::PARAM_HUMAN_KEY),
+                       a_command->getParam(Language::PARAM_VOLUME)
                    );
 
         case Language::ID_COMMAND_TRANSPORT_RESOURCE_REQUEST:
             return message_factory.createTransportResourceRequest(
                        a_command->getLogin(),
                        a_command->getPassword(),
-                       a_command->getParam("settlement_name_source"),
-                       a_command->getParam("settlement_name_destination"),
-                       a_command->getParam("resourcekey"),
-                       a_command->getParam("volume")
+                       a_command->getParam(Language::PARAM_SETTLEMENT_NAME_SOURCE),
+                       a_command->getParam(Language::PARAM_SETTLEMENT_NAME_DESTINATION),
+                       a_command->getParam(Language::PARAM_RESOURCE_KEY),
+                       a_command->getParam(Language::PARAM_VOLUME)
+                   );
+
+        case Language::ID_COMMAND_BATCH_REQUEST:
+            return message_factory.createBatchRequest(
+                       a_command->getLogin(),
+                       a_command->getPassword(),
+                       a_command->getParam(Language::PARAM_ATOMIC),
+                       translateCommands(a_command)
+                   );
+
+        case Language::ID_COMMAND_SUBSCRIBE_REQUEST:
+            return message_factory.createSubscribeRequest(
+                       a_command->getLogin(),
+                       a_command->getPassword(),
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
+                   );
+
+        case Language::ID_COMMAND_LOGIN_REQUEST:
+            return message_factory.createLoginRequest(
+                       a_command->getLogin(),
+                       a_command->getPassword()
+                   );
+
+        case Language::ID_COMMAND_LOGOUT_REQUEST:
+            return message_factory.createLogoutRequest(
+                       a_command->getLogin(),
+                       a_command->getPassword()
                    );
 
         case Language::ID_COMMAND_ECHO_REPLY:
@@ -607,9 +685,67 @@ Message::Handle LanguageToProtocolTranslator::translate(
                        a_command->getMessage()
                    );
 
+        case Language::ID_COMMAND_BATCH_REPLY:
+            return message_factory.createBatchReply(
+                       boost::lexical_cast<std::string>(a_command->getCode()),
+                       a_command->getMessage(),
+                       translateCommands(a_command)
+                   );
+
+        case Language::ID_COMMAND_SUBSCRIBE_REPLY:
+            return message_factory.createSubscribeReply(
+                       boost::lexical_cast<std::string>(a_command->getCode()),
+                       a_command->getMessage()
+                   );
+
+        case Language::ID_COMMAND_LOGIN_REPLY:
+            return message_factory.createLoginReply(
+                       boost::lexical_cast<std::string>(a_command->getCode()),
+                       a_command->getMessage(),
+                       a_command->getParam(Language::PARAM_SESSION_TOKEN)
+                   );
+
+        case Language::ID_COMMAND_LOGOUT_REPLY:
+            return message_factory.createLogoutReply(
+                       boost::lexical_cast<std::string>(a_command->getCode()),
+                       a_command->getMessage()
+                   );
+
+        case Language::ID_COMMAND_EPOCH_ACTIVATED_INDICATION:
+            return message_factory.createEpochActivatedIndication(
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
+                   );
+
+        case Language::ID_COMMAND_EPOCH_DEACTIVATED_INDICATION:
+            return message_factory.createEpochDeactivatedIndication(
+                       a_command->getParam(Language::PARAM_WORLD_NAME)
+                   );
+
+        case Language::ID_COMMAND_TICK_COMPLETED_INDICATION:
+            return message_factory.createTickCompletedIndication(
+                       a_command->getParam(Language::PARAM_WORLD_NAME),
+                       a_command->getParam(Language::PARAM_TICKS)
+                   );
+
         default:
             BOOST_ASSERT_MSG(false, "Invalid command ID.");
     }
 }
 
+std::vector<Message::Handle> LanguageToProtocolTranslator::translateCommands(
+    Language::ICommand::Handle a_command
+) const
+{
+    std::vector<Message::Handle> messages;
+
+    Language::ICommand::Commands const & commands = a_command->getCommands();
+
+    for (Language::ICommand::Commands::const_iterator it = commands.begin(); it != commands.end(); ++it)
+    {
+        messages.push_back(translate(*it));
+    }
+
+    return messages;
+}
+
 } // namespace Protocol
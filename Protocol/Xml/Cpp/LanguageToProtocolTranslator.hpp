@@ -42,6 +42,8 @@ public:
     /**
      * @brief Translates a command to a message.
      *
+     * The session token of the command, if any, is sent instead of the password.
+     *
      * @param a_command The command.
      *
      * @return The message.
@@ -49,6 +51,29 @@ public:
     Message::Handle translate(
         Language::ICommand::Handle a_command
     ) const;
+
+private:
+    /**
+     * @brief Translates a command to a message, leaving the session token aside.
+     *
+     * @param a_command The command.
+     *
+     * @return The message.
+     */
+    Message::Handle translateCommand(
+        Language::ICommand::Handle a_command
+    ) const;
+
+    /**
+     * @brief Translates the sub-commands of a batch command to messages.
+     *
+     * @param a_command The batch command.
+     *
+     * @return The messages, in order.
+     */
+    std::vector<Message::Handle> translateCommands(
+        Language::ICommand::Handle a_command
+    ) const;
 };
 
 } // namespace Protocol
@@ -134,6 +134,19 @@ void MessageBuilder::addRequest(
     m_current_node = m_current_node->appendChild(element);
 }
 
+void MessageBuilder::addIndication(
+    std::string const a_indication
+)
+{
+    Poco::AutoPtr<Poco::XML::Element> element;
+
+    element = m_document->createElement("indication");
+    m_current_node = m_document->documentElement()->appendChild(element);
+
+    element = m_document->createElement(a_indication);
+    m_current_node = m_current_node->appendChild(element);
+}
+
 void MessageBuilder::addParam(
     std::string const a_param_name,
     std::string const a_param_value
@@ -242,6 +255,23 @@ void MessageBuilder::addObjects(
     }
 }
 
+void MessageBuilder::addMessages(
+    std::string                  const   a_messages_name,
+    std::vector<Message::Handle> const & a_messages
+)
+{
+    Poco::AutoPtr<Poco::XML::Element> element;
+
+    element = m_document->createElement(a_messages_name);
+    m_current_node = m_current_node->appendChild(element);
+
+    for (std::vector<Message::Handle>::const_iterator it = a_messages.begin(); it != a_messages.end(); ++it)
+    {
+        Poco::AutoPtr<Poco::XML::Node> message = m_document->importNode((*it)->documentElement(), true);
+        m_current_node->appendChild(message);
+    }
+}
+
 Message::Handle MessageBuilder::extract()
 {
     return m_document;
@@ -82,6 +82,15 @@ public:
         std::string const a_request
     );
 
+    /**
+     * @brief Adds the indication.
+     *
+     * @param a_indication The name of the indication.
+     */
+    void addIndication(
+        std::string const a_indication
+    );
+
     /**
      * @brief Adds a parameter.
      *
@@ -149,6 +158,19 @@ public:
         Message::Objects const & a_objects
     );
 
+    /**
+     * @brief Adds nested messages.
+     *
+     * The root element of each message is copied under a single element of the given name.
+     *
+     * @param a_messages_name The name of the element grouping the messages.
+     * @param a_messages      The messages.
+     */
+    void addMessages(
+        std::string                  const   a_messages_name,
+        std::vector<Message::Handle> const & a_messages
+    );
+
     /**
      * @brief Extracts the message.
      *
@@ -574,6 +574,68 @@ Message::Handle MessageFactory::createTransportResourceRequest(
     return message_builder.extract();
 }
 
+Message::Handle MessageFactory::createBatchRequest(
+    std::string                  const   a_login,
+    std::string                  const   a_password,
+    std::string                  const   a_atomic,
+    std::vector<Message::Handle> const & a_messages
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_BATCH_REQUEST, a_login, a_password);
+    message_builder.addRequest("batch_request");
+    message_builder.addParam("atomic", a_atomic);
+    message_builder.addMessages("messages", a_messages);
+
+    return message_builder.extract();
+}
+
+Message::Handle MessageFactory::createSubscribeRequest(
+    std::string const a_login,
+    std::string const a_password,
+    std::string const a_world_name
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_SUBSCRIBE_REQUEST, a_login, a_password);
+    message_builder.addRequest("subscribe_request");
+    message_builder.addParam("world_name", a_world_name);
+
+    return message_builder.extract();
+}
+
+Message::Handle MessageFactory::createLoginRequest(
+    std::string const a_login,
+    std::string const a_password
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_LOGIN_REQUEST, a_login, a_password);
+    message_builder.addRequest("login_request");
+
+    return message_builder.extract();
+}
+
+Message::Handle MessageFactory::createLogoutRequest(
+    std::string const a_login,
+    std::string const a_password
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_LOGOUT_REQUEST, a_login, a_password);
+    message_builder.addRequest("logout_request");
+
+    return message_builder.extract();
+}
+
 Message::Handle MessageFactory::createEchoReply(
     std::string const a_code
 ) const
@@ -1286,4 +1348,120 @@ Message::Handle MessageFactory::createTransportResourceReply(
     return message_builder.extract();
 }
 
+Message::Handle MessageFactory::createBatchReply(
+    std::string                  const   a_code,
+    std::string                  const   a_message,
+    std::vector<Message::Handle> const & a_messages
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_BATCH_REPLY);
+    message_builder.addReply();
+    message_builder.addCode(a_code);
+    message_builder.addMessage(a_message);
+    message_builder.addSpecificReply("batch_reply");
+    message_builder.addMessages("messages", a_messages);
+
+    return message_builder.extract();
+}
+
+Message::Handle MessageFactory::createSubscribeReply(
+    std::string const a_code,
+    std::string const a_message
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_SUBSCRIBE_REPLY);
+    message_builder.addReply();
+    message_builder.addCode(a_code);
+    message_builder.addMessage(a_message);
+    message_builder.addSpecificReply("subscribe_reply");
+
+    return message_builder.extract();
+}
+
+Message::Handle MessageFactory::createLoginReply(
+    std::string const a_code,
+    std::string const a_message,
+    std::string const a_session_token
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_LOGIN_REPLY);
+    message_builder.addReply();
+    message_builder.addCode(a_code);
+    message_builder.addMessage(a_message);
+    message_builder.addSpecificReply("login_reply");
+    message_builder.addParam("session_token", a_session_token);
+
+    return message_builder.extract();
+}
+
+Message::Handle MessageFactory::createLogoutReply(
+    std::string const a_code,
+    std::string const a_message
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_LOGOUT_REPLY);
+    message_builder.addReply();
+    message_builder.addCode(a_code);
+    message_builder.addMessage(a_message);
+    message_builder.addSpecificReply("logout_reply");
+
+    return message_builder.extract();
+}
+
+Message::Handle MessageFactory::createEpochActivatedIndication(
+    std::string const a_world_name
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_EPOCH_ACTIVATED_INDICATION);
+    message_builder.addIndication("epoch_activated");
+    message_builder.addParam("world_name", a_world_name);
+
+    return message_builder.extract();
+}
+
+Message::Handle MessageFactory::createEpochDeactivatedIndication(
+    std::string const a_world_name
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_EPOCH_DEACTIVATED_INDICATION);
+    message_builder.addIndication("epoch_deactivated");
+    message_builder.addParam("world_name", a_world_name);
+
+    return message_builder.extract();
+}
+
+Message::Handle MessageFactory::createTickCompletedIndication(
+    std::string const a_world_name,
+    std::string const a_ticks
+) const
+{
+    MessageBuilder message_builder;
+
+    message_builder.makeMessage();
+    message_builder.addHeader(Language::ID_COMMAND_TICK_COMPLETED_INDICATION);
+    message_builder.addIndication("tick_completed");
+    message_builder.addParam("world_name", a_world_name);
+    message_builder.addParam("ticks", a_ticks);
+
+    return message_builder.extract();
+}
+
 } // namespace Protocol
@@ -244,6 +244,29 @@ public:
         std::string const a_volume
     ) const;
 
+    Message::Handle createBatchRequest(
+        std::string                  const   a_login,
+        std::string                  const   a_password,
+        std::string                  const   a_atomic,
+        std::vector<Message::Handle> const & a_messages
+    ) const;
+
+    Message::Handle createSubscribeRequest(
+        std::string const a_login,
+        std::string const a_password,
+        std::string const a_world_name
+    ) const;
+
+    Message::Handle createLoginRequest(
+        std::string const a_login,
+        std::string const a_password
+    ) const;
+
+    Message::Handle createLogoutRequest(
+        std::string const a_login,
+        std::string const a_password
+    ) const;
+
     Message::Handle createEchoReply(
         std::string const a_code
     ) const;
@@ -462,6 +485,41 @@ public:
         std::string const a_code,
         std::string const a_message
     ) const;
+
+    Message::Handle createBatchReply(
+        std::string                  const   a_code,
+        std::string                  const   a_message,
+        std::vector<Message::Handle> const & a_messages
+    ) const;
+
+    Message::Handle createSubscribeReply(
+        std::string const a_code,
+        std::string const a_message
+    ) const;
+
+    Message::Handle createLoginReply(
+        std::string const a_code,
+        std::string const a_message,
+        std::string const a_session_token
+    ) const;
+
+    Message::Handle createLogoutReply(
+        std::string const a_code,
+        std::string const a_message
+    ) const;
+
+    Message::Handle createEpochActivatedIndication(
+        std::string const a_world_name
+    ) const;
+
+    Message::Handle createEpochDeactivatedIndication(
+        std::string const a_world_name
+    ) const;
+
+    Message::Handle createTickCompletedIndication(
+        std::string const a_world_name,
+        std::string const a_ticks
+    ) const;
 };
 
 } // namespace Protocol
@@ -0,0 +1,128 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Protocol/Xml/Cpp/MessageShape.hpp>
+#include <cstddef>
+
+namespace Protocol
+{
+
+namespace
+{
+
+/**
+ * @brief The shapes of all messages, ordered by identifier.
+ */
+MessageShape const SHAPES[] =
+{
+    { 1,  MESSAGE_KIND_BARE_REQUEST,      "echo_request",                 { 0 }, 0, 0, { 0 } },
+    { 2,  MESSAGE_KIND_BARE_REQUEST,      "error_request",                { 0 }, 0, 0, { 0 } },
+    { 3,  MESSAGE_KIND_REQUEST,           "create_land_request",          { "world_name", "land_name", 0 }, 0, 0, { 0 } },
+    { 4,  MESSAGE_KIND_REQUEST,           "delete_land_request",          { "land_name", 0 }, 0, 0, { 0 } },
+    { 5,  MESSAGE_KIND_REQUEST,           "get_land_request",             { "land_name", 0 }, 0, 0, { 0 } },
+    { 6,  MESSAGE_KIND_REQUEST,           "get_lands_request",            { 0 }, 0, 0, { 0 } },
+    { 7,  MESSAGE_KIND_REQUEST,           "create_settlement_request",    { "land_name", "settlement_name", 0 }, 0, 0, { 0 } },
+    { 8,  MESSAGE_KIND_REQUEST,           "delete_settlement_request",    { "settlement_name", 0 }, 0, 0, { 0 } },
+    { 9,  MESSAGE_KIND_REQUEST,           "get_settlement_request",       { "settlement_name", 0 }, 0, 0, { 0 } },
+    { 10, MESSAGE_KIND_REQUEST,           "get_settlements_request",      { "land_name", 0 }, 0, 0, { 0 } },
+    { 11, MESSAGE_KIND_REQUEST,           "build_building_request",       { "idholderclass", "holder_name", "buildingkey", "volume", 0 }, 0, 0, { 0 } },
+    { 12, MESSAGE_KIND_REQUEST,           "destroy_building_request",     { "idholderclass", "holder_name", "buildingkey", "volume", 0 }, 0, 0, { 0 } },
+    { 13, MESSAGE_KIND_REQUEST,           "get_building_request",         { "idholderclass", "holder_name", "buildingkey", 0 }, 0, 0, { 0 } },
+    { 14, MESSAGE_KIND_REQUEST,           "get_buildings_request",        { "idholderclass", "holder_name", 0 }, 0, 0, { 0 } },
+    { 15, MESSAGE_KIND_REQUEST,           "dismiss_human_request",        { "idholderclass", "holder_name", "humankey", "volume", 0 }, 0, 0, { 0 } },
+    { 16, MESSAGE_KIND_REQUEST,           "engage_human_request",         { "idholderclass", "holder_name", "humankey", "volume", 0 }, 0, 0, { 0 } },
+    { 17, MESSAGE_KIND_REQUEST,           "get_human_request",            { "idholderclass", "holder_name", "humankey", 0 }, 0, 0, { 0 } },
+    { 18, MESSAGE_KIND_REQUEST,           "get_humans_request",           { "idholderclass", "holder_name", 0 }, 0, 0, { 0 } },
+    { 19, MESSAGE_KIND_REQUEST,           "get_resource_request",         { "idholderclass", "holder_name", "resourcekey", 0 }, 0, 0, { 0 } },
+    { 20, MESSAGE_KIND_REQUEST,           "get_resources_request",        { "idholderclass", "holder_name", 0 }, 0, 0, { 0 } },
+    { 21, MESSAGE_KIND_ANONYMOUS_REQUEST, "create_user_request",          { "login", "password", 0 }, 0, 0, { 0 } },
+    { 22, MESSAGE_KIND_REQUEST,           "create_world_request",         { "world_name", 0 }, 0, 0, { 0 } },
+    { 23, MESSAGE_KIND_REQUEST,           "create_epoch_request",         { "world_name", "epoch_name", 0 }, 0, 0, { 0 } },
+    { 24, MESSAGE_KIND_REQUEST,           "delete_epoch_request",         { "world_name", 0 }, 0, 0, { 0 } },
+    { 25, MESSAGE_KIND_REQUEST,           "activate_epoch_request",       { "world_name", 0 }, 0, 0, { 0 } },
+    { 26, MESSAGE_KIND_REQUEST,           "deactivate_epoch_request",     { "world_name", 0 }, 0, 0, { 0 } },
+    { 27, MESSAGE_KIND_REQUEST,           "finish_epoch_request",         { "world_name", 0 }, 0, 0, { 0 } },
+    { 28, MESSAGE_KIND_REQUEST,           "tick_epoch_request",           { "world_name", 0 }, 0, 0, { 0 } },
+    { 29, MESSAGE_KIND_REQUEST,           "get_epoch_request",            { "world_name", 0 }, 0, 0, { 0 } },
+    { 30, MESSAGE_KIND_REQUEST,           "transport_human_request",      { "settlement_name_source", "settlement_name_destination", "humankey", "volume", 0 }, 0, 0, { 0 } },
+    { 31, MESSAGE_KIND_REQUEST,           "transport_resource_request",   { "settlement_name_source", "settlement_name_destination", "resourcekey", "volume", 0 }, 0, 0, { 0 } },
+    { 32, MESSAGE_KIND_BARE_REPLY,        "echo_reply",                   { 0 }, 0, 0, { 0 } },
+    { 33, MESSAGE_KIND_BARE_REPLY,        "error_reply",                  { 0 }, 0, 0, { 0 } },
+    { 34, MESSAGE_KIND_REPLY,             "create_land_reply",            { 0 }, 0, 0, { 0 } },
+    { 35, MESSAGE_KIND_REPLY,             "delete_land_reply",            { 0 }, 0, 0, { 0 } },
+    { 36, MESSAGE_KIND_REPLY,             "get_land_reply",               { 0 }, 0, "land", { "login", "world_name", "land_name", "granted", 0 } },
+    { 37, MESSAGE_KIND_REPLY,             "get_lands_reply",              { 0 }, "lands", "land", { "login", "world_name", "land_name", "granted", 0 } },
+    { 38, MESSAGE_KIND_REPLY,             "create_settlement_reply",      { 0 }, 0, 0, { 0 } },
+    { 39, MESSAGE_KIND_REPLY,             "delete_settlement_reply",      { 0 }, 0, 0, { 0 } },
+    { 40, MESSAGE_KIND_REPLY,             "get_settlement_reply",         { 0 }, 0, "settlement", { "land_name", "settlement_name", 0 } },
+    { 41, MESSAGE_KIND_REPLY,             "get_settlements_reply",        { 0 }, "settlements", "settlement", { "land_name", "settlement_name", 0 } },
+    { 42, MESSAGE_KIND_REPLY,             "build_building_reply",         { 0 }, 0, 0, { 0 } },
+    { 43, MESSAGE_KIND_REPLY,             "destroy_building_reply",       { 0 }, 0, 0, { 0 } },
+    { 44, MESSAGE_KIND_REPLY,             "get_building_reply",           { 0 }, 0, "building", { "buildingclass", "buildingname", "volume", 0 } },
+    { 45, MESSAGE_KIND_REPLY,             "get_buildings_reply",          { 0 }, "buildings", "building", { "buildingclass", "buildingname", "volume", 0 } },
+    { 46, MESSAGE_KIND_REPLY,             "dismiss_human_reply",          { 0 }, 0, 0, { 0 } },
+    { 47, MESSAGE_KIND_REPLY,             "engage_human_reply",           { 0 }, 0, 0, { 0 } },
+    { 48, MESSAGE_KIND_REPLY,             "get_human_reply",              { 0 }, 0, "human", { "humanclass", "humanname", "experience", "volume", 0 } },
+    { 49, MESSAGE_KIND_REPLY,             "get_humans_reply",             { 0 }, "humans", "human", { "humanclass", "humanname", "experience", "volume", 0 } },
+    { 50, MESSAGE_KIND_REPLY,             "get_resource_reply",           { 0 }, 0, "resource", { "resourcename", "volume", 0 } },
+    { 51, MESSAGE_KIND_REPLY,             "get_resources_reply",          { 0 }, "resources", "resource", { "resourcename", "volume", 0 } },
+    { 52, MESSAGE_KIND_REPLY,             "create_user_reply",            { 0 }, 0, 0, { 0 } },
+    { 53, MESSAGE_KIND_REPLY,             "create_world_reply",           { 0 }, 0, 0, { 0 } },
+    { 54, MESSAGE_KIND_REPLY,             "create_epoch_reply",           { 0 }, 0, 0, { 0 } },
+    { 55, MESSAGE_KIND_REPLY,             "delete_epoch_reply",           { 0 }, 0, 0, { 0 } },
+    { 56, MESSAGE_KIND_REPLY,             "activate_epoch_reply",         { 0 }, 0, 0, { 0 } },
+    { 57, MESSAGE_KIND_REPLY,             "deactivate_epoch_reply",       { 0 }, 0, 0, { 0 } },
+    { 58, MESSAGE_KIND_REPLY,             "finish_epoch_reply",           { 0 }, 0, 0, { 0 } },
+    { 59, MESSAGE_KIND_REPLY,             "tick_epoch_reply",             { 0 }, 0, 0, { 0 } },
+    { 60, MESSAGE_KIND_REPLY,             "get_epoch_reply",              { 0 }, 0, "epoch", { "epoch_name", "world_name", "active", "finished", "ticks", 0 } },
+    { 61, MESSAGE_KIND_REPLY,             "transport_human_reply",        { 0 }, 0, 0, { 0 } },
+    { 62, MESSAGE_KIND_REPLY,             "transport_resource_reply",     { 0 }, 0, 0, { 0 } },
+    { 63, MESSAGE_KIND_BATCH_REQUEST,     "batch_request",                { "atomic", 0 }, 0, 0, { 0 } },
+    { 64, MESSAGE_KIND_BATCH_REPLY,       "batch_reply",                  { 0 }, 0, 0, { 0 } },
+    { 65, MESSAGE_KIND_REQUEST,           "subscribe_request",            { "world_name", 0 }, 0, 0, { 0 } },
+    { 66, MESSAGE_KIND_REPLY,             "subscribe_reply",              { 0 }, 0, 0, { 0 } },
+    { 67, MESSAGE_KIND_INDICATION,        "epoch_activated",              { "world_name", 0 }, 0, 0, { 0 } },
+    { 68, MESSAGE_KIND_INDICATION,        "epoch_deactivated",            { "world_name", 0 }, 0, 0, { 0 } },
+    { 69, MESSAGE_KIND_INDICATION,        "tick_completed",               { "world_name", "ticks", 0 }, 0, 0, { 0 } },
+    { 70, MESSAGE_KIND_REQUEST,           "login_request",                { 0 }, 0, 0, { 0 } },
+    { 71, MESSAGE_KIND_REPLY,             "login_reply",                  { "session_token", 0 }, 0, 0, { 0 } },
+    { 72, MESSAGE_KIND_REQUEST,           "logout_request",               { 0 }, 0, 0, { 0 } },
+    { 73, MESSAGE_KIND_REPLY,             "logout_reply",                 { 0 }, 0, 0, { 0 } }
+};
+
+} // namespace
+
+MessageShape const * findMessageShape(
+    unsigned short int const aId
+)
+{
+    std::size_t const count = sizeof(SHAPES) / sizeof(SHAPES[0]);
+
+    return (aId >= 1 and aId <= count and SHAPES[aId - 1].mId == aId) ? &SHAPES[aId - 1] : 0;
+}
+
+} // namespace Protocol
@@ -0,0 +1,105 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef PROTOCOL_MESSAGESHAPE_HPP
+#define PROTOCOL_MESSAGESHAPE_HPP
+
+namespace Protocol
+{
+
+/**
+ * @brief The kinds of messages, telling which elements a message carries.
+ */
+enum MessageKind
+{
+    MESSAGE_KIND_BARE_REQUEST,
+    MESSAGE_KIND_REQUEST,
+    MESSAGE_KIND_ANONYMOUS_REQUEST,
+    MESSAGE_KIND_BATCH_REQUEST,
+    MESSAGE_KIND_BARE_REPLY,
+    MESSAGE_KIND_REPLY,
+    MESSAGE_KIND_BATCH_REPLY,
+    MESSAGE_KIND_INDICATION
+};
+
+/**
+ * @brief The shape of a message, the elements it carries on the wire.
+ *
+ * The lists of fields are terminated with a null pointer.
+ */
+struct MessageShape
+{
+    /**
+     * @brief The identifier of the message.
+     */
+    unsigned short int mId;
+
+    /**
+     * @brief The kind of the message.
+     */
+    MessageKind mKind;
+
+    /**
+     * @brief The name of the element specific to the message.
+     */
+    char const * mSpecific;
+
+    /**
+     * @brief The names of the fields of the specific element, mapped to the params of the command.
+     */
+    char const * mFields[5];
+
+    /**
+     * @brief The name of the element grouping the objects, null if at most one object is carried.
+     */
+    char const * mContainer;
+
+    /**
+     * @brief The name of an object, null if no objects are carried.
+     */
+    char const * mObject;
+
+    /**
+     * @brief The names of the fields of an object.
+     */
+    char const * mObjectFields[6];
+};
+
+/**
+ * @brief Finds the shape of a message.
+ *
+ * @param aId The identifier of the message.
+ *
+ * @return The shape, null if the identifier is unknown.
+ */
+MessageShape const * findMessageShape(
+    unsigned short int const aId
+);
+
+} // namespace Protocol
+
+#endif // PROTOCOL_MESSAGESHAPE_HPP
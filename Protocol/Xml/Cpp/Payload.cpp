@@ -58,6 +58,15 @@ Payload::Payload(
     BOOST_ASSERT_MSG(mLength == mContent.length(), "Invalid length set.");
 }
 
+Payload::Payload(
+    char        const * aContent,
+    std::size_t         aLength
+)
+    : mLength(aLength),
+      mContent(aContent, aLength)
+{
+}
+
 int Payload::getLength() const
 {
     return mLength;
@@ -46,6 +46,17 @@ public:
         std::string const & aContent
     );
 
+    /**
+     * @brief Constructs the payload straight from a receive buffer.
+     *
+     * @param aContent The content.
+     * @param aLength  The length of the content.
+     */
+    Payload(
+        char        const * aContent,
+        std::size_t         aLength
+    );
+
     int getLength() const;
 
     std::string const & getContent() const;
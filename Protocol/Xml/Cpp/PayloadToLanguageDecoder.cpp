@@ -0,0 +1,736 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Command.hpp>
+#include <Poco/SAX/Attributes.h>
+#include <Poco/SAX/DefaultHandler.h>
+#include <Poco/SAX/SAXParser.h>
+#include <Poco/SAX/XMLReader.h>
+#include <Poco/String.h>
+#include <Protocol/Xml/Cpp/MessageShape.hpp>
+#include <Protocol/Xml/Cpp/PayloadToLanguageDecoder.hpp>
+#include <boost/lexical_cast.hpp>
+#include <vector>
+
+namespace Protocol
+{
+
+namespace
+{
+
+/**
+ * @brief Verifies whether a name belongs to a null terminated list of names.
+ */
+bool contains(
+    char const * const * aNames,
+    std::string  const & aName
+)
+{
+    for (; *aNames; ++aNames)
+    {
+        if (aName == *aNames) return true;
+    }
+
+    return false;
+}
+
+bool isReply(
+    MessageKind const aKind
+)
+{
+    return aKind == MESSAGE_KIND_BARE_REPLY or aKind == MESSAGE_KIND_REPLY or aKind == MESSAGE_KIND_BATCH_REPLY;
+}
+
+bool isBatch(
+    MessageKind const aKind
+)
+{
+    return aKind == MESSAGE_KIND_BATCH_REQUEST or aKind == MESSAGE_KIND_BATCH_REPLY;
+}
+
+/**
+ * @brief Gets the name of the element carrying the body of a message of the given kind.
+ */
+char const * getSection(
+    MessageKind const aKind
+)
+{
+    return isReply(aKind) ? "reply" : (aKind == MESSAGE_KIND_INDICATION) ? "indication" : "request";
+}
+
+/**
+ * @brief Verifies whether an XML declaration leaves the payload in UTF-8, the only encoding the parser assumes when
+ *        it starts past the declaration.
+ *
+ * @param aContent  The content of a payload.
+ * @param aPosition The offset of the XML declaration.
+ * @param aEnd      The offset of the end of the XML declaration.
+ */
+bool declaresUtf8(
+    std::string            const & aContent,
+    std::string::size_type const   aPosition,
+    std::string::size_type const   aEnd
+)
+{
+    std::string const declaration = aContent.substr(aPosition, aEnd - aPosition);
+    std::string::size_type const attribute = declaration.find("encoding");
+
+    if (attribute == std::string::npos) return true;
+
+    std::string::size_type const begin = declaration.find_first_of("\"'", attribute);
+
+    if (begin == std::string::npos) return false;
+
+    std::string::size_type const end = declaration.find(declaration[begin], begin + 1);
+
+    if (end == std::string::npos) return false;
+
+    std::string const encoding = declaration.substr(begin + 1, end - begin - 1);
+
+    return Poco::icompare(encoding, "UTF-8") == 0 or Poco::icompare(encoding, "US-ASCII") == 0;
+}
+
+/**
+ * @brief Finds the root element, past the XML declaration, the processing instructions, the comments and the document
+ *        type declaration.
+ *
+ * A payload declared in an encoding other than UTF-8, or starting with the byte order mark of UTF-16, is left to the
+ * parser from its very beginning, so that the parser converts it.
+ *
+ * @param aContent The content of a payload.
+ *
+ * @return The offset of the root element, zero if it cannot be found, so that the parser reports the error, or if the
+ *         payload has to be converted.
+ */
+std::string::size_type findRootElement(
+    std::string const & aContent
+)
+{
+    if (aContent.compare(0, 2, "\xFE\xFF") == 0 or aContent.compare(0, 2, "\xFF\xFE") == 0) return 0;
+
+    std::string::size_type position = aContent.find('<');
+
+    while (position != std::string::npos)
+    {
+        if (aContent.compare(position, 5, "<?xml") == 0)
+        {
+            std::string::size_type const end = aContent.find("?>", position);
+
+            if (end == std::string::npos or not declaresUtf8(aContent, position, end)) return 0;
+
+            position = end;
+        }
+        else if (aContent.compare(position, 2, "<?") == 0)
+        {
+            position = aContent.find("?>", position);
+        }
+        else if (aContent.compare(position, 4, "<!--") == 0)
+        {
+            position = aContent.find("-->", position);
+        }
+        else if (aContent.compare(position, 2, "<!") == 0)
+        {
+            // The internal subset of the document type declaration carries markup of its own.
+            std::string::size_type const end = aContent.find('>', position);
+            std::string::size_type const subset = aContent.find('[', position);
+            position = (subset < end) ? aContent.find(']', subset) : end;
+        }
+        else
+        {
+            return position;
+        }
+
+        if (position == std::string::npos) break;
+
+        position = aContent.find('<', position);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief The roles the elements play in a message.
+ */
+enum Role
+{
+    ROLE_SKIPPED,
+    ROLE_INNER,
+    ROLE_MESSAGE,
+    ROLE_HEADER,
+    ROLE_ID,
+    ROLE_USER,
+    ROLE_LOGIN,
+    ROLE_PASSWORD,
+    ROLE_SESSION_TOKEN,
+    ROLE_TIMEOUT,
+    ROLE_IDEMPOTENCY_KEY,
+    ROLE_SECTION,
+    ROLE_CODE,
+    ROLE_TEXT,
+    ROLE_SPECIFIC,
+    ROLE_FIELD,
+    ROLE_CONTAINER,
+    ROLE_OBJECT,
+    ROLE_OBJECT_FIELD,
+    ROLE_MESSAGES
+};
+
+/**
+ * @brief Verifies whether the text of an element playing the given role is needed.
+ */
+bool isCaptured(
+    Role const aRole
+)
+{
+    switch (aRole)
+    {
+        case ROLE_ID:
+        case ROLE_LOGIN:
+        case ROLE_PASSWORD:
+        case ROLE_SESSION_TOKEN:
+        case ROLE_TIMEOUT:
+        case ROLE_IDEMPOTENCY_KEY:
+        case ROLE_CODE:
+        case ROLE_TEXT:
+        case ROLE_FIELD:
+        case ROLE_OBJECT_FIELD:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief The state of a message being decoded.
+ *
+ * Only the first occurrence of an element counts, as with Poco::XML::Element::getChildElement().
+ */
+struct MessageState
+{
+    MessageState(
+        std::string const & aLogin,
+        std::string const & aPassword
+    )
+        : mShape(0),
+          mSeen(0),
+          mLogin(aLogin),
+          mPassword(aPassword)
+    {
+    }
+
+    /**
+     * @brief Claims the first occurrence of a role.
+     *
+     * @return The role if it is the first occurrence, ROLE_SKIPPED otherwise.
+     */
+    Role claim(
+        Role const aRole
+    )
+    {
+        if (seen(aRole)) return ROLE_SKIPPED;
+
+        mSeen |= (1ul << aRole);
+
+        return aRole;
+    }
+
+    bool seen(
+        Role const aRole
+    ) const
+    {
+        return mSeen & (1ul << aRole);
+    }
+
+    MessageShape const * mShape;
+
+    unsigned long int mSeen;
+
+    std::string mLogin;
+    std::string mPassword;
+
+    std::string mUserLogin;
+    std::string mUserPassword;
+    std::string mSessionToken;
+    std::string mTimeout;
+    std::string mIdempotencyKey;
+    std::string mCode;
+    std::string mMessage;
+
+    Language::ICommand::Object mFields;
+    Language::ICommand::Object mObject;
+    Language::ICommand::Objects mObjects;
+    Language::ICommand::Commands mCommands;
+};
+
+/**
+ * @brief Builds the command of a completely read message.
+ *
+ * @throw std::exception          In case of missing elements.
+ * @throw boost::bad_lexical_cast In case of invalid reply code.
+ */
+Language::ICommand::Handle buildCommand(
+    MessageState const & aMessage
+)
+{
+    if (not (aMessage.seen(ROLE_HEADER) and aMessage.seen(ROLE_ID))) throw std::exception();
+
+    MessageShape const & shape = *aMessage.mShape;
+
+    Language::ICommand::Handle command = Language::createCommand();
+    command->setID(shape.mId);
+
+    if (shape.mKind == MESSAGE_KIND_BARE_REQUEST) return command;
+
+    if (not (aMessage.seen(ROLE_SECTION) and aMessage.seen(ROLE_SPECIFIC))) throw std::exception();
+
+    if (isReply(shape.mKind))
+    {
+        if (not aMessage.seen(ROLE_CODE)) throw std::exception();
+        if (shape.mKind != MESSAGE_KIND_BARE_REPLY and not aMessage.seen(ROLE_TEXT)) throw std::exception();
+    }
+
+    if (isBatch(shape.mKind) and not aMessage.seen(ROLE_MESSAGES)) throw std::exception();
+    if (shape.mContainer and not aMessage.seen(ROLE_CONTAINER)) throw std::exception();
+
+    if (shape.mKind == MESSAGE_KIND_REQUEST or shape.mKind == MESSAGE_KIND_BATCH_REQUEST)
+    {
+        command->setLogin(aMessage.mLogin);
+        command->setPassword(aMessage.mPassword);
+    }
+
+    for (char const * const * field = shape.mFields; *field; ++field)
+    {
+        Language::ICommand::Object::const_iterator const it = aMessage.mFields.find(*field);
+        if (it == aMessage.mFields.end()) throw std::exception();
+
+        command->setParam(it->first, it->second);
+    }
+
+    if (isReply(shape.mKind))
+    {
+        command->setCode(boost::lexical_cast<unsigned short int>(aMessage.mCode));
+
+        if (shape.mKind != MESSAGE_KIND_BARE_REPLY)
+        {
+            command->setMessage(aMessage.mMessage);
+        }
+    }
+
+    for (Language::ICommand::Objects::const_iterator it = aMessage.mObjects.begin(); it != aMessage.mObjects.end(); ++it)
+    {
+        command->addObject(*it);
+    }
+
+    for (Language::ICommand::Commands::const_iterator it = aMessage.mCommands.begin(); it != aMessage.mCommands.end(); ++it)
+    {
+        command->addCommand(*it);
+    }
+
+    return command;
+}
+
+/**
+ * @brief The SAX handler building a command as the elements of a message stream by.
+ *
+ * Every element gets a role from the role of its parent. The messages nested in a batch are kept on a stack of their
+ * own, and their commands are collected by the enclosing message.
+ */
+class MessageHandler
+    : public Poco::XML::DefaultHandler
+{
+public:
+    MessageHandler()
+        : mFailed(false),
+          mCapturing(0)
+    {
+    }
+
+    /**
+     * @brief Gets the decoded command.
+     *
+     * @throw std::exception If no message has been decoded, or if the message is not valid.
+     */
+    Language::ICommand::Handle getCommand() const
+    {
+        if (mFailed or not mCommand) throw std::exception();
+
+        return mCommand;
+    }
+
+    virtual void startElement(
+        Poco::XML::XMLString  const & aUri,
+        Poco::XML::XMLString  const & aLocalName,
+        Poco::XML::XMLString  const & aQualifiedName,
+        Poco::XML::Attributes const & aAttributes
+    )
+    {
+        if (mFailed) return;
+
+        // Namespace processing fills in the local name, its absence the qualified one.
+        try
+        {
+            start(aLocalName.empty() ? aQualifiedName : aLocalName);
+        }
+        catch (std::exception const &)
+        {
+            mFailed = true;
+        }
+    }
+
+    virtual void endElement(
+        Poco::XML::XMLString const & aUri,
+        Poco::XML::XMLString const & aLocalName,
+        Poco::XML::XMLString const & aQualifiedName
+    )
+    {
+        if (mFailed) return;
+
+        try
+        {
+            end();
+        }
+        catch (std::exception const &)
+        {
+            mFailed = true;
+        }
+    }
+
+    virtual void characters(
+        Poco::XML::XMLChar const aCharacters[],
+        int                      aStart,
+        int                      aLength
+    )
+    {
+        if (mCapturing and not mFailed)
+        {
+            mText.append(aCharacters + aStart, aLength);
+        }
+    }
+
+private:
+    /**
+     * @brief Handles the start of an element.
+     *
+     * @param aName The name of the element.
+     *
+     * @throw std::exception If the element is not allowed where it appears.
+     */
+    void start(
+        std::string const & aName
+    )
+    {
+        if (mCapturing)
+        {
+            ++mCapturing;
+            mRoles.push_back(ROLE_INNER);
+            return;
+        }
+
+        Role const role = mRoles.empty() ? ROLE_MESSAGE : classify(aName);
+
+        if (role == ROLE_MESSAGE)
+        {
+            bool const inherits = not mMessages.empty()
+                                  and mMessages.back().mShape->mKind == MESSAGE_KIND_BATCH_REQUEST;
+
+            std::string const login = inherits ? mMessages.back().mLogin : "";
+            std::string const password = inherits ? mMessages.back().mPassword : "";
+
+            mMessages.push_back(MessageState(login, password));
+        }
+        else if (role == ROLE_OBJECT)
+        {
+            mMessages.back().mObject.clear();
+        }
+        else if (isCaptured(role))
+        {
+            mCapturing = 1;
+            mName = aName;
+            mText.clear();
+        }
+
+        mRoles.push_back(role);
+    }
+
+    /**
+     * @brief Handles the end of the current element.
+     *
+     * @throw std::exception          In case of missing elements.
+     * @throw boost::bad_lexical_cast In case of invalid identifier, reply code or timeout.
+     */
+    void end()
+    {
+        Role const role = mRoles.back();
+        mRoles.pop_back();
+
+        if (role == ROLE_INNER)
+        {
+            --mCapturing;
+            return;
+        }
+
+        if (isCaptured(role))
+        {
+            mCapturing = 0;
+        }
+
+        MessageState & message = mMessages.back();
+
+        switch (role)
+        {
+            case ROLE_ID:
+                message.mShape = findMessageShape(boost::lexical_cast<unsigned short int>(mText));
+                if (not message.mShape) throw std::exception();
+                break;
+
+            case ROLE_USER:
+                if (not (message.seen(ROLE_LOGIN) and (message.seen(ROLE_PASSWORD) or message.seen(ROLE_SESSION_TOKEN))))
+                {
+                    throw std::exception();
+                }
+
+                message.mLogin = message.mUserLogin;
+                message.mPassword = message.mUserPassword;
+                break;
+
+            case ROLE_LOGIN:           message.mUserLogin = mText;      break;
+            case ROLE_PASSWORD:        message.mUserPassword = mText;   break;
+            case ROLE_SESSION_TOKEN:   message.mSessionToken = mText;   break;
+            case ROLE_TIMEOUT:         message.mTimeout = mText;        break;
+            case ROLE_IDEMPOTENCY_KEY: message.mIdempotencyKey = mText; break;
+            case ROLE_CODE:            message.mCode = mText;           break;
+            case ROLE_TEXT:            message.mMessage = mText;        break;
+
+            case ROLE_FIELD:
+                message.mFields.insert(std::make_pair(mName, mText));
+                break;
+
+            case ROLE_OBJECT_FIELD:
+                message.mObject.insert(std::make_pair(mName, mText));
+                break;
+
+            case ROLE_OBJECT:
+                for (char const * const * field = message.mShape->mObjectFields; *field; ++field)
+                {
+                    if (not message.mObject.count(*field)) throw std::exception();
+                }
+
+                message.mObjects.push_back(message.mObject);
+                break;
+
+            case ROLE_MESSAGE:
+                finishMessage();
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /**
+     * @brief Gives a role to a child element of the current element.
+     *
+     * @param aName The name of the child element.
+     *
+     * @return The role.
+     *
+     * @throw std::exception If the element cannot be told apart yet, or if it is not allowed where it appears.
+     */
+    Role classify(
+        std::string const & aName
+    )
+    {
+        MessageState & message = mMessages.back();
+        MessageShape const * shape = message.mShape;
+
+        switch (mRoles.back())
+        {
+            case ROLE_MESSAGE:
+                if (aName == "header") return message.claim(ROLE_HEADER);
+
+                if (aName == "request" or aName == "reply" or aName == "indication")
+                {
+                    // The body is interpreted according to the identifier, so the header has to come first.
+                    if (not shape) throw std::exception();
+
+                    if (aName == getSection(shape->mKind)) return message.claim(ROLE_SECTION);
+                }
+
+                return ROLE_SKIPPED;
+
+            case ROLE_HEADER:
+                if (aName == "id") return message.claim(ROLE_ID);
+                if (aName == "user") return message.claim(ROLE_USER);
+                if (aName == "timeout") return message.claim(ROLE_TIMEOUT);
+                if (aName == "idempotency_key") return message.claim(ROLE_IDEMPOTENCY_KEY);
+                return ROLE_SKIPPED;
+
+            case ROLE_USER:
+                if (aName == "login") return message.claim(ROLE_LOGIN);
+                if (aName == "password") return message.claim(ROLE_PASSWORD);
+                if (aName == "session_token") return message.claim(ROLE_SESSION_TOKEN);
+                return ROLE_SKIPPED;
+
+            case ROLE_SECTION:
+                if (aName == shape->mSpecific) return message.claim(ROLE_SPECIFIC);
+
+                if (isReply(shape->mKind))
+                {
+                    if (aName == "code") return message.claim(ROLE_CODE);
+                    if (aName == "message") return message.claim(ROLE_TEXT);
+                }
+
+                return ROLE_SKIPPED;
+
+            case ROLE_SPECIFIC:
+                if (isBatch(shape->mKind) and aName == "messages") return message.claim(ROLE_MESSAGES);
+                if (shape->mContainer and aName == shape->mContainer) return message.claim(ROLE_CONTAINER);
+                if (not shape->mContainer and shape->mObject and aName == shape->mObject) return message.claim(ROLE_OBJECT);
+                if (contains(shape->mFields, aName) and not message.mFields.count(aName)) return ROLE_FIELD;
+                return ROLE_SKIPPED;
+
+            case ROLE_CONTAINER:
+                return (aName == shape->mObject) ? ROLE_OBJECT : ROLE_SKIPPED;
+
+            case ROLE_OBJECT:
+                if (contains(shape->mObjectFields, aName) and not message.mObject.count(aName)) return ROLE_OBJECT_FIELD;
+                return ROLE_SKIPPED;
+
+            case ROLE_MESSAGES:
+                // Only messages may be nested, so that the order of the batch is preserved.
+                if (aName != "message") throw std::exception();
+                return ROLE_MESSAGE;
+
+            default:
+                return ROLE_SKIPPED;
+        }
+    }
+
+    /**
+     * @brief Builds the command of the current message and hands it over to the enclosing one, if any.
+     */
+    void finishMessage()
+    {
+        Language::ICommand::Handle const command = buildCommand(mMessages.back());
+
+        if (mMessages.size() > 1)
+        {
+            mMessages.pop_back();
+            mMessages.back().mCommands.push_back(command);
+            return;
+        }
+
+        // The session token, the timeout and the idempotency key are honoured at the top level only, nested messages
+        // act on behalf of the enclosing one.
+        MessageState const & message = mMessages.back();
+
+        if (message.seen(ROLE_SESSION_TOKEN))
+        {
+            command->setSessionToken(message.mSessionToken);
+        }
+
+        if (message.seen(ROLE_TIMEOUT))
+        {
+            command->setTimeout(boost::lexical_cast<unsigned int>(message.mTimeout));
+        }
+
+        if (message.seen(ROLE_IDEMPOTENCY_KEY))
+        {
+            command->setIdempotencyKey(message.mIdempotencyKey);
+        }
+
+        mMessages.pop_back();
+        mCommand = command;
+    }
+
+    /**
+     * @brief Whether the message has been found invalid.
+     *
+     * Exceptions are not let through the parser, the rest of the payload is ignored instead.
+     */
+    bool mFailed;
+
+    /**
+     * @brief The roles of the open elements.
+     */
+    std::vector<Role> mRoles;
+
+    /**
+     * @brief The open messages, the nested ones on top.
+     */
+    std::vector<MessageState> mMessages;
+
+    /**
+     * @brief The depth of the element whose text is being captured, zero if none.
+     */
+    unsigned int mCapturing;
+
+    /**
+     * @brief The name of the element whose text is being captured.
+     */
+    std::string mName;
+
+    /**
+     * @brief The text being captured.
+     */
+    std::string mText;
+
+    /**
+     * @brief The decoded command.
+     */
+    Language::ICommand::Handle mCommand;
+};
+
+} // namespace
+
+PayloadToLanguageDecoder::PayloadToLanguageDecoder(
+    DecodingMode const aMode
+)
+    : mMode(aMode)
+{
+}
+
+Language::ICommand::Handle PayloadToLanguageDecoder::decode(
+    Payload const & aPayload
+) const
+{
+    std::string const & content = aPayload.getContent();
+    std::string::size_type const begin = (mMode == DECODING_MODE_FAST) ? findRootElement(content) : 0;
+
+    MessageHandler handler;
+
+    Poco::XML::SAXParser parser;
+    parser.setFeature(Poco::XML::XMLReader::FEATURE_NAMESPACES, mMode == DECODING_MODE_STANDARD);
+    parser.setFeature(Poco::XML::XMLReader::FEATURE_NAMESPACE_PREFIXES, mMode == DECODING_MODE_STANDARD);
+    parser.setContentHandler(&handler);
+    parser.parseMemoryNP(content.data() + begin, content.size() - begin);
+
+    return handler.getCommand();
+}
+
+} // namespace Protocol
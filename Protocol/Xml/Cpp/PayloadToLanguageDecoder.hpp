@@ -0,0 +1,97 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef PROTOCOL_PAYLOADTOLANGUAGEDECODER_HPP
+#define PROTOCOL_PAYLOADTOLANGUAGEDECODER_HPP
+
+#include <Language/Interface/ICommand.hpp>
+#include <Protocol/Xml/Cpp/Payload.hpp>
+
+namespace Protocol
+{
+
+/**
+ * @brief The modes of decoding.
+ */
+enum DecodingMode
+{
+    /**
+     * @brief The whole payload is parsed, the prolog and the document type declaration included, with namespaces
+     *        processed the way the DOM parser does.
+     */
+    DECODING_MODE_STANDARD,
+
+    /**
+     * @brief The prolog is skipped before parsing, so the document type declaration is never looked at, and namespaces
+     *        are not processed.
+     *
+     * A payload declared in an encoding other than UTF-8 is parsed whole, as in the standard mode, to be converted.
+     */
+    DECODING_MODE_FAST
+};
+
+/**
+ * @brief The streaming decoder of payloads.
+ *
+ * Decodes a payload straight to a command by means of a SAX parser, so no DOM is built on the way. The commands are
+ * identical to the ones produced by PayloadToProtocolTranslator followed by ProtocolToLanguageTranslator.
+ */
+class PayloadToLanguageDecoder
+{
+public:
+    /**
+     * @brief Constructs the decoder.
+     *
+     * @param aMode The mode of decoding.
+     */
+    explicit PayloadToLanguageDecoder(
+        DecodingMode const aMode = DECODING_MODE_FAST
+    );
+
+    /**
+     * @brief Decodes a payload to a command.
+     *
+     * @param aPayload The payload.
+     *
+     * @return The command.
+     *
+     * @throw std::exception In case of failure.
+     */
+    Language::ICommand::Handle decode(
+        Payload const & aPayload
+    ) const;
+
+private:
+    /**
+     * @brief The mode of decoding.
+     */
+    DecodingMode const mMode;
+};
+
+} // namespace Protocol
+
+#endif // PROTOCOL_PAYLOADTOLANGUAGEDECODER_HPP
@@ -25,6 +25,7 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Language/Interface/IndicationBuilder.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
 #include <Language/Interface/RequestBuilder.hpp>
 #include <Poco/AutoPtr.h>
@@ -42,19 +43,56 @@ namespace Protocol
 Language::ICommand::Handle ProtocolToLanguageTranslator::translate(
     Message::Handle a_message
 ) const
+{
+    Poco::XML::Element * message = a_message->documentElement();
+    if (not message) throw std::exception();
+
+    Language::ICommand::Handle const command = translateElement(message, "", "");
+
+    // The session token, the timeout and the idempotency key are honoured at the top level only, nested messages act
+    // on behalf of the enclosing one.
+    Poco::XML::Element * header = message->getChildElement("header");
+    Poco::XML::Element * user = header->getChildElement("user");
+    Poco::XML::Element * session_token = user ? user->getChildElement("session_token") : 0;
+    Poco::XML::Element * timeout = header->getChildElement("timeout");
+    Poco::XML::Element * idempotency_key = header->getChildElement("idempotency_key");
+
+    if (session_token)
+    {
+        command->setSessionToken(session_token->innerText());
+    }
+
+    if (timeout)
+    {
+        command->setTimeout(boost::lexical_cast<unsigned int>(timeout->innerText()));
+    }
+
+    if (idempotency_key)
+    {
+        command->setIdempotencyKey(idempotency_key->innerText());
+    }
+
+    return command;
+}
+
+Language::ICommand::Handle ProtocolToLanguageTranslator::translateElement(
+    Poco::XML::Element * a_message,
+    std::string  const   a_login,
+    std::string  const   a_password
+) const
 {
     typedef Poco::XML::Element *               Element;
     typedef Poco::AutoPtr<Poco::XML::NodeList> NodeList;
 
     Language::RequestBuilder request_builder;
     Language::ReplyBuilder reply_builder;
+    Language::IndicationBuilder indication_builder;
 
     // Default values.
     unsigned short int id(0);
-    std::string login, password;
+    std::string login(a_login), password(a_password);
 
-    Element message = a_message->documentElement();
-    if (not message) throw std::exception();
+    Element message = a_message;
 
     Element header = message->getChildElement("header");
     if (not header) throw std::exception();
@@ -70,10 +108,11 @@ Language::ICommand::Handle ProtocolToLanguageTranslator::translate(
     {
         Element element_login = user->getChildElement("login");
         Element element_password = user->getChildElement("password");
-        if (not (element_login and element_password)) throw std::exception();
+        Element element_session_token = user->getChildElement("session_token");
+        if (not (element_login and (element_password or element_session_token))) throw std::exception();
 
         login = element_login->innerText();
-        password = element_password->innerText();
+        password = element_password ? element_password->innerText() : "";
     }
 
     switch (id)
@@ -666,6 +705,74 @@ Language::ICommand::Handle ProtocolToLanguageTranslator::translate(
                    );
         }
 
+        case Language::ID_COMMAND_BATCH_REQUEST:
+        {
+            Element request = message->getChildElement("request");
+            if (not request) throw std::exception();
+
+            Element specific_request = request->getChildElement("batch_request");
+            if (not specific_request) throw std::exception();
+
+            Element atomic = specific_request->getChildElement("atomic");
+            Element messages = specific_request->getChildElement("messages");
+            if (not (atomic and messages)) throw std::exception();
+
+            return request_builder.buildBatchRequest(
+                       login,
+                       password,
+                       atomic->innerText(),
+                       translateMessages(messages, login, password)
+                   );
+        }
+
+        case Language::ID_COMMAND_SUBSCRIBE_REQUEST:
+        {
+            Element request = message->getChildElement("request");
+            if (not request) throw std::exception();
+
+            Element specific_request = request->getChildElement("subscribe_request");
+            if (not specific_request) throw std::exception();
+
+            Element world_name = specific_request->getChildElement("world_name");
+            if (not world_name) throw std::exception();
+
+            return request_builder.buildSubscribeRequest(
+                       login,
+                       password,
+                       world_name->innerText()
+                   );
+        }
+
+        case Language::ID_COMMAND_LOGIN_REQUEST:
+        {
+            Element request = message->getChildElement("request");
+            if (not request) throw std::exception();
+
+            Element specific_request = request->getChildElement("login_request");
+            if (not specific_request) throw std::exception();
+
+            return request_builder.buildLoginRequest(
+                       login,
+                       password
+                   );
+        }
+
+        case Language::ID_COMMAND_LOGOUT_REQUEST:
+        {
+            Element request = message->getChildElement("request");
+            if (not request) throw std::exception();
+
+            Element specific_request = request->getChildElement("logout_request");
+            if (not specific_request) throw std::exception();
+
+            Element session_token = user ? user->getChildElement("session_token") : 0;
+
+            return request_builder.buildLogoutRequest(
+                       login,
+                       session_token ? session_token->innerText() : ""
+                   );
+        }
+
         case Language::ID_COMMAND_ECHO_REPLY:
         {
             Element reply = message->getChildElement("reply");
@@ -1522,9 +1629,155 @@ Language::ICommand::Handle ProtocolToLanguageTranslator::translate(
                    );
         }
 
+        case Language::ID_COMMAND_BATCH_REPLY:
+        {
+            Element reply = message->getChildElement("reply");
+            if (not reply) throw std::exception();
+
+            Element code = reply->getChildElement("code");
+            Element message = reply->getChildElement("message");
+            if (not (code and message)) throw std::exception();
+
+            Element specific_reply = reply->getChildElement("batch_reply");
+            if (not specific_reply) throw std::exception();
+
+            Element messages = specific_reply->getChildElement("messages");
+            if (not messages) throw std::exception();
+
+            return reply_builder.buildBatchReply(
+                       boost::lexical_cast<unsigned short int>(code->innerText()),
+                       message->innerText(),
+                       translateMessages(messages, "", "")
+                   );
+        }
+
+        case Language::ID_COMMAND_SUBSCRIBE_REPLY:
+        {
+            Element reply = message->getChildElement("reply");
+            if (not reply) throw std::exception();
+
+            Element code = reply->getChildElement("code");
+            Element message = reply->getChildElement("message");
+            if (not (code and message)) throw std::exception();
+
+            Element specific_reply = reply->getChildElement("subscribe_reply");
+            if (not specific_reply) throw std::exception();
+
+            return reply_builder.buildSubscribeReply(
+                       boost::lexical_cast<unsigned short int>(code->innerText()),
+                       message->innerText()
+                   );
+        }
+
+        case Language::ID_COMMAND_LOGIN_REPLY:
+        {
+            Element reply = message->getChildElement("reply");
+            if (not reply) throw std::exception();
+
+            Element code = reply->getChildElement("code");
+            Element message = reply->getChildElement("message");
+            if (not (code and message)) throw std::exception();
+
+            Element specific_reply = reply->getChildElement("login_reply");
+            if (not specific_reply) throw std::exception();
+
+            Element session_token = specific_reply->getChildElement("session_token");
+            if (not session_token) throw std::exception();
+
+            return reply_builder.buildLoginReply(
+                       boost::lexical_cast<unsigned short int>(code->innerText()),
+                       message->innerText(),
+                       session_token->innerText()
+                   );
+        }
+
+        case Language::ID_COMMAND_LOGOUT_REPLY:
+        {
+            Element reply = message->getChildElement("reply");
+            if (not reply) throw std::exception();
+
+            Element code = reply->getChildElement("code");
+            Element message = reply->getChildElement("message");
+            if (not (code and message)) throw std::exception();
+
+            Element specific_reply = reply->getChildElement("logout_reply");
+            if (not specific_reply) throw std::exception();
+
+            return reply_builder.buildLogoutReply(
+                       boost::lexical_cast<unsigned short int>(code->innerText()),
+                       message->innerText()
+                   );
+        }
+
+        case Language::ID_COMMAND_EPOCH_ACTIVATED_INDICATION:
+        {
+            Element indication = message->getChildElement("indication");
+            if (not indication) throw std::exception();
+
+            Element specific_indication = indication->getChildElement("epoch_activated");
+            if (not specific_indication) throw std::exception();
+
+            Element world_name = specific_indication->getChildElement("world_name");
+            if (not world_name) throw std::exception();
+
+            return indication_builder.buildEpochActivatedIndication(world_name->innerText());
+        }
+
+        case Language::ID_COMMAND_EPOCH_DEACTIVATED_INDICATION:
+        {
+            Element indication = message->getChildElement("indication");
+            if (not indication) throw std::exception();
+
+            Element specific_indication = indication->getChildElement("epoch_deactivated");
+            if (not specific_indication) throw std::exception();
+
+            Element world_name = specific_indication->getChildElement("world_name");
+            if (not world_name) throw std::exception();
+
+            return indication_builder.buildEpochDeactivatedIndication(world_name->innerText());
+        }
+
+        case Language::ID_COMMAND_TICK_COMPLETED_INDICATION:
+        {
+            Element indication = message->getChildElement("indication");
+            if (not indication) throw std::exception();
+
+            Element specific_indication = indication->getChildElement("tick_completed");
+            if (not specific_indication) throw std::exception();
+
+            Element world_name = specific_indication->getChildElement("world_name");
+            Element ticks = specific_indication->getChildElement("ticks");
+            if (not (world_name and ticks)) throw std::exception();
+
+            return indication_builder.buildTickCompletedIndication(
+                       world_name->innerText(),
+                       ticks->innerText()
+                   );
+        }
+
         default:
             BOOST_ASSERT_MSG(false, "Invalid command ID.");
     }
 }
 
+Language::ICommand::Commands ProtocolToLanguageTranslator::translateMessages(
+    Poco::XML::Element * a_messages,
+    std::string  const   a_login,
+    std::string  const   a_password
+) const
+{
+    Language::ICommand::Commands commands;
+
+    // Only direct children are taken into account, so the order of the batch is preserved.
+    for (Poco::XML::Node * node = a_messages->firstChild(); node; node = node->nextSibling())
+    {
+        if (node->nodeType() != Poco::XML::Node::ELEMENT_NODE) continue;
+        if (node->nodeName() != "message") throw std::exception();
+
+        commands.push_back(translateElement(static_cast<Poco::XML::Element *>(node), a_login, a_password));
+    }
+
+    return commands;
+}
+
 } // namespace Protocol
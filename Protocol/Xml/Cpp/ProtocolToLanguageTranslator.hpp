@@ -30,6 +30,7 @@
 
 #include <Language/Interface/ICommand.hpp>
 #include <Protocol/Xml/Cpp/Message.hpp>
+#include <Poco/DOM/Element.h>
 
 namespace Protocol
 {
@@ -53,6 +54,42 @@ public:
     Language::ICommand::Handle translate(
         Message::Handle a_message
     ) const;
+
+private:
+    /**
+     * @brief Translates a message element to a command.
+     *
+     * @param a_message  The root element of the message.
+     * @param a_login    The login to be used if the message does not carry a user.
+     * @param a_password The password to be used if the message does not carry a user.
+     *
+     * @return The command.
+     *
+     * @throw std::exception          In case of failure.
+     * @throw boost::bad_lexical_cast In case of invalid reply code.
+     */
+    Language::ICommand::Handle translateElement(
+        Poco::XML::Element * a_message,
+        std::string  const   a_login,
+        std::string  const   a_password
+    ) const;
+
+    /**
+     * @brief Translates the nested messages of a batch message to commands.
+     *
+     * @param a_messages The element grouping the nested messages.
+     * @param a_login    The login of the batch, inherited by nested messages without a user.
+     * @param a_password The password of the batch, inherited by nested messages without a user.
+     *
+     * @return The commands, in order.
+     *
+     * @throw std::exception In case of failure.
+     */
+    Language::ICommand::Commands translateMessages(
+        Poco::XML::Element * a_messages,
+        std::string  const   a_login,
+        std::string  const   a_password
+    ) const;
 };
 
 } // namespace Protocol
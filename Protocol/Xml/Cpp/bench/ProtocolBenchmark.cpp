@@ -0,0 +1,652 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Command.hpp>
+#include <Language/Interface/Rows.hpp>
+#include <Poco/Timestamp.h>
+#include <Protocol/Binary/Cpp/BinaryToLanguageDecoder.hpp>
+#include <Protocol/Binary/Cpp/LanguageToBinaryEncoder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToPayloadEncoder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToProtocolTranslator.hpp>
+#include <Protocol/Xml/Cpp/MessageShape.hpp>
+#include <Protocol/Xml/Cpp/Payload.hpp>
+#include <Protocol/Xml/Cpp/PayloadToLanguageDecoder.hpp>
+#include <Protocol/Xml/Cpp/PayloadToProtocolTranslator.hpp>
+#include <Protocol/Xml/Cpp/ProtocolToLanguageTranslator.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/shared_ptr.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+/**
+ * Measures every message of the protocol through every codec, one case per message, object count, codec and
+ * operation.
+ *
+ * Usage: protocolbench <milliseconds per case> [<objects per collection reply> ...]
+ *
+ * The commands are made from the shapes of the messages, so a message added to the protocol is measured with no
+ * change here. The collection replies are measured with each of the given object counts (10, 100 and 1000 by
+ * default), carried as rows the way the server builds them; the other messages carry what their shape tells.
+ *
+ * The direct XML codec only encodes what the server sends, so the requests are decoded from what the DOM codec
+ * writes and are not encoded with it.
+ *
+ * A case is repeated, doubling the number of iterations, until it has taken the given time. The results go to the
+ * standard output as tab separated values with a header line, one line per case in a stable order, so that the
+ * outputs of two builds can be diffed or joined on the first five columns. The failures go to the standard error.
+ *
+ * The allocations are counted by the replaced operator new, expat allocates with malloc behind the parsers of Poco,
+ * which take no memory handling suite. The last column tells whether the counts of a case take in everything
+ * ("all") or leave the allocations of the XML parser out ("without_parser"), as for decoding the XML codecs.
+ */
+
+namespace
+{
+
+/**
+ * @brief The number of the allocations made since the start, counted by the replaced operator new.
+ *
+ * The allocations of expat, made by malloc, are not counted.
+ */
+unsigned long long gAllocations = 0;
+
+/**
+ * @brief The number of the bytes allocated since the start.
+ */
+unsigned long long gAllocatedBytes = 0;
+
+void * allocate(
+    std::size_t const aSize
+)
+{
+    ++gAllocations;
+    gAllocatedBytes += aSize;
+
+    void * const pointer = std::malloc(aSize ? aSize : 1);
+
+    if (not pointer)
+    {
+        throw std::bad_alloc();
+    }
+
+    return pointer;
+}
+
+} // namespace
+
+void * operator new(
+    std::size_t aSize
+)
+{
+    return allocate(aSize);
+}
+
+void * operator new[](
+    std::size_t aSize
+)
+{
+    return allocate(aSize);
+}
+
+void operator delete(
+    void * aPointer
+) throw()
+{
+    std::free(aPointer);
+}
+
+void operator delete[](
+    void * aPointer
+) throw()
+{
+    std::free(aPointer);
+}
+
+namespace
+{
+
+enum Codec
+{
+    CODEC_XML_DOM,
+    CODEC_XML_DIRECT,
+    CODEC_BINARY
+};
+
+char const * const CODEC_NAMES[] = {"dom", "direct", "tlv"};
+
+enum Operation
+{
+    OPERATION_ENCODE,
+    OPERATION_DECODE,
+    OPERATION_ROUND_TRIP
+};
+
+char const * const OPERATION_NAMES[] = {"encode", "decode", "roundtrip"};
+
+/**
+ * @brief Verifies whether a case parses XML, the allocations of the parser are not counted then.
+ */
+bool parsesXml(
+    Codec     const aCodec,
+    Operation const aOperation
+)
+{
+    return aCodec != CODEC_BINARY and aOperation != OPERATION_ENCODE;
+}
+
+/**
+ * @brief The number of the sub-commands of a batch.
+ */
+unsigned int const BATCH_SIZE = 4;
+
+/**
+ * @brief The limit of the iterations of a case, reached only by an empty operation.
+ */
+unsigned long long const MAX_ITERATIONS = 1ULL << 32;
+
+struct Case
+{
+    std::string mMessage;
+
+    unsigned short int mId;
+
+    Protocol::MessageKind mKind;
+
+    unsigned int mObjects;
+
+    Language::ICommand::Handle mCommand;
+};
+
+struct Measurement
+{
+    unsigned long long mIterations;
+
+    double mNanoseconds;
+
+    double mAllocations;
+
+    double mBytes;
+};
+
+/**
+ * @brief Makes the value of a field, in the format the game uses for it.
+ */
+std::string createValue(
+    char const * const aField,
+    unsigned int const aIndex
+)
+{
+    static char const * const NUMERIC_FIELDS[] = {"idholderclass", "ticks", "volume", 0};
+    static char const * const BOOLEAN_FIELDS[] = {"active", "atomic", "finished", "granted", 0};
+
+    for (char const * const * field = NUMERIC_FIELDS; *field; ++field)
+    {
+        if (std::strcmp(*field, aField) == 0)
+        {
+            return boost::lexical_cast<std::string>(std::strcmp(aField, "idholderclass") ? 42 + aIndex : 1);
+        }
+    }
+
+    for (char const * const * field = BOOLEAN_FIELDS; *field; ++field)
+    {
+        if (std::strcmp(*field, aField) == 0)
+        {
+            return aIndex % 2 ? "false" : "true";
+        }
+    }
+
+    return std::string(aField) + boost::lexical_cast<std::string>(aIndex % 16);
+}
+
+/**
+ * @brief Finds the schema of the rows of a collection reply.
+ *
+ * @return The schema, null if the container is not carried as rows.
+ */
+Language::RowSchema const * findRowSchema(
+    char const * const aContainer
+)
+{
+    struct ContainerRows
+    {
+        char const * mContainer;
+
+        Language::RowSchema const * mSchema;
+    };
+
+    static ContainerRows const CONTAINER_ROWS[] =
+    {
+        { "buildings",   &Language::BUILDING_ROWS },
+        { "humans",      &Language::HUMAN_ROWS },
+        { "lands",       &Language::LAND_ROWS },
+        { "resources",   &Language::RESOURCE_ROWS },
+        { "settlements", &Language::SETTLEMENT_ROWS }
+    };
+
+    for (std::size_t i = 0; i < sizeof(CONTAINER_ROWS) / sizeof(CONTAINER_ROWS[0]); ++i)
+    {
+        if (std::strcmp(CONTAINER_ROWS[i].mContainer, aContainer) == 0)
+        {
+            return CONTAINER_ROWS[i].mSchema;
+        }
+    }
+
+    return 0;
+}
+
+Language::ICommand::Handle createSample(
+    Protocol::MessageShape const & aShape,
+    unsigned int           const   aObjects
+)
+{
+    Language::ICommand::Handle const command = Language::createCommand();
+    command->setID(aShape.mId);
+
+    switch (aShape.mKind)
+    {
+        case Protocol::MESSAGE_KIND_REQUEST:
+        case Protocol::MESSAGE_KIND_ANONYMOUS_REQUEST:
+        case Protocol::MESSAGE_KIND_BATCH_REQUEST:
+            command->setLogin("Login");
+            command->setPassword("Password");
+            break;
+
+        case Protocol::MESSAGE_KIND_BARE_REPLY:
+            command->setCode(1);
+            break;
+
+        case Protocol::MESSAGE_KIND_REPLY:
+        case Protocol::MESSAGE_KIND_BATCH_REPLY:
+            command->setCode(1);
+            command->setMessage("The operation has been performed.");
+            break;
+
+        default:
+            break;
+    }
+
+    for (std::size_t i = 0; aShape.mFields[i]; ++i)
+    {
+        command->setParam(aShape.mFields[i], createValue(aShape.mFields[i], 0));
+    }
+
+    Language::RowSchema const * const schema = aShape.mContainer ? findRowSchema(aShape.mContainer) : 0;
+
+    if (schema)
+    {
+        Language::Rows rows(*schema);
+
+        for (unsigned int i = 0; i < aObjects; ++i)
+        {
+            for (unsigned int column = 0; column < rows.getColumnCount(); ++column)
+            {
+                rows.appendText(column, createValue(rows.getKey(column), i));
+            }
+        }
+
+        command->setRows(rows);
+    }
+    else if (aShape.mObject)
+    {
+        for (unsigned int i = 0; i < aObjects; ++i)
+        {
+            Language::ICommand::Object object;
+
+            for (std::size_t j = 0; aShape.mObjectFields[j]; ++j)
+            {
+                object.insert(std::make_pair(aShape.mObjectFields[j], createValue(aShape.mObjectFields[j], i)));
+            }
+
+            command->addObject(object);
+        }
+    }
+
+    if (aShape.mKind == Protocol::MESSAGE_KIND_BATCH_REQUEST or aShape.mKind == Protocol::MESSAGE_KIND_BATCH_REPLY)
+    {
+        bool const request = aShape.mKind == Protocol::MESSAGE_KIND_BATCH_REQUEST;
+        Protocol::MessageShape const * const subShape = Protocol::findMessageShape(
+            request ? Language::ID_COMMAND_GET_LAND_REQUEST : Language::ID_COMMAND_GET_LAND_REPLY);
+
+        for (unsigned int i = 0; i < BATCH_SIZE; ++i)
+        {
+            command->addCommand(createSample(*subShape, request ? 0 : 1));
+        }
+    }
+
+    return command;
+}
+
+std::vector<Case> createCases(
+    std::vector<unsigned int> const & aObjectCounts
+)
+{
+    std::vector<Case> cases;
+
+    for (unsigned short int id = 1; Protocol::MessageShape const * const shape = Protocol::findMessageShape(id); ++id)
+    {
+        std::vector<unsigned int> objectCounts(1, shape->mObject ? 1 : 0);
+
+        if (shape->mContainer)
+        {
+            objectCounts = aObjectCounts;
+        }
+
+        for (std::vector<unsigned int>::const_iterator it = objectCounts.begin(); it != objectCounts.end(); ++it)
+        {
+            Case sample;
+            sample.mMessage = shape->mSpecific;
+            sample.mId = id;
+            sample.mKind = shape->mKind;
+            sample.mObjects = *it;
+            sample.mCommand = createSample(*shape, *it);
+
+            cases.push_back(sample);
+        }
+    }
+
+    return cases;
+}
+
+/**
+ * @brief Tells whether a codec encodes a kind of message, the direct XML encoder writing only what the server sends.
+ */
+bool canEncode(
+    Codec                 const aCodec,
+    Protocol::MessageKind const aKind
+)
+{
+    if (aCodec != CODEC_XML_DIRECT)
+    {
+        return true;
+    }
+
+    return aKind == Protocol::MESSAGE_KIND_BARE_REPLY
+        or aKind == Protocol::MESSAGE_KIND_REPLY
+        or aKind == Protocol::MESSAGE_KIND_BATCH_REPLY
+        or aKind == Protocol::MESSAGE_KIND_INDICATION;
+}
+
+/**
+ * @brief Performs one operation of a case, keeping the codecs and the buffers across the iterations like the server.
+ */
+class Runner
+{
+public:
+    Runner(
+        Codec                      const aCodec,
+        Operation                  const aOperation,
+        Language::ICommand::Handle const aCommand,
+        bool                       const aEncodable
+    )
+        : mCodec(aCodec),
+          mOperation(aOperation),
+          mCommand(aCommand),
+          mPayloadToLanguageDecoder(Protocol::DECODING_MODE_FAST)
+    {
+        if (aEncodable)
+        {
+            encode();
+
+            mPayload = mCodec == CODEC_XML_DOM
+                       ? mEncodedPayload
+                       : boost::shared_ptr<Protocol::Payload>(new Protocol::Payload(&mBuffer[0], mBuffer.size()));
+        }
+        else
+        {
+            mPayload.reset(new Protocol::Payload(mLanguageToProtocolTranslator.translate(mCommand)));
+        }
+    }
+
+    void run()
+    {
+        switch (mOperation)
+        {
+            case OPERATION_ENCODE:
+                encode();
+                break;
+
+            case OPERATION_DECODE:
+                decode(*mPayload);
+                break;
+
+            default:
+                encode();
+
+                if (mCodec == CODEC_XML_DOM)
+                {
+                    decode(*mEncodedPayload);
+                }
+                else
+                {
+                    decode(Protocol::Payload(&mBuffer[0], mBuffer.size()));
+                }
+
+                break;
+        }
+    }
+
+    std::size_t getWireSize() const
+    {
+        return mPayload->getContent().length();
+    }
+
+private:
+    void encode()
+    {
+        switch (mCodec)
+        {
+            case CODEC_XML_DOM:
+                mEncodedPayload.reset(new Protocol::Payload(mLanguageToProtocolTranslator.translate(mCommand)));
+                break;
+
+            case CODEC_XML_DIRECT:
+                mBuffer.clear();
+                mLanguageToPayloadEncoder.encode(mCommand, mBuffer);
+                break;
+
+            default:
+                mBuffer.clear();
+                mLanguageToBinaryEncoder.encode(mCommand, mBuffer);
+                break;
+        }
+    }
+
+    void decode(
+        Protocol::Payload const & aPayload
+    )
+    {
+        switch (mCodec)
+        {
+            case CODEC_XML_DOM:
+                mDecoded = mProtocolToLanguageTranslator.translate(mPayloadToProtocolTranslator.translate(aPayload));
+                break;
+
+            case CODEC_XML_DIRECT:
+                mDecoded = mPayloadToLanguageDecoder.decode(aPayload);
+                break;
+
+            default:
+                mDecoded = mBinaryToLanguageDecoder.decode(aPayload);
+                break;
+        }
+    }
+
+    Codec const mCodec;
+
+    Operation const mOperation;
+
+    Language::ICommand::Handle const mCommand;
+
+    Protocol::LanguageToProtocolTranslator mLanguageToProtocolTranslator;
+
+    Protocol::PayloadToProtocolTranslator mPayloadToProtocolTranslator;
+
+    Protocol::ProtocolToLanguageTranslator mProtocolToLanguageTranslator;
+
+    Protocol::LanguageToPayloadEncoder mLanguageToPayloadEncoder;
+
+    Protocol::PayloadToLanguageDecoder mPayloadToLanguageDecoder;
+
+    Protocol::LanguageToBinaryEncoder mLanguageToBinaryEncoder;
+
+    Protocol::BinaryToLanguageDecoder mBinaryToLanguageDecoder;
+
+    /**
+     * @brief The output of the DOM codec.
+     */
+    boost::shared_ptr<Protocol::Payload> mEncodedPayload;
+
+    /**
+     * @brief The output of the direct codecs, reused across the iterations.
+     */
+    std::vector<char> mBuffer;
+
+    /**
+     * @brief The encoded command, the input of the decoding, written by the DOM codec if the codec cannot encode it.
+     */
+    boost::shared_ptr<Protocol::Payload> mPayload;
+
+    Language::ICommand::Handle mDecoded;
+};
+
+Measurement measure(
+    Runner                          & aRunner,
+    Poco::Timestamp::TimeDiff const   aMinimum
+)
+{
+    for (unsigned long long iterations = 1; ; iterations *= 2)
+    {
+        unsigned long long const allocations = gAllocations;
+        unsigned long long const allocatedBytes = gAllocatedBytes;
+
+        Poco::Timestamp start;
+
+        for (unsigned long long i = 0; i < iterations; ++i)
+        {
+            aRunner.run();
+        }
+
+        Poco::Timestamp::TimeDiff const elapsed = start.elapsed();
+
+        if (elapsed >= aMinimum or iterations >= MAX_ITERATIONS)
+        {
+            Measurement measurement;
+            measurement.mIterations = iterations;
+            measurement.mNanoseconds = static_cast<double>(elapsed) * 1000 / iterations;
+            measurement.mAllocations = static_cast<double>(gAllocations - allocations) / iterations;
+            measurement.mBytes = static_cast<double>(gAllocatedBytes - allocatedBytes) / iterations;
+
+            return measurement;
+        }
+    }
+}
+
+} // namespace
+
+int main(
+    int     aNumberOfArguments,
+    char ** aArguments
+)
+{
+    if (aNumberOfArguments < 2)
+    {
+        std::cerr << "Usage: " << aArguments[0] << " <milliseconds per case> [<objects per collection reply> ...]"
+                  << std::endl;
+        return 1;
+    }
+
+    Poco::Timestamp::TimeDiff const minimum = boost::lexical_cast<Poco::Timestamp::TimeDiff>(aArguments[1]) * 1000;
+    std::vector<unsigned int> objectCounts;
+
+    for (int i = 2; i < aNumberOfArguments; ++i)
+    {
+        objectCounts.push_back(boost::lexical_cast<unsigned int>(aArguments[i]));
+    }
+
+    if (objectCounts.empty())
+    {
+        objectCounts.push_back(10);
+        objectCounts.push_back(100);
+        objectCounts.push_back(1000);
+    }
+
+    std::vector<Case> const cases = createCases(objectCounts);
+    Codec const codecs[] = {CODEC_XML_DOM, CODEC_XML_DIRECT, CODEC_BINARY};
+    Operation const operations[] = {OPERATION_ENCODE, OPERATION_DECODE, OPERATION_ROUND_TRIP};
+    int failures = 0;
+
+    std::cout << "message\tid\tobjects\tcodec\toperation\t"
+              << "iterations\tns_per_op\tallocs_per_op\tbytes_per_op\twire_bytes\tallocs_counted" << std::endl;
+
+    for (std::vector<Case>::const_iterator it = cases.begin(); it != cases.end(); ++it)
+    {
+        for (std::size_t i = 0; i < sizeof(codecs) / sizeof(codecs[0]); ++i)
+        {
+            for (std::size_t j = 0; j < sizeof(operations) / sizeof(operations[0]); ++j)
+            {
+                bool const encodable = canEncode(codecs[i], it->mKind);
+
+                if (not encodable and operations[j] != OPERATION_DECODE)
+                {
+                    continue;
+                }
+
+                try
+                {
+                    Runner runner(codecs[i], operations[j], it->mCommand, encodable);
+                    Measurement const measurement = measure(runner, minimum);
+
+                    std::cout << it->mMessage << '\t'
+                              << it->mId << '\t'
+                              << it->mObjects << '\t'
+                              << CODEC_NAMES[codecs[i]] << '\t'
+                              << OPERATION_NAMES[operations[j]] << '\t'
+                              << measurement.mIterations << '\t'
+                              << static_cast<unsigned long long>(measurement.mNanoseconds + 0.5) << '\t'
+                              << measurement.mAllocations << '\t'
+                              << static_cast<unsigned long long>(measurement.mBytes + 0.5) << '\t'
+                              << runner.getWireSize() << '\t'
+                              << (parsesXml(codecs[i], operations[j]) ? "without_parser" : "all")
+                              << std::endl;
+                }
+                catch (std::exception const & e)
+                {
+                    std::cerr << it->mMessage << ' ' << it->mObjects << ' ' << CODEC_NAMES[codecs[i]] << ' '
+                              << OPERATION_NAMES[operations[j]] << ": " << e.what() << std::endl;
+                    ++failures;
+                }
+            }
+        }
+    }
+
+    return failures ? 1 : 0;
+}
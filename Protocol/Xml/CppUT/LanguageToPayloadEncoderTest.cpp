@@ -0,0 +1,231 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/IndicationBuilder.hpp>
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <Language/Interface/RequestBuilder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToPayloadEncoder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToProtocolTranslator.hpp>
+#include <Protocol/Xml/Cpp/Payload.hpp>
+#include <gtest/gtest.h>
+
+/**
+ * @brief Compares the direct encoder with the DOM path it replaces, byte for byte.
+ */
+class LanguageToPayloadEncoderTest
+    : public ::testing::Test
+{
+protected:
+    std::string encodeDirectly(
+        Language::ICommand::Handle a_command
+    ) const
+    {
+        std::vector<char> buffer;
+        m_encoder.encode(a_command, buffer);
+
+        return std::string(buffer.begin(), buffer.end());
+    }
+
+    std::string encodeThroughDom(
+        Language::ICommand::Handle a_command
+    ) const
+    {
+        return Protocol::Payload(m_translator.translate(a_command)).getContent();
+    }
+
+    void expectByteExact(
+        Language::ICommand::Handle a_command
+    ) const
+    {
+        EXPECT_EQ(encodeThroughDom(a_command), encodeDirectly(a_command));
+    }
+
+    Language::ICommand::Object createLand(
+        std::string const a_land_name
+    ) const
+    {
+        Language::ICommand::Object land;
+        land.insert(std::make_pair("login", "Login"));
+        land.insert(std::make_pair("world_name", "World"));
+        land.insert(std::make_pair("land_name", a_land_name));
+        land.insert(std::make_pair("granted", "true"));
+
+        return land;
+    }
+
+    Language::ReplyBuilder m_reply_builder;
+    Language::IndicationBuilder m_indication_builder;
+    Language::RequestBuilder m_request_builder;
+    Protocol::LanguageToPayloadEncoder m_encoder;
+    Protocol::LanguageToProtocolTranslator m_translator;
+};
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesBasicRepliesByteExact)
+{
+    unsigned short int const ids[] = { 63, 65, 70, 72 };
+
+    for (unsigned short int id = Language::ID_COMMAND_ECHO_REQUEST; id <= Language::ID_COMMAND_TRANSPORT_RESOURCE_REQUEST; ++id)
+    {
+        expectByteExact(m_reply_builder.buildBasicReply(id, 1, "Message"));
+    }
+
+    for (unsigned int i = 0; i < sizeof(ids) / sizeof(ids[0]); ++i)
+    {
+        expectByteExact(m_reply_builder.buildBasicReply(ids[i], 1, "Message"));
+    }
+}
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesEmptyMessagesByteExact)
+{
+    expectByteExact(m_reply_builder.buildCreateLandReply(0));
+    expectByteExact(m_reply_builder.buildGetLandsReply(0));
+    expectByteExact(m_reply_builder.buildLoginReply(0));
+    expectByteExact(m_reply_builder.buildLogoutReply(0));
+}
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesSingleObjectRepliesByteExact)
+{
+    Language::ICommand::Object epoch;
+    epoch.insert(std::make_pair("epoch_name", "Epoch"));
+    epoch.insert(std::make_pair("world_name", "World"));
+    epoch.insert(std::make_pair("active", "true"));
+    epoch.insert(std::make_pair("finished", "false"));
+    epoch.insert(std::make_pair("ticks", "12"));
+
+    expectByteExact(m_reply_builder.buildGetLandReply(1, "Message", createLand("Land")));
+    expectByteExact(m_reply_builder.buildGetEpochReply(1, "Message", epoch));
+    expectByteExact(m_reply_builder.buildGetEpochReply(1, "Message", Language::ICommand::Object()));
+}
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesListRepliesByteExact)
+{
+    Language::ICommand::Objects lands;
+    lands.push_back(createLand("Land1"));
+    lands.push_back(createLand("Land2"));
+    lands.push_back(createLand(""));
+
+    Language::ICommand::Object human;
+    human.insert(std::make_pair("humanclass", "Worker"));
+    human.insert(std::make_pair("humanname", "Blacksmith"));
+    human.insert(std::make_pair("experience", "Novice"));
+    human.insert(std::make_pair("volume", "100"));
+
+    expectByteExact(m_reply_builder.buildGetLandsReply(1, "Message", lands));
+    expectByteExact(m_reply_builder.buildGetHumansReply(1, "Message", Language::ICommand::Objects(1, human)));
+    expectByteExact(m_reply_builder.buildGetHumansReply(1, "Message", Language::ICommand::Objects()));
+}
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesRowsAsTheObjectsTheyHold)
+{
+    Language::Rows lands(Language::LAND_ROWS);
+    Language::ICommand::Objects objects;
+
+    for (unsigned int i = 0; i < 3; ++i)
+    {
+        std::string const land_name = i ? "Land" : "&amp; <Land>";
+
+        lands.appendText(Language::LAND_COLUMN_LOGIN, "Login");
+        lands.appendText(Language::LAND_COLUMN_WORLD_NAME, "World");
+        lands.appendText(Language::LAND_COLUMN_LAND_NAME, land_name);
+        lands.appendBoolean(Language::LAND_COLUMN_GRANTED, true);
+        objects.push_back(createLand(land_name));
+    }
+
+    expectByteExact(m_reply_builder.buildGetLandsReply(1, "Message", lands));
+    EXPECT_EQ(encodeDirectly(m_reply_builder.buildGetLandsReply(1, "Message", objects)),
+              encodeDirectly(m_reply_builder.buildGetLandsReply(1, "Message", lands)));
+
+    Language::Rows humans(Language::HUMAN_ROWS);
+    humans.appendText(Language::HUMAN_COLUMN_HUMANCLASS, "Worker");
+    humans.appendText(Language::HUMAN_COLUMN_HUMANNAME, "Blacksmith");
+    humans.appendText(Language::HUMAN_COLUMN_EXPERIENCE, "Novice");
+    humans.appendNumber(Language::HUMAN_COLUMN_VOLUME, 100);
+
+    expectByteExact(m_reply_builder.buildGetHumansReply(1, "Message", humans));
+    expectByteExact(m_reply_builder.buildGetHumansReply(1, "Message", Language::Rows(Language::HUMAN_ROWS)));
+}
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesEscapedTextsByteExact)
+{
+    expectByteExact(m_reply_builder.buildCreateLandReply(1, "<a href=\"x\">Tom & 'Jerry'</a>\tone\r\ntwo"));
+    expectByteExact(m_reply_builder.buildGetLandReply(1, "Message", createLand("&amp; <Land>")));
+    expectByteExact(m_indication_builder.buildTickCompletedIndication("W\"orld'", "1 > 0"));
+}
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesBatchRepliesByteExact)
+{
+    Language::ICommand::Commands commands;
+    commands.push_back(m_reply_builder.buildEchoReply(1));
+    commands.push_back(m_reply_builder.buildGetLandsReply(2, "Message", Language::ICommand::Objects(1, createLand("Land"))));
+    commands.push_back(m_reply_builder.buildBatchReply(3, "Nested", Language::ICommand::Commands(1, m_reply_builder.buildErrorReply(4))));
+
+    expectByteExact(m_reply_builder.buildBatchReply(1, "Message", commands));
+    expectByteExact(m_reply_builder.buildBatchReply(1, "Message"));
+}
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesLoginReplyByteExact)
+{
+    expectByteExact(m_reply_builder.buildLoginReply(1, "Message", "Token"));
+}
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesIndicationsByteExact)
+{
+    expectByteExact(m_indication_builder.buildEpochActivatedIndication("World"));
+    expectByteExact(m_indication_builder.buildEpochDeactivatedIndication("World"));
+    expectByteExact(m_indication_builder.buildTickCompletedIndication("World", "7"));
+}
+
+TEST_F(LanguageToPayloadEncoderTest, EncodesTimeoutAndIdempotencyKeyByteExact)
+{
+    Language::ICommand::Handle command = m_reply_builder.buildCreateLandReply(1, "Message");
+    command->setTimeout(1500);
+    command->setIdempotencyKey("Key");
+
+    expectByteExact(command);
+}
+
+TEST_F(LanguageToPayloadEncoderTest, AppendsToBuffer)
+{
+    std::vector<char> buffer(3, 'x');
+    m_encoder.encode(m_reply_builder.buildEchoReply(1), buffer);
+
+    ASSERT_EQ("xxx" + encodeThroughDom(m_reply_builder.buildEchoReply(1)), std::string(buffer.begin(), buffer.end()));
+}
+
+TEST_F(LanguageToPayloadEncoderTest, ThrowsOnRequests)
+{
+    std::vector<char> buffer;
+
+    ASSERT_THROW(m_encoder.encode(m_request_builder.buildEchoRequest(), buffer), std::exception);
+}
+
+TEST_F(LanguageToPayloadEncoderTest, ThrowsOnControlCharacters)
+{
+    std::vector<char> buffer;
+
+    ASSERT_THROW(m_encoder.encode(m_reply_builder.buildCreateLandReply(1, std::string("a\0b", 3)), buffer), std::exception);
+}
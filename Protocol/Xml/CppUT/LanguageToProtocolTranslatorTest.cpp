@@ -25,6 +25,7 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Language/Interface/IndicationBuilder.hpp>
 #include <Language/Interface/ReplyBuilder.hpp>
 #include <Language/Interface/RequestBuilder.hpp>
 #include <Poco/AutoPtr.h>
@@ -4018,3 +4019,219 @@ TEST_F(LanguageToProtocolTranslatorTransportResourceReplyTranslation, SetsSpecif
         getChildElement("reply")->getChildElement("transport_resource_reply");
     ASSERT_TRUE(element != NULL);
 }
+
+class LanguageToProtocolTranslatorBatchRequestTranslation
+    : public ::testing::Test
+{
+protected:
+    LanguageToProtocolTranslatorBatchRequestTranslation()
+    {
+        Language::ICommand::Commands commands;
+        commands.push_back(m_builder.buildEchoRequest());
+        commands.push_back(m_builder.buildTransportResourceRequest(
+            "Login", "Password", "SettlementSource", "SettlementDestination", "Coal", "100"));
+        m_command = m_builder.buildBatchRequest("Login", "Password", "1", commands);
+        m_message = m_translator.translate(m_command);
+    }
+
+    Language::RequestBuilder m_builder;
+    Protocol::LanguageToProtocolTranslator m_translator;
+    Language::ICommand::Handle m_command;
+    Protocol::Message::Handle m_message;
+};
+
+TEST_F(LanguageToProtocolTranslatorBatchRequestTranslation, SetsProperID)
+{
+    Poco::XML::Element * element = m_message->documentElement()->
+        getChildElement("header")->getChildElement("id");
+    ASSERT_STREQ("63", element->innerText().c_str());
+}
+
+TEST_F(LanguageToProtocolTranslatorBatchRequestTranslation, SetsProperAtomic)
+{
+    Poco::XML::Element * element = m_message->documentElement()->
+        getChildElement("request")->getChildElement("batch_request")->getChildElement("atomic");
+    ASSERT_STREQ("1", element->innerText().c_str());
+}
+
+TEST_F(LanguageToProtocolTranslatorBatchRequestTranslation, SetsProperMessages)
+{
+    Poco::XML::Element * messages = m_message->documentElement()->
+        getChildElement("request")->getChildElement("batch_request")->getChildElement("messages");
+    ASSERT_TRUE(messages != NULL);
+    Poco::XML::Element * first = static_cast<Poco::XML::Element *>(messages->firstChild());
+    ASSERT_STREQ("1", first->getChildElement("header")->getChildElement("id")->innerText().c_str());
+    Poco::XML::Element * second = static_cast<Poco::XML::Element *>(first->nextSibling());
+    ASSERT_STREQ("31", second->getChildElement("header")->getChildElement("id")->innerText().c_str());
+    ASSERT_TRUE(second->nextSibling() == NULL);
+}
+
+class LanguageToProtocolTranslatorBatchReplyTranslation
+    : public ::testing::Test
+{
+protected:
+    LanguageToProtocolTranslatorBatchReplyTranslation()
+    {
+        Language::ICommand::Commands commands;
+        commands.push_back(m_builder.buildEchoReply(1));
+        m_command = m_builder.buildBatchReply(1, "Message", commands);
+        m_message = m_translator.translate(m_command);
+    }
+
+    Language::ReplyBuilder m_builder;
+    Protocol::LanguageToProtocolTranslator m_translator;
+    Language::ICommand::Handle m_command;
+    Protocol::Message::Handle m_message;
+};
+
+TEST_F(LanguageToProtocolTranslatorBatchReplyTranslation, SetsProperReplyID)
+{
+    Poco::XML::Element * element = m_message->documentElement()->
+        getChildElement("header")->getChildElement("id");
+    ASSERT_STREQ("64", element->innerText().c_str());
+}
+
+TEST_F(LanguageToProtocolTranslatorBatchReplyTranslation, SetsProperMessages)
+{
+    Poco::XML::Element * messages = m_message->documentElement()->
+        getChildElement("reply")->getChildElement("batch_reply")->getChildElement("messages");
+    ASSERT_TRUE(messages != NULL);
+    Poco::XML::Element * first = static_cast<Poco::XML::Element *>(messages->firstChild());
+    ASSERT_STREQ("32", first->getChildElement("header")->getChildElement("id")->innerText().c_str());
+}
+
+TEST(LanguageToProtocolTranslatorSubscribeRequestTranslation, SetsProperFields)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Protocol::Message::Handle message = translator.translate(builder.buildSubscribeRequest("Login", "Password", "World"));
+    ASSERT_STREQ("65", message->documentElement()->getChildElement("header")->getChildElement("id")->innerText().c_str());
+    Poco::XML::Element * element = message->documentElement()->
+        getChildElement("request")->getChildElement("subscribe_request")->getChildElement("world_name");
+    ASSERT_STREQ("World", element->innerText().c_str());
+}
+
+TEST(LanguageToProtocolTranslatorTickCompletedIndicationTranslation, SetsProperFields)
+{
+    Language::IndicationBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Protocol::Message::Handle message = translator.translate(builder.buildTickCompletedIndication("World", "7"));
+    ASSERT_STREQ("69", message->documentElement()->getChildElement("header")->getChildElement("id")->innerText().c_str());
+    Poco::XML::Element * indication = message->documentElement()->
+        getChildElement("indication")->getChildElement("tick_completed");
+    ASSERT_STREQ("World", indication->getChildElement("world_name")->innerText().c_str());
+    ASSERT_STREQ("7", indication->getChildElement("ticks")->innerText().c_str());
+}
+
+TEST(LanguageToProtocolTranslatorEpochActivatedIndicationTranslation, SetsProperFields)
+{
+    Language::IndicationBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Protocol::Message::Handle message = translator.translate(builder.buildEpochActivatedIndication("World"));
+    ASSERT_STREQ("67", message->documentElement()->getChildElement("header")->getChildElement("id")->innerText().c_str());
+    Poco::XML::Element * element = message->documentElement()->
+        getChildElement("indication")->getChildElement("epoch_activated")->getChildElement("world_name");
+    ASSERT_STREQ("World", element->innerText().c_str());
+}
+
+TEST(LanguageToProtocolTranslatorLoginRequestTranslation, SetsProperFields)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Protocol::Message::Handle message = translator.translate(builder.buildLoginRequest("Login", "Password"));
+    ASSERT_STREQ("70", message->documentElement()->getChildElement("header")->getChildElement("id")->innerText().c_str());
+    Poco::XML::Element * user = message->documentElement()->getChildElement("header")->getChildElement("user");
+    ASSERT_STREQ("Login", user->getChildElement("login")->innerText().c_str());
+    ASSERT_STREQ("Password", user->getChildElement("password")->innerText().c_str());
+    ASSERT_TRUE(message->documentElement()->getChildElement("request")->getChildElement("login_request"));
+}
+
+TEST(LanguageToProtocolTranslatorLoginReplyTranslation, SetsProperFields)
+{
+    Language::ReplyBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Protocol::Message::Handle message = translator.translate(builder.buildLoginReply(1, "Message", "Token"));
+    ASSERT_STREQ("71", message->documentElement()->getChildElement("header")->getChildElement("id")->innerText().c_str());
+    Poco::XML::Element * element = message->documentElement()->
+        getChildElement("reply")->getChildElement("login_reply")->getChildElement("session_token");
+    ASSERT_STREQ("Token", element->innerText().c_str());
+}
+
+TEST(LanguageToProtocolTranslatorLogoutRequestTranslation, SetsProperFields)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Protocol::Message::Handle message = translator.translate(builder.buildLogoutRequest("Login", "Token"));
+    ASSERT_STREQ("72", message->documentElement()->getChildElement("header")->getChildElement("id")->innerText().c_str());
+    Poco::XML::Element * user = message->documentElement()->getChildElement("header")->getChildElement("user");
+    ASSERT_STREQ("Login", user->getChildElement("login")->innerText().c_str());
+    ASSERT_FALSE(user->getChildElement("password"));
+    ASSERT_STREQ("Token", user->getChildElement("session_token")->innerText().c_str());
+    ASSERT_TRUE(message->documentElement()->getChildElement("request")->getChildElement("logout_request"));
+}
+
+TEST(LanguageToProtocolTranslatorLogoutReplyTranslation, SetsProperFields)
+{
+    Language::ReplyBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Protocol::Message::Handle message = translator.translate(builder.buildLogoutReply(1, "Message"));
+    ASSERT_STREQ("73", message->documentElement()->getChildElement("header")->getChildElement("id")->innerText().c_str());
+    ASSERT_TRUE(message->documentElement()->getChildElement("reply")->getChildElement("logout_reply"));
+}
+
+TEST(LanguageToProtocolTranslatorSessionTokenTranslation, ReplacesPassword)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Language::ICommand::Handle request = builder.buildGetLandsRequest("Login", "Password");
+    request->setSessionToken("Token");
+    Protocol::Message::Handle message = translator.translate(request);
+    Poco::XML::Element * user = message->documentElement()->getChildElement("header")->getChildElement("user");
+    ASSERT_STREQ("Login", user->getChildElement("login")->innerText().c_str());
+    ASSERT_FALSE(user->getChildElement("password"));
+    ASSERT_STREQ("Token", user->getChildElement("session_token")->innerText().c_str());
+}
+
+TEST(LanguageToProtocolTranslatorTimeoutTranslation, AddsTimeout)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Language::ICommand::Handle request = builder.buildGetLandsRequest("Login", "Password");
+    request->setTimeout(5000);
+    Protocol::Message::Handle message = translator.translate(request);
+    Poco::XML::Element * header = message->documentElement()->getChildElement("header");
+    ASSERT_STREQ("5000", header->getChildElement("timeout")->innerText().c_str());
+}
+
+TEST(LanguageToProtocolTranslatorTimeoutTranslation, OmitsUnsetTimeout)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Language::ICommand::Handle request = builder.buildGetLandsRequest("Login", "Password");
+    Protocol::Message::Handle message = translator.translate(request);
+    Poco::XML::Element * header = message->documentElement()->getChildElement("header");
+    ASSERT_FALSE(header->getChildElement("timeout"));
+}
+
+TEST(LanguageToProtocolTranslatorIdempotencyKeyTranslation, AddsIdempotencyKey)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Language::ICommand::Handle request =
+        builder.buildEngageHumanRequest("Login", "Password", "1", "Settlement", "soldier_archer", "5");
+    request->setIdempotencyKey("Key");
+    Protocol::Message::Handle message = translator.translate(request);
+    Poco::XML::Element * header = message->documentElement()->getChildElement("header");
+    ASSERT_STREQ("Key", header->getChildElement("idempotency_key")->innerText().c_str());
+}
+
+TEST(LanguageToProtocolTranslatorIdempotencyKeyTranslation, OmitsUnsetIdempotencyKey)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator translator;
+    Language::ICommand::Handle request =
+        builder.buildEngageHumanRequest("Login", "Password", "1", "Settlement", "soldier_archer", "5");
+    Protocol::Message::Handle message = translator.translate(request);
+    Poco::XML::Element * header = message->documentElement()->getChildElement("header");
+    ASSERT_FALSE(header->getChildElement("idempotency_key"));
+}
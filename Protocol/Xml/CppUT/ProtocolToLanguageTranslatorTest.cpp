@@ -25,12 +25,73 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Language/Interface/RequestBuilder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToProtocolTranslator.hpp>
 #include <Protocol/Xml/Cpp/MessageFactory.hpp>
+#include <Protocol/Xml/Cpp/Payload.hpp>
+#include <Protocol/Xml/Cpp/PayloadToLanguageDecoder.hpp>
 #include <Protocol/Xml/Cpp/ProtocolToLanguageTranslator.hpp>
 #include <gtest/gtest.h>
 
 // TODO: Add UTs to verify thrown exceptions.
 
+/**
+ * @brief Translates messages as ProtocolToLanguageTranslator does, verifying on the way that PayloadToLanguageDecoder
+ *        decodes the payloads of the messages to identical commands, in both modes.
+ *
+ * The whole corpus below goes through it, so the streaming decoder is held to the same expectations.
+ */
+class CrossCheckingTranslator
+{
+public:
+    Language::ICommand::Handle translate(
+        Protocol::Message::Handle a_message
+    ) const
+    {
+        Language::ICommand::Handle const command = m_translator.translate(a_message);
+
+        Protocol::Payload const payload(a_message);
+
+        expectIdentical(command, Protocol::PayloadToLanguageDecoder(Protocol::DECODING_MODE_STANDARD).decode(payload));
+        expectIdentical(command, Protocol::PayloadToLanguageDecoder(Protocol::DECODING_MODE_FAST).decode(payload));
+
+        return command;
+    }
+
+private:
+    void expectIdentical(
+        Language::ICommand::Handle a_expected,
+        Language::ICommand::Handle a_actual
+    ) const
+    {
+        EXPECT_EQ(a_expected->getID(), a_actual->getID());
+        EXPECT_EQ(a_expected->getLogin(), a_actual->getLogin());
+        EXPECT_EQ(a_expected->getPassword(), a_actual->getPassword());
+        EXPECT_EQ(a_expected->getSessionToken(), a_actual->getSessionToken());
+        EXPECT_EQ(a_expected->getTimeout(), a_actual->getTimeout());
+        EXPECT_EQ(a_expected->getIdempotencyKey(), a_actual->getIdempotencyKey());
+        EXPECT_EQ(a_expected->getCode(), a_actual->getCode());
+        EXPECT_EQ(a_expected->getMessage(), a_actual->getMessage());
+        EXPECT_TRUE(a_expected->getObjects() == a_actual->getObjects());
+
+        // The params are compared through the messages encoding them.
+        EXPECT_EQ(
+            Protocol::Payload(m_encoder.translate(a_expected)).getContent(),
+            Protocol::Payload(m_encoder.translate(a_actual)).getContent()
+        );
+
+        ASSERT_EQ(a_expected->getCommands().size(), a_actual->getCommands().size());
+
+        for (size_t i = 0; i < a_expected->getCommands().size(); ++i)
+        {
+            expectIdentical(a_expected->getCommands()[i], a_actual->getCommands()[i]);
+        }
+    }
+
+    Protocol::ProtocolToLanguageTranslator m_translator;
+    Protocol::LanguageToProtocolTranslator m_encoder;
+};
+
 class ProtocolToLanguageTranslatorEchoRequestTranslation
     : public ::testing::Test
 {
@@ -42,7 +103,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -68,7 +129,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -94,7 +155,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -140,7 +201,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -181,7 +242,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -222,7 +283,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -258,7 +319,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -304,7 +365,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -345,7 +406,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -386,7 +447,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -428,7 +489,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -485,7 +546,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -542,7 +603,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -593,7 +654,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -640,7 +701,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -697,7 +758,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -754,7 +815,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -805,7 +866,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -852,7 +913,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -903,7 +964,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -949,7 +1010,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -995,7 +1056,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1036,7 +1097,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1082,7 +1143,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1123,7 +1184,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1164,7 +1225,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1205,7 +1266,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1246,7 +1307,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1287,7 +1348,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1329,7 +1390,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1386,7 +1447,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1442,7 +1503,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1473,7 +1534,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1504,7 +1565,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1540,7 +1601,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1572,7 +1633,7 @@ protected:
     ProtocolToLanguageTranslatorGetLandReplyWithoutObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetLandReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -1612,7 +1673,7 @@ protected:
     ProtocolToLanguageTranslatorGetLandReplyWithObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object land;
         land.insert(std::make_pair("login", "Login1"));
         land.insert(std::make_pair("world_name", "World1"));
@@ -1667,7 +1728,7 @@ protected:
     ProtocolToLanguageTranslatorGetLandsReplyWithoutObjectsTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetLandsReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -1707,7 +1768,7 @@ protected:
             ProtocolToLanguageTranslatorGetLandsReplyWithObjectsTranslation()
     {
                 Protocol::MessageFactory factory;
-                Protocol::ProtocolToLanguageTranslator translator;
+                CrossCheckingTranslator translator;
         Protocol::Message::Object land_1, land_2;
         Protocol::Message::Objects lands;
         land_1.insert(std::make_pair("login", "Login1"));
@@ -1778,7 +1839,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1814,7 +1875,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -1846,7 +1907,7 @@ protected:
     ProtocolToLanguageTranslatorGetSettlementReplyWithoutObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetSettlementReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -1886,7 +1947,7 @@ protected:
     ProtocolToLanguageTranslatorGetSettlementReplyWithObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object settlement;
         settlement.insert(std::make_pair("land_name", "Land1"));
         settlement.insert(std::make_pair("settlement_name", "Settlement1"));
@@ -1937,7 +1998,7 @@ protected:
     ProtocolToLanguageTranslatorGetSettlementsReplyWithoutObjectsTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetSettlementsReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -1977,7 +2038,7 @@ protected:
     ProtocolToLanguageTranslatorGetSettlementsReplyWithObjectsTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object settlement_1, settlement_2;
         Protocol::Message::Objects settlements;
         settlement_1.insert(std::make_pair("land_name", "Land1"));
@@ -2040,7 +2101,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2076,7 +2137,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2108,7 +2169,7 @@ protected:
     ProtocolToLanguageTranslatorGetBuildingReplyWithoutObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetBuildingReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -2148,7 +2209,7 @@ protected:
     ProtocolToLanguageTranslatorGetBuildingReplyWithObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object building;
         building.insert(std::make_pair("buildingclass", "Regular"));
         building.insert(std::make_pair("buildingname", "Farm"));
@@ -2201,7 +2262,7 @@ protected:
     ProtocolToLanguageTranslatorGetBuildingsReplyWithoutObjectsTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetBuildingsReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -2241,7 +2302,7 @@ protected:
     ProtocolToLanguageTranslatorGetBuildingsReplyWithObjectsTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object building_1, building_2;
         Protocol::Message::Objects buildings;
         building_1.insert(std::make_pair("buildingclass", "Regular"));
@@ -2308,7 +2369,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2340,7 +2401,7 @@ protected:
     ProtocolToLanguageTranslatorGetHumanReplyWithoutObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetHumanReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -2380,7 +2441,7 @@ protected:
     ProtocolToLanguageTranslatorGetHumanReplyWithObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object human;
         human.insert(std::make_pair("humanclass", "Worker"));
         human.insert(std::make_pair("humanname", "Farmer"));
@@ -2435,7 +2496,7 @@ protected:
     ProtocolToLanguageTranslatorGetHumansReplyWithObjectsTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object human_1, human_2;
         Protocol::Message::Objects humans;
         human_1.insert(std::make_pair("humanclass", "Worker"));
@@ -2502,7 +2563,7 @@ protected:
     ProtocolToLanguageTranslatorGetHumansReplyWithoutObjectsTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetHumansReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -2542,7 +2603,7 @@ protected:
     ProtocolToLanguageTranslatorGetResourceReplyWithoutObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetResourceReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -2582,7 +2643,7 @@ protected:
     ProtocolToLanguageTranslatorGetResourceReplyWithObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object resource;
         resource.insert(std::make_pair("resourcename", "Coal"));
         resource.insert(std::make_pair("volume", "10"));
@@ -2633,7 +2694,7 @@ protected:
     ProtocolToLanguageTranslatorGetResourcesReplyWithoutObjectsTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetResourcesReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -2673,7 +2734,7 @@ protected:
     ProtocolToLanguageTranslatorGetResourcesReplyWithObjectsTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object resource_1, resource_2;
         Protocol::Message::Objects resources;
         resource_1.insert(std::make_pair("resourcename", "Coal"));
@@ -2736,7 +2797,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2772,7 +2833,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2808,7 +2869,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2844,7 +2905,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2880,7 +2941,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2916,7 +2977,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2952,7 +3013,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -2988,7 +3049,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -3020,7 +3081,7 @@ protected:
     ProtocolToLanguageTranslatorGetEpochReplyWithoutObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Handle message = factory.createGetEpochReply("1", "Message");
         m_command = translator.translate(message);
     }
@@ -3060,7 +3121,7 @@ protected:
     ProtocolToLanguageTranslatorGetEpochReplyWithObjectTranslation()
     {
         Protocol::MessageFactory factory;
-        Protocol::ProtocolToLanguageTranslator translator;
+        CrossCheckingTranslator translator;
         Protocol::Message::Object epoch;
         epoch.insert(std::make_pair("epoch_name", "Epoch"));
         epoch.insert(std::make_pair("world_name", "World"));
@@ -3121,7 +3182,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -3157,7 +3218,7 @@ protected:
     }
 
     Protocol::MessageFactory m_factory;
-    Protocol::ProtocolToLanguageTranslator m_translator;
+    CrossCheckingTranslator m_translator;
     Protocol::Message::Handle m_message;
     Language::ICommand::Handle m_command;
 };
@@ -3181,3 +3242,271 @@ TEST_F(ProtocolToLanguageTranslatorTransportResourceReplyTranslation, SetsProper
 {
     ASSERT_STREQ("Message", m_command->getMessage().c_str());
 }
+
+class ProtocolToLanguageTranslatorBatchRequestTranslation
+    : public ::testing::Test
+{
+protected:
+    ProtocolToLanguageTranslatorBatchRequestTranslation()
+    {
+        std::vector<Protocol::Message::Handle> messages;
+        messages.push_back(m_factory.createEchoRequest());
+        messages.push_back(m_factory.createTransportResourceRequest(
+            "Other", "Secret", "SettlementSource", "SettlementDestination", "Coal", "100"));
+        m_message = m_factory.createBatchRequest("Login", "Password", "1", messages);
+        m_command = m_translator.translate(m_message);
+    }
+
+    Protocol::MessageFactory m_factory;
+    CrossCheckingTranslator m_translator;
+    Protocol::Message::Handle m_message;
+    Language::ICommand::Handle m_command;
+};
+
+TEST_F(ProtocolToLanguageTranslatorBatchRequestTranslation, SetsProperID)
+{
+    ASSERT_EQ(63, m_command->getID());
+}
+
+TEST_F(ProtocolToLanguageTranslatorBatchRequestTranslation, SetsProperAtomic)
+{
+    ASSERT_STREQ("1", m_command->getParam("atomic").c_str());
+}
+
+TEST_F(ProtocolToLanguageTranslatorBatchRequestTranslation, SetsProperCommands)
+{
+    ASSERT_EQ(2, m_command->getCommands().size());
+    ASSERT_EQ(1, m_command->getCommands().at(0)->getID());
+    ASSERT_EQ(31, m_command->getCommands().at(1)->getID());
+    ASSERT_STREQ("Coal", m_command->getCommands().at(1)->getParam("resourcekey").c_str());
+}
+
+TEST_F(ProtocolToLanguageTranslatorBatchRequestTranslation, KeepsOwnUserOfCommands)
+{
+    ASSERT_STREQ("Other", m_command->getCommands().at(1)->getLogin().c_str());
+    ASSERT_STREQ("Secret", m_command->getCommands().at(1)->getPassword().c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorBatchRequestInheritance, CommandsWithoutUserInheritUserOfBatch)
+{
+    Protocol::MessageFactory factory;
+    CrossCheckingTranslator translator;
+    Protocol::Message::Handle message = factory.createGetLandsRequest("Other", "Secret");
+    Poco::XML::Element * header = message->documentElement()->getChildElement("header");
+    header->removeChild(header->getChildElement("user"));
+    std::vector<Protocol::Message::Handle> messages;
+    messages.push_back(message);
+    Language::ICommand::Handle batch = translator.translate(factory.createBatchRequest("Login", "Password", "0", messages));
+    Language::ICommand::Handle command = batch->getCommands().at(0);
+    ASSERT_EQ(6, command->getID());
+    ASSERT_STREQ("Login", command->getLogin().c_str());
+    ASSERT_STREQ("Password", command->getPassword().c_str());
+}
+
+class ProtocolToLanguageTranslatorBatchReplyTranslation
+    : public ::testing::Test
+{
+protected:
+    ProtocolToLanguageTranslatorBatchReplyTranslation()
+    {
+        std::vector<Protocol::Message::Handle> messages;
+        messages.push_back(m_factory.createEchoReply("1"));
+        messages.push_back(m_factory.createTransportResourceReply("2", "Failed"));
+        m_message = m_factory.createBatchReply("1", "Message", messages);
+        m_command = m_translator.translate(m_message);
+    }
+
+    Protocol::MessageFactory m_factory;
+    CrossCheckingTranslator m_translator;
+    Protocol::Message::Handle m_message;
+    Language::ICommand::Handle m_command;
+};
+
+TEST_F(ProtocolToLanguageTranslatorBatchReplyTranslation, SetsProperReplyID)
+{
+    ASSERT_EQ(64, m_command->getID());
+}
+
+TEST_F(ProtocolToLanguageTranslatorBatchReplyTranslation, SetsProperCodeAndMessage)
+{
+    ASSERT_EQ(1, m_command->getCode());
+    ASSERT_STREQ("Message", m_command->getMessage().c_str());
+}
+
+TEST_F(ProtocolToLanguageTranslatorBatchReplyTranslation, SetsProperCommands)
+{
+    ASSERT_EQ(2, m_command->getCommands().size());
+    ASSERT_EQ(32, m_command->getCommands().at(0)->getID());
+    ASSERT_EQ(62, m_command->getCommands().at(1)->getID());
+    ASSERT_EQ(2, m_command->getCommands().at(1)->getCode());
+    ASSERT_STREQ("Failed", m_command->getCommands().at(1)->getMessage().c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorSubscribeRequestTranslation, SetsProperFields)
+{
+    Protocol::MessageFactory factory;
+    CrossCheckingTranslator translator;
+    Language::ICommand::Handle command = translator.translate(factory.createSubscribeRequest("Login", "Password", "World"));
+    ASSERT_EQ(65, command->getID());
+    ASSERT_STREQ("Login", command->getLogin().c_str());
+    ASSERT_STREQ("Password", command->getPassword().c_str());
+    ASSERT_STREQ("World", command->getParam("world_name").c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorSubscribeReplyTranslation, SetsProperFields)
+{
+    Protocol::MessageFactory factory;
+    CrossCheckingTranslator translator;
+    Language::ICommand::Handle command = translator.translate(factory.createSubscribeReply("1", "Message"));
+    ASSERT_EQ(66, command->getID());
+    ASSERT_EQ(1, command->getCode());
+    ASSERT_STREQ("Message", command->getMessage().c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorEpochDeactivatedIndicationTranslation, SetsProperFields)
+{
+    Protocol::MessageFactory factory;
+    CrossCheckingTranslator translator;
+    Language::ICommand::Handle command = translator.translate(factory.createEpochDeactivatedIndication("World"));
+    ASSERT_EQ(68, command->getID());
+    ASSERT_STREQ("World", command->getParam("world_name").c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorTickCompletedIndicationTranslation, SetsProperFields)
+{
+    Protocol::MessageFactory factory;
+    CrossCheckingTranslator translator;
+    Language::ICommand::Handle command = translator.translate(factory.createTickCompletedIndication("World", "7"));
+    ASSERT_EQ(69, command->getID());
+    ASSERT_STREQ("World", command->getParam("world_name").c_str());
+    ASSERT_STREQ("7", command->getParam("ticks").c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorLoginRequestTranslation, SetsProperFields)
+{
+    Protocol::MessageFactory factory;
+    CrossCheckingTranslator translator;
+    Language::ICommand::Handle command = translator.translate(factory.createLoginRequest("Login", "Password"));
+    ASSERT_EQ(70, command->getID());
+    ASSERT_STREQ("Login", command->getLogin().c_str());
+    ASSERT_STREQ("Password", command->getPassword().c_str());
+    ASSERT_STREQ("", command->getSessionToken().c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorLoginReplyTranslation, SetsProperFields)
+{
+    Protocol::MessageFactory factory;
+    CrossCheckingTranslator translator;
+    Language::ICommand::Handle command = translator.translate(factory.createLoginReply("1", "Message", "Token"));
+    ASSERT_EQ(71, command->getID());
+    ASSERT_EQ(1, command->getCode());
+    ASSERT_STREQ("Message", command->getMessage().c_str());
+    ASSERT_STREQ("Token", command->getParam("session_token").c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorLogoutRequestTranslation, SetsProperFields)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator language_to_protocol;
+    Protocol::ProtocolToLanguageTranslator protocol_to_language;
+    Language::ICommand::Handle command =
+        protocol_to_language.translate(language_to_protocol.translate(builder.buildLogoutRequest("Login", "Token")));
+    ASSERT_EQ(72, command->getID());
+    ASSERT_STREQ("Login", command->getLogin().c_str());
+    ASSERT_STREQ("Token", command->getSessionToken().c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorLogoutReplyTranslation, SetsProperFields)
+{
+    Protocol::MessageFactory factory;
+    Protocol::ProtocolToLanguageTranslator translator;
+    Language::ICommand::Handle command = translator.translate(factory.createLogoutReply("1", "Message"));
+    ASSERT_EQ(73, command->getID());
+    ASSERT_EQ(1, command->getCode());
+    ASSERT_STREQ("Message", command->getMessage().c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorSessionTokenTranslation, SetsProperFields)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator language_to_protocol;
+    CrossCheckingTranslator protocol_to_language;
+    Language::ICommand::Handle request = builder.buildGetLandsRequest("Login", "");
+    request->setSessionToken("Token");
+    Language::ICommand::Handle command = protocol_to_language.translate(language_to_protocol.translate(request));
+    ASSERT_EQ(Language::ID_COMMAND_GET_LANDS_REQUEST, command->getID());
+    ASSERT_STREQ("Login", command->getLogin().c_str());
+    ASSERT_STREQ("", command->getPassword().c_str());
+    ASSERT_STREQ("Token", command->getSessionToken().c_str());
+}
+
+TEST(ProtocolToLanguageTranslatorTimeoutTranslation, SetsProperFields)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator language_to_protocol;
+    CrossCheckingTranslator protocol_to_language;
+    Language::ICommand::Handle request = builder.buildGetLandsRequest("Login", "Password");
+    request->setTimeout(5000);
+    Language::ICommand::Handle command = protocol_to_language.translate(language_to_protocol.translate(request));
+    ASSERT_EQ(Language::ID_COMMAND_GET_LANDS_REQUEST, command->getID());
+    ASSERT_EQ(5000U, command->getTimeout());
+}
+
+TEST(ProtocolToLanguageTranslatorIdempotencyKeyTranslation, SetsProperFields)
+{
+    Language::RequestBuilder builder;
+    Protocol::LanguageToProtocolTranslator language_to_protocol;
+    CrossCheckingTranslator protocol_to_language;
+    Language::ICommand::Handle request =
+        builder.buildEngageHumanRequest("Login", "Password", "1", "Settlement", "soldier_archer", "5");
+    request->setIdempotencyKey("Key");
+    Language::ICommand::Handle command = protocol_to_language.translate(language_to_protocol.translate(request));
+    ASSERT_EQ(Language::ID_COMMAND_ENGAGE_HUMAN_REQUEST, command->getID());
+    ASSERT_STREQ("Key", command->getIdempotencyKey().c_str());
+}
+
+/**
+ * @brief Gets the payload of a login request declared in the given encoding, with the login given in that encoding.
+ */
+std::string getDeclaredLoginRequest(
+    std::string const & a_encoding,
+    std::string const & a_login
+)
+{
+    Protocol::MessageFactory factory;
+    std::string content = Protocol::Payload(factory.createLoginRequest("Login", "Password")).getContent();
+
+    content.replace(content.find("Login"), 5, a_login);
+
+    return "<?xml version=\"1.0\" encoding=\"" + a_encoding + "\"?>" + content;
+}
+
+TEST(PayloadToLanguageDecoderEncodingTranslation, DecodesPayloadDeclaredInUtf8)
+{
+    std::string const content = getDeclaredLoginRequest("utf-8", "L\xC3\xB3gin");
+    Protocol::Payload const payload(content.data(), content.size());
+
+    ASSERT_EQ(
+        "L\xC3\xB3gin",
+        Protocol::PayloadToLanguageDecoder(Protocol::DECODING_MODE_STANDARD).decode(payload)->getLogin()
+    );
+    ASSERT_EQ(
+        "L\xC3\xB3gin",
+        Protocol::PayloadToLanguageDecoder(Protocol::DECODING_MODE_FAST).decode(payload)->getLogin()
+    );
+}
+
+TEST(PayloadToLanguageDecoderEncodingTranslation, ConvertsPayloadDeclaredInAnotherEncoding)
+{
+    std::string const content = getDeclaredLoginRequest("ISO-8859-1", "L\xF3gin");
+    Protocol::Payload const payload(content.data(), content.size());
+
+    ASSERT_EQ(
+        "L\xC3\xB3gin",
+        Protocol::PayloadToLanguageDecoder(Protocol::DECODING_MODE_STANDARD).decode(payload)->getLogin()
+    );
+    ASSERT_EQ(
+        "L\xC3\xB3gin",
+        Protocol::PayloadToLanguageDecoder(Protocol::DECODING_MODE_FAST).decode(payload)->getLogin()
+    );
+}
@@ -84,7 +84,7 @@ class AsynchCommLink():
         while self.doReceive :
             reply = b''
             # TODO better message extracting
-            while not str(reply, 'UTF-8').endswith('</reply>\n'):
+            while not str(reply, 'UTF-8').endswith(('</reply>\n', '</indication>\n')):
                 r = self._socket.recv(2048);
                 
                 # handle graceful socket shutdown
@@ -98,7 +98,11 @@ class AsynchCommLink():
                 reply = str(reply, 'UTF-8')
                 try:
                     document = xml.dom.minidom.parseString(reply)
-                    self.msgQueue.put(document);
+                    # Indications are pushed by the server on its own, they never answer a request.
+                    if document.getElementsByTagName('indication'):
+                        self.indQueue.put(document);
+                    else:
+                        self.msgQueue.put(document);
                 except xml.parsers.expat.ExpatError:
                     raise CommLinkFailure('validation_reply', message=reply)
         #end of main loop [while self.doReceive]
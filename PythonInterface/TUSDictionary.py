@@ -63,6 +63,12 @@ COMMAND_SCHEMAS = {
                                                     'settlement_name_destination',
                                                     'resourcekey',
                                                     'volume']),
+
+# Subscription.
+'SUBSCRIBE'          : (65, ['login', 'password'], ['world_name']),
+
+# Session.
+'LOGIN'              : (70, ['login', 'password'], []),
 }
 
 # A complete list of available statuses with their identifiers.
@@ -77,5 +83,8 @@ REPLY_STATUSES = {
  7 : 'REPLY_STATUS_UNAUTHORIZED',
  8 : 'REPLY_STATUS_EPOCH_IS_NOT_ACTIVE',
  9 : 'REPLY_STATUS_ACTION_UNAVAILABLE',
-10 : 'REPLY_STATUS_OK'
+10 : 'REPLY_STATUS_OK',
+11 : 'REPLY_STATUS_SERVER_BUSY',
+12 : 'REPLY_STATUS_THROTTLED',
+13 : 'REPLY_STATUS_TIMED_OUT'
 }
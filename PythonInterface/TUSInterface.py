@@ -196,6 +196,14 @@ class TUSInterface():
                                                 a_volume])
         return self.__send(command)
 
+    def subscribe(self, a_login, a_password, a_world_name):
+        command = self.m_command_builder.build("SUBSCRIBE", [a_login, a_password], [a_world_name])
+        return self.__send(command)
+
+    def login(self, a_login, a_password):
+        command = self.m_command_builder.build("LOGIN", [a_login, a_password], [])
+        return self.__send(command)
+
     def __send(self, a_command):
         return self.link.exchange_xmls(a_command)
 
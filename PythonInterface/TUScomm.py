@@ -87,7 +87,7 @@ class CommLink:
         """
         reply = b''
         r = True
-        while r and not str(reply, 'UTF-8').endswith('</reply>\n'):
+        while r and not str(reply, 'UTF-8').endswith(('</reply>\n', '</indication>\n')):
             r = self._socket.recv(2048)
             if r:
                 reply += r
@@ -183,7 +183,7 @@ class AsynchCommLink(CommLink):
             
             if reply:
                 repel = reply.getElementsByTagName('reply');
-                if repel and repel[0].getAttribute("isdummy") :
+                if reply.getElementsByTagName('indication') or (repel and repel[0].getAttribute("isdummy")) :
                     self.indQueue.put(reply);
                 else :
                     self.msgQueue.put(reply);
@@ -0,0 +1,219 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <Poco/Timestamp.h>
+#include <Protocol/Xml/Cpp/LanguageToProtocolTranslator.hpp>
+#include <Protocol/Xml/Cpp/Payload.hpp>
+#include <Server/include/ReplyCompressor.hpp>
+#include <boost/lexical_cast.hpp>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Measures the bytes on the wire and the CPU cost of compressing the collection replies.
+ *
+ * Usage: compressionbench <objects per reply> <iterations>
+ *
+ * Each collection reply is built with the given number of objects, encoded to the payload and compressed at
+ * the fastest, the default and the best zlib level. The figures guide the <compression> section of the
+ * configuration: the threshold below which compressing does not pay off and the level worth its CPU.
+ */
+
+namespace
+{
+
+struct Sample
+{
+    std::string mName;
+
+    std::string mContent;
+};
+
+Language::ICommand::Object createObject(
+    char const * const * aKeys,
+    std::size_t  const   aNumberOfKeys,
+    unsigned int const   aIndex
+)
+{
+    Language::ICommand::Object object;
+
+    for (std::size_t i = 0; i < aNumberOfKeys; ++i)
+    {
+        // Repetitive values, as in the real replies, where names come from a small configured set.
+        object.insert(std::make_pair(aKeys[i], std::string(aKeys[i]) + boost::lexical_cast<std::string>(aIndex % 16)));
+    }
+
+    return object;
+}
+
+Language::ICommand::Objects createObjects(
+    char const * const * aKeys,
+    std::size_t  const   aNumberOfKeys,
+    unsigned int const   aNumberOfObjects
+)
+{
+    Language::ICommand::Objects objects;
+
+    for (unsigned int i = 0; i < aNumberOfObjects; ++i)
+    {
+        objects.push_back(createObject(aKeys, aNumberOfKeys, i));
+    }
+
+    return objects;
+}
+
+std::string encode(
+    Language::ICommand::Handle const aCommandReply
+)
+{
+    Protocol::LanguageToProtocolTranslator languageToProtocolTranslator;
+
+    return Protocol::Payload(languageToProtocolTranslator.translate(aCommandReply)).getContent();
+}
+
+std::vector<Sample> createSamples(
+    unsigned int const aNumberOfObjects
+)
+{
+    static char const * const HUMAN_KEYS[] = {"humanclass", "humanname", "experience", "volume"};
+    static char const * const BUILDING_KEYS[] = {"buildingclass", "buildingname", "volume"};
+    static char const * const RESOURCE_KEYS[] = {"resourcename", "volume"};
+    static char const * const LAND_KEYS[] = {"login", "world_name", "land_name", "granted"};
+    static char const * const SETTLEMENT_KEYS[] = {"land_name", "settlement_name"};
+
+    Language::ReplyBuilder replyBuilder;
+    std::vector<Sample> samples;
+
+    Sample sample;
+
+    sample.mName = "get_humans";
+    sample.mContent = encode(replyBuilder.buildGetHumansReply(1, "", createObjects(HUMAN_KEYS, 4, aNumberOfObjects)));
+    samples.push_back(sample);
+
+    sample.mName = "get_buildings";
+    sample.mContent =
+        encode(replyBuilder.buildGetBuildingsReply(1, "", createObjects(BUILDING_KEYS, 3, aNumberOfObjects)));
+    samples.push_back(sample);
+
+    sample.mName = "get_resources";
+    sample.mContent =
+        encode(replyBuilder.buildGetResourcesReply(1, "", createObjects(RESOURCE_KEYS, 2, aNumberOfObjects)));
+    samples.push_back(sample);
+
+    sample.mName = "get_lands";
+    sample.mContent = encode(replyBuilder.buildGetLandsReply(1, "", createObjects(LAND_KEYS, 4, aNumberOfObjects)));
+    samples.push_back(sample);
+
+    sample.mName = "get_settlements";
+    sample.mContent =
+        encode(replyBuilder.buildGetSettlementsReply(1, "", createObjects(SETTLEMENT_KEYS, 2, aNumberOfObjects)));
+    samples.push_back(sample);
+
+    return samples;
+}
+
+} // namespace
+
+int main(
+    int     aNumberOfArguments,
+    char ** aArguments
+)
+{
+    if (aNumberOfArguments != 3)
+    {
+        std::cerr << "Usage: " << aArguments[0] << " <objects per reply> <iterations>" << std::endl;
+        return 1;
+    }
+
+    unsigned int const numberOfObjects = boost::lexical_cast<unsigned int>(aArguments[1]);
+    unsigned int const iterations = boost::lexical_cast<unsigned int>(aArguments[2]);
+
+    if (iterations == 0)
+    {
+        std::cerr << "The number of iterations has to be positive." << std::endl;
+        return 1;
+    }
+
+    std::vector<Sample> const samples = createSamples(numberOfObjects);
+    int const levels[] = {1, 6, 9};
+
+    std::cout << std::left
+              << std::setw(16) << "reply"
+              << std::setw(7) << "level"
+              << std::setw(12) << "raw [B]"
+              << std::setw(12) << "wire [B]"
+              << std::setw(9) << "ratio"
+              << std::setw(16) << "compress [us]"
+              << std::setw(16) << "decompress [us]"
+              << std::endl;
+
+    for (std::vector<Sample>::const_iterator it = samples.begin(); it != samples.end(); ++it)
+    {
+        for (std::size_t i = 0; i < sizeof(levels) / sizeof(levels[0]); ++i)
+        {
+            // A threshold of a single byte, so every reply is compressed.
+            Server::ReplyCompressor const replyCompressor(1, levels[i]);
+            std::string content;
+
+            Poco::Timestamp compressStart;
+
+            for (unsigned int j = 0; j < iterations; ++j)
+            {
+                content = it->mContent;
+                replyCompressor.compress(content);
+            }
+
+            Poco::Timestamp::TimeDiff const compressElapsed = compressStart.elapsed();
+            std::size_t const wireLength = content.length();
+            std::string decompressed;
+
+            Poco::Timestamp decompressStart;
+
+            for (unsigned int j = 0; j < iterations; ++j)
+            {
+                decompressed = content;
+                replyCompressor.decompress(decompressed);
+            }
+
+            Poco::Timestamp::TimeDiff const decompressElapsed = decompressStart.elapsed();
+
+            std::cout << std::setw(16) << it->mName
+                      << std::setw(7) << levels[i]
+                      << std::setw(12) << it->mContent.length()
+                      << std::setw(12) << wireLength
+                      << std::setw(9) << std::setprecision(3) << static_cast<double>(wireLength) / it->mContent.length()
+                      << std::setw(16) << static_cast<double>(compressElapsed) / iterations
+                      << std::setw(16) << static_cast<double>(decompressElapsed) / iterations
+                      << std::endl;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,318 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Poco/Net/SocketAddress.h>
+#include <Poco/Net/SocketStream.h>
+#include <Poco/Net/StreamSocket.h>
+#include <Poco/Runnable.h>
+#include <Poco/Thread.h>
+#include <Poco/Timestamp.h>
+#include <Protocol/Xml/Cpp/MessageFactory.hpp>
+#include <Protocol/Xml/Cpp/Payload.hpp>
+#include <Server/include/Framing.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Measures the front end of a running server under N idle and M active persistent connections.
+ *
+ * Usage: frontendbench <host> <port> <idle connections> <active connections> <requests per active connection>
+ *                       [<pipeline depth>]
+ *
+ * Run it once against the server configured with <frontend>threaded</frontend> and once against
+ * <frontend>reactor</frontend> to compare both. With a pipeline depth given, active connections use the binary
+ * framing and keep that many requests in flight.
+ */
+
+namespace
+{
+
+class ActiveClient
+    : public Poco::Runnable
+{
+public:
+    ActiveClient(
+        Poco::Net::SocketAddress const & aAddress,
+        std::string              const & aRequest,
+        unsigned int             const   aRequests,
+        unsigned int             const   aPipelineDepth
+    )
+        : mAddress(aAddress),
+          mRequest(aRequest),
+          mRequests(aRequests),
+          mPipelineDepth(aPipelineDepth),
+          mFailed(false)
+    {
+    }
+
+    virtual void run()
+    {
+        if (mPipelineDepth)
+        {
+            runPipelined();
+            return;
+        }
+
+        try
+        {
+            Poco::Net::StreamSocket socket(mAddress);
+            Poco::Net::SocketStream socketStream(socket);
+
+            for (unsigned int i = 0; i < mRequests; ++i)
+            {
+                Poco::Timestamp start;
+
+                socketStream << mRequest.length();
+                socketStream << mRequest;
+                socketStream.flush();
+
+                int length;
+                socketStream >> length;
+
+                if (not socketStream or length <= 0)
+                {
+                    mFailed = true;
+                    return;
+                }
+
+                std::string content(length, '\0');
+                socketStream.read(&content[0], length);
+
+                mLatencies.push_back(start.elapsed());
+            }
+        }
+        catch (std::exception const &)
+        {
+            mFailed = true;
+        }
+    }
+
+    std::vector<Poco::Timestamp::TimeDiff> const & getLatencies() const
+    {
+        return mLatencies;
+    }
+
+    bool hasFailed() const
+    {
+        return mFailed;
+    }
+
+private:
+    /**
+     * @brief Keeps up to the pipeline depth of binary framed requests in flight, replies may arrive out of order.
+     */
+    void runPipelined()
+    {
+        try
+        {
+            Poco::Net::StreamSocket socket(mAddress);
+
+            std::map<unsigned long long int, Poco::Timestamp> inFlight;
+            unsigned long long int sent = 0;
+
+            while (mLatencies.size() < mRequests)
+            {
+                while (sent < mRequests and inFlight.size() < mPipelineDepth)
+                {
+                    Server::BinaryFrameHeader const header = {
+                        Server::BINARY_FRAME_VERSION, 0, static_cast<unsigned int>(mRequest.length()), ++sent
+                    };
+
+                    std::string frame(Server::BINARY_FRAME_HEADER_SIZE, '\0');
+                    Server::encodeBinaryFrameHeader(header, &frame[0]);
+                    frame.append(mRequest);
+
+                    inFlight[sent].update();
+                    sendAll(socket, frame.data(), frame.length());
+                }
+
+                char headerBuffer[Server::BINARY_FRAME_HEADER_SIZE];
+                receiveAll(socket, headerBuffer, Server::BINARY_FRAME_HEADER_SIZE);
+
+                Server::BinaryFrameHeader header;
+                if (not Server::decodeBinaryFrameHeader(headerBuffer, header) or inFlight.count(header.mRequestId) == 0)
+                {
+                    mFailed = true;
+                    return;
+                }
+
+                std::string content(header.mLength, '\0');
+                receiveAll(socket, &content[0], header.mLength);
+
+                mLatencies.push_back(inFlight[header.mRequestId].elapsed());
+                inFlight.erase(header.mRequestId);
+            }
+        }
+        catch (std::exception const &)
+        {
+            mFailed = true;
+        }
+    }
+
+    static void sendAll(
+        Poco::Net::StreamSocket       & aSocket,
+        char                    const * aData,
+        std::size_t                     aLength
+    )
+    {
+        while (aLength)
+        {
+            int const sent = aSocket.sendBytes(aData, static_cast<int>(aLength));
+            aData += sent;
+            aLength -= sent;
+        }
+    }
+
+    static void receiveAll(
+        Poco::Net::StreamSocket & aSocket,
+        char                    * aData,
+        std::size_t               aLength
+    )
+    {
+        while (aLength)
+        {
+            int const received = aSocket.receiveBytes(aData, static_cast<int>(aLength));
+
+            if (received <= 0)
+            {
+                throw std::runtime_error("Connection closed.");
+            }
+
+            aData += received;
+            aLength -= received;
+        }
+    }
+
+    Poco::Net::SocketAddress const mAddress;
+
+    std::string const mRequest;
+
+    unsigned int const mRequests;
+
+    unsigned int const mPipelineDepth;
+
+    std::vector<Poco::Timestamp::TimeDiff> mLatencies;
+
+    bool mFailed;
+};
+
+Poco::Timestamp::TimeDiff percentile(
+    std::vector<Poco::Timestamp::TimeDiff> const & aSorted,
+    double                                 const   aPercentile
+)
+{
+    if (aSorted.empty())
+    {
+        return 0;
+    }
+
+    return aSorted[static_cast<std::size_t>(aPercentile * (aSorted.size() - 1))];
+}
+
+} // namespace
+
+int main(
+    int     aNumberOfArguments,
+    char ** aArguments
+)
+{
+    if (aNumberOfArguments != 6 and aNumberOfArguments != 7)
+    {
+        std::cerr << "Usage: " << aArguments[0]
+                  << " <host> <port> <idle connections> <active connections> <requests per active connection>"
+                  << " [<pipeline depth>]"
+                  << std::endl;
+        return 1;
+    }
+
+    Poco::Net::SocketAddress address(aArguments[1], boost::lexical_cast<unsigned short int>(aArguments[2]));
+    unsigned int const idleConnections = boost::lexical_cast<unsigned int>(aArguments[3]);
+    unsigned int const activeConnections = boost::lexical_cast<unsigned int>(aArguments[4]);
+    unsigned int const requests = boost::lexical_cast<unsigned int>(aArguments[5]);
+    unsigned int const pipelineDepth = aNumberOfArguments == 7 ? boost::lexical_cast<unsigned int>(aArguments[6]) : 0;
+
+    Protocol::MessageFactory messageFactory;
+    Protocol::Payload payloadRequest(messageFactory.createEchoRequest());
+
+    // Idle connections only occupy the front end.
+    std::vector<boost::shared_ptr<Poco::Net::StreamSocket> > idle;
+    for (unsigned int i = 0; i < idleConnections; ++i)
+    {
+        idle.push_back(boost::shared_ptr<Poco::Net::StreamSocket>(new Poco::Net::StreamSocket(address)));
+    }
+
+    std::vector<boost::shared_ptr<ActiveClient> > clients;
+    std::vector<boost::shared_ptr<Poco::Thread> > threads;
+    for (unsigned int i = 0; i < activeConnections; ++i)
+    {
+        clients.push_back(
+            boost::shared_ptr<ActiveClient>(new ActiveClient(address, payloadRequest.getContent(), requests, pipelineDepth))
+        );
+        threads.push_back(boost::shared_ptr<Poco::Thread>(new Poco::Thread));
+    }
+
+    Poco::Timestamp start;
+
+    for (unsigned int i = 0; i < activeConnections; ++i)
+    {
+        threads[i]->start(*clients[i]);
+    }
+
+    for (unsigned int i = 0; i < activeConnections; ++i)
+    {
+        threads[i]->join();
+    }
+
+    Poco::Timestamp::TimeDiff const elapsed = start.elapsed();
+
+    std::vector<Poco::Timestamp::TimeDiff> latencies;
+    unsigned int failed = 0;
+    for (unsigned int i = 0; i < activeConnections; ++i)
+    {
+        latencies.insert(latencies.end(), clients[i]->getLatencies().begin(), clients[i]->getLatencies().end());
+        failed += clients[i]->hasFailed() ? 1 : 0;
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    std::cout << "idle connections:   " << idleConnections << std::endl
+              << "active connections: " << activeConnections << " (" << failed << " failed)" << std::endl
+              << "pipeline depth:     " << pipelineDepth << std::endl
+              << "requests:           " << latencies.size() << std::endl
+              << "elapsed [us]:       " << elapsed << std::endl
+              << "throughput [req/s]: " << (elapsed ? latencies.size() * 1000000.0 / elapsed : 0.0) << std::endl
+              << "latency p50 [us]:   " << percentile(latencies, 0.50) << std::endl
+              << "latency p99 [us]:   " << percentile(latencies, 0.99) << std::endl
+              << "latency max [us]:   " << percentile(latencies, 1.00) << std::endl;
+
+    return failed ? 1 : 0;
+}
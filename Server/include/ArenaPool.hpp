@@ -0,0 +1,166 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_ARENAPOOL_HPP
+#define SERVER_ARENAPOOL_HPP
+
+#include <Language/Interface/Arena.hpp>
+#include <Poco/Mutex.h>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <vector>
+
+namespace Server
+{
+
+/**
+ * @brief The allocations of the requests of a command, gathered since the previous collection.
+ */
+struct ArenaStatistics
+{
+    unsigned long long int mRequests;
+    unsigned long long int mAllocations;
+    unsigned long long int mAllocatedSize;
+};
+
+/**
+ * @brief The allocation statistics, by the identifiers of the commands.
+ */
+typedef std::map<unsigned short int, ArenaStatistics> ArenaStatisticsMap;
+
+/**
+ * @brief The pool of the arenas of the requests.
+ *
+ * An arena is handed out for a request and travels with it from the decoding to the reply. It is rewound and taken
+ * back to the pool once the last reference to it is gone, so its blocks serve the requests that follow.
+ */
+class ArenaPool
+    : public boost::enable_shared_from_this<ArenaPool>,
+      private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the pool.
+     *
+     * @param aMaxArenas The maximum number of arenas resting in the pool.
+     * @param aBlockSize The size of a block of an arena.
+     */
+    ArenaPool(
+        std::size_t const aMaxArenas,
+        std::size_t const aBlockSize
+    );
+
+    /**
+     * @brief Destructs the pool along with the arenas resting in it.
+     *
+     * An arena still holding an object lives on until the object is freed.
+     */
+    ~ArenaPool();
+
+    /**
+     * @brief Takes an arena from the pool.
+     *
+     * @return The arena, which goes back to the pool when its last reference is gone.
+     */
+    Language::ArenaShrPtr acquire();
+
+    /**
+     * @brief Records the allocations a request has made from its arena, its decoding, execution and encoding included.
+     *
+     * Called once the reply has been encoded. The objects that stay on the heap, the strings mostly, are not counted.
+     * The pool is shared by the listeners, the allocations are kept apart by the listener the request has come through.
+     *
+     * @param aListenerId The identifier of the listener of the request.
+     * @param aCommandId  The identifier of the command of the request.
+     * @param aArena      The arena of the request.
+     */
+    void record(
+        unsigned int       const   aListenerId,
+        unsigned short int const   aCommandId,
+        Language::Arena    const & aArena
+    );
+
+    /**
+     * @brief Collects the allocation statistics of a listener and resets them.
+     *
+     * @param aListenerId The identifier of the listener.
+     *
+     * @return The statistics gathered since the previous collection for the listener.
+     */
+    ArenaStatisticsMap collectStatistics(
+        unsigned int const aListenerId
+    );
+
+private:
+    /**
+     * @brief Gives an arena back to the pool.
+     */
+    class Release
+    {
+    public:
+        explicit Release(
+            boost::shared_ptr<ArenaPool> aArenaPool
+        );
+
+        void operator()(
+            Language::Arena * aArena
+        ) const;
+
+    private:
+        boost::shared_ptr<ArenaPool> mArenaPool;
+    };
+
+    void release(
+        Language::Arena * aArena
+    );
+
+    std::size_t const mMaxArenas;
+
+    std::size_t const mBlockSize;
+
+    Poco::Mutex mMutex;
+
+    std::vector<Language::Arena *> mArenas;
+
+    /**
+     * @brief Guards the statistics apart from the arenas, so that recording does not hold up acquiring.
+     */
+    Poco::Mutex mStatisticsMutex;
+
+    /**
+     * @brief The statistics by the identifier of the listener.
+     */
+    std::map<unsigned int, ArenaStatisticsMap> mStatistics;
+};
+
+typedef boost::shared_ptr<ArenaPool> ArenaPoolShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_ARENAPOOL_HPP
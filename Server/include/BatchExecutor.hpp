@@ -0,0 +1,153 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_BATCHEXECUTOR_HPP
+#define SERVER_BATCHEXECUTOR_HPP
+
+#include <Game/GameServer/Common/IExecutor.hpp>
+#include <Game/GameServer/Common/IOperatorAbstractFactory.hpp>
+#include <Game/GameServer/Persistence/BatchPersistencePostgresql.hpp>
+#include <Server/include/IContext.hpp>
+
+namespace Server
+{
+
+/**
+ * @brief The executor of a batch of requests.
+ *
+ * Authenticates the user of the batch once, then dispatches the commands of the batch in order, sharing one connection
+ * and one transaction. Each command runs in its own savepoint.
+ *
+ * An atomic batch is rolled back as a whole as soon as one of its commands fails, and the remaining commands are not
+ * executed. A non-atomic batch keeps the work of the successful commands and commits it at the end.
+ *
+ * The indications of the successful commands are published once the batch has been committed.
+ */
+class BatchExecutor
+    : public Game::IExecutor
+{
+public:
+    /**
+     * @brief Constructs the executor.
+     *
+     * @param aContext The context of the server.
+     */
+    explicit BatchExecutor(
+        IContextShrPtr const aContext
+    );
+
+    /**
+     * @brief Executes the batch.
+     *
+     * @param aRequest The batch request.
+     *
+     * @return The batch reply, carrying the replies to the executed commands.
+     */
+    virtual Language::ICommand::Handle execute(
+        Language::ICommand::Handle aRequest
+    );
+
+    /**
+     * @brief Rejects a batch nested in another batch.
+     *
+     * @param aRequest     The batch request.
+     * @param aPersistence The persistence of the outer batch.
+     * @param aActingUser  The acting user of the outer batch.
+     *
+     * @return The batch reply.
+     */
+    virtual Language::ICommand::Handle execute(
+        Language::ICommand::Handle                  aRequest,
+        GameServer::Persistence::IPersistenceShrPtr aPersistence,
+        GameServer::User::IUserShrPtr               aActingUser
+    );
+
+    /**
+     * @brief Gets the indications of the successful commands of the committed batch.
+     *
+     * @return The indications.
+     */
+    virtual Language::ICommand::Commands const & getIndications() const;
+
+private:
+    /**
+     * @brief Authenticates the user of the batch and gets the acting user.
+     *
+     * @param aPersistence The persistence of the batch.
+     * @param aLogin       The login of the user.
+     * @param aPassword    The password of the user.
+     *
+     * @return The acting user, null if the user has not been authenticated.
+     */
+    GameServer::User::IUserShrPtr authenticate(
+        GameServer::Persistence::IPersistenceShrPtr aPersistence,
+        std::string                         const   aLogin,
+        std::string                         const   aPassword
+    ) const;
+
+    /**
+     * @brief Executes a single command of the batch.
+     *
+     * @param aCommand     The command.
+     * @param aPersistence The persistence of the batch.
+     * @param aActingUser  The acting user of the batch.
+     * @param aLogin       The login of the user of the batch.
+     * @param aPassword    The password of the user of the batch.
+     * @param aFailed      Set to true if the command has failed or any of its transactions has been rolled back.
+     * @param aIndications The indications of the batch, the indications of the successful command are appended.
+     *
+     * @return The reply to the command.
+     */
+    Language::ICommand::Handle executeCommand(
+        Language::ICommand::Handle                                 aCommand,
+        GameServer::Persistence::BatchPersistencePostgresqlShrPtr aPersistence,
+        GameServer::User::IUserShrPtr                              aActingUser,
+        std::string                                        const   aLogin,
+        std::string                                        const   aPassword,
+        bool                                                     & aFailed,
+        Language::ICommand::Commands                             & aIndications
+    ) const;
+
+    /**
+     * @brief The context of the server.
+     */
+    IContextShrPtr const mContext;
+
+    /**
+     * @brief The operator abstract factory.
+     */
+    GameServer::Common::IOperatorAbstractFactoryShrPtr mOperatorAbstractFactory;
+
+    /**
+     * @brief The indications of the successful commands of the committed batch.
+     */
+    Language::ICommand::Commands mIndications;
+};
+
+} // namespace Server
+
+#endif // SERVER_BATCHEXECUTOR_HPP
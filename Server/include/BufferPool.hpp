@@ -0,0 +1,93 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_BUFFERPOOL_HPP
+#define SERVER_BUFFERPOOL_HPP
+
+#include <Poco/Mutex.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+namespace Server
+{
+
+/**
+ * @brief The pool of growable buffers shared by the connections.
+ *
+ * Buffers are handed over by swapping, so a buffer keeps the size it has grown to while it rests in the pool.
+ */
+class BufferPool
+    : private boost::noncopyable
+{
+public:
+    typedef std::vector<char> Buffer;
+
+    /**
+     * @brief Constructs the pool.
+     *
+     * @param aMaxBuffers      The maximum number of buffers resting in the pool.
+     * @param aMaxRetainedSize The maximum size of a buffer that is taken back to the pool.
+     */
+    BufferPool(
+        std::size_t const aMaxBuffers,
+        std::size_t const aMaxRetainedSize
+    );
+
+    /**
+     * @brief Takes a buffer from the pool.
+     *
+     * @param aBuffer The buffer, empty if the pool has been exhausted.
+     */
+    void acquire(
+        Buffer & aBuffer
+    );
+
+    /**
+     * @brief Gives a buffer back to the pool.
+     *
+     * @param aBuffer The buffer, empty after the call.
+     */
+    void release(
+        Buffer & aBuffer
+    );
+
+private:
+    std::size_t const mMaxBuffers;
+
+    std::size_t const mMaxRetainedSize;
+
+    Poco::Mutex mMutex;
+
+    std::vector<Buffer> mBuffers;
+};
+
+typedef boost::shared_ptr<BufferPool> BufferPoolShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_BUFFERPOOL_HPP
@@ -0,0 +1,63 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_COMMANDCLASSIFIER_HPP
+#define SERVER_COMMANDCLASSIFIER_HPP
+
+#include <Language/Interface/ICommand.hpp>
+
+namespace Server
+{
+
+/**
+ * @brief The classes of commands, as seen by the admission and scheduling of requests.
+ */
+enum CommandClass
+{
+    COMMAND_CLASS_READ,
+    COMMAND_CLASS_WRITE,
+    COMMAND_CLASS_MODERATOR
+};
+
+class CommandClassifier
+{
+public:
+    /**
+     * @brief Classifies a request.
+     *
+     * @param aId The identifier of the request.
+     *
+     * @return The class of the request.
+     */
+    CommandClass classify(
+        unsigned short int const aId
+    ) const;
+};
+
+} // namespace Server
+
+#endif // SERVER_COMMANDCLASSIFIER_HPP
@@ -28,9 +28,12 @@
 #ifndef SERVER_COMMANDDISPATCHER_HPP
 #define SERVER_COMMANDDISPATCHER_HPP
 
+#include <Game/GameServer/Common/IAsyncExecutor.hpp>
 #include <Game/GameServer/Common/IExecutor.hpp>
 #include <Language/Interface/ICommand.hpp>
 #include <Server/include/IContext.hpp>
+#include <Server/include/IReplyStream.hpp>
+#include <Server/include/ISubscriber.hpp>
 
 namespace Server
 {
@@ -38,7 +41,32 @@ namespace Server
 class CommandDispatcher
 {
 public:
+    /**
+     * @brief Dispatches a command to its executor.
+     *
+     * @param aCommand     The command.
+     * @param aContext     The context of the server.
+     * @param aSubscriber  The subscriber of the connection the command has arrived on, null if not available.
+     * @param aReplyStream The stream a listing is replied to through in parts, null if the reply is not to be streamed.
+     *
+     * @return The executor.
+     */
     Game::IExecutorShrPtr dispatch(
+        Language::ICommand::Handle const aCommand,
+        IContextShrPtr             const aContext,
+        ISubscriberShrPtr          const aSubscriber = ISubscriberShrPtr(),
+        IReplyStreamShrPtr         const aReplyStream = IReplyStreamShrPtr()
+    ) const;
+
+    /**
+     * @brief Dispatches a command to its asynchronous executor.
+     *
+     * @param aCommand The command.
+     * @param aContext The context of the server.
+     *
+     * @return The executor, null if the asynchronous execution is disabled or the command has not been migrated.
+     */
+    Game::IAsyncExecutorShrPtr dispatchAsync(
         Language::ICommand::Handle const aCommand,
         IContextShrPtr             const aContext
     ) const;
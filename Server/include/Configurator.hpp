@@ -31,6 +31,7 @@
 #include <Poco/AutoPtr.h>
 #include <Poco/DOM/Document.h>
 #include <Server/include/IConfigurator.hpp>
+#include <map>
 
 namespace Server
 {
@@ -46,6 +47,37 @@ public:
     virtual std::string        getHost()                  const;
     virtual std::string        getPort()                  const;
     virtual unsigned short int getThreads()               const;
+    virtual unsigned short int getReservedThreads()       const;
+    virtual std::string        getFrontEnd()              const;
+    virtual unsigned short int getListenerCount()         const;
+    virtual std::string        getListenerAffinity()      const;
+    virtual std::string        getListenerUnixPath()      const;
+    virtual unsigned int       getQueueCapacity()         const;
+    virtual unsigned int       getQueuePriorityCapacity() const;
+    virtual std::string        getQueueOverload()         const;
+    virtual unsigned int       getQueueReportInterval()   const;
+    virtual unsigned int       getConnectionMaxRequests() const;
+    virtual unsigned int       getConnectionIdleTimeout() const;
+    virtual unsigned int       getConnectionMaxPayload()  const;
+    virtual unsigned int       getConnectionMaxInFlight() const;
+    virtual unsigned int       getSessionTimeout()        const;
+    virtual unsigned int       getIdempotencyTimeout()    const;
+    virtual unsigned int       getRateLimitLoginRate()    const;
+    virtual unsigned int       getRateLimitLoginBurst()   const;
+    virtual unsigned int       getRateLimitReadRate()     const;
+    virtual unsigned int       getRateLimitReadBurst()    const;
+    virtual unsigned int       getRateLimitWriteRate()    const;
+    virtual unsigned int       getRateLimitWriteBurst()   const;
+    virtual unsigned int       getCompressionThreshold()  const;
+    virtual int                getCompressionLevel()      const;
+    virtual unsigned int       getStreamPartSize()        const;
+    virtual unsigned int       getShutdownDrainTimeout()  const;
+    virtual std::string        getShutdownHandoffPath()   const;
+    virtual unsigned int       getDeadlineTimeout(unsigned short int const aCommandId) const;
+    virtual unsigned int       getAsyncConnections()      const;
+    virtual std::string        getAsyncConnectionString() const;
+    virtual unsigned int       getAsyncMaxQueries()       const;
+    virtual std::string        getDecoder()               const;
     virtual int                getLoggerPriority()        const;
     virtual std::string        getPersistence()           const;
     virtual std::string        getConfigurationPath()     const;
@@ -60,6 +92,38 @@ private:
     std::string        mHost;
     std::string        mPort;
     unsigned short int mThreads;
+    unsigned short int mReservedThreads;
+    std::string        mFrontEnd;
+    unsigned short int mListenerCount;
+    std::string        mListenerAffinity;
+    std::string        mListenerUnixPath;
+    unsigned int       mQueueCapacity;
+    unsigned int       mQueuePriorityCapacity;
+    std::string        mQueueOverload;
+    unsigned int       mQueueReportInterval;
+    unsigned int       mConnectionMaxRequests;
+    unsigned int       mConnectionIdleTimeout;
+    unsigned int       mConnectionMaxPayload;
+    unsigned int       mConnectionMaxInFlight;
+    unsigned int       mSessionTimeout;
+    unsigned int       mIdempotencyTimeout;
+    unsigned int       mRateLimitLoginRate;
+    unsigned int       mRateLimitLoginBurst;
+    unsigned int       mRateLimitReadRate;
+    unsigned int       mRateLimitReadBurst;
+    unsigned int       mRateLimitWriteRate;
+    unsigned int       mRateLimitWriteBurst;
+    unsigned int       mCompressionThreshold;
+    int                mCompressionLevel;
+    unsigned int       mStreamPartSize;
+    unsigned int       mShutdownDrainTimeout;
+    std::string        mShutdownHandoffPath;
+    unsigned int       mDeadlineDefaultTimeout;
+    std::map<unsigned short int, unsigned int> mDeadlineTimeouts;
+    unsigned int       mAsyncConnections;
+    std::string        mAsyncConnectionString;
+    unsigned int       mAsyncMaxQueries;
+    std::string        mDecoder;
     int                mLoggerPriority;
     std::string        mPersistence;
     std::string        mConfigurationPath;
@@ -28,9 +28,12 @@
 #ifndef SERVER_CONNECTION_HPP
 #define SERVER_CONNECTION_HPP
 
-#include <Poco/Net/SocketStream.h>
 #include <Poco/Net/TCPServerConnection.h>
+#include <Poco/Timespan.h>
+#include <Server/include/FrameReader.hpp>
 #include <Server/include/IContext.hpp>
+#include <Server/include/RequestProcessor.hpp>
+#include <boost/shared_ptr.hpp>
 
 namespace Server
 {
@@ -45,11 +48,55 @@ public:
     );
 
 private:
+    /**
+     * @brief Writes the replies and the indications of the connection, one frame at a time.
+     */
+    class Writer;
+
     virtual void run();
 
-    Poco::Net::SocketStream mSocketStream;
+    /**
+     * @brief Waits for the next request to arrive.
+     *
+     * @param aIdleTimeout The time the connection may stay idle.
+     *
+     * @return True if a request is pending, false if the peer has closed the connection or the timeout has expired.
+     */
+    bool waitForRequest(
+        Poco::Timespan const & aIdleTimeout
+    );
+
+    /**
+     * @brief Reads, executes and replies to a single request.
+     *
+     * @return True if the request has been served, false if the connection is no longer usable.
+     */
+    bool serveRequest();
+
+    /**
+     * @brief Receives whatever is available on the socket, blocks until something is.
+     *
+     * @return False if the peer has closed the connection, true otherwise.
+     */
+    bool receive();
+
+    /**
+     * @brief Verifies whether the connection is subscribed to the indications of any world.
+     *
+     * @return True if the connection is subscribed, false otherwise.
+     */
+    bool isSubscribed() const;
+
+    FrameReader mFrameReader;
 
     IContextShrPtr mContext;
+
+    RequestProcessor mRequestProcessor;
+
+    /**
+     * @brief The writer, created along with the first request, once the framing is known.
+     */
+    boost::shared_ptr<Writer> mWriter;
 };
 
 } // namespace Server
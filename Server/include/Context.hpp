@@ -44,6 +44,15 @@ public:
     virtual IConfiguratorBuildingShrPtr getConfiguratorBuilding() const;
     virtual IConfiguratorHumanShrPtr    getConfiguratorHuman()    const;
     virtual IConfiguratorResourceShrPtr getConfiguratorResource() const;
+    virtual BufferPoolShrPtr            getBufferPool()           const;
+    virtual ArenaPoolShrPtr             getArenaPool()            const;
+    virtual SubscriptionRegistryShrPtr  getSubscriptionRegistry() const;
+    virtual SessionManagerShrPtr        getSessionManager()       const;
+    virtual RateLimiterShrPtr           getRateLimiter()          const;
+    virtual ReplyCompressorShrPtr       getReplyCompressor()      const;
+    virtual DeadlineWatchdogShrPtr      getDeadlineWatchdog()     const;
+    virtual IdempotencyCacheShrPtr      getIdempotencyCache()     const;
+    virtual GameServer::Persistence::IAsyncQueryRunnerShrPtr getAsyncQueryRunner() const;
 
 private:
     IConfiguratorShrPtr         const mConfigurator;
@@ -51,6 +60,15 @@ private:
     IConfiguratorBuildingShrPtr const mConfiguratorBuilding;
     IConfiguratorHumanShrPtr    const mConfiguratorHuman;
     IConfiguratorResourceShrPtr const mConfiguratorResource;
+    BufferPoolShrPtr            const mBufferPool;
+    ArenaPoolShrPtr             const mArenaPool;
+    SubscriptionRegistryShrPtr  const mSubscriptionRegistry;
+    SessionManagerShrPtr        const mSessionManager;
+    RateLimiterShrPtr           const mRateLimiter;
+    ReplyCompressorShrPtr       const mReplyCompressor;
+    DeadlineWatchdogShrPtr      const mDeadlineWatchdog;
+    IdempotencyCacheShrPtr      const mIdempotencyCache;
+    GameServer::Persistence::IAsyncQueryRunnerShrPtr const mAsyncQueryRunner;
 };
 
 } // namespace Server
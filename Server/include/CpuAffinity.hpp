@@ -0,0 +1,78 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_CPUAFFINITY_HPP
+#define SERVER_CPUAFFINITY_HPP
+
+#include <vector>
+
+namespace Server
+{
+
+/**
+ * @brief A set of CPUs, empty if not restricted.
+ */
+typedef std::vector<unsigned int> CpuSet;
+
+/**
+ * @brief Gets the number of CPUs online.
+ *
+ * @return The number of CPUs, at least 1.
+ */
+unsigned int getNumberOfCpus();
+
+/**
+ * @brief Splits the CPUs into contiguous subsets of (nearly) equal sizes and gets one of them.
+ *
+ * If there are fewer CPUs than subsets, the subsets wrap around and share CPUs.
+ *
+ * @param aNumberOfCpus    The number of CPUs.
+ * @param aIndex           The index of the subset.
+ * @param aNumberOfSubsets The number of subsets.
+ *
+ * @return The subset.
+ */
+CpuSet getCpuSubset(
+    unsigned int const aNumberOfCpus,
+    unsigned int const aIndex,
+    unsigned int const aNumberOfSubsets
+);
+
+/**
+ * @brief Pins the calling thread to a set of CPUs.
+ *
+ * @param aCpus The CPUs, the thread is left as it is if empty.
+ *
+ * @return False if the thread could not be pinned, true otherwise.
+ */
+bool pinCurrentThread(
+    CpuSet const & aCpus
+);
+
+} // namespace Server
+
+#endif // SERVER_CPUAFFINITY_HPP
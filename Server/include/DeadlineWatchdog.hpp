@@ -0,0 +1,177 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_DEADLINEWATCHDOG_HPP
+#define SERVER_DEADLINEWATCHDOG_HPP
+
+#include <Game/GameServer/Persistence/IConnection.hpp>
+#include <Poco/Condition.h>
+#include <Poco/Mutex.h>
+#include <Poco/Runnable.h>
+#include <Poco/Thread.h>
+#include <Poco/Timestamp.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <utility>
+
+namespace Server
+{
+
+/**
+ * @brief The watchdog cancelling the queries of the requests which have outlived their deadlines.
+ *
+ * A single thread sleeps until the nearest deadline and cancels the query being run on the connection watched with
+ * it. The cancelled query fails, so the worker gets back to the queue instead of waiting for the database.
+ */
+class DeadlineWatchdog
+    : private Poco::Runnable,
+      private boost::noncopyable
+{
+public:
+    /**
+     * @brief The identifier of a watch.
+     */
+    typedef unsigned long long int Ticket;
+
+    /**
+     * @brief Constructs the watchdog and starts its thread.
+     */
+    DeadlineWatchdog();
+
+    /**
+     * @brief Stops the thread of the watchdog.
+     */
+    virtual ~DeadlineWatchdog();
+
+    /**
+     * @brief Watches a connection.
+     *
+     * @param aDeadline   The deadline (in microseconds since the epoch).
+     * @param aConnection The connection.
+     *
+     * @return The ticket of the watch.
+     */
+    Ticket watch(
+        Poco::Timestamp::TimeVal                   const aDeadline,
+        GameServer::Persistence::IConnectionShrPtr const aConnection
+    );
+
+    /**
+     * @brief Stops watching a connection.
+     *
+     * @param aTicket The ticket of the watch.
+     *
+     * @return True if the connection has been watched, false if the watch has already expired.
+     */
+    bool unwatch(
+        Ticket const aTicket
+    );
+
+    /**
+     * @brief Cancels the queries of the expired watches and forgets the watches.
+     *
+     * @param aNow The current time (in microseconds since the epoch).
+     *
+     * @return The number of the expired watches.
+     */
+    std::size_t cancelExpired(
+        Poco::Timestamp::TimeVal const aNow
+    );
+
+private:
+    typedef std::pair<Ticket, GameServer::Persistence::IConnectionShrPtr> Watch;
+
+    typedef std::multimap<Poco::Timestamp::TimeVal, Watch> Watches;
+
+    typedef std::map<Ticket, Watches::iterator> Tickets;
+
+    /**
+     * @brief Cancels the expired watches until stopped.
+     */
+    virtual void run();
+
+    Poco::Mutex mMutex;
+
+    Poco::Condition mCondition;
+
+    Watches mWatches;
+
+    Tickets mTickets;
+
+    Ticket mNextTicket;
+
+    bool mStopRequested;
+
+    Poco::Thread mThread;
+};
+
+typedef boost::shared_ptr<DeadlineWatchdog> DeadlineWatchdogShrPtr;
+
+/**
+ * @brief The watch of a connection for the lifetime of the scope.
+ */
+class ScopedDeadlineWatch
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Watches a connection.
+     *
+     * @param aWatchdog   The watchdog.
+     * @param aDeadline   The deadline (in microseconds since the epoch), nothing is watched if zero.
+     * @param aConnection The connection.
+     */
+    ScopedDeadlineWatch(
+        DeadlineWatchdogShrPtr                     const aWatchdog,
+        Poco::Timestamp::TimeVal                   const aDeadline,
+        GameServer::Persistence::IConnectionShrPtr const aConnection
+    );
+
+    /**
+     * @brief Stops watching the connection if not stopped yet.
+     */
+    ~ScopedDeadlineWatch();
+
+    /**
+     * @brief Stops watching the connection.
+     *
+     * @return True if the deadline has passed and the query being run meanwhile has been cancelled, false otherwise.
+     */
+    bool stop();
+
+private:
+    DeadlineWatchdogShrPtr const mWatchdog;
+
+    bool mWatching;
+
+    DeadlineWatchdog::Ticket mTicket;
+};
+
+} // namespace Server
+
+#endif // SERVER_DEADLINEWATCHDOG_HPP
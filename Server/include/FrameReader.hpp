@@ -0,0 +1,211 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_FRAMEREADER_HPP
+#define SERVER_FRAMEREADER_HPP
+
+#include <Server/include/BufferPool.hpp>
+#include <Server/include/Framing.hpp>
+
+namespace Server
+{
+
+/**
+ * @brief Splits the incoming bytes of a connection into frames.
+ *
+ * The framing is detected from the first byte received, see Framing. Bytes are received straight into a buffer
+ * taken from the pool, the buffer grows as needed and complete frames are handed out in place, without copying.
+ * The unconsumed bytes are kept within the capacity, a complete frame of the maximum length with its header.
+ */
+class FrameReader
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the reader.
+     *
+     * @param aBufferPool The pool of buffers.
+     * @param aMaxPayload The maximum length of the content of a frame.
+     */
+    FrameReader(
+        BufferPoolShrPtr         aBufferPool,
+        std::size_t      const   aMaxPayload
+    );
+
+    ~FrameReader();
+
+    /**
+     * @brief Prepares room for bytes to be received.
+     *
+     * @param aSize The number of bytes to be received.
+     *
+     * @return The place the bytes are to be received to.
+     */
+    char * prepare(
+        std::size_t const aSize
+    );
+
+    /**
+     * @brief Accepts bytes received to the place returned by prepare().
+     *
+     * @param aSize The number of bytes received.
+     */
+    void commit(
+        std::size_t const aSize
+    );
+
+    /**
+     * @brief Verifies whether there are received bytes that have not been consumed yet.
+     *
+     * @return True if there are unconsumed bytes, false otherwise.
+     */
+    bool hasBufferedData() const;
+
+    /**
+     * @brief Gets the number of bytes that may be received before the unconsumed bytes reach the capacity.
+     *
+     * @return The number of bytes, 0 if the frames received have to be consumed first.
+     */
+    std::size_t getRoom() const;
+
+    /**
+     * @brief Extracts the next complete frame.
+     *
+     * The content stays valid until consume(), prepare() or commit() is called.
+     *
+     * @param aContent The content of the frame.
+     * @param aLength  The length of the content of the frame.
+     *
+     * @return True if a complete frame is available, false otherwise.
+     */
+    bool extract(
+        char        const * & aContent,
+        std::size_t       &   aLength
+    );
+
+    /**
+     * @brief Drops the frame returned by extract().
+     */
+    void consume();
+
+    /**
+     * @brief Verifies whether the incoming data violates the framing or the payload limit.
+     *
+     * @return True if the framing has been violated, false otherwise.
+     */
+    bool isMalformed() const;
+
+    /**
+     * @brief Gets the framing of the connection.
+     *
+     * @return The framing, unknown until the first byte has been received.
+     */
+    Framing getFraming() const;
+
+    /**
+     * @brief Gets the identifier of the request carried by the frame returned by extract().
+     *
+     * @return The identifier of the request, 0 for the text framing.
+     */
+    unsigned long long int getRequestId() const;
+
+    /**
+     * @brief Gets the flags of the frame returned by extract().
+     *
+     * @return The flags, 0 for the text framing.
+     */
+    unsigned char getFlags() const;
+
+private:
+    /**
+     * @brief Parses the header of the frame at the beginning of the unconsumed bytes.
+     *
+     * @return True if the header is complete, false otherwise.
+     */
+    bool parseHeader();
+
+    /**
+     * @brief Parses the length prefix of a text frame.
+     *
+     * @return True if the length prefix is complete, false otherwise.
+     */
+    bool parseTextHeader();
+
+    /**
+     * @brief Parses the header of a binary frame.
+     *
+     * @return True if the header is complete, false otherwise.
+     */
+    bool parseBinaryHeader();
+
+    /**
+     * @brief Gets the maximum number of unconsumed bytes, enough for a complete frame of the maximum length.
+     *
+     * @return The capacity.
+     */
+    std::size_t getCapacity() const;
+
+    BufferPoolShrPtr mBufferPool;
+
+    std::size_t const mMaxPayload;
+
+    BufferPool::Buffer mBuffer;
+
+    /**
+     * @brief The offset of the first unconsumed byte.
+     */
+    std::size_t mBegin;
+
+    /**
+     * @brief The offset past the last received byte.
+     */
+    std::size_t mEnd;
+
+    /**
+     * @brief The offset of the content of the current frame, valid once the length prefix has been parsed.
+     */
+    std::size_t mContentOffset;
+
+    /**
+     * @brief The length of the content of the current frame, valid once the length prefix has been parsed.
+     */
+    std::size_t mContentLength;
+
+    unsigned long long int mRequestId;
+
+    unsigned char mFlags;
+
+    bool mLengthParsed;
+
+    bool mMalformed;
+
+    Framing mFraming;
+};
+
+} // namespace Server
+
+#endif // SERVER_FRAMEREADER_HPP
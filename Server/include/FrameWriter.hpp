@@ -0,0 +1,142 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_FRAMEWRITER_HPP
+#define SERVER_FRAMEWRITER_HPP
+
+#include <Server/include/Framing.hpp>
+#include <boost/noncopyable.hpp>
+#include <deque>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief Writes frames to a connection.
+ *
+ * The length prefix and the content of a frame are written with a single scatter-gather write, the content is never
+ * copied into an intermediate buffer.
+ */
+class FrameWriter
+    : private boost::noncopyable
+{
+public:
+    FrameWriter();
+
+    /**
+     * @brief Queues a frame.
+     *
+     * @param aFraming   The framing.
+     * @param aRequestId The identifier of the request replied to, ignored by the text framing.
+     * @param aContent   The content of the frame, taken over by the writer and empty after the call.
+     * @param aFlags     The flags of the frame, ignored by the text framing.
+     */
+    void queue(
+        Framing                const   aFraming,
+        unsigned long long int const   aRequestId,
+        std::string                  & aContent,
+        unsigned char          const   aFlags = 0
+    );
+
+    /**
+     * @brief Writes as much of the queued frames as the socket accepts.
+     *
+     * @param aDescriptor The descriptor of the socket.
+     *
+     * @return False if an error occurred, true otherwise.
+     */
+    bool send(
+        int const aDescriptor
+    );
+
+    /**
+     * @brief Verifies whether there are frames waiting to be written.
+     *
+     * @return True if there are no frames waiting to be written, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Writes a single frame to a blocking socket.
+     *
+     * @param aDescriptor The descriptor of the socket.
+     * @param aFraming    The framing.
+     * @param aRequestId  The identifier of the request replied to, ignored by the text framing.
+     * @param aContent    The content of the frame.
+     * @param aFlags      The flags of the frame, ignored by the text framing.
+     *
+     * @return False if an error occurred, true otherwise.
+     */
+    static bool write(
+        int                    const   aDescriptor,
+        Framing                const   aFraming,
+        unsigned long long int const   aRequestId,
+        std::string            const & aContent,
+        unsigned char          const   aFlags = 0
+    );
+
+private:
+    struct Frame
+    {
+        char mHeader[24];
+
+        std::size_t mHeaderLength;
+
+        std::string mContent;
+    };
+
+    /**
+     * @brief Writes the header of a frame.
+     *
+     * @param aHeader    The place for the header.
+     * @param aFraming   The framing.
+     * @param aRequestId The identifier of the request replied to.
+     * @param aLength    The length of the content.
+     * @param aFlags     The flags of the frame.
+     *
+     * @return The length of the header.
+     */
+    static std::size_t formatHeader(
+        char                         * aHeader,
+        Framing                const   aFraming,
+        unsigned long long int const   aRequestId,
+        std::size_t            const   aLength,
+        unsigned char          const   aFlags
+    );
+
+    std::deque<Frame> mFrames;
+
+    /**
+     * @brief The number of bytes of the first frame that have already been written.
+     */
+    std::size_t mOffset;
+};
+
+} // namespace Server
+
+#endif // SERVER_FRAMEWRITER_HPP
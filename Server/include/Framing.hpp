@@ -0,0 +1,156 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_FRAMING_HPP
+#define SERVER_FRAMING_HPP
+
+#include <cstddef>
+
+namespace Server
+{
+
+/**
+ * @brief The framings of the requests and the replies.
+ *
+ * The framing of a connection is detected from the first byte the client sends and stays the same afterwards.
+ */
+enum Framing
+{
+    /**
+     * @brief Nothing has been received yet.
+     */
+    FRAMING_UNKNOWN,
+
+    /**
+     * @brief The length of the content as text immediately followed by the content.
+     *
+     * Requests are served one by one and replied to in order.
+     */
+    FRAMING_TEXT,
+
+    /**
+     * @brief A binary header carrying the identifier of the request followed by the content.
+     *
+     * Requests may be pipelined, replies carry the identifier of the request and may arrive out of order.
+     */
+    FRAMING_BINARY
+};
+
+/**
+ * @brief The header of a binary frame.
+ *
+ * The layout on the wire, integers are in network byte order:
+ *
+ *     offset  size  field
+ *          0     2  magic, "TU"
+ *          2     1  version
+ *          3     1  flags
+ *          4     4  length of the content
+ *          8     8  identifier of the request, echoed in the reply
+ */
+struct BinaryFrameHeader
+{
+    unsigned char mVersion;
+
+    unsigned char mFlags;
+
+    unsigned int mLength;
+
+    unsigned long long int mRequestId;
+};
+
+std::size_t const BINARY_FRAME_HEADER_SIZE = 16U;
+
+char const BINARY_FRAME_MAGIC[2] = {'T', 'U'};
+
+unsigned char const BINARY_FRAME_VERSION = 1;
+
+/**
+ * @brief The flags of a binary frame.
+ *
+ * An indication is pushed by the server on its own, its identifier of the request is meaningless.
+ *
+ * A request carrying the accept compressed flag allows the reply to be compressed, a reply carrying the compressed
+ * flag has its content deflated by zlib, preceded by the length of the raw content on 4 bytes. Replies below
+ * the configured threshold are sent raw regardless.
+ */
+unsigned char const BINARY_FRAME_FLAG_INDICATION = 0x01;
+
+unsigned char const BINARY_FRAME_FLAG_ACCEPT_COMPRESSED = 0x02;
+
+unsigned char const BINARY_FRAME_FLAG_COMPRESSED = 0x04;
+
+/**
+ * @brief The flag of a codec handshake.
+ *
+ * A frame carrying the flag is not a request, its content names the codec the client asks for (see Codec.hpp).
+ * The server answers with a frame carrying the flag and the name of the codec used for the requests following
+ * the handshake, their replies and the indications, XML if the requested one is not supported. The requests
+ * in progress are replied to in the codec they have arrived in.
+ */
+unsigned char const BINARY_FRAME_FLAG_NEGOTIATE = 0x08;
+
+/**
+ * @brief The flags of a streamed reply.
+ *
+ * A request carrying the accept streamed flag allows a listing to be replied to in parts as its rows are fetched, so
+ * neither the server holds the whole listing nor the client waits for it. A part is written out before the next batch
+ * of rows is fetched. Every part is a complete reply of its own carrying a slice of the objects, each but the last
+ * carries the continued flag. The last part terminates the reply, it carries no objects and the status the reply has
+ * ended with. Each part is compressed on its own.
+ */
+unsigned char const BINARY_FRAME_FLAG_ACCEPT_STREAMED = 0x10;
+
+unsigned char const BINARY_FRAME_FLAG_CONTINUED = 0x20;
+
+/**
+ * @brief Encodes the header of a binary frame.
+ *
+ * @param aHeader The header.
+ * @param aBuffer The place for BINARY_FRAME_HEADER_SIZE bytes.
+ */
+void encodeBinaryFrameHeader(
+    BinaryFrameHeader const & aHeader,
+    char                    * aBuffer
+);
+
+/**
+ * @brief Decodes the header of a binary frame.
+ *
+ * @param aBuffer BINARY_FRAME_HEADER_SIZE bytes.
+ * @param aHeader The header.
+ *
+ * @return False if the magic or the version is not recognized, true otherwise.
+ */
+bool decodeBinaryFrameHeader(
+    char              const * aBuffer,
+    BinaryFrameHeader       & aHeader
+);
+
+} // namespace Server
+
+#endif // SERVER_FRAMING_HPP
@@ -46,6 +46,37 @@ public:
     virtual std::string        getHost()                  const = 0;
     virtual std::string        getPort()                  const = 0;
     virtual unsigned short int getThreads()               const = 0;
+    virtual unsigned short int getReservedThreads()       const = 0;
+    virtual std::string        getFrontEnd()              const = 0;
+    virtual unsigned short int getListenerCount()         const = 0;
+    virtual std::string        getListenerAffinity()      const = 0;
+    virtual std::string        getListenerUnixPath()      const = 0;
+    virtual unsigned int       getQueueCapacity()         const = 0;
+    virtual unsigned int       getQueuePriorityCapacity() const = 0;
+    virtual std::string        getQueueOverload()         const = 0;
+    virtual unsigned int       getQueueReportInterval()   const = 0;
+    virtual unsigned int       getConnectionMaxRequests() const = 0;
+    virtual unsigned int       getConnectionIdleTimeout() const = 0;
+    virtual unsigned int       getConnectionMaxPayload()  const = 0;
+    virtual unsigned int       getConnectionMaxInFlight() const = 0;
+    virtual unsigned int       getSessionTimeout()        const = 0;
+    virtual unsigned int       getIdempotencyTimeout()    const = 0;
+    virtual unsigned int       getRateLimitLoginRate()    const = 0;
+    virtual unsigned int       getRateLimitLoginBurst()   const = 0;
+    virtual unsigned int       getRateLimitReadRate()     const = 0;
+    virtual unsigned int       getRateLimitReadBurst()    const = 0;
+    virtual unsigned int       getRateLimitWriteRate()    const = 0;
+    virtual unsigned int       getRateLimitWriteBurst()   const = 0;
+    virtual unsigned int       getCompressionThreshold()  const = 0;
+    virtual int                getCompressionLevel()      const = 0;
+    virtual unsigned int       getStreamPartSize()        const = 0;
+    virtual unsigned int       getShutdownDrainTimeout()  const = 0;
+    virtual std::string        getShutdownHandoffPath()   const = 0;
+    virtual unsigned int       getDeadlineTimeout(unsigned short int const aCommandId) const = 0;
+    virtual unsigned int       getAsyncConnections()      const = 0;
+    virtual std::string        getAsyncConnectionString() const = 0;
+    virtual unsigned int       getAsyncMaxQueries()       const = 0;
+    virtual std::string        getDecoder()               const = 0;
     virtual int                getLoggerPriority()        const = 0;
     virtual std::string        getPersistence()           const = 0;
     virtual std::string        getConfigurationPath()     const = 0;
@@ -28,11 +28,20 @@
 #ifndef SERVER_ICONTEXT_HPP
 #define SERVER_ICONTEXT_HPP
 
+#include <Game/GameServer/Persistence/IAsyncQueryRunner.hpp>
+#include <Server/include/ArenaPool.hpp>
+#include <Server/include/BufferPool.hpp>
+#include <Server/include/DeadlineWatchdog.hpp>
 #include <Server/include/IConfigurator.hpp>
 #include <Server/include/IConfiguratorBase.hpp>
 #include <Server/include/IConfiguratorBuilding.hpp>
 #include <Server/include/IConfiguratorHuman.hpp>
 #include <Server/include/IConfiguratorResource.hpp>
+#include <Server/include/IdempotencyCache.hpp>
+#include <Server/include/RateLimiter.hpp>
+#include <Server/include/ReplyCompressor.hpp>
+#include <Server/include/SessionManager.hpp>
+#include <Server/include/SubscriptionRegistry.hpp>
 
 namespace Server
 {
@@ -48,6 +57,21 @@ public:
     virtual IConfiguratorBuildingShrPtr getConfiguratorBuilding() const = 0;
     virtual IConfiguratorHumanShrPtr    getConfiguratorHuman()    const = 0;
     virtual IConfiguratorResourceShrPtr getConfiguratorResource() const = 0;
+    virtual BufferPoolShrPtr            getBufferPool()           const = 0;
+    virtual ArenaPoolShrPtr             getArenaPool()            const = 0;
+    virtual SubscriptionRegistryShrPtr  getSubscriptionRegistry() const = 0;
+    virtual SessionManagerShrPtr        getSessionManager()       const = 0;
+    virtual RateLimiterShrPtr           getRateLimiter()          const = 0;
+    virtual ReplyCompressorShrPtr       getReplyCompressor()      const = 0;
+    virtual DeadlineWatchdogShrPtr      getDeadlineWatchdog()     const = 0;
+    virtual IdempotencyCacheShrPtr      getIdempotencyCache()     const = 0;
+
+    /**
+     * @brief Gets the runner of the asynchronous queries.
+     *
+     * @return The runner, null if the asynchronous execution is disabled.
+     */
+    virtual GameServer::Persistence::IAsyncQueryRunnerShrPtr getAsyncQueryRunner() const = 0;
 };
 
 typedef boost::shared_ptr<IContext> IContextShrPtr;
@@ -0,0 +1,97 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_IREPLYSINK_HPP
+#define SERVER_IREPLYSINK_HPP
+
+#include <boost/noncopyable.hpp>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief The interface of the receiver of replies produced by the worker pool.
+ */
+class IReplySink
+    : private boost::noncopyable
+{
+public:
+    virtual ~IReplySink(){}
+
+    /**
+     * @brief Posts a reply to a connection.
+     *
+     * Called from the threads of the worker pool.
+     *
+     * @param aConnectionId The identifier of the connection.
+     * @param aRequestId    The identifier of the request within the connection.
+     * @param aContent      The content of the reply.
+     * @param aFlags        The flags of the frame of the reply.
+     */
+    virtual void postReply(
+        unsigned long long int         aConnectionId,
+        unsigned long long int         aRequestId,
+        std::string            const & aContent,
+        unsigned char                  aFlags = 0
+    ) = 0;
+
+    /**
+     * @brief Posts a part of a streamed reply to a connection and waits until it has been written out.
+     *
+     * Called from the threads of the worker pool, which are held back as long as the peer reads slower than the listing
+     * is fetched.
+     *
+     * @param aConnectionId The identifier of the connection.
+     * @param aRequestId    The identifier of the request within the connection.
+     * @param aContent      The content of the part.
+     * @param aFlags        The flags of the frame of the part.
+     *
+     * @return True once the part has been written, false if the connection has gone away before.
+     */
+    virtual bool postPart(
+        unsigned long long int         aConnectionId,
+        unsigned long long int         aRequestId,
+        std::string            const & aContent,
+        unsigned char                  aFlags
+    ) = 0;
+
+    /**
+     * @brief Posts a failure of processing a request of a connection.
+     *
+     * Called from the threads of the worker pool.
+     *
+     * @param aConnectionId The identifier of the connection.
+     */
+    virtual void postFailure(
+        unsigned long long int aConnectionId
+    ) = 0;
+};
+
+} // namespace Server
+
+#endif // SERVER_IREPLYSINK_HPP
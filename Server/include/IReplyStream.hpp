@@ -0,0 +1,75 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_IREPLYSTREAM_HPP
+#define SERVER_IREPLYSTREAM_HPP
+
+#include <Language/Interface/ICommand.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace Server
+{
+
+/**
+ * @brief The interface of the stream a listing is replied to through in parts, see BINARY_FRAME_FLAG_ACCEPT_STREAMED.
+ *
+ * The executor writes a part for every batch of the listing as soon as it has been fetched, and returns the last part
+ * as its reply.
+ */
+class IReplyStream
+    : private boost::noncopyable
+{
+public:
+    virtual ~IReplyStream(){}
+
+    /**
+     * @brief Gets the number of rows fetched for a part.
+     *
+     * @return The number of rows.
+     */
+    virtual unsigned int getPartSize() const = 0;
+
+    /**
+     * @brief Writes a part of the reply out ahead of the rest.
+     *
+     * @param aPart The part, a reply carrying a slice of the objects.
+     *
+     * Returns once the part has been written out, the next batch is not fetched before.
+     *
+     * @throw std::exception If the part could not be written, the client will not get the rest either.
+     */
+    virtual void write(
+        Language::ICommand::Handle const aPart
+    ) = 0;
+};
+
+typedef boost::shared_ptr<IReplyStream> IReplyStreamShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_IREPLYSTREAM_HPP
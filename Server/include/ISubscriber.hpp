@@ -0,0 +1,85 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_ISUBSCRIBER_HPP
+#define SERVER_ISUBSCRIBER_HPP
+
+#include <Server/include/Codec.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief The interface of a connection subscribed to the indications of the worlds.
+ */
+class ISubscriber
+    : private boost::noncopyable
+{
+public:
+    virtual ~ISubscriber(){}
+
+    /**
+     * @brief Delivers an indication to the subscriber.
+     *
+     * Called from the thread that has committed the action the indication is about. Must not block for long.
+     *
+     * @param aContent The content of the indication.
+     *
+     * @return False if the connection has gone away and the subscriber is to be dropped, true otherwise.
+     */
+    virtual bool notify(
+        std::string const & aContent
+    ) = 0;
+
+    /**
+     * @brief Gets the codec the indications are to be delivered in.
+     *
+     * @return The codec of the connection.
+     */
+    virtual Codec getCodec() const
+    {
+        return CODEC_XML;
+    }
+
+    /**
+     * @brief Tells the subscriber it has been subscribed to a world.
+     *
+     * Called from the thread executing the subscription.
+     */
+    virtual void markSubscribed()
+    {
+    }
+};
+
+typedef boost::shared_ptr<ISubscriber> ISubscriberShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_ISUBSCRIBER_HPP
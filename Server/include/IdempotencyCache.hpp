@@ -0,0 +1,183 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_IDEMPOTENCYCACHE_HPP
+#define SERVER_IDEMPOTENCYCACHE_HPP
+
+#include <Poco/Mutex.h>
+#include <Poco/Timestamp.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <boost/tuple/tuple_comparison.hpp>
+#include <list>
+#include <map>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief The state of a request carrying an idempotency key.
+ */
+enum IdempotencyState
+{
+    IDEMPOTENCY_STATE_NEW,
+    IDEMPOTENCY_STATE_IN_PROGRESS,
+    IDEMPOTENCY_STATE_COMPLETED
+};
+
+/**
+ * @brief The cache of the replies to the recent requests carrying idempotency keys.
+ *
+ * A client which has not got the reply retries the request with the same key and gets the original reply, so the
+ * request is not executed twice. A request is told apart by the login of the user, the key and the identifier of the
+ * command, so a key reused for another command does not get a reply it has not asked for. The replies are kept for
+ * the configured timeout, the oldest ones are forgotten earlier if there is no room for more.
+ */
+class IdempotencyCache
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the cache.
+     *
+     * @param aTimeout    The time (in milliseconds) a reply is kept, 0 if the cache is disabled.
+     * @param aMaxEntries The maximum number of replies kept at once.
+     */
+    IdempotencyCache(
+        unsigned int const aTimeout,
+        std::size_t  const aMaxEntries
+    );
+
+    /**
+     * @brief Begins a request.
+     *
+     * A new request is marked as in progress, it has to be either completed or abandoned then.
+     *
+     * @param aLogin     The login of the user.
+     * @param aKey       The idempotency key.
+     * @param aCommandId The identifier of the command.
+     * @param aReply     The original reply, if the request has been completed.
+     *
+     * @return The state of the request before the call.
+     */
+    IdempotencyState begin(
+        std::string        const & aLogin,
+        std::string        const & aKey,
+        unsigned short int const   aCommandId,
+        std::string              & aReply
+    );
+
+    /**
+     * @brief Completes a request, its reply is replayed to the retries.
+     *
+     * @param aLogin     The login of the user.
+     * @param aKey       The idempotency key.
+     * @param aCommandId The identifier of the command.
+     * @param aReply     The reply.
+     */
+    void complete(
+        std::string        const & aLogin,
+        std::string        const & aKey,
+        unsigned short int const   aCommandId,
+        std::string        const & aReply
+    );
+
+    /**
+     * @brief Abandons a request, its retry is executed again.
+     *
+     * To be called only if the request is known not to have been applied.
+     *
+     * @param aLogin     The login of the user.
+     * @param aKey       The idempotency key.
+     * @param aCommandId The identifier of the command.
+     */
+    void abandon(
+        std::string        const & aLogin,
+        std::string        const & aKey,
+        unsigned short int const   aCommandId
+    );
+
+private:
+    typedef boost::tuple<std::string, std::string, unsigned short int> Key;
+
+    typedef std::list<Key> Order;
+
+    /**
+     * @brief A request.
+     */
+    struct Entry
+    {
+        bool mCompleted;
+
+        std::string mReply;
+
+        Poco::Timestamp mCreated;
+
+        Order::iterator mPosition;
+    };
+
+    typedef std::map<Key, Entry> Entries;
+
+    /**
+     * @brief Removes an entry.
+     *
+     * Expects the mutex to be locked.
+     *
+     * @param aEntry The entry.
+     */
+    void remove(
+        Entries::iterator const aEntry
+    );
+
+    /**
+     * @brief Removes the expired entries and the oldest ones until there is room for another one.
+     *
+     * Expects the mutex to be locked.
+     */
+    void purge();
+
+    Poco::Timestamp::TimeDiff const mTimeout;
+
+    std::size_t const mMaxEntries;
+
+    Poco::Mutex mMutex;
+
+    Entries mEntries;
+
+    /**
+     * @brief The keys of the entries from the oldest to the newest.
+     */
+    Order mOrder;
+};
+
+typedef boost::shared_ptr<IdempotencyCache> IdempotencyCacheShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_IDEMPOTENCYCACHE_HPP
@@ -0,0 +1,82 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_INPROCESSCLIENT_HPP
+#define SERVER_INPROCESSCLIENT_HPP
+
+#include <Language/Interface/ICommand.hpp>
+#include <Server/include/IContext.hpp>
+#include <Server/include/ISubscriber.hpp>
+#include <Server/include/RequestProcessor.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace Server
+{
+
+/**
+ * @brief The client executing the requests within the process embedding the server.
+ *
+ * The requests go straight to the dispatch pipeline, there is no socket, framing or XML in between. The rate limits
+ * and the deadlines apply as to the requests arriving on the sockets, the idempotency keys are not needed.
+ * May be used from many threads at once.
+ */
+class InProcessClient
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the client.
+     *
+     * @param aContext The context of the server.
+     */
+    explicit InProcessClient(
+        IContextShrPtr const aContext
+    );
+
+    /**
+     * @brief Executes a request.
+     *
+     * @param aRequest    The request.
+     * @param aSubscriber The subscriber of the indications, used by the subscription requests only.
+     *
+     * @return The reply.
+     */
+    Language::ICommand::Handle execute(
+        Language::ICommand::Handle const aRequest,
+        ISubscriberShrPtr          const aSubscriber = ISubscriberShrPtr()
+    ) const;
+
+private:
+    RequestProcessor const mRequestProcessor;
+};
+
+typedef boost::shared_ptr<InProcessClient> InProcessClientShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_INPROCESSCLIENT_HPP
@@ -0,0 +1,158 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_LISTENERHANDOFF_HPP
+#define SERVER_LISTENERHANDOFF_HPP
+
+#include <Poco/AtomicCounter.h>
+#include <Poco/Runnable.h>
+#include <Poco/Thread.h>
+#include <boost/noncopyable.hpp>
+#include <string>
+#include <sys/types.h>
+#include <unistd.h>
+#include <vector>
+
+namespace Server
+{
+
+/**
+ * @brief The handoff of the listening sockets to a restarted server over a Unix domain socket.
+ *
+ * The running server offers its listening sockets at a path. A server started afterwards with the same path
+ * connects to it and receives the listening sockets by SCM_RIGHTS, so it accepts connections right away.
+ * The running server requests its own termination then and drains, no connection is refused in between.
+ */
+class ListenerHandoff
+    : private Poco::Runnable,
+      private boost::noncopyable
+{
+public:
+    /**
+     * @brief Takes the listening sockets over from the server offering them at a path.
+     *
+     * Returns once the predecessor has released the path, so it may be offered again.
+     *
+     * @param aPath        The path of the Unix domain socket.
+     * @param aDescriptors The descriptors of the listening sockets.
+     *
+     * @return True if the listening sockets have been taken over, false if nobody offers them.
+     */
+    static bool takeOver(
+        std::string      const & aPath,
+        std::vector<int>       & aDescriptors
+    );
+
+    /**
+     * @brief Constructs the handoff.
+     *
+     * The path is accessible to its owner only, and a successor running as another user is refused.
+     *
+     * @param aPath        The path of the Unix domain socket.
+     * @param aDescriptors The descriptors of the listening sockets, not owned by the handoff.
+     * @param aTrustedUid  The user a successor has to run as, the user of the server by default.
+     *
+     * @throw std::runtime_error If the path could not be bound.
+     */
+    ListenerHandoff(
+        std::string      const & aPath,
+        std::vector<int> const & aDescriptors,
+        uid_t            const   aTrustedUid = ::geteuid()
+    );
+
+    ~ListenerHandoff();
+
+    /**
+     * @brief Starts offering the listening sockets.
+     */
+    void start();
+
+    /**
+     * @brief Stops offering the listening sockets.
+     */
+    void stop();
+
+    /**
+     * @brief Verifies whether the listening sockets have been handed off.
+     *
+     * @return True if a successor has taken the listening sockets over, false otherwise.
+     */
+    bool isHandedOff() const;
+
+private:
+    virtual void run();
+
+    /**
+     * @brief Sends the descriptors of the listening sockets to a successor.
+     *
+     * @param aDescriptor The descriptor of the connection to the successor.
+     *
+     * @return True if the descriptors have been sent, false otherwise.
+     */
+    bool handOff(
+        int const aDescriptor
+    ) const;
+
+    /**
+     * @brief Closes the socket of the handoff and removes its path.
+     */
+    void release();
+
+    /**
+     * @brief Closes the event the offering thread is woken up with.
+     */
+    void closeWakeUp();
+
+    std::string const mPath;
+
+    std::vector<int> const mDescriptors;
+
+    uid_t const mTrustedUid;
+
+    /**
+     * @brief The descriptor of the socket the successors connect to, -1 once released.
+     */
+    int mDescriptor;
+
+    /**
+     * @brief The descriptor of the event the stopping thread wakes the offering thread up with.
+     */
+    int mWakeUpDescriptor;
+
+    /**
+     * @brief Set by the stopping thread, the offering thread is woken up to notice it.
+     */
+    Poco::AtomicCounter mStopRequested;
+
+    bool mHandedOff;
+
+    Poco::Thread mThread;
+};
+
+} // namespace Server
+
+#endif // SERVER_LISTENERHANDOFF_HPP
@@ -0,0 +1,154 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_RATELIMITER_HPP
+#define SERVER_RATELIMITER_HPP
+
+#include <Poco/Mutex.h>
+#include <Poco/Timestamp.h>
+#include <Server/include/CommandClassifier.hpp>
+#include <Server/include/TokenBucket.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief The limit of the rate of requests.
+ */
+struct RateLimit
+{
+    RateLimit(
+        unsigned int const aRate,
+        unsigned int const aBurst
+    )
+        : mRate(aRate),
+          mBurst(aBurst)
+    {
+    }
+
+    /**
+     * @brief The number of requests per second, 0 if unlimited.
+     */
+    unsigned int mRate;
+
+    /**
+     * @brief The number of requests that may be issued at once.
+     */
+    unsigned int mBurst;
+};
+
+/**
+ * @brief The admission of requests by token buckets per login and per command class.
+ *
+ * The logins are the ones verified by the sessions of the requests (see RequestProcessor::identify()), the requests
+ * without a verified login share a single bucket of the login limit, so that nobody is throttled on behalf of a login
+ * claimed by somebody else. The commands of the moderator class are never throttled, the class is granted
+ * to the verified moderators only (see RequestProcessor::classify()).
+ */
+class RateLimiter
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the limiter.
+     *
+     * @param aLoginLimit The limit of a single login.
+     * @param aReadLimit  The limit of the read only commands of all logins.
+     * @param aWriteLimit The limit of the modifying commands of all logins.
+     * @param aMaxLogins  The maximum number of logins tracked at once.
+     */
+    RateLimiter(
+        RateLimit   const aLoginLimit,
+        RateLimit   const aReadLimit,
+        RateLimit   const aWriteLimit,
+        std::size_t const aMaxLogins
+    );
+
+    /**
+     * @brief Admits a request.
+     *
+     * A request is admitted if all buckets it is subject to have a token, a token is taken from each of them then.
+     *
+     * @param aLogin       The login verified for the request, empty if unauthenticated.
+     * @param aClass       The class of the command.
+     * @param aNow         The current time (in microseconds).
+     * @param aRetryAfter  The time (in microseconds) after which the request would be admitted, if throttled.
+     *
+     * @return True if the request has been admitted, false if it has been throttled.
+     */
+    bool admit(
+        std::string              const & aLogin,
+        CommandClass             const   aClass,
+        Poco::Timestamp::TimeVal const   aNow,
+        Poco::Timestamp::TimeDiff      & aRetryAfter
+    );
+
+private:
+    typedef std::map<std::string, TokenBucket> LoginBuckets;
+
+    /**
+     * @brief Gets the bucket of a login, creates it if needed.
+     *
+     * Expects the mutex to be locked.
+     *
+     * @param aLogin The login.
+     * @param aNow   The current time (in microseconds).
+     *
+     * @return The bucket, null if there is no room for another login.
+     */
+    TokenBucket * getLoginBucket(
+        std::string              const & aLogin,
+        Poco::Timestamp::TimeVal const   aNow
+    );
+
+    RateLimit const mLoginLimit;
+
+    std::size_t const mMaxLogins;
+
+    Poco::Mutex mMutex;
+
+    boost::shared_ptr<TokenBucket> mReadBucket;
+
+    boost::shared_ptr<TokenBucket> mWriteBucket;
+
+    /**
+     * @brief The bucket shared by the requests without a verified login.
+     */
+    boost::shared_ptr<TokenBucket> mUnauthenticatedBucket;
+
+    LoginBuckets mLoginBuckets;
+};
+
+typedef boost::shared_ptr<RateLimiter> RateLimiterShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_RATELIMITER_HPP
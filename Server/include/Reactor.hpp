@@ -0,0 +1,370 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_REACTOR_HPP
+#define SERVER_REACTOR_HPP
+
+#include <Poco/AtomicCounter.h>
+#include <Poco/Event.h>
+#include <Poco/Mutex.h>
+#include <Poco/Runnable.h>
+#include <Poco/Thread.h>
+#include <Poco/Timespan.h>
+#include <Server/include/CpuAffinity.hpp>
+#include <Server/include/IContext.hpp>
+#include <Server/include/IReplySink.hpp>
+#include <Server/include/ReactorConnection.hpp>
+#include <Server/include/RequestProcessor.hpp>
+#include <Server/include/RequestQueue.hpp>
+#include <Server/include/SubscriptionRegistry.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <vector>
+
+namespace Server
+{
+
+/**
+ * @brief The event driven front end of the server.
+ *
+ * A single thread multiplexes the listening socket and all connections with epoll, frames and decodes the requests
+ * and pushes them to the request queue. Replies are posted back by the worker pool and written by the reactor.
+ * Idle connections cost a descriptor and a few buffers rather than a thread.
+ *
+ * A draining reactor accepts no more connections and starts no more requests, it closes each connection as soon as
+ * the requests of the connection in progress have been replied to.
+ */
+class Reactor
+    : public IReplySink,
+      private Poco::Runnable
+{
+public:
+    /**
+     * @brief Constructs the reactor.
+     *
+     * @param aContext            The context of the server.
+     * @param aListenerDescriptor The descriptor of the listening socket, not owned by the reactor.
+     * @param aRequestQueue       The queue the decoded requests are pushed to.
+     * @param aListenerId         The identifier of the listener the reactor serves, reported with the statistics.
+     * @param aCpus               The CPUs the reactor thread is pinned to, not pinned if empty.
+     */
+    Reactor(
+        IContextShrPtr         aContext,
+        int            const   aListenerDescriptor,
+        RequestQueue         & aRequestQueue,
+        unsigned int   const   aListenerId,
+        CpuSet         const & aCpus
+    );
+
+    ~Reactor();
+
+    /**
+     * @brief Starts the reactor thread.
+     */
+    void start();
+
+    /**
+     * @brief Stops the reactor thread and closes all connections.
+     */
+    void stop();
+
+    /**
+     * @brief Starts draining, returns immediately.
+     */
+    void drain();
+
+    /**
+     * @brief Waits for the draining reactor to close its last connection.
+     *
+     * @param aTimeout The maximum time (in milliseconds) to wait.
+     *
+     * @return True if the reactor has drained, false if the time is up.
+     */
+    bool waitForDrain(
+        long const aTimeout
+    );
+
+    virtual void postReply(
+        unsigned long long int         aConnectionId,
+        unsigned long long int         aRequestId,
+        std::string            const & aContent,
+        unsigned char                  aFlags = 0
+    );
+
+    virtual bool postPart(
+        unsigned long long int         aConnectionId,
+        unsigned long long int         aRequestId,
+        std::string            const & aContent,
+        unsigned char                  aFlags
+    );
+
+    virtual void postFailure(
+        unsigned long long int aConnectionId
+    );
+
+    /**
+     * @brief Posts an indication to a subscribed connection.
+     *
+     * Called from the threads that publish indications.
+     *
+     * @param aConnectionId The identifier of the connection.
+     * @param aContent      The content of the indication.
+     */
+    void postIndication(
+        unsigned long long int         aConnectionId,
+        std::string            const & aContent
+    );
+
+private:
+    /**
+     * @brief The subscriber of a connection, posts the indications back to the reactor.
+     */
+    class Subscriber;
+
+    /**
+     * @brief The receipt a worker waits on until the part of a streamed reply it has posted has been written out.
+     */
+    struct Receipt
+    {
+        Receipt()
+            : mWritten(false)
+        {
+        }
+
+        Poco::Event mEvent;
+        bool        mWritten;
+    };
+
+    typedef boost::shared_ptr<Receipt> ReceiptShrPtr;
+
+    /**
+     * @brief A reply or an indication posted by another thread, not handed over to the connection yet.
+     */
+    struct Completion
+    {
+        unsigned long long int mConnectionId;
+        unsigned long long int mRequestId;
+        std::string            mContent;
+        unsigned char          mFlags;
+        bool                   mFailed;
+        bool                   mIndication;
+        ReceiptShrPtr          mReceipt;
+    };
+
+    typedef std::map<unsigned long long int, ReactorConnectionShrPtr> Connections;
+
+    typedef std::map<unsigned long long int, boost::shared_ptr<Subscriber> > Subscribers;
+
+    typedef std::multimap<unsigned long long int, ReceiptShrPtr> Receipts;
+
+    /**
+     * @brief The event loop.
+     */
+    virtual void run();
+
+    void acceptConnections();
+
+    /**
+     * @brief Accepts the next connection and closes it at once, with the spare descriptor given up for it.
+     *
+     * Called when the process has run out of descriptors, the peer is refused rather than kept waiting.
+     *
+     * @return True if a connection has been dropped, false otherwise.
+     */
+    bool dropConnection();
+
+    void handleConnectionEvent(
+        unsigned long long int const aConnectionId,
+        unsigned int           const aEvents
+    );
+
+    void handleCompletions();
+
+    /**
+     * @brief Lets the workers waiting for the parts posted to a connection go.
+     *
+     * @param aConnectionId The identifier of the connection.
+     * @param aWritten      Whether the parts have been written out.
+     */
+    void releaseReceipts(
+        unsigned long long int const aConnectionId,
+        bool                   const aWritten
+    );
+
+    /**
+     * @brief Lets all workers still waiting for their parts go, once the loop is over nothing gets written anymore.
+     */
+    void releaseAllReceipts();
+
+    void sweepIdleConnections();
+
+    /**
+     * @brief Pushes the next request of the connection to the queue if possible.
+     *
+     * Requests that do not fit into the queue are answered with the "server busy" status right away.
+     *
+     * @return False if the connection has to be closed, true otherwise.
+     */
+    bool dispatchRequest(
+        ReactorConnection & aConnection
+    );
+
+    /**
+     * @brief Reports the statistics of the listener and of its request queue.
+     */
+    void reportStatistics();
+
+    /**
+     * @brief Sends pending output and adjusts the events the connection is watched for.
+     *
+     * @return False if the connection has to be closed, true otherwise.
+     */
+    bool flush(
+        ReactorConnection & aConnection
+    );
+
+    /**
+     * @brief Stops watching the listening socket and closes the connections with nothing in progress.
+     */
+    void startDraining();
+
+    /**
+     * @brief Verifies whether the connection has served everything it is going to serve.
+     *
+     * @return True if the connection has to be closed, false otherwise.
+     */
+    bool isDone(
+        ReactorConnection const & aConnection
+    ) const;
+
+    void closeConnection(
+        unsigned long long int const aConnectionId
+    );
+
+    /**
+     * @brief Gets the subscriber of a connection, creates it if it does not exist yet.
+     *
+     * The indications are delivered in the codec the connection uses at the latest subscription.
+     */
+    ISubscriberShrPtr getSubscriber(
+        unsigned long long int const aConnectionId,
+        Codec                  const aCodec
+    );
+
+    /**
+     * @brief Drops the subscriber of a connection, the indications posted afterwards are discarded.
+     */
+    void dropSubscriber(
+        unsigned long long int const aConnectionId
+    );
+
+    /**
+     * @brief Closes all connections.
+     */
+    void closeConnections();
+
+    void wakeUp();
+
+    RequestProcessor mRequestProcessor;
+
+    int const mListenerDescriptor;
+
+    RequestQueue & mRequestQueue;
+
+    BufferPoolShrPtr mBufferPool;
+
+    ArenaPoolShrPtr mArenaPool;
+
+    SubscriptionRegistryShrPtr mSubscriptionRegistry;
+
+    unsigned int const mMaxRequests;
+
+    std::size_t const mMaxPayload;
+
+    unsigned int const mMaxInFlight;
+
+    Poco::Timespan const mIdleTimeout;
+
+    Poco::Timespan const mReportInterval;
+
+    unsigned int const mListenerId;
+
+    CpuSet const mCpus;
+
+    /**
+     * @brief The number of connections accepted so far.
+     */
+    unsigned long long int mAccepted;
+
+    int mEpollDescriptor;
+
+    /**
+     * @brief The eventfd used to wake the event loop up.
+     */
+    int mWakeUpDescriptor;
+
+    /**
+     * @brief The descriptor held in reserve to accept and drop a connection once the descriptors have run out.
+     */
+    int mSpareDescriptor;
+
+    Connections mConnections;
+
+    /**
+     * @brief The subscribers of the connections that have ever asked for a subscription.
+     */
+    Subscribers mSubscribers;
+
+    unsigned long long int mNextConnectionId;
+
+    Poco::Mutex mCompletionsMutex;
+
+    std::vector<Completion> mCompletions;
+
+    /**
+     * @brief The receipts of the parts handed over to the connections, released once their output has been written.
+     */
+    Receipts mReceipts;
+
+    /**
+     * @brief Set by the stopping thread, the loop is woken up to notice it.
+     */
+    Poco::AtomicCounter mStopRequested;
+
+    /**
+     * @brief Set by the draining thread, the loop is woken up to notice it.
+     */
+    Poco::AtomicCounter mDrainRequested;
+
+    bool mDraining;
+
+    Poco::Thread mThread;
+};
+
+} // namespace Server
+
+#endif // SERVER_REACTOR_HPP
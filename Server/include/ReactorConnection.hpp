@@ -0,0 +1,254 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_REACTORCONNECTION_HPP
+#define SERVER_REACTORCONNECTION_HPP
+
+#include <Poco/Timespan.h>
+#include <Poco/Timestamp.h>
+#include <Server/include/Codec.hpp>
+#include <Server/include/FrameReader.hpp>
+#include <Server/include/FrameWriter.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief The state of a single non-blocking connection handled by the reactor.
+ *
+ * The connection accumulates incoming bytes until a complete frame is available, hands the request over
+ * and holds the reply until the socket is writable. Requests of a text framed connection are served one by one,
+ * requests of a binary framed connection may be in progress concurrently, up to a limit.
+ */
+class ReactorConnection
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the connection.
+     *
+     * @param aDescriptor  The descriptor of the non-blocking socket, owned by the connection since now.
+     * @param aId          The identifier of the connection.
+     * @param aBufferPool  The pool of buffers.
+     * @param aMaxPayload  The maximum length of a request.
+     * @param aMaxInFlight The maximum number of requests of a binary framed connection in progress concurrently.
+     */
+    ReactorConnection(
+        int                    const aDescriptor,
+        unsigned long long int const aId,
+        BufferPoolShrPtr             aBufferPool,
+        std::size_t            const aMaxPayload,
+        unsigned int           const aMaxInFlight
+    );
+
+    ~ReactorConnection();
+
+    int getDescriptor() const;
+
+    unsigned long long int getId() const;
+
+    /**
+     * @brief Gets the codec of the requests, negotiated by the client.
+     *
+     * @return The codec.
+     */
+    Codec getCodec() const;
+
+    /**
+     * @brief Sets the codec of the requests following the handshake.
+     *
+     * @param aCodec The codec.
+     */
+    void setCodec(
+        Codec const aCodec
+    );
+
+    /**
+     * @brief Gets the number of requests accepted so far.
+     *
+     * @return The number of requests accepted.
+     */
+    unsigned int getAccepted() const;
+
+    /**
+     * @brief Verifies whether any request of the connection is in progress.
+     *
+     * @return True if a request is in progress, false otherwise.
+     */
+    bool isBusy() const;
+
+    /**
+     * @brief Verifies whether the connection takes more input.
+     *
+     * Input is not taken while the limit of requests in progress is reached or the received requests fill the buffer,
+     * the socket should not be watched for input then.
+     *
+     * @return True if more input is taken, false otherwise.
+     */
+    bool isReceiving() const;
+
+    /**
+     * @brief Reads what is available on the socket, as long as the connection takes input and up to a limit.
+     *
+     * @return False if an error occurred, true otherwise.
+     */
+    bool receive();
+
+    /**
+     * @brief Verifies whether the peer has shut down its sending side.
+     *
+     * @return True if no more requests will arrive, false otherwise.
+     */
+    bool isPeerClosed() const;
+
+    /**
+     * @brief Verifies whether the connection can be closed.
+     *
+     * @return True if the peer has shut down its sending side and everything it has sent has been replied to.
+     */
+    bool isFinished() const;
+
+    /**
+     * @brief Extracts the next complete request if the limit of requests in progress allows it.
+     *
+     * The content stays valid until acceptRequest() is called.
+     *
+     * @param aContent   The content of the request.
+     * @param aLength    The length of the content of the request.
+     * @param aRequestId The identifier of the request, 0 for the text framing.
+     * @param aFlags     The flags of the frame of the request, 0 for the text framing.
+     *
+     * @return True if a request has been extracted, false otherwise.
+     */
+    bool extractRequest(
+        char                   const * & aContent,
+        std::size_t                    &   aLength,
+        unsigned long long int         &   aRequestId,
+        unsigned char                  &   aFlags
+    );
+
+    /**
+     * @brief Drops the extracted request from the input and marks it as being in progress.
+     */
+    void acceptRequest();
+
+    /**
+     * @brief Verifies whether the incoming data violates the framing.
+     *
+     * @return True if the framing has been violated, false otherwise.
+     */
+    bool isMalformed() const;
+
+    /**
+     * @brief Queues the reply to a request in progress.
+     *
+     * The request stays in progress if the reply is a part of a streamed reply other than the last one.
+     *
+     * @param aRequestId The identifier of the request.
+     * @param aContent   The content of the reply, taken over by the connection and empty after the call.
+     * @param aFlags     The flags of the frame of the reply.
+     */
+    void queueReply(
+        unsigned long long int const   aRequestId,
+        std::string                  & aContent,
+        unsigned char          const   aFlags = 0
+    );
+
+    /**
+     * @brief Queues an indication pushed by the server.
+     *
+     * @param aContent The content of the indication, taken over by the connection and empty after the call.
+     */
+    void queueIndication(
+        std::string & aContent
+    );
+
+    /**
+     * @brief Writes as much of the queued output as the socket accepts.
+     *
+     * @return False if an error occurred, true otherwise.
+     */
+    bool send();
+
+    /**
+     * @brief Verifies whether there is output waiting for the socket to become writable.
+     *
+     * @return True if there is pending output, false otherwise.
+     */
+    bool hasPendingOutput() const;
+
+    /**
+     * @brief Verifies whether the connection has been idle for a given time.
+     *
+     * @param aIdleTimeout The idle timeout.
+     *
+     * @return True if the connection has nothing in progress and has been idle longer than the timeout.
+     */
+    bool isIdle(
+        Poco::Timespan const & aIdleTimeout
+    ) const;
+
+private:
+    /**
+     * @brief Verifies whether the limit of requests in progress is reached.
+     *
+     * @return True if no more requests may be started, false otherwise.
+     */
+    bool isSaturated() const;
+
+    int const mDescriptor;
+
+    unsigned long long int const mId;
+
+    FrameReader mFrameReader;
+
+    FrameWriter mFrameWriter;
+
+    bool mPeerClosed;
+
+    Codec mCodec;
+
+    unsigned int const mMaxInFlight;
+
+    /**
+     * @brief The number of requests of the connection being executed.
+     */
+    unsigned int mInFlight;
+
+    unsigned int mAccepted;
+
+    Poco::Timestamp mLastActivity;
+};
+
+typedef boost::shared_ptr<ReactorConnection> ReactorConnectionShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_REACTORCONNECTION_HPP
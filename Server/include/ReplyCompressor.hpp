@@ -0,0 +1,93 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_REPLYCOMPRESSOR_HPP
+#define SERVER_REPLYCOMPRESSOR_HPP
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <cstddef>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief The compressor of the content of large replies.
+ *
+ * The content is deflated by zlib. Short replies, which would not pay off the CPU spent, are left raw.
+ */
+class ReplyCompressor
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the compressor.
+     *
+     * @param aThreshold The minimum length of the content worth compressing, 0 if nothing is compressed.
+     * @param aLevel     The zlib compression level.
+     */
+    ReplyCompressor(
+        std::size_t const aThreshold,
+        int         const aLevel
+    );
+
+    /**
+     * @brief Compresses the content in place if it is worth it.
+     *
+     * The content is left untouched if it is shorter than the threshold or if it would not shrink.
+     *
+     * @param aContent The content.
+     *
+     * @return True if the content has been compressed, false otherwise.
+     */
+    bool compress(
+        std::string & aContent
+    ) const;
+
+    /**
+     * @brief Decompresses the content in place.
+     *
+     * @param aContent The compressed content.
+     *
+     * @return True if the content has been decompressed, false if it is corrupted.
+     */
+    bool decompress(
+        std::string & aContent
+    ) const;
+
+private:
+    std::size_t const mThreshold;
+
+    int const mLevel;
+};
+
+typedef boost::shared_ptr<ReplyCompressor> ReplyCompressorShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_REPLYCOMPRESSOR_HPP
@@ -0,0 +1,99 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_REPLYSTREAM_HPP
+#define SERVER_REPLYSTREAM_HPP
+
+#include <Server/include/Codec.hpp>
+#include <Server/include/IReplyStream.hpp>
+#include <boost/function.hpp>
+#include <string>
+
+namespace Server
+{
+
+class RequestProcessor;
+
+/**
+ * @brief The stream a listing is replied to through in parts, each encoded, compressed and framed on its own.
+ */
+class ReplyStream
+    : public IReplyStream
+{
+public:
+    /**
+     * @brief The writer of the content of a part to the connection.
+     *
+     * Gets the content and the flags of the frame, returns false if the connection is no longer usable.
+     */
+    typedef boost::function<bool (std::string const &, unsigned char)> Writer;
+
+    /**
+     * @brief Constructs the stream.
+     *
+     * @param aRequestProcessor The request processor the parts are encoded and compressed by.
+     * @param aCodec            The codec of the reply.
+     * @param aRequestFlags     The flags of the frame of the request.
+     * @param aPartSize         The number of rows fetched for a part.
+     * @param aWriter           The writer of the parts.
+     */
+    ReplyStream(
+        RequestProcessor const & aRequestProcessor,
+        Codec            const   aCodec,
+        unsigned char    const   aRequestFlags,
+        unsigned int     const   aPartSize,
+        Writer           const & aWriter
+    );
+
+    virtual unsigned int getPartSize() const;
+
+    /**
+     * @brief Writes a part of the reply out ahead of the rest, in a frame carrying the continued flag.
+     *
+     * @param aPart The part.
+     *
+     * @throw std::runtime_error If the connection is no longer usable.
+     */
+    virtual void write(
+        Language::ICommand::Handle const aPart
+    );
+
+private:
+    RequestProcessor const & mRequestProcessor;
+
+    Codec const mCodec;
+
+    unsigned char const mRequestFlags;
+
+    unsigned int const mPartSize;
+
+    Writer const mWriter;
+};
+
+} // namespace Server
+
+#endif // SERVER_REPLYSTREAM_HPP
@@ -0,0 +1,340 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_REQUESTPROCESSOR_HPP
+#define SERVER_REQUESTPROCESSOR_HPP
+
+#include <Game/GameServer/Common/IAsyncExecutor.hpp>
+#include <Game/GameServer/User/IUser.hpp>
+#include <Language/Interface/ICommand.hpp>
+#include <Poco/Timestamp.h>
+#include <Protocol/Xml/Cpp/Payload.hpp>
+#include <Server/include/Codec.hpp>
+#include <Server/include/CommandClassifier.hpp>
+#include <Server/include/IContext.hpp>
+#include <Server/include/IReplyStream.hpp>
+#include <Server/include/ISubscriber.hpp>
+#include <Server/include/ReplyStream.hpp>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief The request processor.
+ *
+ * Runs the decode, dispatch, execute and encode pipeline for a single request.
+ * Shared by all front ends of the server.
+ */
+class RequestProcessor
+{
+public:
+    RequestProcessor(
+        IContextShrPtr aContext
+    );
+
+    /**
+     * @brief Processes a request, the request and its reply allocated from an arena of the pool.
+     *
+     * @param aPayloadRequest The payload of the request.
+     * @param aSubscriber     The subscriber of the connection the request has arrived on, null if not available.
+     *
+     * @return The payload of the reply.
+     */
+    Protocol::Payload process(
+        Protocol::Payload const & aPayloadRequest,
+        ISubscriberShrPtr const   aSubscriber = ISubscriberShrPtr()
+    ) const;
+
+    /**
+     * @brief Decodes a request.
+     *
+     * The deadline of the request is set from the sooner of the timeout requested by the client and the one configured
+     * for the command, so the time spent in the queue counts against it.
+     *
+     * @param aPayloadRequest The payload of the request.
+     * @param aCodec          The codec of the connection the request has arrived on.
+     *
+     * @return The request.
+     *
+     * @throw std::exception If the payload is not a valid request.
+     */
+    Language::ICommand::Handle decode(
+        Protocol::Payload const & aPayloadRequest,
+        Codec             const   aCodec = CODEC_XML
+    ) const;
+
+    /**
+     * @brief Sets the deadline of a request from the sooner of its timeout and the one configured for the command.
+     *
+     * @param aCommandRequest The request.
+     */
+    void setDeadline(
+        Language::ICommand::Handle const aCommandRequest
+    ) const;
+
+    /**
+     * @brief Classifies a decoded request for its admission and scheduling.
+     *
+     * A moderator command is of the moderator class only if it carries the session of a moderator, it is treated
+     * as a modifying command otherwise. The executor authorizes the user either way.
+     *
+     * @param aCommandRequest The request.
+     *
+     * @return The class of the request.
+     */
+    CommandClass classify(
+        Language::ICommand::Handle const aCommandRequest
+    ) const;
+
+    /**
+     * @brief Identifies the sender of a decoded request for its admission and scheduling.
+     *
+     * The login claimed by a request is not trusted before the request is authenticated, only a session tells
+     * who the sender is up front.
+     *
+     * @param aCommandRequest The request.
+     *
+     * @return The login verified by the session of the request, empty if the request carries none.
+     */
+    std::string identify(
+        Language::ICommand::Handle const aCommandRequest
+    ) const;
+
+    /**
+     * @brief Admits a decoded request by the rate limits of the server.
+     *
+     * @param aCommandRequest The request.
+     * @param aRetryAfter     The time (in microseconds) after which the request would be admitted, if throttled.
+     *
+     * @return True if the request has been admitted, false if it has been throttled.
+     */
+    bool admit(
+        Language::ICommand::Handle const   aCommandRequest,
+        Poco::Timestamp::TimeDiff        & aRetryAfter
+    ) const;
+
+    /**
+     * @brief Admits a decoded request of a class and a sender already verified by classify() and identify().
+     *
+     * @param aClass      The class of the request.
+     * @param aIdentity   The login verified for the request, empty if unauthenticated.
+     * @param aRetryAfter The time (in microseconds) after which the request would be admitted, if throttled.
+     *
+     * @return True if the request has been admitted, false if it has been throttled.
+     */
+    bool admit(
+        CommandClass              const   aClass,
+        std::string               const & aIdentity,
+        Poco::Timestamp::TimeDiff       & aRetryAfter
+    ) const;
+
+    /**
+     * @brief Executes a decoded request.
+     *
+     * A request whose deadline has passed while queued is replied to with the "timed out" status without executing it.
+     * A modifying request carrying an idempotency key is executed once, its retries by the same user get the original
+     * reply, encoded with the codec of the retry.
+     *
+     * A listing may be replied to in parts through the reply stream, the payload returned is the last part then.
+     * The reply to a request carrying an idempotency key is never streamed.
+     *
+     * @param aCommandRequest The request.
+     * @param aSubscriber     The subscriber of the connection the request has arrived on, null if not available.
+     * @param aCodec          The codec of the reply.
+     * @param aReplyStream    The stream of the reply, null if the reply is not to be streamed.
+     *
+     * @return The payload of the reply.
+     */
+    Protocol::Payload execute(
+        Language::ICommand::Handle const aCommandRequest,
+        ISubscriberShrPtr          const aSubscriber = ISubscriberShrPtr(),
+        Codec                      const aCodec = CODEC_XML,
+        IReplyStreamShrPtr         const aReplyStream = IReplyStreamShrPtr()
+    ) const;
+
+    /**
+     * @brief Executes a request unless its deadline has passed, with no payload to encode.
+     *
+     * The idempotency key of the request is not honoured.
+     *
+     * @param aCommandRequest The request.
+     * @param aSubscriber     The subscriber of the connection the request has arrived on, null if not available.
+     * @param aReplyStream    The stream of the reply, null if the reply is not to be streamed.
+     *
+     * @return The reply, the last part of it if it has been streamed.
+     */
+    Language::ICommand::Handle executeCommand(
+        Language::ICommand::Handle const aCommandRequest,
+        ISubscriberShrPtr          const aSubscriber = ISubscriberShrPtr(),
+        IReplyStreamShrPtr         const aReplyStream = IReplyStreamShrPtr()
+    ) const;
+
+    /**
+     * @brief Opens the stream a listing is replied to through in parts, if the request allows it.
+     *
+     * @param aRequestFlags The flags of the frame of the request.
+     * @param aCodec        The codec of the reply.
+     * @param aWriter       The writer of the parts.
+     *
+     * @return The stream, null if the request does not accept a streamed reply or the streaming is disabled.
+     */
+    IReplyStreamShrPtr openReplyStream(
+        unsigned char       const   aRequestFlags,
+        Codec               const   aCodec,
+        ReplyStream::Writer const & aWriter
+    ) const;
+
+    /**
+     * @brief Starts a decoded request on its asynchronous executor.
+     *
+     * Returns at once, the executor does not hold the calling thread while waiting for the database.
+     * A request carrying an idempotency key or one whose deadline has passed is left to execute().
+     *
+     * @param aCommandRequest The request.
+     * @param aCompletion     The receiver of the reply, called from the thread of the query runner.
+     *
+     * @return True if the request has been started, false if it has no asynchronous executor.
+     */
+    bool startAsync(
+        Language::ICommand::Handle       const   aCommandRequest,
+        Game::IAsyncExecutor::Completion const & aCompletion
+    ) const;
+
+    /**
+     * @brief Turns a decoded request away without executing it.
+     *
+     * @param aCommandRequest The request.
+     * @param aStatus         The status of the reply.
+     * @param aCodec          The codec of the reply.
+     *
+     * @return The payload of the reply.
+     */
+    Protocol::Payload reject(
+        Language::ICommand::Handle const aCommandRequest,
+        unsigned short int         const aStatus,
+        Codec                      const aCodec = CODEC_XML
+    ) const;
+
+    /**
+     * @brief Turns a throttled request away without executing it, with no payload to encode.
+     *
+     * @param aCommandRequest The request.
+     * @param aRetryAfter     The time (in microseconds) after which the request would be admitted.
+     *
+     * @return The reply, carrying the hint in its message.
+     */
+    Language::ICommand::Handle throttle(
+        Language::ICommand::Handle const aCommandRequest,
+        Poco::Timestamp::TimeDiff  const aRetryAfter
+    ) const;
+
+    /**
+     * @brief Turns a throttled request away without executing it.
+     *
+     * @param aCommandRequest The request.
+     * @param aRetryAfter     The time (in microseconds) after which the request would be admitted.
+     * @param aCodec          The codec of the reply.
+     *
+     * @return The payload of the reply, carrying the hint in its message.
+     */
+    Protocol::Payload throttle(
+        Language::ICommand::Handle const aCommandRequest,
+        Poco::Timestamp::TimeDiff  const aRetryAfter,
+        Codec                      const aCodec
+    ) const;
+
+    /**
+     * @brief Compresses the content of a reply if the request allows it and the reply is large enough.
+     *
+     * @param aRequestFlags The flags of the frame of the request.
+     * @param aContent      The content of the reply, compressed in place.
+     *
+     * @return The flags of the frame of the reply.
+     */
+    unsigned char compress(
+        unsigned char const   aRequestFlags,
+        std::string         & aContent
+    ) const;
+
+    /**
+     * @brief Encodes a reply.
+     *
+     * @param aCommandReply The reply.
+     * @param aCodec        The codec of the reply.
+     *
+     * @return The payload of the reply.
+     */
+    Protocol::Payload encode(
+        Language::ICommand::Handle const aCommandReply,
+        Codec                      const aCodec = CODEC_XML
+    ) const;
+
+private:
+    /**
+     * @brief Resolves the session carried by a request.
+     *
+     * @param aCommandRequest The request.
+     *
+     * @return The user of the session, null if the request carries no valid session of the login it claims.
+     */
+    GameServer::User::IUserShrPtr resolveSession(
+        Language::ICommand::Handle const aCommandRequest
+    ) const;
+
+    /**
+     * @brief Verifies whether a request has been sent by the user it claims to be sent by.
+     *
+     * @param aCommandRequest The request.
+     *
+     * @return True if the request has been sent by its user or by nobody in particular, false otherwise.
+     */
+    bool authenticate(
+        Language::ICommand::Handle const aCommandRequest
+    ) const;
+
+    /**
+     * @brief Encodes a reply kept by the idempotency cache for a retry.
+     *
+     * @param aReply The reply in the binary format.
+     * @param aCodec The codec of the retry.
+     *
+     * @return The payload of the reply.
+     */
+    Protocol::Payload replay(
+        std::string const & aReply,
+        Codec       const   aCodec
+    ) const;
+
+    IContextShrPtr mContext;
+
+    CommandClassifier mCommandClassifier;
+};
+
+} // namespace Server
+
+#endif // SERVER_REQUESTPROCESSOR_HPP
@@ -0,0 +1,291 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_REQUESTQUEUE_HPP
+#define SERVER_REQUESTQUEUE_HPP
+
+#include <Language/Interface/Arena.hpp>
+#include <Language/Interface/ICommand.hpp>
+#include <Poco/Condition.h>
+#include <Poco/Mutex.h>
+#include <Poco/Timestamp.h>
+#include <Server/include/Codec.hpp>
+#include <Server/include/CommandClassifier.hpp>
+#include <Server/include/IReplySink.hpp>
+#include <Server/include/ISubscriber.hpp>
+#include <boost/noncopyable.hpp>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Server
+{
+
+/**
+ * @brief A decoded request waiting for a worker.
+ */
+struct QueuedRequest
+{
+    /**
+     * @brief The receiver of the reply.
+     */
+    IReplySink * mReplySink;
+
+    /**
+     * @brief The identifier of the listener the request came through.
+     */
+    unsigned int mListenerId;
+
+    /**
+     * @brief The identifier of the connection the request came from.
+     */
+    unsigned long long int mConnectionId;
+
+    /**
+     * @brief The identifier of the request within the connection, 0 for the text framing.
+     */
+    unsigned long long int mRequestId;
+
+    /**
+     * @brief The flags of the frame of the request, 0 for the text framing.
+     */
+    unsigned char mFlags;
+
+    /**
+     * @brief The codec of the connection at the time the request has arrived, the reply is encoded with it.
+     */
+    Codec mCodec;
+
+    /**
+     * @brief The arena of the request, declared before the objects allocated from it so that it outlives them.
+     */
+    Language::ArenaShrPtr mArena;
+
+    /**
+     * @brief The request.
+     */
+    Language::ICommand::Handle mCommand;
+
+    /**
+     * @brief The class of the request as verified at its admission, it decides the lane the request takes.
+     */
+    CommandClass mClass;
+
+    /**
+     * @brief The login verified at the admission of the request, empty if unauthenticated, it decides the flow
+     *        the request takes.
+     */
+    std::string mIdentity;
+
+    /**
+     * @brief The subscriber of the connection, set for the subscription requests only.
+     */
+    ISubscriberShrPtr mSubscriber;
+
+    /**
+     * @brief The moment the request has been queued.
+     */
+    Poco::Timestamp mQueued;
+};
+
+/**
+ * @brief What to do with a request that does not fit into the queue.
+ */
+enum OverloadPolicy
+{
+    /**
+     * @brief Turn the incoming request away.
+     */
+    OVERLOAD_POLICY_REJECT,
+
+    /**
+     * @brief Turn the oldest queued read only request of the busiest user away instead.
+     *
+     * Falls back to rejecting if there is none.
+     */
+    OVERLOAD_POLICY_SHED_OLDEST_READ
+};
+
+/**
+ * @brief The statistics of the request queue gathered since the previous collection.
+ */
+struct RequestQueueStatistics
+{
+    std::size_t mDepth;
+    std::size_t mPeakDepth;
+
+    unsigned long long int mQueued;
+    unsigned long long int mRejected;
+    unsigned long long int mShed;
+    unsigned long long int mPopped;
+
+    std::size_t mPriorityDepth;
+
+    Poco::Timestamp::TimeDiff mTotalWait;
+    Poco::Timestamp::TimeDiff mMaxWait;
+};
+
+/**
+ * @brief The bounded queue of requests shared by the front end and the worker pool.
+ *
+ * Requests are queued per login and the logins are served round-robin, so a flood of requests of a single user
+ * delays the requests of that user only. The requests of a single login are served in order. The login is the one
+ * verified at the admission, the unauthenticated requests share a single flow, so that made up logins do not buy
+ * a larger share of the workers.
+ *
+ * The requests of the moderator class take a separate lane of its own capacity, served ahead of all other requests
+ * and never shed, so the world keeps ticking on schedule while the queue is saturated. The class is taken from the
+ * request as it has been verified at its admission, the queue does not classify the requests by itself.
+ */
+class RequestQueue
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the queue.
+     *
+     * @param aCapacity         The maximum number of queued requests, the moderator requests aside.
+     * @param aPriorityCapacity The maximum number of queued moderator requests.
+     * @param aOverloadPolicy   What to do with a request that does not fit into the queue.
+     */
+    RequestQueue(
+        std::size_t    const aCapacity,
+        std::size_t    const aPriorityCapacity,
+        OverloadPolicy const aOverloadPolicy
+    );
+
+    /**
+     * @brief Pushes a request to the queue.
+     *
+     * @param aRequest      The request.
+     * @param aShedRequests Queued requests that have been turned away to make room for the request.
+     *
+     * @return True if the request has been queued, false if it has been rejected.
+     */
+    bool push(
+        QueuedRequest              const & aRequest,
+        std::vector<QueuedRequest>       & aShedRequests
+    );
+
+    /**
+     * @brief Pops a request from the queue, blocks until one is available.
+     *
+     * @param aRequest      The popped request.
+     * @param aPriorityOnly Whether to pop the moderator requests only, as the reserved workers do.
+     *
+     * @return True if a request has been popped, false if the queue has been closed.
+     */
+    bool pop(
+        QueuedRequest       & aRequest,
+        bool          const   aPriorityOnly = false
+    );
+
+    /**
+     * @brief Closes the queue and wakes up all waiting workers.
+     */
+    void close();
+
+    /**
+     * @brief Collects the statistics and starts gathering them anew.
+     *
+     * @return The statistics gathered since the previous collection.
+     */
+    RequestQueueStatistics collectStatistics();
+
+private:
+    /**
+     * @brief Pops the request of the login next in line.
+     *
+     * Expects the mutex to be locked and a request to be queued.
+     *
+     * @param aRequest The popped request.
+     */
+    void popFlow(
+        QueuedRequest & aRequest
+    );
+
+    /**
+     * @brief Removes the oldest queued read only request of the login with the most requests queued.
+     *
+     * @param aShedRequests The removed request, if any.
+     *
+     * @return True if a request has been removed, false otherwise.
+     */
+    bool shedOldestRead(
+        std::vector<QueuedRequest> & aShedRequests
+    );
+
+    void resetStatistics();
+
+    std::size_t const mCapacity;
+
+    std::size_t const mPriorityCapacity;
+
+    OverloadPolicy const mOverloadPolicy;
+
+    Poco::Mutex mMutex;
+
+    Poco::Condition mCondition;
+
+    /**
+     * @brief Signalled on the moderator requests only, waited for by the reserved workers.
+     */
+    Poco::Condition mPriorityCondition;
+
+    /**
+     * @brief The queued moderator requests.
+     */
+    std::deque<QueuedRequest> mPriorityRequests;
+
+    typedef std::deque<QueuedRequest> Flow;
+
+    typedef std::map<std::string, Flow> Flows;
+
+    /**
+     * @brief The queued requests, per login.
+     */
+    Flows mFlows;
+
+    /**
+     * @brief The logins having requests queued, in the order they are going to be served.
+     */
+    std::deque<std::string> mRoundRobin;
+
+    /**
+     * @brief The number of queued requests.
+     */
+    std::size_t mSize;
+
+    bool mClosed;
+
+    RequestQueueStatistics mStatistics;
+};
+
+} // namespace Server
+
+#endif // SERVER_REQUESTQUEUE_HPP
@@ -28,9 +28,13 @@
 #ifndef SERVER_SERVER_HPP
 #define SERVER_SERVER_HPP
 
+#include <Poco/Net/ServerSocket.h>
+#include <Poco/Net/SocketAddress.h>
 #include <Poco/Net/TCPServer.h>
 #include <Poco/Util/ServerApplication.h>
 #include <Server/include/IContext.hpp>
+#include <Server/include/Reactor.hpp>
+#include <boost/shared_ptr.hpp>
 #include <memory>
 #include <string>
 #include <vector>
@@ -51,6 +55,51 @@ private:
 
     void startServer();
 
+    /**
+     * @brief Serves the clients with a pooled thread per connection until the termination is requested.
+     *
+     * @param aSocket The listening socket.
+     */
+    void runThreadedFrontEnd(
+        Poco::Net::ServerSocket const & aSocket
+    );
+
+    /**
+     * @brief Serves the clients with the epoll reactors and the worker pools until the termination is requested.
+     *
+     * Each listener has its own socket bound to the address, reactor, request queue and worker pool. The Unix domain
+     * socket, if configured, is served as another listener.
+     *
+     * @param aAddress The address to listen on.
+     */
+    void runReactorFrontEnd(
+        Poco::Net::SocketAddress const & aAddress
+    );
+
+    /**
+     * @brief Opens the listening sockets sharing the address.
+     *
+     * @param aAddress           The address to listen on.
+     * @param aNumberOfListeners The number of listening sockets.
+     *
+     * @return The descriptors of the listening sockets, owned by the caller.
+     */
+    std::vector<int> openListeners(
+        Poco::Net::SocketAddress const & aAddress,
+        unsigned int             const   aNumberOfListeners
+    ) const;
+
+    /**
+     * @brief Drains the reactors, waits for them no longer than the timeout.
+     *
+     * @param aReactors The reactors.
+     * @param aTimeout  The time (in milliseconds) the reactors are given to drain.
+     */
+    void drainReactors(
+        std::vector<boost::shared_ptr<Reactor> > const & aReactors,
+        unsigned int                             const   aTimeout
+    ) const;
+
     std::auto_ptr<Poco::Net::TCPServer> mServer;
 
     bool mServerStarted;
@@ -0,0 +1,129 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_SESSIONMANAGER_HPP
+#define SERVER_SESSIONMANAGER_HPP
+
+#include <Game/GameServer/User/IUser.hpp>
+#include <Poco/Mutex.h>
+#include <Poco/Timestamp.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief The manager of the sessions of the authenticated users.
+ *
+ * A session binds an opaque token to the acting user, so requests carrying the token skip the authentication.
+ * The session expires once it has not been used for the configured timeout.
+ */
+class SessionManager
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the manager.
+     *
+     * @param aTimeout     The time (in milliseconds) a session may stay unused.
+     * @param aMaxSessions The maximum number of sessions kept at once.
+     */
+    SessionManager(
+        unsigned int const aTimeout,
+        std::size_t  const aMaxSessions
+    );
+
+    /**
+     * @brief Opens a session.
+     *
+     * @param aUser The authenticated user.
+     *
+     * @return The session token, an empty string if no more sessions can be kept.
+     */
+    std::string open(
+        GameServer::User::IUserShrPtr const aUser
+    );
+
+    /**
+     * @brief Resolves a session token to the user, prolonging the session.
+     *
+     * @param aToken The session token.
+     * @param aLogin The login the token is presented with.
+     *
+     * @return The user, null if the session does not exist, has expired or belongs to another login.
+     */
+    GameServer::User::IUserShrPtr resolve(
+        std::string const & aToken,
+        std::string const & aLogin
+    );
+
+    /**
+     * @brief Closes a session.
+     *
+     * @param aToken The session token.
+     */
+    void close(
+        std::string const & aToken
+    );
+
+private:
+    /**
+     * @brief A session.
+     */
+    struct Session
+    {
+        GameServer::User::IUserShrPtr mUser;
+
+        Poco::Timestamp mLastUsed;
+    };
+
+    typedef std::map<std::string, Session> Sessions;
+
+    /**
+     * @brief Removes the expired sessions.
+     *
+     * Expects the mutex to be locked.
+     */
+    void purge();
+
+    Poco::Timestamp::TimeDiff const mTimeout;
+
+    std::size_t const mMaxSessions;
+
+    Poco::Mutex mMutex;
+
+    Sessions mSessions;
+};
+
+typedef boost::shared_ptr<SessionManager> SessionManagerShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_SESSIONMANAGER_HPP
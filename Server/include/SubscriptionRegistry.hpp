@@ -0,0 +1,109 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_SUBSCRIPTIONREGISTRY_HPP
+#define SERVER_SUBSCRIPTIONREGISTRY_HPP
+
+#include <Language/Interface/ICommand.hpp>
+#include <Poco/Mutex.h>
+#include <Server/include/ISubscriber.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <set>
+#include <string>
+
+namespace Server
+{
+
+/**
+ * @brief The registry of the connections subscribed to the indications of the worlds.
+ *
+ * An indication is encoded once per codec and the same content is handed over to every subscriber of its world using
+ * that codec.
+ */
+class SubscriptionRegistry
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Subscribes to the indications of a world.
+     *
+     * @param aWorldName  The name of the world.
+     * @param aSubscriber The subscriber.
+     */
+    void subscribe(
+        std::string       const & aWorldName,
+        ISubscriberShrPtr const   aSubscriber
+    );
+
+    /**
+     * @brief Unsubscribes from the indications of all worlds.
+     *
+     * @param aSubscriber The subscriber.
+     */
+    void unsubscribe(
+        ISubscriberShrPtr const aSubscriber
+    );
+
+    /**
+     * @brief Verifies whether a subscriber is subscribed to any world.
+     *
+     * @param aSubscriber The subscriber.
+     *
+     * @return True if the subscriber is subscribed, false otherwise.
+     */
+    bool isSubscribed(
+        ISubscriberShrPtr const aSubscriber
+    ) const;
+
+    /**
+     * @brief Publishes indications to the subscribers of their worlds.
+     *
+     * Subscribers are notified outside of the lock, subscribers that have gone away are dropped.
+     *
+     * @param aIndications The indications, each carrying the "world_name" parameter.
+     */
+    void publish(
+        Language::ICommand::Commands const & aIndications
+    );
+
+private:
+    typedef std::set<ISubscriberShrPtr> Subscribers;
+
+    typedef std::map<std::string, Subscribers> Worlds;
+
+    mutable Poco::Mutex mMutex;
+
+    Worlds mWorlds;
+};
+
+typedef boost::shared_ptr<SubscriptionRegistry> SubscriptionRegistryShrPtr;
+
+} // namespace Server
+
+#endif // SERVER_SUBSCRIPTIONREGISTRY_HPP
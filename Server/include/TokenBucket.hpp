@@ -0,0 +1,103 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_TOKENBUCKET_HPP
+#define SERVER_TOKENBUCKET_HPP
+
+#include <Poco/Timestamp.h>
+
+namespace Server
+{
+
+/**
+ * @brief A token bucket.
+ *
+ * The bucket is refilled at a constant rate up to its capacity, a request takes a single token.
+ * Tokens are counted in millionths, so the bucket is refilled exactly for any elapsed number of microseconds.
+ */
+class TokenBucket
+{
+public:
+    /**
+     * @brief Constructs a full bucket.
+     *
+     * @param aRate  The number of tokens added per second.
+     * @param aBurst The capacity of the bucket, at least a single token.
+     * @param aNow   The current time (in microseconds).
+     */
+    TokenBucket(
+        unsigned int             const aRate,
+        unsigned int             const aBurst,
+        Poco::Timestamp::TimeVal const aNow
+    );
+
+    /**
+     * @brief Gets the time until a token is available.
+     *
+     * @param aNow The current time (in microseconds).
+     *
+     * @return The time (in microseconds), 0 if a token is available right away.
+     */
+    Poco::Timestamp::TimeDiff getWait(
+        Poco::Timestamp::TimeVal const aNow
+    );
+
+    /**
+     * @brief Takes a token, expects one to be available.
+     */
+    void take();
+
+    /**
+     * @brief Verifies whether the bucket is full.
+     *
+     * A full bucket is indistinguishable from a newly constructed one.
+     *
+     * @param aNow The current time (in microseconds).
+     *
+     * @return True if the bucket is full, false otherwise.
+     */
+    bool isFull(
+        Poco::Timestamp::TimeVal const aNow
+    );
+
+private:
+    void refill(
+        Poco::Timestamp::TimeVal const aNow
+    );
+
+    Poco::Timestamp::TimeVal mRate;
+
+    Poco::Timestamp::TimeVal mCapacity;
+
+    Poco::Timestamp::TimeVal mTokens;
+
+    Poco::Timestamp::TimeVal mRefilled;
+};
+
+} // namespace Server
+
+#endif // SERVER_TOKENBUCKET_HPP
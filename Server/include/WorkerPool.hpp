@@ -0,0 +1,170 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#ifndef SERVER_WORKERPOOL_HPP
+#define SERVER_WORKERPOOL_HPP
+
+#include <Poco/Runnable.h>
+#include <Poco/Thread.h>
+#include <Server/include/CpuAffinity.hpp>
+#include <Server/include/IContext.hpp>
+#include <Server/include/RequestProcessor.hpp>
+#include <Server/include/RequestQueue.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+namespace Server
+{
+
+/**
+ * @brief The pool of workers executing requests taken from the request queue.
+ *
+ * The reserved workers execute the moderator requests only, so these never wait for a busy worker.
+ */
+class WorkerPool
+    : private boost::noncopyable
+{
+public:
+    /**
+     * @brief Constructs the pool.
+     *
+     * @param aContext                 The context of the server.
+     * @param aRequestQueue            The request queue.
+     * @param aNumberOfWorkers         The number of workers executing any request.
+     * @param aNumberOfReservedWorkers The number of workers executing the moderator requests only.
+     * @param aCpus                    The CPUs the workers are pinned to, not pinned if empty.
+     */
+    WorkerPool(
+        IContextShrPtr             aContext,
+        RequestQueue             & aRequestQueue,
+        unsigned short int const   aNumberOfWorkers,
+        unsigned short int const   aNumberOfReservedWorkers,
+        CpuSet             const & aCpus
+    );
+
+    /**
+     * @brief Starts the workers.
+     */
+    void start();
+
+    /**
+     * @brief Waits for the workers to finish.
+     *
+     * The request queue has to be closed beforehand.
+     */
+    void join();
+
+private:
+    /**
+     * @brief The loop of a single worker.
+     */
+    class Worker
+        : public Poco::Runnable
+    {
+    public:
+        Worker(
+            WorkerPool       & aWorkerPool,
+            bool       const   aPriorityOnly
+        );
+
+        virtual void run();
+
+    private:
+        WorkerPool & mWorkerPool;
+
+        bool const mPriorityOnly;
+    };
+
+    /**
+     * @brief Serves requests until the request queue is closed.
+     *
+     * A request having an asynchronous executor is only started, the worker moves on to the next request at once.
+     *
+     * @param aPriorityOnly Whether to serve the moderator requests only.
+     */
+    void serve(
+        bool const aPriorityOnly
+    );
+
+    /**
+     * @brief Posts the reply to a request executed asynchronously.
+     *
+     * @param aRequest      The request.
+     * @param aCommandReply The reply.
+     */
+    void replyAsync(
+        QueuedRequest              const aRequest,
+        Language::ICommand::Handle const aCommandReply
+    ) const;
+
+    /**
+     * @brief Posts the reply to a request.
+     *
+     * @param aRequest The request.
+     * @param aContent The content of the reply.
+     */
+    void reply(
+        QueuedRequest const & aRequest,
+        std::string           aContent
+    ) const;
+
+    /**
+     * @brief Posts a part of the streamed reply to a request.
+     *
+     * @param aRequest The request.
+     * @param aContent The content of the part.
+     * @param aFlags   The flags of the frame of the part.
+     *
+     * @return True once the part has been written out, false if the connection has gone away.
+     */
+    bool post(
+        QueuedRequest const & aRequest,
+        std::string   const & aContent,
+        unsigned char const   aFlags
+    ) const;
+
+    RequestProcessor mRequestProcessor;
+
+    RequestQueue & mRequestQueue;
+
+    ArenaPoolShrPtr mArenaPool;
+
+    Worker mWorker;
+
+    Worker mReservedWorker;
+
+    unsigned short int const mNumberOfReservedWorkers;
+
+    CpuSet const mCpus;
+
+    std::vector<boost::shared_ptr<Poco::Thread> > mThreads;
+};
+
+} // namespace Server
+
+#endif // SERVER_WORKERPOOL_HPP
@@ -0,0 +1,141 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/ArenaPool.hpp>
+
+namespace Server
+{
+
+ArenaPool::Release::Release(
+    boost::shared_ptr<ArenaPool> aArenaPool
+)
+    : mArenaPool(aArenaPool)
+{
+}
+
+void ArenaPool::Release::operator()(
+    Language::Arena * aArena
+) const
+{
+    mArenaPool->release(aArena);
+}
+
+ArenaPool::ArenaPool(
+    std::size_t const aMaxArenas,
+    std::size_t const aBlockSize
+)
+    : mMaxArenas(aMaxArenas),
+      mBlockSize(aBlockSize)
+{
+}
+
+ArenaPool::~ArenaPool()
+{
+    for (std::vector<Language::Arena *>::iterator it = mArenas.begin(); it != mArenas.end(); ++it)
+    {
+        (*it)->abandon();
+    }
+}
+
+Language::ArenaShrPtr ArenaPool::acquire()
+{
+    Language::Arena * arena = 0;
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        if (not mArenas.empty())
+        {
+            arena = mArenas.back();
+            mArenas.pop_back();
+        }
+    }
+
+    if (arena)
+    {
+        // An object that has outlived the previous request may be gone by now.
+        arena->reset();
+    }
+    else
+    {
+        arena = new Language::Arena(mBlockSize);
+    }
+
+    // The deleter keeps the pool alive for as long as the arena is out.
+    return Language::ArenaShrPtr(arena, Release(shared_from_this()));
+}
+
+void ArenaPool::record(
+    unsigned int       const   aListenerId,
+    unsigned short int const   aCommandId,
+    Language::Arena    const & aArena
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mStatisticsMutex);
+
+    ArenaStatistics & statistics = mStatistics[aListenerId][aCommandId];
+    ++statistics.mRequests;
+    statistics.mAllocations += aArena.getAllocationCount();
+    statistics.mAllocatedSize += aArena.getAllocatedSize();
+}
+
+ArenaStatisticsMap ArenaPool::collectStatistics(
+    unsigned int const aListenerId
+)
+{
+    ArenaStatisticsMap statistics;
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mStatisticsMutex);
+        statistics.swap(mStatistics[aListenerId]);
+    }
+
+    return statistics;
+}
+
+void ArenaPool::release(
+    Language::Arena * aArena
+)
+{
+    // An arena still holding an object is taken back all the same, it goes on bumping until it can be rewound.
+    aArena->reset();
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        if (mArenas.size() < mMaxArenas)
+        {
+            mArenas.push_back(aArena);
+            return;
+        }
+    }
+
+    // An object outliving its request still refers to the arena, which is destroyed once that object is freed.
+    aArena->abandon();
+}
+
+} // namespace Server
@@ -0,0 +1,229 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/Common/OperatorAbstractFactoryPostgresql.hpp>
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <Server/include/BatchExecutor.hpp>
+#include <Server/include/CommandDispatcher.hpp>
+#include <stdexcept>
+
+using namespace GameServer::Authentication;
+using namespace GameServer::Persistence;
+using namespace GameServer::User;
+
+namespace Server
+{
+
+BatchExecutor::BatchExecutor(
+    IContextShrPtr const aContext
+)
+    : mContext(aContext),
+      mOperatorAbstractFactory(new GameServer::Common::OperatorAbstractFactoryPostgresql(aContext))
+{
+}
+
+Language::ICommand::Handle BatchExecutor::execute(
+    Language::ICommand::Handle aRequest
+)
+{
+    Language::ReplyBuilder replyBuilder;
+
+    bool atomic;
+
+    try
+    {
+        atomic = aRequest->getBooleanParam(Language::PARAM_ATOMIC);
+    }
+    catch (std::out_of_range const &)
+    {
+        return replyBuilder.buildBatchReply(Game::REPLY_STATUS_INVALID_REQUEST);
+    }
+
+    std::string const login = aRequest->getLogin();
+    std::string const password = aRequest->getPassword();
+
+    BatchPersistencePostgresqlShrPtr persistence(new BatchPersistencePostgresql);
+
+    // The query running when the deadline of the batch passes is cancelled, the batch is rolled back then.
+    ScopedDeadlineWatch deadlineWatch(
+        mContext->getDeadlineWatchdog(), aRequest->getDeadline(), persistence->getConnection()
+    );
+
+    // A session token stands for the password, the user bound to the session is acting then.
+    IUserShrPtr user = aRequest->getSessionToken().empty()
+                       ? authenticate(persistence, login, password)
+                       : mContext->getSessionManager()->resolve(aRequest->getSessionToken(), login);
+
+    if (!user)
+    {
+        return replyBuilder.buildBatchReply(Game::REPLY_STATUS_UNAUTHENTICATED);
+    }
+
+    Language::ICommand::Commands replies;
+    Language::ICommand::Commands indications;
+    Language::ICommand::Commands const & commands = aRequest->getCommands();
+
+    for (Language::ICommand::Commands::const_iterator it = commands.begin(); it != commands.end(); ++it)
+    {
+        bool failed = false;
+
+        // Commands inherit the deadline of the batch.
+        (*it)->setDeadline(aRequest->getDeadline());
+
+        replies.push_back(executeCommand(*it, persistence, user, login, password, failed, indications));
+
+        if (failed && atomic)
+        {
+            persistence->abort();
+
+            if (deadlineWatch.stop())
+            {
+                return replyBuilder.buildBatchReply(Game::REPLY_STATUS_TIMED_OUT);
+            }
+
+            return replyBuilder.buildBatchReply(Game::REPLY_STATUS_OK, Game::BATCH_BATCH_HAS_BEEN_ROLLED_BACK, replies);
+        }
+    }
+
+    if (deadlineWatch.stop())
+    {
+        persistence->abort();
+
+        return replyBuilder.buildBatchReply(Game::REPLY_STATUS_TIMED_OUT);
+    }
+
+    persistence->commit();
+
+    mIndications.swap(indications);
+    mContext->getSubscriptionRegistry()->publish(mIndications);
+
+    return replyBuilder.buildBatchReply(Game::REPLY_STATUS_OK, Game::BATCH_BATCH_HAS_BEEN_COMMITTED, replies);
+}
+
+Language::ICommand::Handle BatchExecutor::execute(
+    Language::ICommand::Handle,
+    IPersistenceShrPtr,
+    IUserShrPtr
+)
+{
+    Language::ReplyBuilder replyBuilder;
+
+    return replyBuilder.buildBatchReply(Game::REPLY_STATUS_INVALID_REQUEST, Game::BATCH_NESTED_BATCH);
+}
+
+Language::ICommand::Commands const & BatchExecutor::getIndications() const
+{
+    return mIndications;
+}
+
+IUserShrPtr BatchExecutor::authenticate(
+    IPersistenceShrPtr aPersistence,
+    std::string const  aLogin,
+    std::string const  aPassword
+) const
+{
+    IAuthenticateOperatorShrPtr authenticateOperator = mOperatorAbstractFactory->createAuthenticateOperator();
+    IGetUserOperatorShrPtr getUserOperator = mOperatorAbstractFactory->createGetUserOperator();
+
+    // The transaction lifetime.
+    {
+        IConnectionShrPtr connection = aPersistence->getConnection();
+        ITransactionShrPtr transaction = aPersistence->getTransaction(connection);
+
+        AuthenticateOperatorExitCode const authenticateExitCode =
+            authenticateOperator->authenticate(transaction, aLogin, aPassword);
+
+        if (!authenticateExitCode.ok() || !authenticateExitCode.m_authenticated)
+        {
+            return IUserShrPtr();
+        }
+
+        GetUserOperatorExitCode const getUserExitCode = getUserOperator->getUser(transaction, aLogin);
+
+        if (!getUserExitCode.ok())
+        {
+            return IUserShrPtr();
+        }
+
+        transaction->commit();
+
+        return getUserExitCode.m_user;
+    }
+}
+
+Language::ICommand::Handle BatchExecutor::executeCommand(
+    Language::ICommand::Handle       aCommand,
+    BatchPersistencePostgresqlShrPtr aPersistence,
+    IUserShrPtr                      aActingUser,
+    std::string const                aLogin,
+    std::string const                aPassword,
+    bool                           & aFailed,
+    Language::ICommand::Commands   & aIndications
+) const
+{
+    Language::ReplyBuilder replyBuilder;
+
+    if (aCommand->getID() == Language::ID_COMMAND_BATCH_REQUEST)
+    {
+        aFailed = true;
+
+        return replyBuilder.buildBatchReply(Game::REPLY_STATUS_INVALID_REQUEST, Game::BATCH_NESTED_BATCH);
+    }
+
+    // Commands inherit the user of the batch, and are not allowed to act on behalf of anyone else.
+    if (aCommand->getLogin().empty())
+    {
+        aCommand->setLogin(aLogin);
+        aCommand->setPassword(aPassword);
+    }
+    else if (aCommand->getLogin() != aLogin || aCommand->getPassword() != aPassword)
+    {
+        aFailed = true;
+
+        return replyBuilder.buildBasicReply(aCommand->getID(), Game::REPLY_STATUS_UNAUTHENTICATED, Game::BATCH_FOREIGN_USER);
+    }
+
+    unsigned int const rollbacks = aPersistence->getRollbacks();
+
+    CommandDispatcher commandDispatcher;
+    Game::IExecutorShrPtr executor = commandDispatcher.dispatch(aCommand, mContext);
+
+    Language::ICommand::Handle reply = executor->execute(aCommand, aPersistence, aActingUser);
+
+    aFailed = (reply->getCode() != Game::REPLY_STATUS_OK) || (aPersistence->getRollbacks() != rollbacks);
+
+    if (!aFailed)
+    {
+        Language::ICommand::Commands const & indications = executor->getIndications();
+        aIndications.insert(aIndications.end(), indications.begin(), indications.end());
+    }
+
+    return reply;
+}
+
+} // namespace Server
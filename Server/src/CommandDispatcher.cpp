@@ -29,12 +29,14 @@
 #include <Game/GameServer/Building/Executors/ExecutorDestroyBuilding.hpp>
 #include <Game/GameServer/Building/Executors/ExecutorGetBuilding.hpp>
 #include <Game/GameServer/Building/Executors/ExecutorGetBuildings.hpp>
+#include <Game/GameServer/Epoch/Executors/AsyncExecutorGetEpoch.hpp>
 #include <Game/GameServer/Epoch/Executors/ExecutorActivateEpoch.hpp>
 #include <Game/GameServer/Epoch/Executors/ExecutorCreateEpoch.hpp>
 #include <Game/GameServer/Epoch/Executors/ExecutorDeactivateEpoch.hpp>
 #include <Game/GameServer/Epoch/Executors/ExecutorDeleteEpoch.hpp>
 #include <Game/GameServer/Epoch/Executors/ExecutorFinishEpoch.hpp>
 #include <Game/GameServer/Epoch/Executors/ExecutorGetEpoch.hpp>
+#include <Game/GameServer/Epoch/Executors/ExecutorSubscribe.hpp>
 #include <Game/GameServer/Epoch/Executors/ExecutorTickEpoch.hpp>
 #include <Game/GameServer/Generic/Executors/ExecutorEcho.hpp>
 #include <Game/GameServer/Generic/Executors/ExecutorError.hpp>
@@ -46,6 +48,7 @@
 #include <Game/GameServer/Land/Executors/ExecutorDeleteLand.hpp>
 #include <Game/GameServer/Land/Executors/ExecutorGetLand.hpp>
 #include <Game/GameServer/Land/Executors/ExecutorGetLands.hpp>
+#include <Game/GameServer/Resource/Executors/AsyncExecutorGetResources.hpp>
 #include <Game/GameServer/Resource/Executors/ExecutorGetResource.hpp>
 #include <Game/GameServer/Resource/Executors/ExecutorGetResources.hpp>
 #include <Game/GameServer/Settlement/Executors/ExecutorCreateSettlement.hpp>
@@ -55,7 +58,10 @@
 #include <Game/GameServer/Transport/Executors/ExecutorTransportHuman.hpp>
 #include <Game/GameServer/Transport/Executors/ExecutorTransportResource.hpp>
 #include <Game/GameServer/User/Executors/ExecutorCreateUser.hpp>
+#include <Game/GameServer/User/Executors/ExecutorLogin.hpp>
+#include <Game/GameServer/User/Executors/ExecutorLogout.hpp>
 #include <Game/GameServer/World/Executors/ExecutorCreateWorld.hpp>
+#include <Server/include/BatchExecutor.hpp>
 #include <Server/include/CommandDispatcher.hpp>
 
 namespace Server
@@ -63,7 +69,9 @@ namespace Server
 
 Game::IExecutorShrPtr CommandDispatcher::dispatch(
     Language::ICommand::Handle const aCommand,
-    IContextShrPtr             const aContext
+    IContextShrPtr             const aContext,
+    ISubscriberShrPtr          const aSubscriber,
+    IReplyStreamShrPtr         const aReplyStream
 ) const
 {
     using namespace Game;
@@ -80,19 +88,19 @@ Game::IExecutorShrPtr CommandDispatcher::dispatch(
         case ID_COMMAND_CREATE_LAND_REQUEST:        return IExecutorShrPtr(new ExecutorCreateLand(aContext));
         case ID_COMMAND_DELETE_LAND_REQUEST:        return IExecutorShrPtr(new ExecutorDeleteLand(aContext));
         case ID_COMMAND_GET_LAND_REQUEST:           return IExecutorShrPtr(new ExecutorGetLand(aContext));
-        case ID_COMMAND_GET_LANDS_REQUEST:          return IExecutorShrPtr(new ExecutorGetLands(aContext));
+        case ID_COMMAND_GET_LANDS_REQUEST:          return IExecutorShrPtr(new ExecutorGetLands(aContext, aReplyStream));
         case ID_COMMAND_CREATE_SETTLEMENT_REQUEST:  return IExecutorShrPtr(new ExecutorCreateSettlement(aContext));
         case ID_COMMAND_DELETE_SETTLEMENT_REQUEST:  return IExecutorShrPtr(new ExecutorDeleteSettlement(aContext));
         case ID_COMMAND_GET_SETTLEMENT_REQUEST:     return IExecutorShrPtr(new ExecutorGetSettlement(aContext));
-        case ID_COMMAND_GET_SETTLEMENTS_REQUEST:    return IExecutorShrPtr(new ExecutorGetSettlements(aContext));
+        case ID_COMMAND_GET_SETTLEMENTS_REQUEST:    return IExecutorShrPtr(new ExecutorGetSettlements(aContext, aReplyStream));
         case ID_COMMAND_BUILD_BUILDING_REQUEST:     return IExecutorShrPtr(new ExecutorBuildBuilding(aContext));
         case ID_COMMAND_DESTROY_BUILDING_REQUEST:   return IExecutorShrPtr(new ExecutorDestroyBuilding(aContext));
         case ID_COMMAND_GET_BUILDING_REQUEST:       return IExecutorShrPtr(new ExecutorGetBuilding(aContext));
-        case ID_COMMAND_GET_BUILDINGS_REQUEST:      return IExecutorShrPtr(new ExecutorGetBuildings(aContext));
+        case ID_COMMAND_GET_BUILDINGS_REQUEST:      return IExecutorShrPtr(new ExecutorGetBuildings(aContext, aReplyStream));
         case ID_COMMAND_DISMISS_HUMAN_REQUEST:      return IExecutorShrPtr(new ExecutorDismissHuman(aContext));
         case ID_COMMAND_ENGAGE_HUMAN_REQUEST:       return IExecutorShrPtr(new ExecutorEngageHuman(aContext));
         case ID_COMMAND_GET_HUMAN_REQUEST:          return IExecutorShrPtr(new ExecutorGetHuman(aContext));
-        case ID_COMMAND_GET_HUMANS_REQUEST:         return IExecutorShrPtr(new ExecutorGetHumans(aContext));
+        case ID_COMMAND_GET_HUMANS_REQUEST:         return IExecutorShrPtr(new ExecutorGetHumans(aContext, aReplyStream));
         case ID_COMMAND_GET_RESOURCE_REQUEST:       return IExecutorShrPtr(new ExecutorGetResource(aContext));
         case ID_COMMAND_GET_RESOURCES_REQUEST:      return IExecutorShrPtr(new ExecutorGetResources(aContext));
         case ID_COMMAND_CREATE_USER_REQUEST:        return IExecutorShrPtr(new ExecutorCreateUser(aContext));
@@ -106,8 +114,40 @@ Game::IExecutorShrPtr CommandDispatcher::dispatch(
         case ID_COMMAND_GET_EPOCH_REQUEST:          return IExecutorShrPtr(new ExecutorGetEpoch(aContext));
         case ID_COMMAND_TRANSPORT_HUMAN_REQUEST:    return IExecutorShrPtr(new ExecutorTransportHuman(aContext));
         case ID_COMMAND_TRANSPORT_RESOURCE_REQUEST: return IExecutorShrPtr(new ExecutorTransportResource(aContext));
+        case ID_COMMAND_BATCH_REQUEST:              return IExecutorShrPtr(new BatchExecutor(aContext));
+        case ID_COMMAND_SUBSCRIBE_REQUEST:          return IExecutorShrPtr(new ExecutorSubscribe(aContext, aSubscriber));
+        case ID_COMMAND_LOGIN_REQUEST:              return IExecutorShrPtr(new ExecutorLogin(aContext));
+        case ID_COMMAND_LOGOUT_REQUEST:             return IExecutorShrPtr(new ExecutorLogout(aContext));
         default:                                    return IExecutorShrPtr(new ExecutorError(aContext));
     }
 }
 
+Game::IAsyncExecutorShrPtr CommandDispatcher::dispatchAsync(
+    Language::ICommand::Handle const aCommand,
+    IContextShrPtr             const aContext
+) const
+{
+    using namespace Game;
+    using namespace Language;
+
+    GameServer::Persistence::IAsyncQueryRunnerShrPtr const queryRunner = aContext->getAsyncQueryRunner();
+
+    if (not aCommand or not queryRunner)
+    {
+        return IAsyncExecutorShrPtr();
+    }
+
+    switch (aCommand->getID())
+    {
+        case ID_COMMAND_GET_EPOCH_REQUEST:
+            return IAsyncExecutorShrPtr(new AsyncExecutorGetEpoch(aContext, queryRunner));
+
+        case ID_COMMAND_GET_RESOURCES_REQUEST:
+            return IAsyncExecutorShrPtr(new AsyncExecutorGetResources(aContext, queryRunner));
+
+        default:
+            return IAsyncExecutorShrPtr();
+    }
+}
+
 } // namespace Server
@@ -68,6 +68,165 @@ unsigned short int Configurator::getThreads() const
     return mThreads;
 }
 
+unsigned short int Configurator::getReservedThreads() const
+{
+    return mReservedThreads;
+}
+
+std::string Configurator::getFrontEnd() const
+{
+    return mFrontEnd;
+}
+
+unsigned short int Configurator::getListenerCount() const
+{
+    return mListenerCount;
+}
+
+std::string Configurator::getListenerAffinity() const
+{
+    return mListenerAffinity;
+}
+
+std::string Configurator::getListenerUnixPath() const
+{
+    return mListenerUnixPath;
+}
+
+unsigned int Configurator::getQueueCapacity() const
+{
+    return mQueueCapacity;
+}
+
+unsigned int Configurator::getQueuePriorityCapacity() const
+{
+    return mQueuePriorityCapacity;
+}
+
+std::string Configurator::getQueueOverload() const
+{
+    return mQueueOverload;
+}
+
+unsigned int Configurator::getQueueReportInterval() const
+{
+    return mQueueReportInterval;
+}
+
+unsigned int Configurator::getConnectionMaxRequests() const
+{
+    return mConnectionMaxRequests;
+}
+
+unsigned int Configurator::getConnectionIdleTimeout() const
+{
+    return mConnectionIdleTimeout;
+}
+
+unsigned int Configurator::getConnectionMaxPayload() const
+{
+    return mConnectionMaxPayload;
+}
+
+unsigned int Configurator::getConnectionMaxInFlight() const
+{
+    return mConnectionMaxInFlight;
+}
+
+unsigned int Configurator::getSessionTimeout() const
+{
+    return mSessionTimeout;
+}
+
+unsigned int Configurator::getIdempotencyTimeout() const
+{
+    return mIdempotencyTimeout;
+}
+
+unsigned int Configurator::getRateLimitLoginRate() const
+{
+    return mRateLimitLoginRate;
+}
+
+unsigned int Configurator::getRateLimitLoginBurst() const
+{
+    return mRateLimitLoginBurst;
+}
+
+unsigned int Configurator::getRateLimitReadRate() const
+{
+    return mRateLimitReadRate;
+}
+
+unsigned int Configurator::getRateLimitReadBurst() const
+{
+    return mRateLimitReadBurst;
+}
+
+unsigned int Configurator::getRateLimitWriteRate() const
+{
+    return mRateLimitWriteRate;
+}
+
+unsigned int Configurator::getRateLimitWriteBurst() const
+{
+    return mRateLimitWriteBurst;
+}
+
+unsigned int Configurator::getCompressionThreshold() const
+{
+    return mCompressionThreshold;
+}
+
+int Configurator::getCompressionLevel() const
+{
+    return mCompressionLevel;
+}
+
+unsigned int Configurator::getStreamPartSize() const
+{
+    return mStreamPartSize;
+}
+
+unsigned int Configurator::getShutdownDrainTimeout() const
+{
+    return mShutdownDrainTimeout;
+}
+
+std::string Configurator::getShutdownHandoffPath() const
+{
+    return mShutdownHandoffPath;
+}
+
+unsigned int Configurator::getDeadlineTimeout(
+    unsigned short int const aCommandId
+) const
+{
+    std::map<unsigned short int, unsigned int>::const_iterator const it = mDeadlineTimeouts.find(aCommandId);
+
+    return (it != mDeadlineTimeouts.end()) ? it->second : mDeadlineDefaultTimeout;
+}
+
+unsigned int Configurator::getAsyncConnections() const
+{
+    return mAsyncConnections;
+}
+
+std::string Configurator::getAsyncConnectionString() const
+{
+    return mAsyncConnectionString;
+}
+
+unsigned int Configurator::getAsyncMaxQueries() const
+{
+    return mAsyncMaxQueries;
+}
+
+std::string Configurator::getDecoder() const
+{
+    return mDecoder;
+}
+
 int Configurator::getLoggerPriority() const
 {
     return mLoggerPriority;
@@ -106,6 +265,121 @@ bool Configurator::parseXml()
     mHost = documentElement->getChildElement("host")->innerText();
     mPort = documentElement->getChildElement("port")->innerText();
     mThreads = boost::lexical_cast<unsigned short int>(documentElement->getChildElement("threads")->innerText());
+    mReservedThreads =
+        boost::lexical_cast<unsigned short int>(documentElement->getChildElement("reservedthreads")->innerText());
+    mFrontEnd = documentElement->getChildElement("frontend")->innerText();
+    mListenerCount =
+        boost::lexical_cast<unsigned short int>(
+            documentElement->getChildElement("listener")->getChildElement("count")->innerText()
+        );
+    mListenerAffinity = documentElement->getChildElement("listener")->getChildElement("affinity")->innerText();
+    mListenerUnixPath = documentElement->getChildElement("listener")->getChildElement("unixpath")->innerText();
+    mQueueCapacity =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("queue")->getChildElement("capacity")->innerText()
+        );
+    mQueuePriorityCapacity =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("queue")->getChildElement("prioritycapacity")->innerText()
+        );
+    mQueueOverload = documentElement->getChildElement("queue")->getChildElement("overload")->innerText();
+    mQueueReportInterval =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("queue")->getChildElement("reportinterval")->innerText()
+        );
+    mConnectionMaxRequests =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("connection")->getChildElement("maxrequests")->innerText()
+        );
+    mConnectionIdleTimeout =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("connection")->getChildElement("idletimeout")->innerText()
+        );
+    mConnectionMaxPayload =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("connection")->getChildElement("maxpayload")->innerText()
+        );
+    mConnectionMaxInFlight =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("connection")->getChildElement("maxinflight")->innerText()
+        );
+    mSessionTimeout =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("session")->getChildElement("timeout")->innerText()
+        );
+    mIdempotencyTimeout =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("idempotency")->getChildElement("timeout")->innerText()
+        );
+    mRateLimitLoginRate =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("ratelimit")->getChildElement("login")->getChildElement("rate")->innerText()
+        );
+    mRateLimitLoginBurst =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("ratelimit")->getChildElement("login")->getChildElement("burst")->innerText()
+        );
+    mRateLimitReadRate =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("ratelimit")->getChildElement("read")->getChildElement("rate")->innerText()
+        );
+    mRateLimitReadBurst =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("ratelimit")->getChildElement("read")->getChildElement("burst")->innerText()
+        );
+    mRateLimitWriteRate =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("ratelimit")->getChildElement("write")->getChildElement("rate")->innerText()
+        );
+    mRateLimitWriteBurst =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("ratelimit")->getChildElement("write")->getChildElement("burst")->innerText()
+        );
+    mCompressionThreshold =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("compression")->getChildElement("threshold")->innerText()
+        );
+    mCompressionLevel =
+        boost::lexical_cast<int>(
+            documentElement->getChildElement("compression")->getChildElement("level")->innerText()
+        );
+    mStreamPartSize =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("stream")->getChildElement("partsize")->innerText()
+        );
+    mShutdownDrainTimeout =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("shutdown")->getChildElement("draintimeout")->innerText()
+        );
+    mShutdownHandoffPath = documentElement->getChildElement("shutdown")->getChildElement("handoffpath")->innerText();
+    mDeadlineDefaultTimeout =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("deadline")->getChildElement("default")->innerText()
+        );
+
+    for (Poco::XML::Node * node = documentElement->getChildElement("deadline")->firstChild();
+         node;
+         node = node->nextSibling())
+    {
+        if (node->nodeType() == Poco::XML::Node::ELEMENT_NODE and node->nodeName() == "command")
+        {
+            Poco::XML::Element * const command = static_cast<Poco::XML::Element *>(node);
+
+            mDeadlineTimeouts[boost::lexical_cast<unsigned short int>(command->getChildElement("id")->innerText())] =
+                boost::lexical_cast<unsigned int>(command->getChildElement("timeout")->innerText());
+        }
+    }
+    mAsyncConnections =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("async")->getChildElement("connections")->innerText()
+        );
+    mAsyncConnectionString =
+        documentElement->getChildElement("async")->getChildElement("connectionstring")->innerText();
+    mAsyncMaxQueries =
+        boost::lexical_cast<unsigned int>(
+            documentElement->getChildElement("async")->getChildElement("maxqueries")->innerText()
+        );
+    mDecoder = documentElement->getChildElement("decoder")->innerText();
     mLoggerPriority =
         boost::lexical_cast<int>(documentElement->getChildElement("logger")->getChildElement("priority")->innerText());
     mPersistence = documentElement->getChildElement("persistence")->innerText();
@@ -25,71 +25,254 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
-#include <Game/GameServer/Common/IExecutor.hpp>
-#include <Language/Interface/Command.hpp>
-#include <Protocol/Xml/Cpp/LanguageToProtocolTranslator.hpp>
-#include <Protocol/Xml/Cpp/PayloadToProtocolTranslator.hpp>
-#include <Protocol/Xml/Cpp/ProtocolToLanguageTranslator.hpp>
-#include <Server/include/CommandDispatcher.hpp>
 #include <Server/include/Connection.hpp>
+#include <Server/include/FrameWriter.hpp>
+#include <Server/include/ISubscriber.hpp>
+#include <boost/bind.hpp>
+#include <string>
 
 namespace Server
 {
 
+namespace
+{
+
+std::size_t const RECEIVE_CHUNK_SIZE = 4096U;
+
+} // namespace
+
+/**
+ * Indications are written by the thread that publishes them, so the writes are serialized with the replies.
+ * A slow subscriber holds the publishing thread up for as long as its socket is full.
+ */
+class Connection::Writer
+    : public ISubscriber
+{
+public:
+    Writer(
+        int     const aDescriptor,
+        Framing const aFraming
+    )
+        : mDescriptor(aDescriptor),
+          mFraming(aFraming),
+          mDetached(false),
+          mCodec(CODEC_XML)
+    {
+    }
+
+    bool write(
+        unsigned long long int const   aRequestId,
+        std::string            const & aContent,
+        unsigned char          const   aFlags
+    )
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        return FrameWriter::write(mDescriptor, mFraming, aRequestId, aContent, aFlags);
+    }
+
+    virtual bool notify(
+        std::string const & aContent
+    )
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        if (mDetached)
+        {
+            return false;
+        }
+
+        return FrameWriter::write(mDescriptor, mFraming, 0, aContent, BINARY_FRAME_FLAG_INDICATION);
+    }
+
+    virtual Codec getCodec() const
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        return mCodec;
+    }
+
+    void setCodec(
+        Codec const aCodec
+    )
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        mCodec = aCodec;
+    }
+
+    /**
+     * @brief Stops the indications, the socket is about to be closed.
+     */
+    void detach()
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        mDetached = true;
+    }
+
+private:
+    int const mDescriptor;
+
+    Framing const mFraming;
+
+    mutable Poco::Mutex mMutex;
+
+    bool mDetached;
+
+    Codec mCodec;
+};
+
 Connection::Connection(
     Poco::Net::StreamSocket const & aSocket,
     IContextShrPtr                  aContext
 )
     : TCPServerConnection(aSocket),
-      mSocketStream(socket()),
-      mContext(aContext)
+      mFrameReader(aContext->getBufferPool(), aContext->getConfigurator()->getConnectionMaxPayload()),
+      mContext(aContext),
+      mRequestProcessor(aContext)
 {
 }
 
 // TODO: shutdownReceive(), shutdownSend(), shutdown().
-// TODO: Remove the hardcoded xml protocol!
 void Connection::run()
 {
-    size_t const BUFFER_SIZE = 2048U;
+    IConfiguratorShrPtr configurator = mContext->getConfigurator();
+
+    unsigned int const maxRequests = configurator->getConnectionMaxRequests();
+    Poco::Timespan const idleTimeout(
+        static_cast<Poco::Timespan::TimeDiff>(configurator->getConnectionIdleTimeout()) * Poco::Timespan::MILLISECONDS
+    );
+
+    // Serve requests until the peer closes the connection, the connection idles out or the limit is reached.
+    for (unsigned int served = 0; maxRequests == 0 or served < maxRequests; ++served)
+    {
+        if (not waitForRequest(idleTimeout))
+        {
+            break;
+        }
+
+        if (not serveRequest())
+        {
+            break;
+        }
+    }
+
+    if (mWriter)
+    {
+        mWriter->detach();
+        mContext->getSubscriptionRegistry()->unsubscribe(mWriter);
+    }
+}
+
+bool Connection::waitForRequest(
+    Poco::Timespan const & aIdleTimeout
+)
+{
+    // A pipelined request may already be buffered.
+    if (mFrameReader.hasBufferedData())
+    {
+        return true;
+    }
+
+    while (not socket().poll(aIdleTimeout, Poco::Net::Socket::SELECT_READ))
+    {
+        // A subscribed connection stays open for the indications until the peer closes it.
+        if (not isSubscribed())
+        {
+            return false;
+        }
+    }
+
+    // A readable socket with nothing to read means that the peer has closed the connection.
+    return receive();
+}
 
+bool Connection::serveRequest()
+{
     // Read the data from the socket.
-    int length;
-    mSocketStream >> length;
+    char const * content;
+    std::size_t length;
 
-    char buffer[2048];
-    mSocketStream.get(&buffer[0], length + 1);
+    while (not mFrameReader.extract(content, length))
+    {
+        if (mFrameReader.isMalformed() or not receive())
+        {
+            return false;
+        }
+    }
 
     // Translate the data to the payload.
-    std::string content(buffer);
-    Protocol::Payload payloadRequest(length, content);
+    Protocol::Payload payloadRequest(content, length);
+    mFrameReader.consume();
+
+    if (not mWriter)
+    {
+        mWriter.reset(new Writer(socket().impl()->sockfd(), mFrameReader.getFraming()));
+    }
 
-    // Translate the payload to the protocol.
-    Protocol::PayloadToProtocolTranslator payloadToProtocolTranslator;
-    Protocol::Message::Handle messageRequest = payloadToProtocolTranslator.translate(payloadRequest);
+    // The handshake switches the codec of the requests that follow it.
+    if (mFrameReader.getFlags() & BINARY_FRAME_FLAG_NEGOTIATE)
+    {
+        mWriter->setCodec(negotiateCodec(payloadRequest.getContent()));
 
-    // Translate the protocol to the language.
-    Protocol::ProtocolToLanguageTranslator protocolToLanguageTranslator;
-    Language::Command::Handle commandRequest = protocolToLanguageTranslator.translate(messageRequest);
+        return mWriter->write(
+                   mFrameReader.getRequestId(),
+                   getCodecName(mWriter->getCodec()),
+                   BINARY_FRAME_FLAG_NEGOTIATE
+               );
+    }
 
-    // Dispatch the command.
-    CommandDispatcher commandDispatcher;
-    Game::IExecutorShrPtr executor = commandDispatcher.dispatch(commandRequest, mContext);
+    // The request and its reply are allocated from an arena, rewound once the reply has been written.
+    Language::ArenaShrPtr const arena = mContext->getArenaPool()->acquire();
+    Language::ArenaScope const arenaScope(arena.get());
 
-    // Execute the command.
-    Language::Command::Handle commandReply = executor->execute(commandRequest);
+    // Process the request, unless it is throttled.
+    Codec const codec = mWriter->getCodec();
+    Language::ICommand::Handle const commandRequest = mRequestProcessor.decode(payloadRequest, codec);
+    Poco::Timestamp::TimeDiff retryAfter;
 
-    // Translate the language to the protocol.
-    Protocol::LanguageToProtocolTranslator languageToProtocolTranslator;
-    Protocol::Message::Handle messageReply = languageToProtocolTranslator.translate(commandReply);
+    IReplyStreamShrPtr const replyStream = mRequestProcessor.openReplyStream(
+        mFrameReader.getFlags(),
+        codec,
+        boost::bind(&Writer::write, mWriter.get(), mFrameReader.getRequestId(), _1, _2)
+    );
 
-    // Translate the protocol to the payload.
-    Protocol::Payload payloadReply(messageReply);
+    Protocol::Payload const payloadReply = mRequestProcessor.admit(commandRequest, retryAfter)
+                                         ? mRequestProcessor.execute(commandRequest, mWriter, codec, replyStream)
+                                         : mRequestProcessor.throttle(commandRequest, retryAfter, codec);
+
+    // The reply has been encoded by now, the allocations of the whole request are in. The threaded front end has
+    // a single listener.
+    if (commandRequest)
+    {
+        mContext->getArenaPool()->record(0, commandRequest->getID(), *arena);
+    }
+
+    std::string contentReply = payloadReply.getContent();
+    unsigned char const flags = mRequestProcessor.compress(mFrameReader.getFlags(), contentReply);
 
     // Write the data to the socket.
-    mSocketStream.clear();
-    mSocketStream << payloadReply.getLength();
-    mSocketStream << payloadReply.getContent();
-    mSocketStream.flush();
+    return mWriter->write(mFrameReader.getRequestId(), contentReply, flags);
+}
+
+bool Connection::receive()
+{
+    int const received = socket().receiveBytes(mFrameReader.prepare(RECEIVE_CHUNK_SIZE), RECEIVE_CHUNK_SIZE);
+
+    if (received <= 0)
+    {
+        return false;
+    }
+
+    mFrameReader.commit(received);
+
+    return true;
+}
+
+bool Connection::isSubscribed() const
+{
+    return mWriter and mContext->getSubscriptionRegistry()->isSubscribed(mWriter);
 }
 
 } // namespace Server
@@ -25,6 +25,7 @@
 // OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
 // SUCH DAMAGE.
 
+#include <Game/GameServer/Persistence/AsyncQueryRunnerPostgresql.hpp>
 #include <Server/include/Configurator.hpp>
 #include <Server/include/ConfiguratorBase.hpp>
 #include <Server/include/ConfiguratorBuilding.hpp>
@@ -35,12 +36,70 @@
 namespace Server
 {
 
+namespace
+{
+
+/**
+ * @brief The limits of the pool of connection buffers.
+ */
+std::size_t const MAX_POOLED_BUFFERS     = 256U;
+std::size_t const MAX_POOLED_BUFFER_SIZE = 65536U;
+
+/**
+ * @brief The limits of the pool of request arenas.
+ */
+std::size_t const MAX_POOLED_ARENAS = 256U;
+std::size_t const ARENA_BLOCK_SIZE  = 16384U;
+
+/**
+ * @brief The maximum number of sessions kept at once.
+ */
+std::size_t const MAX_SESSIONS = 65536U;
+
+/**
+ * @brief The maximum number of logins tracked by the rate limiter at once.
+ */
+std::size_t const MAX_RATE_LIMITED_LOGINS = 65536U;
+
+/**
+ * @brief The maximum number of replies kept for the retried requests at once.
+ */
+std::size_t const MAX_IDEMPOTENT_REPLIES = 65536U;
+
+} // namespace
+
 Context::Context()
     : mConfigurator(new Configurator),
       mConfiguratorBase(new ConfiguratorBase(mConfigurator)),
       mConfiguratorBuilding(new ConfiguratorBuilding(mConfigurator)),
       mConfiguratorHuman(new ConfiguratorHuman(mConfigurator)),
-      mConfiguratorResource(new ConfiguratorResource(mConfigurator))
+      mConfiguratorResource(new ConfiguratorResource(mConfigurator)),
+      mBufferPool(new BufferPool(MAX_POOLED_BUFFERS, MAX_POOLED_BUFFER_SIZE)),
+      mArenaPool(new ArenaPool(MAX_POOLED_ARENAS, ARENA_BLOCK_SIZE)),
+      mSubscriptionRegistry(new SubscriptionRegistry),
+      mSessionManager(new SessionManager(mConfigurator->getSessionTimeout(), MAX_SESSIONS)),
+      mRateLimiter(
+          new RateLimiter(
+              RateLimit(mConfigurator->getRateLimitLoginRate(), mConfigurator->getRateLimitLoginBurst()),
+              RateLimit(mConfigurator->getRateLimitReadRate(), mConfigurator->getRateLimitReadBurst()),
+              RateLimit(mConfigurator->getRateLimitWriteRate(), mConfigurator->getRateLimitWriteBurst()),
+              MAX_RATE_LIMITED_LOGINS
+          )
+      ),
+      mReplyCompressor(
+          new ReplyCompressor(mConfigurator->getCompressionThreshold(), mConfigurator->getCompressionLevel())
+      ),
+      mDeadlineWatchdog(new DeadlineWatchdog),
+      mIdempotencyCache(new IdempotencyCache(mConfigurator->getIdempotencyTimeout(), MAX_IDEMPOTENT_REPLIES)),
+      mAsyncQueryRunner(
+          mConfigurator->getAsyncConnections()
+              ? new GameServer::Persistence::AsyncQueryRunnerPostgresql(
+                    mConfigurator->getAsyncConnectionString(),
+                    mConfigurator->getAsyncConnections(),
+                    mConfigurator->getAsyncMaxQueries()
+                )
+              : 0
+      )
 {
 }
 
@@ -69,4 +128,49 @@ IConfiguratorResourceShrPtr Context::getConfiguratorResource() const
     return mConfiguratorResource;
 }
 
+BufferPoolShrPtr Context::getBufferPool() const
+{
+    return mBufferPool;
+}
+
+ArenaPoolShrPtr Context::getArenaPool() const
+{
+    return mArenaPool;
+}
+
+SubscriptionRegistryShrPtr Context::getSubscriptionRegistry() const
+{
+    return mSubscriptionRegistry;
+}
+
+SessionManagerShrPtr Context::getSessionManager() const
+{
+    return mSessionManager;
+}
+
+RateLimiterShrPtr Context::getRateLimiter() const
+{
+    return mRateLimiter;
+}
+
+ReplyCompressorShrPtr Context::getReplyCompressor() const
+{
+    return mReplyCompressor;
+}
+
+DeadlineWatchdogShrPtr Context::getDeadlineWatchdog() const
+{
+    return mDeadlineWatchdog;
+}
+
+IdempotencyCacheShrPtr Context::getIdempotencyCache() const
+{
+    return mIdempotencyCache;
+}
+
+GameServer::Persistence::IAsyncQueryRunnerShrPtr Context::getAsyncQueryRunner() const
+{
+    return mAsyncQueryRunner;
+}
+
 } // namespace Server
@@ -0,0 +1,96 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/CpuAffinity.hpp>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+namespace Server
+{
+
+unsigned int getNumberOfCpus()
+{
+    long const numberOfCpus = ::sysconf(_SC_NPROCESSORS_ONLN);
+
+    return numberOfCpus > 0 ? static_cast<unsigned int>(numberOfCpus) : 1U;
+}
+
+CpuSet getCpuSubset(
+    unsigned int const aNumberOfCpus,
+    unsigned int const aIndex,
+    unsigned int const aNumberOfSubsets
+)
+{
+    CpuSet cpus;
+
+    if (aNumberOfCpus == 0 or aNumberOfSubsets == 0)
+    {
+        return cpus;
+    }
+
+    if (aNumberOfCpus < aNumberOfSubsets)
+    {
+        cpus.push_back(aIndex % aNumberOfCpus);
+        return cpus;
+    }
+
+    // The first subsets take one CPU more if the CPUs do not split evenly.
+    unsigned int const size = aNumberOfCpus / aNumberOfSubsets;
+    unsigned int const remainder = aNumberOfCpus % aNumberOfSubsets;
+    unsigned int const first = aIndex * size + (aIndex < remainder ? aIndex : remainder);
+    unsigned int const last = first + size + (aIndex < remainder ? 1 : 0);
+
+    for (unsigned int cpu = first; cpu < last; ++cpu)
+    {
+        cpus.push_back(cpu);
+    }
+
+    return cpus;
+}
+
+bool pinCurrentThread(
+    CpuSet const & aCpus
+)
+{
+    if (aCpus.empty())
+    {
+        return true;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    for (CpuSet::const_iterator it = aCpus.begin(); it != aCpus.end(); ++it)
+    {
+        CPU_SET(*it, &cpuSet);
+    }
+
+    return ::pthread_setaffinity_np(::pthread_self(), sizeof(cpuSet), &cpuSet) == 0;
+}
+
+} // namespace Server
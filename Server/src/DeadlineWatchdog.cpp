@@ -0,0 +1,212 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/DeadlineWatchdog.hpp>
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <vector>
+
+namespace Server
+{
+
+namespace
+{
+
+/**
+ * @brief The longest sleep (in milliseconds) of the watchdog, it wakes up at least that often.
+ */
+long const MAX_SLEEP_MS = 1000;
+
+} // namespace
+
+DeadlineWatchdog::DeadlineWatchdog()
+    : mNextTicket(0),
+      mStopRequested(false)
+{
+    mThread.start(*this);
+}
+
+DeadlineWatchdog::~DeadlineWatchdog()
+{
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        mStopRequested = true;
+        mCondition.signal();
+    }
+
+    mThread.join();
+}
+
+DeadlineWatchdog::Ticket DeadlineWatchdog::watch(
+    Poco::Timestamp::TimeVal                   const aDeadline,
+    GameServer::Persistence::IConnectionShrPtr const aConnection
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    Ticket const ticket = ++mNextTicket;
+
+    Watches::iterator const it = mWatches.insert(std::make_pair(aDeadline, Watch(ticket, aConnection)));
+    mTickets.insert(std::make_pair(ticket, it));
+
+    // The new deadline may be the nearest one, the sleep is recalculated.
+    if (it == mWatches.begin())
+    {
+        mCondition.signal();
+    }
+
+    return ticket;
+}
+
+bool DeadlineWatchdog::unwatch(
+    Ticket const aTicket
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    Tickets::iterator const it = mTickets.find(aTicket);
+
+    if (it == mTickets.end())
+    {
+        return false;
+    }
+
+    mWatches.erase(it->second);
+    mTickets.erase(it);
+
+    return true;
+}
+
+std::size_t DeadlineWatchdog::cancelExpired(
+    Poco::Timestamp::TimeVal const aNow
+)
+{
+    std::vector<GameServer::Persistence::IConnectionShrPtr> expired;
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        while (not mWatches.empty() and mWatches.begin()->first <= aNow)
+        {
+            expired.push_back(mWatches.begin()->second.second);
+            mTickets.erase(mWatches.begin()->second.first);
+            mWatches.erase(mWatches.begin());
+        }
+    }
+
+    // Cancelling talks to the database, the watches are not blocked meanwhile.
+    for (std::vector<GameServer::Persistence::IConnectionShrPtr>::const_iterator it = expired.begin();
+         it != expired.end();
+         ++it)
+    {
+        try
+        {
+            (*it)->cancel();
+        }
+        catch (std::exception const & e)
+        {
+            std::clog << "Could not cancel the query of an expired request: " << e.what() << std::endl;
+        }
+    }
+
+    return expired.size();
+}
+
+void DeadlineWatchdog::run()
+{
+    while (true)
+    {
+        {
+            Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+            if (mStopRequested)
+            {
+                return;
+            }
+
+            long sleep = MAX_SLEEP_MS;
+
+            if (not mWatches.empty())
+            {
+                Poco::Timestamp::TimeDiff const left =
+                    mWatches.begin()->first - Poco::Timestamp().epochMicroseconds();
+
+                sleep = (left > 0)
+                        ? static_cast<long>(std::min<Poco::Timestamp::TimeDiff>(left / 1000 + 1, MAX_SLEEP_MS))
+                        : 0;
+            }
+
+            if (sleep)
+            {
+                mCondition.tryWait(mMutex, sleep);
+            }
+
+            if (mStopRequested)
+            {
+                return;
+            }
+        }
+
+        cancelExpired(Poco::Timestamp().epochMicroseconds());
+    }
+}
+
+ScopedDeadlineWatch::ScopedDeadlineWatch(
+    DeadlineWatchdogShrPtr                     const aWatchdog,
+    Poco::Timestamp::TimeVal                   const aDeadline,
+    GameServer::Persistence::IConnectionShrPtr const aConnection
+)
+    : mWatchdog(aWatchdog),
+      mWatching(aDeadline != 0),
+      mTicket(0)
+{
+    if (mWatching)
+    {
+        mTicket = mWatchdog->watch(aDeadline, aConnection);
+    }
+}
+
+ScopedDeadlineWatch::~ScopedDeadlineWatch()
+{
+    stop();
+}
+
+bool ScopedDeadlineWatch::stop()
+{
+    if (not mWatching)
+    {
+        return false;
+    }
+
+    mWatching = false;
+
+    return not mWatchdog->unwatch(mTicket);
+}
+
+} // namespace Server
@@ -0,0 +1,275 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/FrameReader.hpp>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace Server
+{
+
+namespace
+{
+
+/**
+ * @brief The maximum length of the header of a frame, the length prefix of a text frame included.
+ */
+std::size_t const MAX_HEADER_SIZE = 64U;
+
+} // namespace
+
+FrameReader::FrameReader(
+    BufferPoolShrPtr         aBufferPool,
+    std::size_t      const   aMaxPayload
+)
+    : mBufferPool(aBufferPool),
+      mMaxPayload(aMaxPayload),
+      mBegin(0),
+      mEnd(0),
+      mContentOffset(0),
+      mContentLength(0),
+      mRequestId(0),
+      mFlags(0),
+      mLengthParsed(false),
+      mMalformed(false),
+      mFraming(FRAMING_UNKNOWN)
+{
+    mBufferPool->acquire(mBuffer);
+}
+
+FrameReader::~FrameReader()
+{
+    mBufferPool->release(mBuffer);
+}
+
+char * FrameReader::prepare(
+    std::size_t const aSize
+)
+{
+    if (mBuffer.size() - mEnd >= aSize)
+    {
+        return &mBuffer[mEnd];
+    }
+
+    // Move the unconsumed bytes to the front before growing the buffer.
+    if (mBegin > 0)
+    {
+        std::memmove(&mBuffer[0], &mBuffer[mBegin], mEnd - mBegin);
+        mContentOffset -= mLengthParsed ? mBegin : 0;
+        mEnd -= mBegin;
+        mBegin = 0;
+    }
+
+    // The buffer doubles, but does not outgrow a complete frame of the maximum length unless asked to.
+    if (mBuffer.size() - mEnd < aSize)
+    {
+        mBuffer.resize(std::max(std::min(mBuffer.size() * 2, getCapacity()), mEnd + aSize));
+    }
+
+    return &mBuffer[mEnd];
+}
+
+void FrameReader::commit(
+    std::size_t const aSize
+)
+{
+    mEnd += aSize;
+}
+
+bool FrameReader::hasBufferedData() const
+{
+    return mBegin < mEnd;
+}
+
+std::size_t FrameReader::getRoom() const
+{
+    std::size_t const buffered = mEnd - mBegin;
+
+    return buffered < getCapacity() ? getCapacity() - buffered : 0;
+}
+
+bool FrameReader::extract(
+    char        const * & aContent,
+    std::size_t       &   aLength
+)
+{
+    if (mMalformed)
+    {
+        return false;
+    }
+
+    if (not mLengthParsed and not parseHeader())
+    {
+        return false;
+    }
+
+    if (mEnd - mContentOffset < mContentLength)
+    {
+        return false;
+    }
+
+    aContent = &mBuffer[0] + mContentOffset;
+    aLength = mContentLength;
+
+    return true;
+}
+
+void FrameReader::consume()
+{
+    if (not mLengthParsed)
+    {
+        return;
+    }
+
+    mBegin = mContentOffset + mContentLength;
+    mLengthParsed = false;
+
+    // Rewind an empty buffer, so that the next frame is received from the beginning.
+    if (mBegin == mEnd)
+    {
+        mBegin = 0;
+        mEnd = 0;
+    }
+}
+
+bool FrameReader::isMalformed() const
+{
+    return mMalformed;
+}
+
+Framing FrameReader::getFraming() const
+{
+    return mFraming;
+}
+
+unsigned long long int FrameReader::getRequestId() const
+{
+    return mRequestId;
+}
+
+unsigned char FrameReader::getFlags() const
+{
+    return mFlags;
+}
+
+bool FrameReader::parseHeader()
+{
+    if (mFraming == FRAMING_UNKNOWN)
+    {
+        if (mBegin == mEnd)
+        {
+            return false;
+        }
+
+        // A text frame starts with a digit or a whitespace, never with the magic.
+        mFraming = mBuffer[mBegin] == BINARY_FRAME_MAGIC[0] ? FRAMING_BINARY : FRAMING_TEXT;
+    }
+
+    return mFraming == FRAMING_BINARY ? parseBinaryHeader() : parseTextHeader();
+}
+
+bool FrameReader::parseTextHeader()
+{
+    std::size_t position = mBegin;
+
+    while (position < mEnd and std::isspace(static_cast<unsigned char>(mBuffer[position])))
+    {
+        ++position;
+    }
+
+    std::size_t const digits = position;
+    std::size_t length = 0;
+
+    while (position < mEnd and std::isdigit(static_cast<unsigned char>(mBuffer[position])))
+    {
+        length = length * 10 + (mBuffer[position] - '0');
+        ++position;
+
+        if (length > mMaxPayload)
+        {
+            mMalformed = true;
+            return false;
+        }
+    }
+
+    // A length prefix padded beyond the header limit would never let the frame fit into the capacity.
+    if (position - mBegin > MAX_HEADER_SIZE)
+    {
+        mMalformed = true;
+        return false;
+    }
+
+    // The length prefix ends at the first byte that is not a digit.
+    if (position == mEnd)
+    {
+        return false;
+    }
+
+    if (position == digits)
+    {
+        mMalformed = true;
+        return false;
+    }
+
+    mContentOffset = position;
+    mContentLength = length;
+    mLengthParsed = true;
+
+    return true;
+}
+
+bool FrameReader::parseBinaryHeader()
+{
+    if (mEnd - mBegin < BINARY_FRAME_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    BinaryFrameHeader header;
+
+    if (not decodeBinaryFrameHeader(&mBuffer[mBegin], header) or header.mLength > mMaxPayload)
+    {
+        mMalformed = true;
+        return false;
+    }
+
+    mContentOffset = mBegin + BINARY_FRAME_HEADER_SIZE;
+    mContentLength = header.mLength;
+    mRequestId = header.mRequestId;
+    mFlags = header.mFlags;
+    mLengthParsed = true;
+
+    return true;
+}
+
+std::size_t FrameReader::getCapacity() const
+{
+    return mMaxPayload + MAX_HEADER_SIZE;
+}
+
+} // namespace Server
@@ -0,0 +1,212 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/FrameWriter.hpp>
+#include <cerrno>
+#include <cstdio>
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+namespace Server
+{
+
+namespace
+{
+
+/**
+ * @brief The maximum number of frames written with a single call.
+ */
+std::size_t const MAX_FRAMES_PER_WRITE = 32U;
+
+} // namespace
+
+FrameWriter::FrameWriter()
+    : mOffset(0)
+{
+}
+
+void FrameWriter::queue(
+    Framing                const   aFraming,
+    unsigned long long int const   aRequestId,
+    std::string                  & aContent,
+    unsigned char          const   aFlags
+)
+{
+    mFrames.push_back(Frame());
+
+    Frame & frame = mFrames.back();
+    frame.mHeaderLength = formatHeader(frame.mHeader, aFraming, aRequestId, aContent.length(), aFlags);
+    frame.mContent.swap(aContent);
+}
+
+bool FrameWriter::send(
+    int const aDescriptor
+)
+{
+    while (not mFrames.empty())
+    {
+        iovec vectors[2 * MAX_FRAMES_PER_WRITE];
+        std::size_t count = 0;
+        std::size_t skip = mOffset;
+
+        for (std::deque<Frame>::iterator it = mFrames.begin();
+             it != mFrames.end() and count < 2 * MAX_FRAMES_PER_WRITE;
+             ++it)
+        {
+            char * const parts[2] = {it->mHeader, const_cast<char *>(it->mContent.data())};
+            std::size_t const lengths[2] = {it->mHeaderLength, it->mContent.length()};
+
+            for (std::size_t i = 0; i < 2; ++i)
+            {
+                if (skip >= lengths[i])
+                {
+                    skip -= lengths[i];
+                    continue;
+                }
+
+                vectors[count].iov_base = parts[i] + skip;
+                vectors[count].iov_len = lengths[i] - skip;
+                skip = 0;
+                ++count;
+            }
+        }
+
+        msghdr message = msghdr();
+        message.msg_iov = vectors;
+        message.msg_iovlen = count;
+
+        ssize_t const sent = ::sendmsg(aDescriptor, &message, MSG_NOSIGNAL);
+
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return errno == EAGAIN or errno == EWOULDBLOCK;
+        }
+
+        // Drop the frames that have been written completely.
+        mOffset += sent;
+
+        while (not mFrames.empty() and mOffset >= mFrames.front().mHeaderLength + mFrames.front().mContent.length())
+        {
+            mOffset -= mFrames.front().mHeaderLength + mFrames.front().mContent.length();
+            mFrames.pop_front();
+        }
+    }
+
+    mOffset = 0;
+
+    return true;
+}
+
+bool FrameWriter::isEmpty() const
+{
+    return mFrames.empty();
+}
+
+bool FrameWriter::write(
+    int                    const   aDescriptor,
+    Framing                const   aFraming,
+    unsigned long long int const   aRequestId,
+    std::string            const & aContent,
+    unsigned char          const   aFlags
+)
+{
+    char header[24];
+    std::size_t const headerLength = formatHeader(header, aFraming, aRequestId, aContent.length(), aFlags);
+
+    std::size_t const total = headerLength + aContent.length();
+    std::size_t written = 0;
+
+    while (written < total)
+    {
+        iovec vectors[2];
+        std::size_t count = 0;
+
+        if (written < headerLength)
+        {
+            vectors[count].iov_base = header + written;
+            vectors[count].iov_len = headerLength - written;
+            ++count;
+        }
+
+        std::size_t const contentWritten = written < headerLength ? 0 : written - headerLength;
+
+        vectors[count].iov_base = const_cast<char *>(aContent.data()) + contentWritten;
+        vectors[count].iov_len = aContent.length() - contentWritten;
+        ++count;
+
+        msghdr message = msghdr();
+        message.msg_iov = vectors;
+        message.msg_iovlen = count;
+
+        ssize_t const sent = ::sendmsg(aDescriptor, &message, MSG_NOSIGNAL);
+
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return false;
+        }
+
+        written += sent;
+    }
+
+    return true;
+}
+
+std::size_t FrameWriter::formatHeader(
+    char                         * aHeader,
+    Framing                const   aFraming,
+    unsigned long long int const   aRequestId,
+    std::size_t            const   aLength,
+    unsigned char          const   aFlags
+)
+{
+    if (aFraming == FRAMING_BINARY)
+    {
+        BinaryFrameHeader header;
+        header.mVersion = BINARY_FRAME_VERSION;
+        header.mFlags = aFlags;
+        header.mLength = static_cast<unsigned int>(aLength);
+        header.mRequestId = aRequestId;
+
+        encodeBinaryFrameHeader(header, aHeader);
+
+        return BINARY_FRAME_HEADER_SIZE;
+    }
+
+    return std::sprintf(aHeader, "%lu", static_cast<unsigned long>(aLength));
+}
+
+} // namespace Server
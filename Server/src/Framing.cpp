@@ -0,0 +1,97 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/Framing.hpp>
+
+namespace Server
+{
+
+namespace
+{
+
+void encodeInteger(
+    unsigned long long int         aValue,
+    std::size_t            const   aSize,
+    char                         * aBuffer
+)
+{
+    for (std::size_t i = aSize; i > 0; --i)
+    {
+        aBuffer[i - 1] = static_cast<char>(aValue & 0xFF);
+        aValue >>= 8;
+    }
+}
+
+unsigned long long int decodeInteger(
+    std::size_t const   aSize,
+    char        const * aBuffer
+)
+{
+    unsigned long long int value = 0;
+
+    for (std::size_t i = 0; i < aSize; ++i)
+    {
+        value = (value << 8) | static_cast<unsigned char>(aBuffer[i]);
+    }
+
+    return value;
+}
+
+} // namespace
+
+void encodeBinaryFrameHeader(
+    BinaryFrameHeader const & aHeader,
+    char                    * aBuffer
+)
+{
+    aBuffer[0] = BINARY_FRAME_MAGIC[0];
+    aBuffer[1] = BINARY_FRAME_MAGIC[1];
+    aBuffer[2] = static_cast<char>(aHeader.mVersion);
+    aBuffer[3] = static_cast<char>(aHeader.mFlags);
+    encodeInteger(aHeader.mLength, 4, aBuffer + 4);
+    encodeInteger(aHeader.mRequestId, 8, aBuffer + 8);
+}
+
+bool decodeBinaryFrameHeader(
+    char              const * aBuffer,
+    BinaryFrameHeader       & aHeader
+)
+{
+    if (aBuffer[0] != BINARY_FRAME_MAGIC[0] or aBuffer[1] != BINARY_FRAME_MAGIC[1])
+    {
+        return false;
+    }
+
+    aHeader.mVersion = static_cast<unsigned char>(aBuffer[2]);
+    aHeader.mFlags = static_cast<unsigned char>(aBuffer[3]);
+    aHeader.mLength = static_cast<unsigned int>(decodeInteger(4, aBuffer + 4));
+    aHeader.mRequestId = decodeInteger(8, aBuffer + 8);
+
+    return aHeader.mVersion == BINARY_FRAME_VERSION;
+}
+
+} // namespace Server
@@ -0,0 +1,143 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/IdempotencyCache.hpp>
+
+namespace Server
+{
+
+IdempotencyCache::IdempotencyCache(
+    unsigned int const aTimeout,
+    std::size_t  const aMaxEntries
+)
+    : mTimeout(static_cast<Poco::Timestamp::TimeDiff>(aTimeout) * 1000),
+      mMaxEntries(aMaxEntries)
+{
+}
+
+IdempotencyState IdempotencyCache::begin(
+    std::string        const & aLogin,
+    std::string        const & aKey,
+    unsigned short int const   aCommandId,
+    std::string              & aReply
+)
+{
+    if (not mTimeout or not mMaxEntries)
+    {
+        return IDEMPOTENCY_STATE_NEW;
+    }
+
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    Key const key(aLogin, aKey, aCommandId);
+    Entries::iterator const it = mEntries.find(key);
+
+    if (it != mEntries.end())
+    {
+        if (not it->second.mCreated.isElapsed(mTimeout))
+        {
+            if (not it->second.mCompleted)
+            {
+                return IDEMPOTENCY_STATE_IN_PROGRESS;
+            }
+
+            aReply = it->second.mReply;
+
+            return IDEMPOTENCY_STATE_COMPLETED;
+        }
+
+        remove(it);
+    }
+
+    purge();
+
+    Entry & entry = mEntries[key];
+    entry.mCompleted = false;
+    entry.mPosition = mOrder.insert(mOrder.end(), key);
+
+    return IDEMPOTENCY_STATE_NEW;
+}
+
+void IdempotencyCache::complete(
+    std::string        const & aLogin,
+    std::string        const & aKey,
+    unsigned short int const   aCommandId,
+    std::string        const & aReply
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    // The entry may have been forgotten meanwhile to make room for newer ones.
+    Entries::iterator const it = mEntries.find(Key(aLogin, aKey, aCommandId));
+
+    if (it != mEntries.end())
+    {
+        it->second.mCompleted = true;
+        it->second.mReply = aReply;
+    }
+}
+
+void IdempotencyCache::abandon(
+    std::string        const & aLogin,
+    std::string        const & aKey,
+    unsigned short int const   aCommandId
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    Entries::iterator const it = mEntries.find(Key(aLogin, aKey, aCommandId));
+
+    if (it != mEntries.end() and not it->second.mCompleted)
+    {
+        remove(it);
+    }
+}
+
+void IdempotencyCache::remove(
+    Entries::iterator const aEntry
+)
+{
+    mOrder.erase(aEntry->second.mPosition);
+    mEntries.erase(aEntry);
+}
+
+void IdempotencyCache::purge()
+{
+    while (not mOrder.empty())
+    {
+        Entries::iterator const oldest = mEntries.find(mOrder.front());
+
+        if (mEntries.size() < mMaxEntries and not oldest->second.mCreated.isElapsed(mTimeout))
+        {
+            break;
+        }
+
+        remove(oldest);
+    }
+}
+
+} // namespace Server
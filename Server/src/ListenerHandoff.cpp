@@ -0,0 +1,319 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Poco/Process.h>
+#include <Server/include/ListenerHandoff.hpp>
+#include <cstring>
+#include <iostream>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace Server
+{
+
+namespace
+{
+
+/**
+ * @brief The maximum number of listening sockets handed off at once.
+ */
+std::size_t const MAX_HANDED_OFF_DESCRIPTORS = 64U;
+
+/**
+ * @brief Fills the address of a Unix domain socket.
+ *
+ * @return False if the path is too long, true otherwise.
+ */
+bool makeAddress(
+    std::string const & aPath,
+    sockaddr_un       & aAddress
+)
+{
+    std::memset(&aAddress, 0, sizeof(aAddress));
+    aAddress.sun_family = AF_UNIX;
+
+    if (aPath.length() >= sizeof(aAddress.sun_path))
+    {
+        return false;
+    }
+
+    std::memcpy(aAddress.sun_path, aPath.c_str(), aPath.length());
+
+    return true;
+}
+
+/**
+ * @brief Verifies whether the peer of a Unix domain socket connection runs as a user.
+ *
+ * @return True if the credentials of the peer are known and its user matches, false otherwise.
+ */
+bool isPeer(
+    int   const aDescriptor,
+    uid_t const aUid
+)
+{
+    ucred credentials;
+    socklen_t length = sizeof(credentials);
+
+    if (::getsockopt(aDescriptor, SOL_SOCKET, SO_PEERCRED, &credentials, &length) != 0
+        or length != sizeof(credentials))
+    {
+        return false;
+    }
+
+    return credentials.uid == aUid;
+}
+
+} // namespace
+
+bool ListenerHandoff::takeOver(
+    std::string      const & aPath,
+    std::vector<int>       & aDescriptors
+)
+{
+    sockaddr_un address;
+
+    if (not makeAddress(aPath, address))
+    {
+        return false;
+    }
+
+    int const descriptor = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    if (::connect(descriptor, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0)
+    {
+        // Nobody offers the listening sockets, this is the first server.
+        ::close(descriptor);
+        return false;
+    }
+
+    char data;
+    iovec vector = {&data, sizeof(data)};
+    std::vector<char> control(CMSG_SPACE(sizeof(int) * MAX_HANDED_OFF_DESCRIPTORS));
+
+    msghdr message = msghdr();
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = &control[0];
+    message.msg_controllen = control.size();
+
+    if (::recvmsg(descriptor, &message, MSG_CMSG_CLOEXEC) <= 0)
+    {
+        ::close(descriptor);
+        return false;
+    }
+
+    for (cmsghdr * header = CMSG_FIRSTHDR(&message); header; header = CMSG_NXTHDR(&message, header))
+    {
+        if (header->cmsg_level == SOL_SOCKET and header->cmsg_type == SCM_RIGHTS)
+        {
+            std::size_t const count = (header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            int const * const descriptors = reinterpret_cast<int const *>(CMSG_DATA(header));
+
+            aDescriptors.insert(aDescriptors.end(), descriptors, descriptors + count);
+        }
+    }
+
+    // The predecessor closes the connection once it has released the path.
+    while (::read(descriptor, &data, sizeof(data)) > 0)
+    {
+    }
+
+    ::close(descriptor);
+
+    return not aDescriptors.empty();
+}
+
+ListenerHandoff::ListenerHandoff(
+    std::string      const & aPath,
+    std::vector<int> const & aDescriptors,
+    uid_t            const   aTrustedUid
+)
+    : mPath(aPath),
+      mDescriptors(aDescriptors),
+      mTrustedUid(aTrustedUid),
+      mDescriptor(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)),
+      mWakeUpDescriptor(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+      mStopRequested(0),
+      mHandedOff(false)
+{
+    sockaddr_un address;
+
+    if (   mDescriptor < 0
+        or mWakeUpDescriptor < 0
+        or mDescriptors.empty()
+        or mDescriptors.size() > MAX_HANDED_OFF_DESCRIPTORS
+        or not makeAddress(mPath, address))
+    {
+        release();
+        closeWakeUp();
+        throw std::runtime_error("Could not create the listener handoff.");
+    }
+
+    // A path left behind by a crashed server would make the bind fail.
+    ::unlink(mPath.c_str());
+
+    // Nobody connects before the listen, so the path is restricted to the owner before anybody could.
+    if (   ::bind(mDescriptor, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0
+        or ::chmod(mPath.c_str(), S_IRUSR | S_IWUSR) != 0
+        or ::listen(mDescriptor, 1) != 0)
+    {
+        release();
+        closeWakeUp();
+        throw std::runtime_error("Could not bind the listener handoff.");
+    }
+}
+
+ListenerHandoff::~ListenerHandoff()
+{
+    release();
+    closeWakeUp();
+}
+
+void ListenerHandoff::start()
+{
+    mThread.start(*this);
+}
+
+void ListenerHandoff::stop()
+{
+    mStopRequested = 1;
+
+    uint64_t const counter = 1;
+    ssize_t const written = ::write(mWakeUpDescriptor, &counter, sizeof(counter));
+    (void) written;
+
+    mThread.join();
+}
+
+bool ListenerHandoff::isHandedOff() const
+{
+    return mHandedOff;
+}
+
+void ListenerHandoff::run()
+{
+    while (not mStopRequested.value())
+    {
+        pollfd descriptors[] = {{mDescriptor, POLLIN, 0}, {mWakeUpDescriptor, POLLIN, 0}};
+
+        if (::poll(descriptors, 2, -1) <= 0 or not (descriptors[0].revents & POLLIN))
+        {
+            continue;
+        }
+
+        int const successor = ::accept4(mDescriptor, 0, 0, SOCK_CLOEXEC);
+
+        if (successor < 0)
+        {
+            continue;
+        }
+
+        // Only a server run by the same user may take the listening sockets over and terminate this one.
+        if (not isPeer(successor, mTrustedUid))
+        {
+            std::clog << "A listener handoff to a foreign user has been refused." << std::endl;
+            ::close(successor);
+            continue;
+        }
+
+        if (not handOff(successor))
+        {
+            ::close(successor);
+            continue;
+        }
+
+        mHandedOff = true;
+
+        // The path is released before the successor is let go, so the successor may offer it in turn.
+        release();
+        ::close(successor);
+
+        std::clog << "Listening sockets have been handed off, draining." << std::endl;
+
+        Poco::Process::requestTermination(Poco::Process::id());
+
+        return;
+    }
+}
+
+bool ListenerHandoff::handOff(
+    int const aDescriptor
+) const
+{
+    char data = 0;
+    iovec vector = {&data, sizeof(data)};
+    std::vector<char> control(CMSG_SPACE(sizeof(int) * mDescriptors.size()));
+
+    msghdr message = msghdr();
+    message.msg_iov = &vector;
+    message.msg_iovlen = 1;
+    message.msg_control = &control[0];
+    message.msg_controllen = control.size();
+
+    cmsghdr * header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int) * mDescriptors.size());
+    std::memcpy(CMSG_DATA(header), &mDescriptors[0], sizeof(int) * mDescriptors.size());
+
+    return ::sendmsg(aDescriptor, &message, MSG_NOSIGNAL) == static_cast<ssize_t>(sizeof(data));
+}
+
+void ListenerHandoff::release()
+{
+    if (mDescriptor < 0)
+    {
+        return;
+    }
+
+    ::close(mDescriptor);
+    mDescriptor = -1;
+
+    ::unlink(mPath.c_str());
+}
+
+void ListenerHandoff::closeWakeUp()
+{
+    if (mWakeUpDescriptor >= 0)
+    {
+        ::close(mWakeUpDescriptor);
+        mWakeUpDescriptor = -1;
+    }
+}
+
+} // namespace Server
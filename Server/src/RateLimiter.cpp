@@ -0,0 +1,152 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/RateLimiter.hpp>
+#include <algorithm>
+
+namespace Server
+{
+
+RateLimiter::RateLimiter(
+    RateLimit   const aLoginLimit,
+    RateLimit   const aReadLimit,
+    RateLimit   const aWriteLimit,
+    std::size_t const aMaxLogins
+)
+    : mLoginLimit(aLoginLimit),
+      mMaxLogins(aMaxLogins)
+{
+    Poco::Timestamp const now;
+
+    if (aReadLimit.mRate)
+    {
+        mReadBucket.reset(new TokenBucket(aReadLimit.mRate, aReadLimit.mBurst, now.epochMicroseconds()));
+    }
+
+    if (aWriteLimit.mRate)
+    {
+        mWriteBucket.reset(new TokenBucket(aWriteLimit.mRate, aWriteLimit.mBurst, now.epochMicroseconds()));
+    }
+
+    if (aLoginLimit.mRate)
+    {
+        mUnauthenticatedBucket.reset(new TokenBucket(aLoginLimit.mRate, aLoginLimit.mBurst, now.epochMicroseconds()));
+    }
+}
+
+bool RateLimiter::admit(
+    std::string              const & aLogin,
+    CommandClass             const   aClass,
+    Poco::Timestamp::TimeVal const   aNow,
+    Poco::Timestamp::TimeDiff      & aRetryAfter
+)
+{
+    // The verified moderator keeps the world running, its commands must not wait for the bots.
+    if (aClass == COMMAND_CLASS_MODERATOR)
+    {
+        return true;
+    }
+
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    TokenBucket * const classBucket = (aClass == COMMAND_CLASS_READ) ? mReadBucket.get() : mWriteBucket.get();
+    TokenBucket * loginBucket = NULL;
+
+    // If too many logins are active to be told apart, the request counts against its class only.
+    if (aLogin.empty())
+    {
+        loginBucket = mUnauthenticatedBucket.get();
+    }
+    else if (mLoginLimit.mRate)
+    {
+        loginBucket = getLoginBucket(aLogin, aNow);
+    }
+
+    aRetryAfter = std::max(
+        classBucket ? classBucket->getWait(aNow) : 0,
+        loginBucket ? loginBucket->getWait(aNow) : 0
+    );
+
+    if (aRetryAfter)
+    {
+        return false;
+    }
+
+    if (classBucket)
+    {
+        classBucket->take();
+    }
+
+    if (loginBucket)
+    {
+        loginBucket->take();
+    }
+
+    return true;
+}
+
+TokenBucket * RateLimiter::getLoginBucket(
+    std::string              const & aLogin,
+    Poco::Timestamp::TimeVal const   aNow
+)
+{
+    LoginBuckets::iterator it = mLoginBuckets.find(aLogin);
+
+    if (it != mLoginBuckets.end())
+    {
+        return &it->second;
+    }
+
+    if (mLoginBuckets.size() >= mMaxLogins)
+    {
+        // A full bucket is as good as a new one, so forgetting it does not let anyone through sooner.
+        for (LoginBuckets::iterator bucket = mLoginBuckets.begin(); bucket != mLoginBuckets.end(); )
+        {
+            if (bucket->second.isFull(aNow))
+            {
+                mLoginBuckets.erase(bucket++);
+            }
+            else
+            {
+                ++bucket;
+            }
+        }
+
+        if (mLoginBuckets.size() >= mMaxLogins)
+        {
+            return NULL;
+        }
+    }
+
+    it = mLoginBuckets.insert(
+             std::make_pair(aLogin, TokenBucket(mLoginLimit.mRate, mLoginLimit.mBurst, aNow))
+         ).first;
+
+    return &it->second;
+}
+
+} // namespace Server
@@ -0,0 +1,857 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Server/include/Reactor.hpp>
+#include <boost/make_shared.hpp>
+#include <cerrno>
+#include <fcntl.h>
+#include <iostream>
+#include <stdexcept>
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace Server
+{
+
+namespace
+{
+
+/**
+ * @brief Reserved identifiers of the epoll events not related to connections.
+ */
+unsigned long long int const LISTENER_ID = 0;
+unsigned long long int const WAKE_UP_ID  = 1;
+
+int const MAX_EVENTS = 256;
+
+int const SWEEP_INTERVAL_MS = 1000;
+
+} // namespace
+
+class Reactor::Subscriber
+    : public ISubscriber
+{
+public:
+    Subscriber(
+        Reactor                      & aReactor,
+        unsigned long long int const   aConnectionId
+    )
+        : mReactor(&aReactor),
+          mConnectionId(aConnectionId),
+          mCodec(CODEC_XML),
+          mSubscribed(false)
+    {
+    }
+
+    virtual bool notify(
+        std::string const & aContent
+    )
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        if (not mReactor)
+        {
+            return false;
+        }
+
+        mReactor->postIndication(mConnectionId, aContent);
+
+        return true;
+    }
+
+    virtual Codec getCodec() const
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        return mCodec;
+    }
+
+    virtual void markSubscribed()
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        mSubscribed = true;
+    }
+
+    /**
+     * @brief Verifies whether the connection has been subscribed to a world.
+     *
+     * @return True if the connection has been subscribed, false otherwise.
+     */
+    bool isSubscribed() const
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        return mSubscribed;
+    }
+
+    void setCodec(
+        Codec const aCodec
+    )
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        mCodec = aCodec;
+    }
+
+    /**
+     * @brief Cuts the subscriber off the reactor, the connection is gone.
+     */
+    void detach()
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        mReactor = 0;
+    }
+
+private:
+    mutable Poco::Mutex mMutex;
+
+    Reactor * mReactor;
+
+    unsigned long long int const mConnectionId;
+
+    Codec mCodec;
+
+    bool mSubscribed;
+};
+
+Reactor::Reactor(
+    IContextShrPtr         aContext,
+    int            const   aListenerDescriptor,
+    RequestQueue         & aRequestQueue,
+    unsigned int   const   aListenerId,
+    CpuSet         const & aCpus
+)
+    : mRequestProcessor(aContext),
+      mListenerDescriptor(aListenerDescriptor),
+      mRequestQueue(aRequestQueue),
+      mBufferPool(aContext->getBufferPool()),
+      mArenaPool(aContext->getArenaPool()),
+      mSubscriptionRegistry(aContext->getSubscriptionRegistry()),
+      mMaxRequests(aContext->getConfigurator()->getConnectionMaxRequests()),
+      mMaxPayload(aContext->getConfigurator()->getConnectionMaxPayload()),
+      mMaxInFlight(aContext->getConfigurator()->getConnectionMaxInFlight()),
+      mIdleTimeout(
+          static_cast<Poco::Timespan::TimeDiff>(aContext->getConfigurator()->getConnectionIdleTimeout())
+          * Poco::Timespan::MILLISECONDS
+      ),
+      mReportInterval(
+          static_cast<Poco::Timespan::TimeDiff>(aContext->getConfigurator()->getQueueReportInterval())
+          * Poco::Timespan::MILLISECONDS
+      ),
+      mListenerId(aListenerId),
+      mCpus(aCpus),
+      mAccepted(0),
+      mEpollDescriptor(::epoll_create1(EPOLL_CLOEXEC)),
+      mWakeUpDescriptor(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)),
+      mSpareDescriptor(::open("/dev/null", O_RDONLY | O_CLOEXEC)),
+      mNextConnectionId(WAKE_UP_ID + 1),
+      mStopRequested(0),
+      mDrainRequested(0),
+      mDraining(false)
+{
+    if (mEpollDescriptor < 0 or mWakeUpDescriptor < 0)
+    {
+        throw std::runtime_error("Could not create the reactor.");
+    }
+
+    ::fcntl(mListenerDescriptor, F_SETFL, ::fcntl(mListenerDescriptor, F_GETFL) | O_NONBLOCK);
+
+    epoll_event event = epoll_event();
+
+    event.events = EPOLLIN;
+    event.data.u64 = LISTENER_ID;
+    ::epoll_ctl(mEpollDescriptor, EPOLL_CTL_ADD, mListenerDescriptor, &event);
+
+    event.events = EPOLLIN;
+    event.data.u64 = WAKE_UP_ID;
+    ::epoll_ctl(mEpollDescriptor, EPOLL_CTL_ADD, mWakeUpDescriptor, &event);
+}
+
+Reactor::~Reactor()
+{
+    closeConnections();
+
+    if (mSpareDescriptor >= 0)
+    {
+        ::close(mSpareDescriptor);
+    }
+
+    ::close(mWakeUpDescriptor);
+    ::close(mEpollDescriptor);
+}
+
+void Reactor::start()
+{
+    mThread.start(*this);
+}
+
+void Reactor::stop()
+{
+    mStopRequested = 1;
+    wakeUp();
+    mThread.join();
+    closeConnections();
+}
+
+void Reactor::drain()
+{
+    mDrainRequested = 1;
+    wakeUp();
+}
+
+bool Reactor::waitForDrain(
+    long const aTimeout
+)
+{
+    return mThread.tryJoin(aTimeout);
+}
+
+void Reactor::postReply(
+    unsigned long long int         aConnectionId,
+    unsigned long long int         aRequestId,
+    std::string            const & aContent,
+    unsigned char                  aFlags
+)
+{
+    Completion completion = {aConnectionId, aRequestId, aContent, aFlags, false, false};
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mCompletionsMutex);
+        mCompletions.push_back(completion);
+    }
+
+    wakeUp();
+}
+
+bool Reactor::postPart(
+    unsigned long long int         aConnectionId,
+    unsigned long long int         aRequestId,
+    std::string            const & aContent,
+    unsigned char                  aFlags
+)
+{
+    Completion completion = {aConnectionId, aRequestId, aContent, aFlags, false, false, boost::make_shared<Receipt>()};
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mCompletionsMutex);
+
+        // Checked under the lock, the loop fails the receipts still queued once it is over.
+        if (mStopRequested.value())
+        {
+            return false;
+        }
+
+        mCompletions.push_back(completion);
+    }
+
+    wakeUp();
+
+    // The worker does not fetch the next part before this one has left, only a part at a time is held per listing.
+    completion.mReceipt->mEvent.wait();
+
+    return completion.mReceipt->mWritten;
+}
+
+void Reactor::postFailure(
+    unsigned long long int aConnectionId
+)
+{
+    Completion completion = {aConnectionId, 0, std::string(), 0, true, false};
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mCompletionsMutex);
+        mCompletions.push_back(completion);
+    }
+
+    wakeUp();
+}
+
+void Reactor::postIndication(
+    unsigned long long int         aConnectionId,
+    std::string            const & aContent
+)
+{
+    Completion completion = {aConnectionId, 0, aContent, 0, false, true};
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mCompletionsMutex);
+        mCompletions.push_back(completion);
+    }
+
+    wakeUp();
+}
+
+void Reactor::run()
+{
+    if (not pinCurrentThread(mCpus))
+    {
+        std::clog << "Could not pin the reactor of listener " << mListenerId << " to its CPUs." << std::endl;
+    }
+
+    epoll_event events[MAX_EVENTS];
+
+    Poco::Timestamp lastSweep;
+    Poco::Timestamp lastReport;
+
+    while (not mStopRequested.value())
+    {
+        if (mDrainRequested.value() and not mDraining)
+        {
+            startDraining();
+        }
+
+        if (mDraining and mConnections.empty())
+        {
+            break;
+        }
+
+        int const ready = ::epoll_wait(mEpollDescriptor, events, MAX_EVENTS, SWEEP_INTERVAL_MS);
+
+        for (int i = 0; i < ready; ++i)
+        {
+            if (events[i].data.u64 == LISTENER_ID)
+            {
+                if (not mDraining)
+                {
+                    acceptConnections();
+                }
+            }
+            else if (events[i].data.u64 == WAKE_UP_ID)
+            {
+                handleCompletions();
+            }
+            else
+            {
+                handleConnectionEvent(events[i].data.u64, events[i].events);
+            }
+        }
+
+        if (lastSweep.isElapsed(SWEEP_INTERVAL_MS * Poco::Timespan::MILLISECONDS))
+        {
+            sweepIdleConnections();
+            lastSweep.update();
+        }
+
+        if (mReportInterval.totalMicroseconds() and lastReport.isElapsed(mReportInterval.totalMicroseconds()))
+        {
+            reportStatistics();
+            lastReport.update();
+        }
+    }
+
+    releaseAllReceipts();
+}
+
+void Reactor::acceptConnections()
+{
+    while (true)
+    {
+        int const descriptor = ::accept4(mListenerDescriptor, 0, 0, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        if (descriptor < 0)
+        {
+            if (errno == EINTR or errno == ECONNABORTED)
+            {
+                continue;
+            }
+
+            // The listener is level triggered, a connection left in the backlog would wake the loop up at once.
+            if ((errno == EMFILE or errno == ENFILE) and dropConnection())
+            {
+                continue;
+            }
+
+            // EAGAIN means that the backlog has been drained, anything else is left for the next round.
+            return;
+        }
+
+        unsigned long long int const connectionId = mNextConnectionId++;
+        ++mAccepted;
+
+        mConnections[connectionId] =
+            ReactorConnectionShrPtr(new ReactorConnection(descriptor, connectionId, mBufferPool, mMaxPayload, mMaxInFlight));
+
+        epoll_event event = epoll_event();
+        event.events = EPOLLIN | EPOLLRDHUP;
+        event.data.u64 = connectionId;
+        ::epoll_ctl(mEpollDescriptor, EPOLL_CTL_ADD, descriptor, &event);
+    }
+}
+
+bool Reactor::dropConnection()
+{
+    if (mSpareDescriptor < 0)
+    {
+        return false;
+    }
+
+    ::close(mSpareDescriptor);
+
+    int const descriptor = ::accept4(mListenerDescriptor, 0, 0, SOCK_CLOEXEC);
+
+    if (descriptor >= 0)
+    {
+        ::close(descriptor);
+    }
+
+    mSpareDescriptor = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+
+    return descriptor >= 0;
+}
+
+void Reactor::handleConnectionEvent(
+    unsigned long long int const aConnectionId,
+    unsigned int           const aEvents
+)
+{
+    Connections::iterator it = mConnections.find(aConnectionId);
+
+    if (it == mConnections.end())
+    {
+        return;
+    }
+
+    ReactorConnection & connection = *(it->second);
+
+    if (aEvents & EPOLLERR)
+    {
+        closeConnection(aConnectionId);
+        return;
+    }
+
+    if (aEvents & (EPOLLIN | EPOLLRDHUP | EPOLLHUP))
+    {
+        if (not connection.receive() or connection.isMalformed())
+        {
+            closeConnection(aConnectionId);
+            return;
+        }
+
+        if (not dispatchRequest(connection))
+        {
+            closeConnection(aConnectionId);
+            return;
+        }
+    }
+
+    if (not flush(connection) or isDone(connection))
+    {
+        closeConnection(aConnectionId);
+    }
+}
+
+void Reactor::handleCompletions()
+{
+    uint64_t counter;
+    while (::read(mWakeUpDescriptor, &counter, sizeof(counter)) > 0)
+    {
+    }
+
+    std::vector<Completion> completions;
+
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mCompletionsMutex);
+        completions.swap(mCompletions);
+    }
+
+    for (std::vector<Completion>::iterator it = completions.begin(); it != completions.end(); ++it)
+    {
+        Connections::iterator connection = mConnections.find(it->mConnectionId);
+
+        // The peer may have gone away while its request was being executed.
+        if (connection == mConnections.end())
+        {
+            if (it->mReceipt)
+            {
+                it->mReceipt->mEvent.set();
+            }
+
+            continue;
+        }
+
+        if (it->mFailed)
+        {
+            closeConnection(it->mConnectionId);
+            continue;
+        }
+
+        // An indication is not an answer to anything, the requests of the connection are not affected.
+        if (it->mIndication)
+        {
+            connection->second->queueIndication(it->mContent);
+
+            if (not flush(*(connection->second)))
+            {
+                closeConnection(it->mConnectionId);
+            }
+
+            continue;
+        }
+
+        connection->second->queueReply(it->mRequestId, it->mContent, it->mFlags);
+
+        // Released by the flush once the part has been written out, or when the connection is closed.
+        if (it->mReceipt)
+        {
+            mReceipts.insert(Receipts::value_type(it->mConnectionId, it->mReceipt));
+        }
+
+        if (not dispatchRequest(*(connection->second))
+            or not flush(*(connection->second))
+            or isDone(*(connection->second)))
+        {
+            closeConnection(it->mConnectionId);
+        }
+    }
+}
+
+void Reactor::sweepIdleConnections()
+{
+    std::vector<unsigned long long int> idle;
+
+    for (Connections::const_iterator it = mConnections.begin(); it != mConnections.end(); ++it)
+    {
+        // A subscribed connection stays open for the indications until the peer closes it.
+        Subscribers::const_iterator const subscriber = mSubscribers.find(it->first);
+
+        if (subscriber != mSubscribers.end() and subscriber->second->isSubscribed())
+        {
+            continue;
+        }
+
+        if (it->second->isIdle(mIdleTimeout))
+        {
+            idle.push_back(it->first);
+        }
+    }
+
+    for (std::vector<unsigned long long int>::const_iterator it = idle.begin(); it != idle.end(); ++it)
+    {
+        closeConnection(*it);
+    }
+}
+
+bool Reactor::dispatchRequest(
+    ReactorConnection & aConnection
+)
+{
+    char const * content;
+    std::size_t length;
+    unsigned long long int requestId;
+    unsigned char flags;
+
+    // A draining reactor lets the peer retry the requests not started yet with the successor.
+    if (mDraining)
+    {
+        return true;
+    }
+
+    while (    (mMaxRequests == 0 or aConnection.getAccepted() < mMaxRequests)
+           and aConnection.extractRequest(content, length, requestId, flags))
+    {
+        Protocol::Payload const payload(content, length);
+        aConnection.acceptRequest();
+
+        // The handshake switches the codec of the requests that follow it.
+        if (flags & BINARY_FRAME_FLAG_NEGOTIATE)
+        {
+            aConnection.setCodec(negotiateCodec(payload.getContent()));
+
+            std::string reply = getCodecName(aConnection.getCodec());
+            aConnection.queueReply(requestId, reply, BINARY_FRAME_FLAG_NEGOTIATE);
+            continue;
+        }
+
+        QueuedRequest request;
+        request.mReplySink = this;
+        request.mListenerId = mListenerId;
+        request.mConnectionId = aConnection.getId();
+        request.mRequestId = requestId;
+        request.mFlags = flags;
+        request.mCodec = aConnection.getCodec();
+        request.mArena = mArenaPool->acquire();
+
+        try
+        {
+            // The scope ends before the request is queued, a worker takes the arena over from there.
+            Language::ArenaScope const arenaScope(request.mArena.get());
+            request.mCommand = mRequestProcessor.decode(payload, request.mCodec);
+        }
+        catch (std::exception const &)
+        {
+            return false;
+        }
+
+        // Throttled requests are answered right away, they must not take the room of the admitted ones.
+        Poco::Timestamp::TimeDiff retryAfter;
+
+        request.mClass = mRequestProcessor.classify(request.mCommand);
+        request.mIdentity = mRequestProcessor.identify(request.mCommand);
+
+        if (not mRequestProcessor.admit(request.mClass, request.mIdentity, retryAfter))
+        {
+            std::string reply = mRequestProcessor.throttle(request.mCommand, retryAfter, request.mCodec).getContent();
+            aConnection.queueReply(requestId, reply);
+            continue;
+        }
+
+        if (request.mCommand->getID() == Language::ID_COMMAND_SUBSCRIBE_REQUEST)
+        {
+            request.mSubscriber = getSubscriber(aConnection.getId(), request.mCodec);
+        }
+
+        std::vector<QueuedRequest> shedRequests;
+
+        bool const queued = mRequestQueue.push(request, shedRequests);
+
+        for (std::vector<QueuedRequest>::const_iterator it = shedRequests.begin(); it != shedRequests.end(); ++it)
+        {
+            it->mReplySink->postReply(
+                it->mConnectionId,
+                it->mRequestId,
+                mRequestProcessor.reject(it->mCommand, Game::REPLY_STATUS_SERVER_BUSY, it->mCodec).getContent()
+            );
+        }
+
+        // Answer the rejected request right away and go on with the next one.
+        if (not queued)
+        {
+            std::string reply =
+                mRequestProcessor.reject(request.mCommand, Game::REPLY_STATUS_SERVER_BUSY, request.mCodec).getContent();
+            aConnection.queueReply(requestId, reply);
+        }
+    }
+
+    return true;
+}
+
+bool Reactor::flush(
+    ReactorConnection & aConnection
+)
+{
+    if (not aConnection.send())
+    {
+        return false;
+    }
+
+    if (not aConnection.hasPendingOutput())
+    {
+        releaseReceipts(aConnection.getId(), true);
+    }
+
+    // Stop watching for input once the peer has shut down its sending side, the events would fire continuously.
+    // Input is not watched either while the connection does not take it, until a reply frees a slot.
+    epoll_event event = epoll_event();
+    event.events = (aConnection.isReceiving() ? static_cast<uint32_t>(EPOLLIN | EPOLLRDHUP) : 0U)
+                 | (aConnection.hasPendingOutput() ? static_cast<uint32_t>(EPOLLOUT) : 0U);
+    event.data.u64 = aConnection.getId();
+    ::epoll_ctl(mEpollDescriptor, EPOLL_CTL_MOD, aConnection.getDescriptor(), &event);
+
+    return true;
+}
+
+bool Reactor::isDone(
+    ReactorConnection const & aConnection
+) const
+{
+    if (aConnection.hasPendingOutput() or aConnection.isBusy())
+    {
+        return false;
+    }
+
+    // The connection is closed once the last reply allowed has been written.
+    return mDraining
+        or aConnection.isFinished()
+        or (mMaxRequests != 0 and aConnection.getAccepted() >= mMaxRequests);
+}
+
+void Reactor::startDraining()
+{
+    mDraining = true;
+
+    ::epoll_ctl(mEpollDescriptor, EPOLL_CTL_DEL, mListenerDescriptor, 0);
+
+    std::vector<unsigned long long int> done;
+
+    for (Connections::const_iterator it = mConnections.begin(); it != mConnections.end(); ++it)
+    {
+        if (isDone(*(it->second)))
+        {
+            done.push_back(it->first);
+        }
+    }
+
+    for (std::vector<unsigned long long int>::const_iterator it = done.begin(); it != done.end(); ++it)
+    {
+        closeConnection(*it);
+    }
+}
+
+void Reactor::closeConnection(
+    unsigned long long int const aConnectionId
+)
+{
+    Connections::iterator it = mConnections.find(aConnectionId);
+
+    if (it != mConnections.end())
+    {
+        ::epoll_ctl(mEpollDescriptor, EPOLL_CTL_DEL, it->second->getDescriptor(), 0);
+        mConnections.erase(it);
+    }
+
+    releaseReceipts(aConnectionId, false);
+    dropSubscriber(aConnectionId);
+}
+
+void Reactor::releaseReceipts(
+    unsigned long long int const aConnectionId,
+    bool                   const aWritten
+)
+{
+    std::pair<Receipts::iterator, Receipts::iterator> const range = mReceipts.equal_range(aConnectionId);
+
+    for (Receipts::iterator it = range.first; it != range.second; ++it)
+    {
+        it->second->mWritten = aWritten;
+        it->second->mEvent.set();
+    }
+
+    mReceipts.erase(range.first, range.second);
+}
+
+void Reactor::releaseAllReceipts()
+{
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mCompletionsMutex);
+
+        // A drained loop is over as well, the parts posted from now on are refused.
+        mStopRequested = 1;
+
+        for (std::vector<Completion>::iterator it = mCompletions.begin(); it != mCompletions.end(); ++it)
+        {
+            if (it->mReceipt)
+            {
+                it->mReceipt->mEvent.set();
+            }
+        }
+    }
+
+    for (Receipts::iterator it = mReceipts.begin(); it != mReceipts.end(); ++it)
+    {
+        it->second->mEvent.set();
+    }
+
+    mReceipts.clear();
+}
+
+ISubscriberShrPtr Reactor::getSubscriber(
+    unsigned long long int const aConnectionId,
+    Codec                  const aCodec
+)
+{
+    boost::shared_ptr<Subscriber> & subscriber = mSubscribers[aConnectionId];
+
+    if (not subscriber)
+    {
+        subscriber.reset(new Subscriber(*this, aConnectionId));
+    }
+
+    subscriber->setCodec(aCodec);
+
+    return subscriber;
+}
+
+void Reactor::dropSubscriber(
+    unsigned long long int const aConnectionId
+)
+{
+    Subscribers::iterator it = mSubscribers.find(aConnectionId);
+
+    if (it != mSubscribers.end())
+    {
+        // The subscription may still be in progress on a worker, the detached subscriber is dropped when notified.
+        it->second->detach();
+        mSubscriptionRegistry->unsubscribe(it->second);
+        mSubscribers.erase(it);
+    }
+}
+
+void Reactor::closeConnections()
+{
+    while (not mSubscribers.empty())
+    {
+        dropSubscriber(mSubscribers.begin()->first);
+    }
+
+    mConnections.clear();
+}
+
+void Reactor::reportStatistics()
+{
+    RequestQueueStatistics const statistics = mRequestQueue.collectStatistics();
+
+    std::clog << "Listener " << mListenerId << ":"
+              << " accepted " << mAccepted
+              << ", connections " << mConnections.size()
+              << "; request queue:"
+              << " depth " << statistics.mDepth
+              << ", priority depth " << statistics.mPriorityDepth
+              << ", peak depth " << statistics.mPeakDepth
+              << ", queued " << statistics.mQueued
+              << ", rejected " << statistics.mRejected
+              << ", shed " << statistics.mShed
+              << ", average wait " << (statistics.mPopped ? statistics.mTotalWait / statistics.mPopped : 0) << " us"
+              << ", max wait " << statistics.mMaxWait << " us"
+              << std::endl;
+
+    ArenaStatisticsMap const arenaStatistics = mArenaPool->collectStatistics(mListenerId);
+
+    for (ArenaStatisticsMap::const_iterator it = arenaStatistics.begin(); it != arenaStatistics.end(); ++it)
+    {
+        std::clog << "Listener " << mListenerId << ":"
+                  << " command " << it->first
+                  << ", requests " << it->second.mRequests
+                  << ", average arena allocations " << it->second.mAllocations / it->second.mRequests
+                  << ", average arena bytes " << it->second.mAllocatedSize / it->second.mRequests
+                  << std::endl;
+    }
+}
+
+void Reactor::wakeUp()
+{
+    uint64_t const counter = 1;
+    ssize_t const written = ::write(mWakeUpDescriptor, &counter, sizeof(counter));
+    (void) written;
+}
+
+} // namespace Server
@@ -0,0 +1,245 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/ReactorConnection.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace Server
+{
+
+namespace
+{
+
+std::size_t const RECEIVE_CHUNK_SIZE = 4096U;
+
+/**
+ * @brief The maximum number of bytes received per readiness, so that a single connection does not hold the reactor.
+ */
+std::size_t const MAX_RECEIVE_SIZE = 16U * RECEIVE_CHUNK_SIZE;
+
+} // namespace
+
+ReactorConnection::ReactorConnection(
+    int                    const aDescriptor,
+    unsigned long long int const aId,
+    BufferPoolShrPtr             aBufferPool,
+    std::size_t            const aMaxPayload,
+    unsigned int           const aMaxInFlight
+)
+    : mDescriptor(aDescriptor),
+      mId(aId),
+      mFrameReader(aBufferPool, aMaxPayload),
+      mPeerClosed(false),
+      mCodec(CODEC_XML),
+      mMaxInFlight(aMaxInFlight),
+      mInFlight(0),
+      mAccepted(0)
+{
+}
+
+ReactorConnection::~ReactorConnection()
+{
+    ::close(mDescriptor);
+}
+
+int ReactorConnection::getDescriptor() const
+{
+    return mDescriptor;
+}
+
+unsigned long long int ReactorConnection::getId() const
+{
+    return mId;
+}
+
+Codec ReactorConnection::getCodec() const
+{
+    return mCodec;
+}
+
+void ReactorConnection::setCodec(
+    Codec const aCodec
+)
+{
+    mCodec = aCodec;
+}
+
+unsigned int ReactorConnection::getAccepted() const
+{
+    return mAccepted;
+}
+
+bool ReactorConnection::isBusy() const
+{
+    return mInFlight > 0;
+}
+
+bool ReactorConnection::isReceiving() const
+{
+    return not mPeerClosed and not isSaturated() and mFrameReader.getRoom() > 0;
+}
+
+bool ReactorConnection::receive()
+{
+    // The socket is level triggered, whatever is left unread is reported again.
+    for (std::size_t total = 0; total < MAX_RECEIVE_SIZE and isReceiving(); )
+    {
+        std::size_t const size = std::min(RECEIVE_CHUNK_SIZE, mFrameReader.getRoom());
+        ssize_t const received = ::recv(mDescriptor, mFrameReader.prepare(size), size, 0);
+
+        if (received > 0)
+        {
+            mFrameReader.commit(received);
+            mLastActivity.update();
+            total += received;
+            continue;
+        }
+
+        if (received == 0)
+        {
+            mPeerClosed = true;
+            return true;
+        }
+
+        if (errno == EINTR)
+        {
+            continue;
+        }
+
+        return errno == EAGAIN or errno == EWOULDBLOCK;
+    }
+
+    return true;
+}
+
+bool ReactorConnection::isPeerClosed() const
+{
+    return mPeerClosed;
+}
+
+bool ReactorConnection::isFinished() const
+{
+    return mPeerClosed and not isBusy() and not hasPendingOutput();
+}
+
+bool ReactorConnection::extractRequest(
+    char                   const * & aContent,
+    std::size_t                    &   aLength,
+    unsigned long long int         &   aRequestId,
+    unsigned char                  &   aFlags
+)
+{
+    if (isSaturated())
+    {
+        return false;
+    }
+
+    if (not mFrameReader.extract(aContent, aLength))
+    {
+        return false;
+    }
+
+    aRequestId = mFrameReader.getRequestId();
+    aFlags = mFrameReader.getFlags();
+
+    return true;
+}
+
+void ReactorConnection::acceptRequest()
+{
+    mFrameReader.consume();
+    ++mInFlight;
+    ++mAccepted;
+}
+
+bool ReactorConnection::isMalformed() const
+{
+    return mFrameReader.isMalformed();
+}
+
+void ReactorConnection::queueReply(
+    unsigned long long int const   aRequestId,
+    std::string                  & aContent,
+    unsigned char          const   aFlags
+)
+{
+    mFrameWriter.queue(mFrameReader.getFraming(), aRequestId, aContent, aFlags);
+
+    // A part of a streamed reply leaves the request in progress until its last part.
+    if (not (aFlags & BINARY_FRAME_FLAG_CONTINUED))
+    {
+        --mInFlight;
+    }
+}
+
+void ReactorConnection::queueIndication(
+    std::string & aContent
+)
+{
+    mFrameWriter.queue(mFrameReader.getFraming(), 0, aContent, BINARY_FRAME_FLAG_INDICATION);
+}
+
+bool ReactorConnection::send()
+{
+    if (not mFrameWriter.send(mDescriptor))
+    {
+        return false;
+    }
+
+    if (mFrameWriter.isEmpty())
+    {
+        mLastActivity.update();
+    }
+
+    return true;
+}
+
+bool ReactorConnection::hasPendingOutput() const
+{
+    return not mFrameWriter.isEmpty();
+}
+
+bool ReactorConnection::isIdle(
+    Poco::Timespan const & aIdleTimeout
+) const
+{
+    return not isBusy()
+       and not hasPendingOutput()
+       and not mFrameReader.hasBufferedData()
+       and mLastActivity.isElapsed(aIdleTimeout.totalMicroseconds());
+}
+
+bool ReactorConnection::isSaturated() const
+{
+    // Only the binary framing allows to match out of order replies with requests.
+    return mInFlight > 0 and (mFrameReader.getFraming() != FRAMING_BINARY or mInFlight >= mMaxInFlight);
+}
+
+} // namespace Server
@@ -0,0 +1,129 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/ReplyCompressor.hpp>
+#include <vector>
+#include <zlib.h>
+
+namespace Server
+{
+
+namespace
+{
+
+/**
+ * @brief The length of the prefix carrying the length of the raw content.
+ */
+std::size_t const LENGTH_PREFIX_SIZE = 4U;
+
+} // namespace
+
+ReplyCompressor::ReplyCompressor(
+    std::size_t const aThreshold,
+    int         const aLevel
+)
+    : mThreshold(aThreshold),
+      mLevel(aLevel)
+{
+}
+
+bool ReplyCompressor::compress(
+    std::string & aContent
+) const
+{
+    if (mThreshold == 0 or aContent.size() < mThreshold)
+    {
+        return false;
+    }
+
+    uLong const rawLength = static_cast<uLong>(aContent.size());
+    uLongf compressedLength = compressBound(rawLength);
+    std::vector<Bytef> buffer(LENGTH_PREFIX_SIZE + compressedLength);
+
+    // The raw length goes first in network byte order, the peer sizes its buffer by it.
+    buffer[0] = static_cast<Bytef>((rawLength >> 24) & 0xFF);
+    buffer[1] = static_cast<Bytef>((rawLength >> 16) & 0xFF);
+    buffer[2] = static_cast<Bytef>((rawLength >> 8) & 0xFF);
+    buffer[3] = static_cast<Bytef>(rawLength & 0xFF);
+
+    if (compress2(
+            &buffer[LENGTH_PREFIX_SIZE],
+            &compressedLength,
+            reinterpret_cast<Bytef const *>(aContent.data()),
+            rawLength,
+            mLevel
+        ) != Z_OK)
+    {
+        return false;
+    }
+
+    if (LENGTH_PREFIX_SIZE + compressedLength >= aContent.size())
+    {
+        return false;
+    }
+
+    aContent.assign(reinterpret_cast<char const *>(&buffer[0]), LENGTH_PREFIX_SIZE + compressedLength);
+
+    return true;
+}
+
+bool ReplyCompressor::decompress(
+    std::string & aContent
+) const
+{
+    if (aContent.size() < LENGTH_PREFIX_SIZE)
+    {
+        return false;
+    }
+
+    unsigned char const * prefix = reinterpret_cast<unsigned char const *>(aContent.data());
+
+    uLongf rawLength = (static_cast<uLongf>(prefix[0]) << 24)
+                     | (static_cast<uLongf>(prefix[1]) << 16)
+                     | (static_cast<uLongf>(prefix[2]) << 8)
+                     |  static_cast<uLongf>(prefix[3]);
+
+    std::vector<Bytef> buffer(rawLength + 1);
+    uLongf decompressedLength = rawLength;
+
+    if (uncompress(
+            &buffer[0],
+            &decompressedLength,
+            reinterpret_cast<Bytef const *>(aContent.data() + LENGTH_PREFIX_SIZE),
+            static_cast<uLong>(aContent.size() - LENGTH_PREFIX_SIZE)
+        ) != Z_OK
+        or decompressedLength != rawLength)
+    {
+        return false;
+    }
+
+    aContent.assign(reinterpret_cast<char const *>(&buffer[0]), decompressedLength);
+
+    return true;
+}
+
+} // namespace Server
@@ -0,0 +1,437 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Game/GameServer/Common/IExecutor.hpp>
+#include <Game/GameServer/Common/OperatorAbstractFactoryPostgresql.hpp>
+#include <Game/GameServer/Persistence/PersistencePostgresql.hpp>
+#include <Language/Interface/Command.hpp>
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <Protocol/Binary/Cpp/BinaryToLanguageDecoder.hpp>
+#include <Protocol/Binary/Cpp/LanguageToBinaryEncoder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToPayloadEncoder.hpp>
+#include <Protocol/Xml/Cpp/PayloadToLanguageDecoder.hpp>
+#include <Protocol/Xml/Cpp/PayloadToProtocolTranslator.hpp>
+#include <Protocol/Xml/Cpp/ProtocolToLanguageTranslator.hpp>
+#include <Server/include/CommandDispatcher.hpp>
+#include <Server/include/Framing.hpp>
+#include <Server/include/RequestProcessor.hpp>
+#include <boost/lexical_cast.hpp>
+#include <algorithm>
+
+namespace Server
+{
+
+RequestProcessor::RequestProcessor(
+    IContextShrPtr aContext
+)
+    : mContext(aContext)
+{
+}
+
+Protocol::Payload RequestProcessor::process(
+    Protocol::Payload const & aPayloadRequest,
+    ISubscriberShrPtr const   aSubscriber
+) const
+{
+    Language::ArenaShrPtr const arena = mContext->getArenaPool()->acquire();
+    Language::ArenaScope const arenaScope(arena.get());
+
+    return execute(decode(aPayloadRequest), aSubscriber);
+}
+
+// TODO: Remove the hardcoded xml protocol!
+Language::ICommand::Handle RequestProcessor::decode(
+    Protocol::Payload const & aPayloadRequest,
+    Codec             const   aCodec
+) const
+{
+    std::string const decoder = mContext->getConfigurator()->getDecoder();
+
+    Language::ICommand::Handle commandRequest;
+
+    if (aCodec == CODEC_TLV)
+    {
+        Protocol::BinaryToLanguageDecoder binaryToLanguageDecoder;
+        commandRequest = binaryToLanguageDecoder.decode(aPayloadRequest);
+    }
+    else if (decoder == "dom")
+    {
+        // Translate the payload to the protocol.
+        Protocol::PayloadToProtocolTranslator payloadToProtocolTranslator;
+        Protocol::Message::Handle messageRequest = payloadToProtocolTranslator.translate(aPayloadRequest);
+
+        // Translate the protocol to the language.
+        Protocol::ProtocolToLanguageTranslator protocolToLanguageTranslator;
+        commandRequest = protocolToLanguageTranslator.translate(messageRequest);
+    }
+    else
+    {
+        // Decode the payload straight to the language.
+        Protocol::PayloadToLanguageDecoder payloadToLanguageDecoder(
+            (decoder == "standard") ? Protocol::DECODING_MODE_STANDARD : Protocol::DECODING_MODE_FAST
+        );
+        commandRequest = payloadToLanguageDecoder.decode(aPayloadRequest);
+    }
+
+    setDeadline(commandRequest);
+
+    return commandRequest;
+}
+
+void RequestProcessor::setDeadline(
+    Language::ICommand::Handle const aCommandRequest
+) const
+{
+    // The client may only shorten the time the server is willing to spend on the command.
+    unsigned int const configuredTimeout = mContext->getConfigurator()->getDeadlineTimeout(aCommandRequest->getID());
+    unsigned int const requestedTimeout = aCommandRequest->getTimeout();
+    unsigned int const timeout =
+        (configuredTimeout and requestedTimeout) ? std::min(configuredTimeout, requestedTimeout)
+                                                 : std::max(configuredTimeout, requestedTimeout);
+
+    if (timeout)
+    {
+        aCommandRequest->setDeadline(Poco::Timestamp().epochMicroseconds() + timeout * 1000ULL);
+    }
+}
+
+CommandClass RequestProcessor::classify(
+    Language::ICommand::Handle const aCommandRequest
+) const
+{
+    CommandClass const commandClass = mCommandClassifier.classify(aCommandRequest->getID());
+
+    if (commandClass != COMMAND_CLASS_MODERATOR)
+    {
+        return commandClass;
+    }
+
+    // Anybody may send the identifier of a moderator command.
+    GameServer::User::IUserShrPtr const user = resolveSession(aCommandRequest);
+
+    return (user and user->isModerator()) ? COMMAND_CLASS_MODERATOR : COMMAND_CLASS_WRITE;
+}
+
+std::string RequestProcessor::identify(
+    Language::ICommand::Handle const aCommandRequest
+) const
+{
+    GameServer::User::IUserShrPtr const user = resolveSession(aCommandRequest);
+
+    return user ? aCommandRequest->getLogin() : std::string();
+}
+
+bool RequestProcessor::admit(
+    Language::ICommand::Handle const   aCommandRequest,
+    Poco::Timestamp::TimeDiff        & aRetryAfter
+) const
+{
+    return admit(classify(aCommandRequest), identify(aCommandRequest), aRetryAfter);
+}
+
+bool RequestProcessor::admit(
+    CommandClass              const   aClass,
+    std::string               const & aIdentity,
+    Poco::Timestamp::TimeDiff       & aRetryAfter
+) const
+{
+    return mContext->getRateLimiter()->admit(
+               aIdentity,
+               aClass,
+               Poco::Timestamp().epochMicroseconds(),
+               aRetryAfter
+           );
+}
+
+Protocol::Payload RequestProcessor::execute(
+    Language::ICommand::Handle const aCommandRequest,
+    ISubscriberShrPtr          const aSubscriber,
+    Codec                      const aCodec,
+    IReplyStreamShrPtr         const aReplyStream
+) const
+{
+    std::string const login = aCommandRequest->getLogin();
+    std::string const key = aCommandRequest->getIdempotencyKey();
+
+    // A retried read does no harm, it is simply executed again.
+    if (key.empty() or mCommandClassifier.classify(aCommandRequest->getID()) == COMMAND_CLASS_READ)
+    {
+        return encode(executeCommand(aCommandRequest, aSubscriber, aReplyStream), aCodec);
+    }
+
+    // The original reply goes to the very user who has sent the request, so the user is told apart up front.
+    if (not authenticate(aCommandRequest))
+    {
+        return reject(aCommandRequest, Game::REPLY_STATUS_UNAUTHENTICATED, aCodec);
+    }
+
+    IdempotencyCacheShrPtr const idempotencyCache = mContext->getIdempotencyCache();
+    unsigned short int const id = aCommandRequest->getID();
+    std::string replayed;
+
+    switch (idempotencyCache->begin(login, key, id, replayed))
+    {
+        case IDEMPOTENCY_STATE_COMPLETED:
+            return replay(replayed, aCodec);
+
+        case IDEMPOTENCY_STATE_IN_PROGRESS:
+            return reject(aCommandRequest, Game::REPLY_STATUS_SERVER_BUSY, aCodec);
+
+        default:
+            break;
+    }
+
+    // The request may have been committed by the time anything goes wrong, so from here on it is never abandoned
+    // unless known not to have been applied, a failed one stays in progress until its entry expires.
+    Language::ICommand::Handle const commandReply = executeCommand(aCommandRequest, aSubscriber);
+
+    // A request timed out has been rolled back (see Game::Executor::execute()), an unauthenticated one has not been
+    // applied, so its retry deserves another chance.
+    if (commandReply->getCode() == Game::REPLY_STATUS_TIMED_OUT
+        or commandReply->getCode() == Game::REPLY_STATUS_UNAUTHENTICATED)
+    {
+        idempotencyCache->abandon(login, key, id);
+
+        return encode(commandReply, aCodec);
+    }
+
+    Protocol::Payload const payloadReply = encode(commandReply, aCodec);
+
+    // The reply is kept in the binary format, the retries arriving in another codec get it translated.
+    idempotencyCache->complete(
+        login, key, id, (aCodec == CODEC_TLV) ? payloadReply.getContent() : encode(commandReply, CODEC_TLV).getContent()
+    );
+
+    return payloadReply;
+}
+
+bool RequestProcessor::startAsync(
+    Language::ICommand::Handle       const   aCommandRequest,
+    Game::IAsyncExecutor::Completion const & aCompletion
+) const
+{
+    // The idempotency cache and the reply to the expired request are taken care of by the synchronous path.
+    if (not aCommandRequest->getIdempotencyKey().empty()
+        or (aCommandRequest->getDeadline()
+            and static_cast<unsigned long long int>(Poco::Timestamp().epochMicroseconds())
+                >= aCommandRequest->getDeadline()))
+    {
+        return false;
+    }
+
+    CommandDispatcher commandDispatcher;
+    Game::IAsyncExecutorShrPtr const executor = commandDispatcher.dispatchAsync(aCommandRequest, mContext);
+
+    if (not executor)
+    {
+        return false;
+    }
+
+    executor->start(aCommandRequest, aCompletion);
+
+    return true;
+}
+
+Protocol::Payload RequestProcessor::reject(
+    Language::ICommand::Handle const aCommandRequest,
+    unsigned short int         const aStatus,
+    Codec                      const aCodec
+) const
+{
+    Language::ReplyBuilder replyBuilder;
+
+    return encode(replyBuilder.buildBasicReply(aCommandRequest->getID(), aStatus), aCodec);
+}
+
+Language::ICommand::Handle RequestProcessor::throttle(
+    Language::ICommand::Handle const aCommandRequest,
+    Poco::Timestamp::TimeDiff  const aRetryAfter
+) const
+{
+    Language::ReplyBuilder replyBuilder;
+
+    // Rounded up, so the client does not come back too early.
+    std::string const message =
+        "Retry after " + boost::lexical_cast<std::string>((aRetryAfter + 999) / 1000) + " ms.";
+
+    return replyBuilder.buildBasicReply(aCommandRequest->getID(), Game::REPLY_STATUS_THROTTLED, message);
+}
+
+Protocol::Payload RequestProcessor::throttle(
+    Language::ICommand::Handle const aCommandRequest,
+    Poco::Timestamp::TimeDiff  const aRetryAfter,
+    Codec                      const aCodec
+) const
+{
+    return encode(throttle(aCommandRequest, aRetryAfter), aCodec);
+}
+
+unsigned char RequestProcessor::compress(
+    unsigned char const   aRequestFlags,
+    std::string         & aContent
+) const
+{
+    if ((aRequestFlags & BINARY_FRAME_FLAG_ACCEPT_COMPRESSED) and mContext->getReplyCompressor()->compress(aContent))
+    {
+        return BINARY_FRAME_FLAG_COMPRESSED;
+    }
+
+    return 0;
+}
+
+Language::ICommand::Handle RequestProcessor::executeCommand(
+    Language::ICommand::Handle const aCommandRequest,
+    ISubscriberShrPtr          const aSubscriber,
+    IReplyStreamShrPtr         const aReplyStream
+) const
+{
+    // Nobody waits for the reply anymore.
+    if (aCommandRequest->getDeadline()
+        and static_cast<unsigned long long int>(Poco::Timestamp().epochMicroseconds()) >= aCommandRequest->getDeadline())
+    {
+        Language::ReplyBuilder replyBuilder;
+
+        return replyBuilder.buildBasicReply(aCommandRequest->getID(), Game::REPLY_STATUS_TIMED_OUT);
+    }
+
+    // Dispatch the command.
+    CommandDispatcher commandDispatcher;
+    Game::IExecutorShrPtr executor = commandDispatcher.dispatch(aCommandRequest, mContext, aSubscriber, aReplyStream);
+
+    // Execute the command.
+    return executor->execute(aCommandRequest);
+}
+
+IReplyStreamShrPtr RequestProcessor::openReplyStream(
+    unsigned char       const   aRequestFlags,
+    Codec               const   aCodec,
+    ReplyStream::Writer const & aWriter
+) const
+{
+    unsigned int const partSize = mContext->getConfigurator()->getStreamPartSize();
+
+    if (not (aRequestFlags & BINARY_FRAME_FLAG_ACCEPT_STREAMED) or partSize == 0)
+    {
+        return IReplyStreamShrPtr();
+    }
+
+    return IReplyStreamShrPtr(new ReplyStream(*this, aCodec, aRequestFlags, partSize, aWriter));
+}
+
+GameServer::User::IUserShrPtr RequestProcessor::resolveSession(
+    Language::ICommand::Handle const aCommandRequest
+) const
+{
+    std::string const sessionToken = aCommandRequest->getSessionToken();
+
+    return sessionToken.empty() ? GameServer::User::IUserShrPtr()
+                                : mContext->getSessionManager()->resolve(sessionToken, aCommandRequest->getLogin());
+}
+
+bool RequestProcessor::authenticate(
+    Language::ICommand::Handle const aCommandRequest
+) const
+{
+    std::string const login = aCommandRequest->getLogin();
+
+    // A request on behalf of nobody in particular is told apart by its key only.
+    if (login.empty())
+    {
+        return true;
+    }
+
+    if (not aCommandRequest->getSessionToken().empty())
+    {
+        return resolveSession(aCommandRequest).get() != NULL;
+    }
+
+    GameServer::Common::OperatorAbstractFactoryPostgresql operatorAbstractFactory(mContext);
+    GameServer::Authentication::IAuthenticateOperatorShrPtr const authenticateOperator =
+        operatorAbstractFactory.createAuthenticateOperator();
+
+    GameServer::Persistence::PersistencePostgresql persistence;
+    GameServer::Persistence::ITransactionShrPtr const transaction =
+        persistence.getTransaction(persistence.getConnection());
+
+    GameServer::Authentication::AuthenticateOperatorExitCode const exitCode =
+        authenticateOperator->authenticate(transaction, login, aCommandRequest->getPassword());
+
+    if (not exitCode.ok() or not exitCode.m_authenticated)
+    {
+        return false;
+    }
+
+    transaction->commit();
+
+    return true;
+}
+
+Protocol::Payload RequestProcessor::replay(
+    std::string const & aReply,
+    Codec       const   aCodec
+) const
+{
+    if (aCodec == CODEC_TLV)
+    {
+        return Protocol::Payload(aReply.length(), aReply);
+    }
+
+    Protocol::BinaryToLanguageDecoder binaryToLanguageDecoder;
+
+    return encode(binaryToLanguageDecoder.decode(aReply.data(), aReply.length()), aCodec);
+}
+
+Protocol::Payload RequestProcessor::encode(
+    Language::ICommand::Handle const aCommandReply,
+    Codec                      const aCodec
+) const
+{
+    // Encode the language straight to the payload, into a buffer grown by the earlier replies.
+    BufferPool::Buffer buffer;
+    mContext->getBufferPool()->acquire(buffer);
+    buffer.clear();
+
+    if (aCodec == CODEC_TLV)
+    {
+        Protocol::LanguageToBinaryEncoder languageToBinaryEncoder;
+        languageToBinaryEncoder.encode(aCommandReply, buffer);
+    }
+    else
+    {
+        Protocol::LanguageToPayloadEncoder languageToPayloadEncoder;
+        languageToPayloadEncoder.encode(aCommandReply, buffer);
+    }
+
+    Protocol::Payload const payloadReply(&buffer[0], buffer.size());
+
+    mContext->getBufferPool()->release(buffer);
+
+    return payloadReply;
+}
+
+} // namespace Server
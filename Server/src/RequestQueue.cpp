@@ -0,0 +1,252 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/RequestQueue.hpp>
+#include <algorithm>
+
+namespace Server
+{
+
+RequestQueue::RequestQueue(
+    std::size_t    const aCapacity,
+    std::size_t    const aPriorityCapacity,
+    OverloadPolicy const aOverloadPolicy
+)
+    : mCapacity(aCapacity),
+      mPriorityCapacity(aPriorityCapacity),
+      mOverloadPolicy(aOverloadPolicy),
+      mSize(0),
+      mClosed(false)
+{
+    resetStatistics();
+}
+
+bool RequestQueue::push(
+    QueuedRequest              const & aRequest,
+    std::vector<QueuedRequest>       & aShedRequests
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    if (aRequest.mClass == COMMAND_CLASS_MODERATOR)
+    {
+        if (mPriorityRequests.size() >= mPriorityCapacity)
+        {
+            ++mStatistics.mRejected;
+            return false;
+        }
+
+        mPriorityRequests.push_back(aRequest);
+        mPriorityRequests.back().mQueued.update();
+
+        ++mStatistics.mQueued;
+
+        // Either kind of worker may take it, whichever comes first.
+        mPriorityCondition.signal();
+        mCondition.signal();
+
+        return true;
+    }
+
+    if (mSize >= mCapacity)
+    {
+        bool const shed = mOverloadPolicy == OVERLOAD_POLICY_SHED_OLDEST_READ and shedOldestRead(aShedRequests);
+
+        if (not shed)
+        {
+            ++mStatistics.mRejected;
+            return false;
+        }
+    }
+
+    std::string const & login = aRequest.mIdentity;
+    Flow & flow = mFlows[login];
+
+    if (flow.empty())
+    {
+        mRoundRobin.push_back(login);
+    }
+
+    flow.push_back(aRequest);
+    flow.back().mQueued.update();
+    ++mSize;
+
+    ++mStatistics.mQueued;
+    mStatistics.mPeakDepth = std::max(mStatistics.mPeakDepth, mSize);
+
+    mCondition.signal();
+
+    return true;
+}
+
+bool RequestQueue::pop(
+    QueuedRequest       & aRequest,
+    bool          const   aPriorityOnly
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    while (mPriorityRequests.empty() and (aPriorityOnly or mSize == 0) and not mClosed)
+    {
+        if (aPriorityOnly)
+        {
+            mPriorityCondition.wait(mMutex);
+        }
+        else
+        {
+            mCondition.wait(mMutex);
+        }
+    }
+
+    if (not mPriorityRequests.empty())
+    {
+        aRequest = mPriorityRequests.front();
+        mPriorityRequests.pop_front();
+    }
+    else if (aPriorityOnly or mSize == 0)
+    {
+        return false;
+    }
+    else
+    {
+        popFlow(aRequest);
+    }
+
+    Poco::Timestamp::TimeDiff const wait = aRequest.mQueued.elapsed();
+
+    ++mStatistics.mPopped;
+    mStatistics.mTotalWait += wait;
+    mStatistics.mMaxWait = std::max(mStatistics.mMaxWait, wait);
+
+    return true;
+}
+
+void RequestQueue::popFlow(
+    QueuedRequest & aRequest
+)
+{
+    std::string const login = mRoundRobin.front();
+    mRoundRobin.pop_front();
+
+    Flows::iterator const flow = mFlows.find(login);
+
+    aRequest = flow->second.front();
+    flow->second.pop_front();
+    --mSize;
+
+    // The login goes to the back of the line if it has more requests waiting.
+    if (flow->second.empty())
+    {
+        mFlows.erase(flow);
+    }
+    else
+    {
+        mRoundRobin.push_back(login);
+    }
+}
+
+void RequestQueue::close()
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    mClosed = true;
+    mCondition.broadcast();
+    mPriorityCondition.broadcast();
+}
+
+RequestQueueStatistics RequestQueue::collectStatistics()
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    RequestQueueStatistics statistics = mStatistics;
+    statistics.mDepth = mSize;
+    statistics.mPriorityDepth = mPriorityRequests.size();
+
+    resetStatistics();
+
+    return statistics;
+}
+
+bool RequestQueue::shedOldestRead(
+    std::vector<QueuedRequest> & aShedRequests
+)
+{
+    // The busiest login pays for the overload, the requests of a login are queued in order.
+    Flows::iterator victim = mFlows.end();
+    Flow::iterator victimRequest;
+
+    for (Flows::iterator flow = mFlows.begin(); flow != mFlows.end(); ++flow)
+    {
+        if (victim != mFlows.end() and flow->second.size() <= victim->second.size())
+        {
+            continue;
+        }
+
+        for (Flow::iterator it = flow->second.begin(); it != flow->second.end(); ++it)
+        {
+            if (it->mClass == COMMAND_CLASS_READ)
+            {
+                victim = flow;
+                victimRequest = it;
+                break;
+            }
+        }
+    }
+
+    if (victim == mFlows.end())
+    {
+        return false;
+    }
+
+    aShedRequests.push_back(*victimRequest);
+    victim->second.erase(victimRequest);
+    --mSize;
+    ++mStatistics.mShed;
+
+    if (victim->second.empty())
+    {
+        mRoundRobin.erase(std::find(mRoundRobin.begin(), mRoundRobin.end(), victim->first));
+        mFlows.erase(victim);
+    }
+
+    return true;
+}
+
+void RequestQueue::resetStatistics()
+{
+    mStatistics.mDepth = 0;
+    mStatistics.mPeakDepth = mSize;
+    mStatistics.mQueued = 0;
+    mStatistics.mRejected = 0;
+    mStatistics.mShed = 0;
+    mStatistics.mPopped = 0;
+    mStatistics.mTotalWait = 0;
+    mStatistics.mMaxWait = 0;
+    mStatistics.mPriorityDepth = 0;
+}
+
+} // namespace Server
@@ -27,9 +27,25 @@
 
 #include <Poco/Net/ServerSocket.h>
 #include <Poco/Net/SocketAddress.h>
+#include <Poco/Net/TCPServerParams.h>
+#include <Poco/ThreadPool.h>
+#include <Poco/Timestamp.h>
 #include <Server/include/ConnectionFactory.hpp>
+#include <Server/include/CpuAffinity.hpp>
+#include <Server/include/ListenerHandoff.hpp>
+#include <Server/include/Reactor.hpp>
+#include <Server/include/RequestQueue.hpp>
 #include <Server/include/Server.hpp>
+#include <Server/include/UnixListener.hpp>
+#include <Server/include/WorkerPool.hpp>
+#include <boost/shared_ptr.hpp>
+#include <algorithm>
+#include <fcntl.h>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <unistd.h>
+#include <vector>
 
 namespace Server
 {
@@ -37,7 +53,8 @@ namespace Server
 Server::Server(
     IContextShrPtr aContext
 )
-    : mContext(aContext)
+    : mServerStarted(false),
+      mContext(aContext)
 {
 }
 
@@ -54,19 +71,22 @@ void Server::startServer()
 {
     if (not mServerStarted)
     {
-        Poco::Net::SocketAddress address("localhost", 2222);
-        Poco::Net::ServerSocket socket(address);
+        IConfiguratorShrPtr configurator = mContext->getConfigurator();
 
-        ConnectionFactoryShrPtr connectionFactory(new ConnectionFactory(mContext));
+        Poco::Net::SocketAddress address(configurator->getHost(), configurator->getPort());
 
-        mServer.reset(new Poco::Net::TCPServer(connectionFactory, socket));
-
-        mServer->start();
         mServerStarted = true;
 
-        waitForTerminationRequest();
+        if (configurator->getFrontEnd() == "reactor")
+        {
+            runReactorFrontEnd(address);
+        }
+        else
+        {
+            Poco::Net::ServerSocket socket(address);
 
-        mServer->stop();
+            runThreadedFrontEnd(socket);
+        }
     }
     else
     {
@@ -75,4 +95,192 @@ void Server::startServer()
     }
 }
 
+void Server::runThreadedFrontEnd(
+    Poco::Net::ServerSocket const & aSocket
+)
+{
+    IConfiguratorShrPtr configurator = mContext->getConfigurator();
+
+    // Connections beyond the capacity of the queue are refused by the TCP server.
+    Poco::Net::TCPServerParams::Ptr params(new Poco::Net::TCPServerParams);
+    params->setMaxThreads(configurator->getThreads());
+    params->setMaxQueued(configurator->getQueueCapacity());
+
+    Poco::ThreadPool threadPool(configurator->getThreads(), configurator->getThreads());
+
+    ConnectionFactoryShrPtr connectionFactory(new ConnectionFactory(mContext));
+
+    mServer.reset(new Poco::Net::TCPServer(connectionFactory, threadPool, aSocket, params));
+
+    mServer->start();
+
+    waitForTerminationRequest();
+
+    mServer->stop();
+    mServer.reset();
+}
+
+void Server::runReactorFrontEnd(
+    Poco::Net::SocketAddress const & aAddress
+)
+{
+    IConfiguratorShrPtr configurator = mContext->getConfigurator();
+
+    std::string const handoffPath = configurator->getShutdownHandoffPath();
+    std::string const unixPath = configurator->getListenerUnixPath();
+    std::vector<int> listeners;
+
+    // The listening sockets of a running server are taken over, so no connection is refused during a restart.
+    if (handoffPath.empty() or not ListenerHandoff::takeOver(handoffPath, listeners))
+    {
+        listeners = openListeners(aAddress, std::max<unsigned int>(configurator->getListenerCount(), 1U));
+
+        if (not unixPath.empty())
+        {
+            listeners.push_back(openUnixListener(unixPath));
+        }
+    }
+
+    unsigned int const numberOfListeners = static_cast<unsigned int>(listeners.size());
+    bool const affinity = configurator->getListenerAffinity() == "on";
+    unsigned int const numberOfCpus = getNumberOfCpus();
+
+    std::vector<boost::shared_ptr<RequestQueue> > requestQueues;
+    std::vector<boost::shared_ptr<WorkerPool> > workerPools;
+    std::vector<boost::shared_ptr<Reactor> > reactors;
+
+    for (unsigned int i = 0; i < numberOfListeners; ++i)
+    {
+        CpuSet const cpus = affinity ? getCpuSubset(numberOfCpus, i, numberOfListeners) : CpuSet();
+
+        requestQueues.push_back(
+            boost::shared_ptr<RequestQueue>(
+                new RequestQueue(
+                    configurator->getQueueCapacity(),
+                    configurator->getQueuePriorityCapacity(),
+                    configurator->getQueueOverload() == "shedoldest"
+                        ? OVERLOAD_POLICY_SHED_OLDEST_READ
+                        : OVERLOAD_POLICY_REJECT
+                )
+            )
+        );
+
+        workerPools.push_back(
+            boost::shared_ptr<WorkerPool>(
+                new WorkerPool(
+                    mContext,
+                    *requestQueues.back(),
+                    configurator->getThreads(),
+                    configurator->getReservedThreads(),
+                    cpus
+                )
+            )
+        );
+
+        reactors.push_back(
+            boost::shared_ptr<Reactor>(new Reactor(mContext, listeners[i], *requestQueues.back(), i, cpus))
+        );
+    }
+
+    for (unsigned int i = 0; i < numberOfListeners; ++i)
+    {
+        workerPools[i]->start();
+        reactors[i]->start();
+    }
+
+    std::auto_ptr<ListenerHandoff> listenerHandoff;
+
+    if (not handoffPath.empty())
+    {
+        listenerHandoff.reset(new ListenerHandoff(handoffPath, listeners));
+        listenerHandoff->start();
+    }
+
+    waitForTerminationRequest();
+
+    if (listenerHandoff.get())
+    {
+        listenerHandoff->stop();
+    }
+
+    drainReactors(reactors, configurator->getShutdownDrainTimeout());
+
+    // The requests still executed asynchronously fail while their reactors are there to post the replies.
+    if (mContext->getAsyncQueryRunner())
+    {
+        mContext->getAsyncQueryRunner()->stop();
+    }
+
+    for (unsigned int i = 0; i < numberOfListeners; ++i)
+    {
+        reactors[i]->stop();
+        requestQueues[i]->close();
+    }
+
+    for (unsigned int i = 0; i < numberOfListeners; ++i)
+    {
+        workerPools[i]->join();
+        ::close(listeners[i]);
+    }
+
+    // The successor listens on the handed off Unix domain socket, its path has to stay.
+    if (not unixPath.empty() and not (listenerHandoff.get() and listenerHandoff->isHandedOff()))
+    {
+        ::unlink(unixPath.c_str());
+    }
+}
+
+std::vector<int> Server::openListeners(
+    Poco::Net::SocketAddress const & aAddress,
+    unsigned int             const   aNumberOfListeners
+) const
+{
+    std::vector<int> listeners;
+
+    for (unsigned int i = 0; i < aNumberOfListeners; ++i)
+    {
+        // All listeners bind the same port, the kernel spreads the incoming connections among them.
+        Poco::Net::ServerSocket socket;
+        socket.bind(aAddress, true, true);
+        socket.listen();
+
+        // The descriptor outlives the socket, it may be handed off to a restarted server.
+        int const descriptor = ::fcntl(socket.impl()->sockfd(), F_DUPFD_CLOEXEC, 0);
+
+        if (descriptor < 0)
+        {
+            throw std::runtime_error("Could not open the listener.");
+        }
+
+        listeners.push_back(descriptor);
+    }
+
+    return listeners;
+}
+
+void Server::drainReactors(
+    std::vector<boost::shared_ptr<Reactor> > const & aReactors,
+    unsigned int                             const   aTimeout
+) const
+{
+    for (std::vector<boost::shared_ptr<Reactor> >::const_iterator it = aReactors.begin(); it != aReactors.end(); ++it)
+    {
+        (*it)->drain();
+    }
+
+    // The reactors drain concurrently, the timeout applies to all of them together.
+    Poco::Timestamp const start;
+
+    for (std::size_t i = 0; i < aReactors.size(); ++i)
+    {
+        long const elapsed = static_cast<long>(start.elapsed() / 1000);
+        long const remaining = elapsed < static_cast<long>(aTimeout) ? static_cast<long>(aTimeout) - elapsed : 0;
+
+        if (not aReactors[i]->waitForDrain(remaining))
+        {
+            std::clog << "Listener " << i << " has not drained in time, closing its connections." << std::endl;
+        }
+    }
+}
+
 } // namespace Server
@@ -0,0 +1,123 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Poco/UUIDGenerator.h>
+#include <Server/include/SessionManager.hpp>
+
+namespace Server
+{
+
+SessionManager::SessionManager(
+    unsigned int const aTimeout,
+    std::size_t  const aMaxSessions
+)
+    : mTimeout(static_cast<Poco::Timestamp::TimeDiff>(aTimeout) * 1000),
+      mMaxSessions(aMaxSessions)
+{
+}
+
+std::string SessionManager::open(
+    GameServer::User::IUserShrPtr const aUser
+)
+{
+    // Random tokens, so a token of one user cannot be derived from a token of another.
+    std::string const token = Poco::UUIDGenerator::defaultGenerator().createRandom().toString();
+
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    if (mSessions.size() >= mMaxSessions)
+    {
+        purge();
+
+        if (mSessions.size() >= mMaxSessions)
+        {
+            return "";
+        }
+    }
+
+    Session & session = mSessions[token];
+    session.mUser = aUser;
+    session.mLastUsed.update();
+
+    return token;
+}
+
+GameServer::User::IUserShrPtr SessionManager::resolve(
+    std::string const & aToken,
+    std::string const & aLogin
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    Sessions::iterator const it = mSessions.find(aToken);
+
+    if (it == mSessions.end())
+    {
+        return GameServer::User::IUserShrPtr();
+    }
+
+    if (it->second.mLastUsed.isElapsed(mTimeout))
+    {
+        mSessions.erase(it);
+        return GameServer::User::IUserShrPtr();
+    }
+
+    if (it->second.mUser->getLogin() != aLogin)
+    {
+        return GameServer::User::IUserShrPtr();
+    }
+
+    it->second.mLastUsed.update();
+
+    return it->second.mUser;
+}
+
+void SessionManager::close(
+    std::string const & aToken
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    mSessions.erase(aToken);
+}
+
+void SessionManager::purge()
+{
+    for (Sessions::iterator it = mSessions.begin(); it != mSessions.end(); )
+    {
+        if (it->second.mLastUsed.isElapsed(mTimeout))
+        {
+            mSessions.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+} // namespace Server
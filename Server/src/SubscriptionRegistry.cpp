@@ -0,0 +1,161 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Protocol/Binary/Cpp/LanguageToBinaryEncoder.hpp>
+#include <Protocol/Xml/Cpp/LanguageToProtocolTranslator.hpp>
+#include <Protocol/Xml/Cpp/Payload.hpp>
+#include <Server/include/SubscriptionRegistry.hpp>
+#include <vector>
+
+namespace Server
+{
+
+namespace
+{
+
+std::string encode(
+    Language::ICommand::Handle const aIndication,
+    Codec                      const aCodec
+)
+{
+    if (aCodec == CODEC_TLV)
+    {
+        Protocol::LanguageToBinaryEncoder languageToBinaryEncoder;
+        std::vector<char> buffer;
+        languageToBinaryEncoder.encode(aIndication, buffer);
+
+        return std::string(buffer.begin(), buffer.end());
+    }
+
+    Protocol::LanguageToProtocolTranslator languageToProtocolTranslator;
+
+    return Protocol::Payload(languageToProtocolTranslator.translate(aIndication)).getContent();
+}
+
+} // namespace
+
+void SubscriptionRegistry::subscribe(
+    std::string       const & aWorldName,
+    ISubscriberShrPtr const   aSubscriber
+)
+{
+    {
+        Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+        mWorlds[aWorldName].insert(aSubscriber);
+    }
+
+    aSubscriber->markSubscribed();
+}
+
+void SubscriptionRegistry::unsubscribe(
+    ISubscriberShrPtr const aSubscriber
+)
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    for (Worlds::iterator it = mWorlds.begin(); it != mWorlds.end(); )
+    {
+        it->second.erase(aSubscriber);
+
+        if (it->second.empty())
+        {
+            mWorlds.erase(it++);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+bool SubscriptionRegistry::isSubscribed(
+    ISubscriberShrPtr const aSubscriber
+) const
+{
+    Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+    for (Worlds::const_iterator it = mWorlds.begin(); it != mWorlds.end(); ++it)
+    {
+        if (it->second.count(aSubscriber))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SubscriptionRegistry::publish(
+    Language::ICommand::Commands const & aIndications
+)
+{
+    for (Language::ICommand::Commands::const_iterator it = aIndications.begin(); it != aIndications.end(); ++it)
+    {
+        std::vector<ISubscriberShrPtr> subscribers;
+
+        {
+            Poco::ScopedLock<Poco::Mutex> lock(mMutex);
+
+            Worlds::const_iterator const world = mWorlds.find((*it)->getParam(Language::PARAM_WORLD_NAME));
+
+            if (world != mWorlds.end())
+            {
+                subscribers.assign(world->second.begin(), world->second.end());
+            }
+        }
+
+        // Nobody listens, do not bother encoding.
+        if (subscribers.empty())
+        {
+            continue;
+        }
+
+        // Encoded once per codec in use.
+        std::map<Codec, std::string> contents;
+
+        for (std::vector<ISubscriberShrPtr>::const_iterator subscriber = subscribers.begin();
+             subscriber != subscribers.end();
+             ++subscriber)
+        {
+            Codec const codec = (*subscriber)->getCodec();
+            std::map<Codec, std::string>::iterator content = contents.find(codec);
+
+            if (content == contents.end())
+            {
+                content = contents.insert(std::make_pair(codec, encode(*it, codec))).first;
+            }
+
+            if (not (*subscriber)->notify(content->second))
+            {
+                unsubscribe(*subscriber);
+            }
+        }
+    }
+}
+
+} // namespace Server
@@ -0,0 +1,101 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/TokenBucket.hpp>
+#include <algorithm>
+
+namespace Server
+{
+
+namespace
+{
+
+/**
+ * @brief A single token, in millionths.
+ */
+Poco::Timestamp::TimeVal const TOKEN = 1000000;
+
+} // namespace
+
+TokenBucket::TokenBucket(
+    unsigned int             const aRate,
+    unsigned int             const aBurst,
+    Poco::Timestamp::TimeVal const aNow
+)
+    : mRate(std::max(aRate, 1U)),
+      mCapacity(std::max(aBurst, 1U) * TOKEN),
+      mTokens(mCapacity),
+      mRefilled(aNow)
+{
+}
+
+Poco::Timestamp::TimeDiff TokenBucket::getWait(
+    Poco::Timestamp::TimeVal const aNow
+)
+{
+    refill(aNow);
+
+    if (mTokens >= TOKEN)
+    {
+        return 0;
+    }
+
+    // A millionth of a token is added per microsecond at a rate of one token per second.
+    return (TOKEN - mTokens + mRate - 1) / mRate;
+}
+
+void TokenBucket::take()
+{
+    mTokens -= TOKEN;
+}
+
+bool TokenBucket::isFull(
+    Poco::Timestamp::TimeVal const aNow
+)
+{
+    refill(aNow);
+
+    return mTokens == mCapacity;
+}
+
+void TokenBucket::refill(
+    Poco::Timestamp::TimeVal const aNow
+)
+{
+    if (aNow <= mRefilled)
+    {
+        return;
+    }
+
+    // Bound the elapsed time before multiplying, a long idle bucket would overflow otherwise.
+    Poco::Timestamp::TimeVal const elapsed = std::min(aNow - mRefilled, mCapacity / mRate + 1);
+
+    mTokens = std::min(mTokens + elapsed * mRate, mCapacity);
+    mRefilled = aNow;
+}
+
+} // namespace Server
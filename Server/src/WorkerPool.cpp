@@ -0,0 +1,183 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/WorkerPool.hpp>
+#include <boost/bind.hpp>
+#include <boost/ref.hpp>
+#include <exception>
+#include <iostream>
+#include <string>
+
+namespace Server
+{
+
+WorkerPool::Worker::Worker(
+    WorkerPool       & aWorkerPool,
+    bool       const   aPriorityOnly
+)
+    : mWorkerPool(aWorkerPool),
+      mPriorityOnly(aPriorityOnly)
+{
+}
+
+void WorkerPool::Worker::run()
+{
+    if (not pinCurrentThread(mWorkerPool.mCpus))
+    {
+        std::clog << "Could not pin a worker to its CPUs." << std::endl;
+    }
+
+    mWorkerPool.serve(mPriorityOnly);
+}
+
+WorkerPool::WorkerPool(
+    IContextShrPtr             aContext,
+    RequestQueue             & aRequestQueue,
+    unsigned short int const   aNumberOfWorkers,
+    unsigned short int const   aNumberOfReservedWorkers,
+    CpuSet             const & aCpus
+)
+    : mRequestProcessor(aContext),
+      mRequestQueue(aRequestQueue),
+      mArenaPool(aContext->getArenaPool()),
+      mWorker(*this, false),
+      mReservedWorker(*this, true),
+      mNumberOfReservedWorkers(aNumberOfReservedWorkers),
+      mCpus(aCpus)
+{
+    for (unsigned int i = 0; i < static_cast<unsigned int>(aNumberOfWorkers) + aNumberOfReservedWorkers; ++i)
+    {
+        mThreads.push_back(boost::shared_ptr<Poco::Thread>(new Poco::Thread));
+    }
+}
+
+void WorkerPool::start()
+{
+    for (std::size_t i = 0; i < mThreads.size(); ++i)
+    {
+        if (i < mNumberOfReservedWorkers)
+        {
+            mThreads[i]->start(mReservedWorker);
+        }
+        else
+        {
+            mThreads[i]->start(mWorker);
+        }
+    }
+}
+
+void WorkerPool::join()
+{
+    for (std::vector<boost::shared_ptr<Poco::Thread> >::iterator it = mThreads.begin(); it != mThreads.end(); ++it)
+    {
+        (*it)->join();
+    }
+}
+
+void WorkerPool::serve(
+    bool const aPriorityOnly
+)
+{
+    QueuedRequest request;
+
+    while (mRequestQueue.pop(request, aPriorityOnly))
+    {
+        try
+        {
+            // The reply is built in the arena of the request, a reply completed asynchronously on the heap.
+            Language::ArenaScope const arenaScope(request.mArena.get());
+
+            bool const started =
+                mRequestProcessor.startAsync(request.mCommand, boost::bind(&WorkerPool::replyAsync, this, request, _1));
+
+            if (not started)
+            {
+                IReplyStreamShrPtr const replyStream = mRequestProcessor.openReplyStream(
+                    request.mFlags, request.mCodec, boost::bind(&WorkerPool::post, this, boost::cref(request), _1, _2)
+                );
+
+                reply(
+                    request,
+                    mRequestProcessor.execute(
+                        request.mCommand, request.mSubscriber, request.mCodec, replyStream
+                    ).getContent()
+                );
+            }
+        }
+        catch (std::exception const &)
+        {
+            request.mReplySink->postFailure(request.mConnectionId);
+        }
+
+        // A reply completed asynchronously is built on the heap, only the decoding is counted for it then.
+        if (request.mCommand and request.mArena)
+        {
+            mArenaPool->record(request.mListenerId, request.mCommand->getID(), *request.mArena);
+        }
+
+        // The arena goes back to the pool once the reply has been posted rather than with the next request.
+        request.mCommand.reset();
+        request.mArena.reset();
+    }
+}
+
+void WorkerPool::replyAsync(
+    QueuedRequest              const aRequest,
+    Language::ICommand::Handle const aCommandReply
+) const
+{
+    try
+    {
+        reply(aRequest, mRequestProcessor.encode(aCommandReply, aRequest.mCodec).getContent());
+    }
+    catch (std::exception const &)
+    {
+        aRequest.mReplySink->postFailure(aRequest.mConnectionId);
+    }
+}
+
+void WorkerPool::reply(
+    QueuedRequest const & aRequest,
+    std::string           aContent
+) const
+{
+    // Compressed here rather than by the reactor, which must not spend its thread on it.
+    unsigned char const flags = mRequestProcessor.compress(aRequest.mFlags, aContent);
+
+    aRequest.mReplySink->postReply(aRequest.mConnectionId, aRequest.mRequestId, aContent, flags);
+}
+
+bool WorkerPool::post(
+    QueuedRequest const & aRequest,
+    std::string   const & aContent,
+    unsigned char const   aFlags
+) const
+{
+    return aRequest.mReplySink->postPart(aRequest.mConnectionId, aRequest.mRequestId, aContent, aFlags);
+}
+
+} // namespace Server
@@ -0,0 +1,172 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Command.hpp>
+#include <Server/include/ArenaPool.hpp>
+#include <gtest/gtest.h>
+
+using namespace Server;
+
+TEST(ArenaPoolTest, ReleasedArenaIsReusedRewound)
+{
+    ArenaPoolShrPtr pool(new ArenaPool(4, 1024));
+
+    Language::Arena * first = 0;
+
+    {
+        Language::ArenaShrPtr arena = pool->acquire();
+        first = arena.get();
+        arena->allocate(16);
+        arena->deallocate();
+    }
+
+    Language::ArenaShrPtr arena = pool->acquire();
+
+    ASSERT_EQ(first, arena.get());
+    ASSERT_EQ(0, arena->getAllocationCount());
+}
+
+TEST(ArenaPoolTest, ArenasOutAtOnceAreDistinct)
+{
+    ArenaPoolShrPtr pool(new ArenaPool(4, 1024));
+
+    Language::ArenaShrPtr first = pool->acquire();
+    Language::ArenaShrPtr second = pool->acquire();
+
+    ASSERT_NE(first.get(), second.get());
+}
+
+TEST(ArenaPoolTest, PoolIsKeptAliveByArenasOut)
+{
+    Language::ArenaShrPtr arena;
+
+    {
+        ArenaPoolShrPtr pool(new ArenaPool(4, 1024));
+        arena = pool->acquire();
+    }
+
+    arena->allocate(16);
+    arena->deallocate();
+    arena.reset();
+}
+
+TEST(ArenaPoolTest, CommandOutlivingItsRequestIsNotOverwritten)
+{
+    ArenaPoolShrPtr pool(new ArenaPool(1, 1024));
+    Language::ICommand::Handle command;
+
+    {
+        Language::ArenaShrPtr arena = pool->acquire();
+        Language::ArenaScope const arenaScope(arena.get());
+        command = Language::createCommand();
+        command->setMessage("Outliving");
+    }
+
+    {
+        Language::ArenaShrPtr arena = pool->acquire();
+        Language::ArenaScope const arenaScope(arena.get());
+        Language::createCommand()->setMessage("Overwriting");
+    }
+
+    ASSERT_STREQ("Outliving", command->getMessage().c_str());
+}
+
+TEST(ArenaPoolTest, ArenaReleasedIntoFullPoolOutlivesItsCommand)
+{
+    ArenaPoolShrPtr pool(new ArenaPool(1, 1024));
+    Language::ICommand::Handle command;
+
+    {
+        Language::ArenaShrPtr arena = pool->acquire();
+        Language::ArenaShrPtr resting = pool->acquire();
+        Language::ArenaScope const arenaScope(arena.get());
+        command = Language::createCommand();
+        command->setMessage("Outliving");
+    }
+
+    pool.reset();
+
+    ASSERT_STREQ("Outliving", command->getMessage().c_str());
+
+    command.reset();
+}
+
+TEST(ArenaPoolTest, AllocationsAreCollectedByCommand)
+{
+    ArenaPoolShrPtr pool(new ArenaPool(4, 1024));
+
+    {
+        Language::ArenaShrPtr arena = pool->acquire();
+        Language::ArenaScope const arenaScope(arena.get());
+        Language::ICommand::Handle const first = Language::createCommand();
+        Language::ICommand::Handle const second = Language::createCommand();
+        pool->record(0, Language::ID_COMMAND_ECHO_REQUEST, *arena);
+    }
+
+    {
+        Language::ArenaShrPtr arena = pool->acquire();
+        Language::ArenaScope const arenaScope(arena.get());
+        Language::ICommand::Handle const command = Language::createCommand();
+        pool->record(0, Language::ID_COMMAND_ECHO_REQUEST, *arena);
+    }
+
+    ArenaStatisticsMap const statistics = pool->collectStatistics(0);
+
+    ASSERT_EQ(1U, statistics.size());
+    ASSERT_EQ(2U, statistics.find(Language::ID_COMMAND_ECHO_REQUEST)->second.mRequests);
+    ASSERT_EQ(3U, statistics.find(Language::ID_COMMAND_ECHO_REQUEST)->second.mAllocations);
+    ASSERT_TRUE(pool->collectStatistics(0).empty());
+}
+
+TEST(ArenaPoolTest, AllocationsAreCollectedByListener)
+{
+    ArenaPoolShrPtr pool(new ArenaPool(4, 1024));
+
+    {
+        Language::ArenaShrPtr arena = pool->acquire();
+        Language::ArenaScope const arenaScope(arena.get());
+        Language::ICommand::Handle const command = Language::createCommand();
+        pool->record(0, Language::ID_COMMAND_ECHO_REQUEST, *arena);
+    }
+
+    {
+        Language::ArenaShrPtr arena = pool->acquire();
+        Language::ArenaScope const arenaScope(arena.get());
+        Language::ICommand::Handle const first = Language::createCommand();
+        Language::ICommand::Handle const second = Language::createCommand();
+        pool->record(1, Language::ID_COMMAND_ECHO_REQUEST, *arena);
+    }
+
+    ArenaStatisticsMap const first = pool->collectStatistics(0);
+    ArenaStatisticsMap const second = pool->collectStatistics(1);
+
+    ASSERT_EQ(1U, first.find(Language::ID_COMMAND_ECHO_REQUEST)->second.mRequests);
+    ASSERT_EQ(1U, first.find(Language::ID_COMMAND_ECHO_REQUEST)->second.mAllocations);
+    ASSERT_EQ(1U, second.find(Language::ID_COMMAND_ECHO_REQUEST)->second.mRequests);
+    ASSERT_EQ(2U, second.find(Language::ID_COMMAND_ECHO_REQUEST)->second.mAllocations);
+    ASSERT_TRUE(pool->collectStatistics(1).empty());
+}
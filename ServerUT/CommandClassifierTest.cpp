@@ -0,0 +1,67 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Command.hpp>
+#include <Server/include/CommandClassifier.hpp>
+#include <gtest/gtest.h>
+
+using namespace Server;
+
+TEST(CommandClassifierTest, ReadOnlyRequestsAreClassifiedAsRead)
+{
+    CommandClassifier classifier;
+
+    ASSERT_EQ(COMMAND_CLASS_READ, classifier.classify(Language::ID_COMMAND_ECHO_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_READ, classifier.classify(Language::ID_COMMAND_GET_LAND_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_READ, classifier.classify(Language::ID_COMMAND_GET_LANDS_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_READ, classifier.classify(Language::ID_COMMAND_GET_HUMANS_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_READ, classifier.classify(Language::ID_COMMAND_GET_RESOURCES_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_READ, classifier.classify(Language::ID_COMMAND_SUBSCRIBE_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_READ, classifier.classify(Language::ID_COMMAND_LOGIN_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_READ, classifier.classify(Language::ID_COMMAND_LOGOUT_REQUEST));
+}
+
+TEST(CommandClassifierTest, ModifyingRequestsAreClassifiedAsWrite)
+{
+    CommandClassifier classifier;
+
+    ASSERT_EQ(COMMAND_CLASS_WRITE, classifier.classify(Language::ID_COMMAND_CREATE_LAND_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_WRITE, classifier.classify(Language::ID_COMMAND_BUILD_BUILDING_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_WRITE, classifier.classify(Language::ID_COMMAND_ENGAGE_HUMAN_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_WRITE, classifier.classify(Language::ID_COMMAND_TRANSPORT_RESOURCE_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_WRITE, classifier.classify(Language::ID_COMMAND_CREATE_USER_REQUEST));
+}
+
+TEST(CommandClassifierTest, EpochAndWorldRequestsAreClassifiedAsModerator)
+{
+    CommandClassifier classifier;
+
+    ASSERT_EQ(COMMAND_CLASS_MODERATOR, classifier.classify(Language::ID_COMMAND_CREATE_WORLD_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_MODERATOR, classifier.classify(Language::ID_COMMAND_CREATE_EPOCH_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_MODERATOR, classifier.classify(Language::ID_COMMAND_TICK_EPOCH_REQUEST));
+    ASSERT_EQ(COMMAND_CLASS_MODERATOR, classifier.classify(Language::ID_COMMAND_GET_EPOCH_REQUEST));
+}
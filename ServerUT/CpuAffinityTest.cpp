@@ -0,0 +1,74 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/CpuAffinity.hpp>
+#include <gtest/gtest.h>
+
+using namespace Server;
+
+TEST(CpuAffinityTest, CpusAreSplitEvenly)
+{
+    CpuSet const first = getCpuSubset(8, 0, 2);
+    CpuSet const second = getCpuSubset(8, 1, 2);
+
+    ASSERT_EQ(4U, first.size());
+    ASSERT_EQ(0U, first.front());
+    ASSERT_EQ(3U, first.back());
+    ASSERT_EQ(4U, second.size());
+    ASSERT_EQ(4U, second.front());
+    ASSERT_EQ(7U, second.back());
+}
+
+TEST(CpuAffinityTest, FirstSubsetsTakeRemainingCpus)
+{
+    CpuSet const first = getCpuSubset(7, 0, 3);
+    CpuSet const second = getCpuSubset(7, 1, 3);
+    CpuSet const third = getCpuSubset(7, 2, 3);
+
+    ASSERT_EQ(3U, first.size());
+    ASSERT_EQ(2U, second.size());
+    ASSERT_EQ(3U, second.front());
+    ASSERT_EQ(2U, third.size());
+    ASSERT_EQ(5U, third.front());
+    ASSERT_EQ(6U, third.back());
+}
+
+TEST(CpuAffinityTest, SubsetsWrapAroundIfCpusAreScarce)
+{
+    CpuSet const third = getCpuSubset(2, 2, 4);
+    CpuSet const fourth = getCpuSubset(2, 3, 4);
+
+    ASSERT_EQ(1U, third.size());
+    ASSERT_EQ(0U, third.front());
+    ASSERT_EQ(1U, fourth.size());
+    ASSERT_EQ(1U, fourth.front());
+}
+
+TEST(CpuAffinityTest, EmptySetDoesNotPin)
+{
+    ASSERT_TRUE(pinCurrentThread(CpuSet()));
+}
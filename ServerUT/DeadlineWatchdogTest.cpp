@@ -0,0 +1,183 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Poco/Event.h>
+#include <Server/include/DeadlineWatchdog.hpp>
+#include <gtest/gtest.h>
+
+using namespace GameServer::Persistence;
+using namespace Server;
+
+namespace
+{
+
+Poco::Timestamp::TimeVal const HOUR = 3600000000LL;
+
+/**
+ * @brief The connection counting the cancellations of its queries.
+ */
+class ConnectionFake
+    : public IConnection
+{
+public:
+    ConnectionFake()
+        : mCancels(0)
+    {
+    }
+
+    virtual void cancel()
+    {
+        ++mCancels;
+        mCancelled.set();
+    }
+
+    unsigned int mCancels;
+
+    Poco::Event mCancelled;
+};
+
+typedef boost::shared_ptr<ConnectionFake> ConnectionFakeShrPtr;
+
+/**
+ * @brief The deadline far enough in the future not to be reached by the thread of the watchdog.
+ */
+Poco::Timestamp::TimeVal getFarDeadline()
+{
+    return Poco::Timestamp().epochMicroseconds() + HOUR;
+}
+
+} // namespace
+
+TEST(DeadlineWatchdogTest, PendingWatchIsNotCancelled)
+{
+    DeadlineWatchdog watchdog;
+    ConnectionFakeShrPtr connection(new ConnectionFake);
+    Poco::Timestamp::TimeVal const deadline = getFarDeadline();
+
+    watchdog.watch(deadline, connection);
+
+    ASSERT_EQ(0U, watchdog.cancelExpired(deadline - 1));
+    ASSERT_EQ(0U, connection->mCancels);
+}
+
+TEST(DeadlineWatchdogTest, ExpiredWatchIsCancelledOnce)
+{
+    DeadlineWatchdog watchdog;
+    ConnectionFakeShrPtr connection(new ConnectionFake);
+    Poco::Timestamp::TimeVal const deadline = getFarDeadline();
+
+    watchdog.watch(deadline, connection);
+
+    ASSERT_EQ(1U, watchdog.cancelExpired(deadline));
+    ASSERT_EQ(0U, watchdog.cancelExpired(deadline + HOUR));
+    ASSERT_EQ(1U, connection->mCancels);
+}
+
+TEST(DeadlineWatchdogTest, OnlyExpiredWatchesAreCancelled)
+{
+    DeadlineWatchdog watchdog;
+    ConnectionFakeShrPtr early(new ConnectionFake);
+    ConnectionFakeShrPtr late(new ConnectionFake);
+    Poco::Timestamp::TimeVal const deadline = getFarDeadline();
+
+    watchdog.watch(deadline + 2, late);
+    watchdog.watch(deadline, early);
+
+    ASSERT_EQ(1U, watchdog.cancelExpired(deadline + 1));
+    ASSERT_EQ(1U, early->mCancels);
+    ASSERT_EQ(0U, late->mCancels);
+}
+
+TEST(DeadlineWatchdogTest, UnwatchedConnectionIsNotCancelled)
+{
+    DeadlineWatchdog watchdog;
+    ConnectionFakeShrPtr connection(new ConnectionFake);
+    Poco::Timestamp::TimeVal const deadline = getFarDeadline();
+
+    ASSERT_TRUE(watchdog.unwatch(watchdog.watch(deadline, connection)));
+    ASSERT_EQ(0U, watchdog.cancelExpired(deadline));
+    ASSERT_EQ(0U, connection->mCancels);
+}
+
+TEST(DeadlineWatchdogTest, ExpiredWatchCannotBeUnwatched)
+{
+    DeadlineWatchdog watchdog;
+    ConnectionFakeShrPtr connection(new ConnectionFake);
+    Poco::Timestamp::TimeVal const deadline = getFarDeadline();
+
+    DeadlineWatchdog::Ticket const ticket = watchdog.watch(deadline, connection);
+    watchdog.cancelExpired(deadline);
+
+    ASSERT_FALSE(watchdog.unwatch(ticket));
+}
+
+TEST(DeadlineWatchdogTest, ThreadCancelsWhenDeadlinePasses)
+{
+    DeadlineWatchdog watchdog;
+    ConnectionFakeShrPtr connection(new ConnectionFake);
+
+    watchdog.watch(Poco::Timestamp().epochMicroseconds() + 10000, connection);
+
+    ASSERT_TRUE(connection->mCancelled.tryWait(5000));
+}
+
+TEST(DeadlineWatchdogTest, ScopedWatchWithoutDeadlineWatchesNothing)
+{
+    DeadlineWatchdogShrPtr watchdog(new DeadlineWatchdog);
+    ConnectionFakeShrPtr connection(new ConnectionFake);
+
+    ScopedDeadlineWatch watch(watchdog, 0, connection);
+
+    ASSERT_EQ(0U, watchdog->cancelExpired(getFarDeadline() + HOUR));
+    ASSERT_FALSE(watch.stop());
+}
+
+TEST(DeadlineWatchdogTest, ScopedWatchReportsExpiry)
+{
+    DeadlineWatchdogShrPtr watchdog(new DeadlineWatchdog);
+    ConnectionFakeShrPtr connection(new ConnectionFake);
+    Poco::Timestamp::TimeVal const deadline = getFarDeadline();
+
+    ScopedDeadlineWatch watch(watchdog, deadline, connection);
+    watchdog->cancelExpired(deadline);
+
+    ASSERT_TRUE(watch.stop());
+    ASSERT_FALSE(watch.stop());
+}
+
+TEST(DeadlineWatchdogTest, ScopedWatchIsStoppedAtEndOfScope)
+{
+    DeadlineWatchdogShrPtr watchdog(new DeadlineWatchdog);
+    ConnectionFakeShrPtr connection(new ConnectionFake);
+    Poco::Timestamp::TimeVal const deadline = getFarDeadline();
+
+    {
+        ScopedDeadlineWatch watch(watchdog, deadline, connection);
+    }
+
+    ASSERT_EQ(0U, watchdog->cancelExpired(deadline));
+}
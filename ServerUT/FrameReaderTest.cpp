@@ -0,0 +1,236 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/FrameReader.hpp>
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+
+using namespace Server;
+
+class FrameReaderTest
+    : public ::testing::Test
+{
+protected:
+    FrameReaderTest()
+        : mBufferPool(new BufferPool(1, 1024)),
+          mFrameReader(mBufferPool, 1000)
+    {
+    }
+
+    /**
+     * @brief Feeds bytes to the reader the way a socket would.
+     *
+     * @param aData The bytes.
+     */
+    void feed(
+        std::string const & aData
+    )
+    {
+        std::memcpy(mFrameReader.prepare(aData.length()), aData.data(), aData.length());
+        mFrameReader.commit(aData.length());
+    }
+
+    /**
+     * @brief Extracts and consumes the next frame.
+     *
+     * @param aContent The content of the frame.
+     *
+     * @return True if a frame has been extracted, false otherwise.
+     */
+    bool extract(
+        std::string & aContent
+    )
+    {
+        char const * content;
+        std::size_t length;
+
+        if (not mFrameReader.extract(content, length))
+        {
+            return false;
+        }
+
+        aContent.assign(content, length);
+        mFrameReader.consume();
+
+        return true;
+    }
+
+    BufferPoolShrPtr mBufferPool;
+
+    FrameReader mFrameReader;
+};
+
+TEST_F(FrameReaderTest, CompleteFrameIsExtracted)
+{
+    feed("5hello");
+
+    std::string content;
+    ASSERT_TRUE(extract(content));
+    ASSERT_EQ("hello", content);
+    ASSERT_EQ(FRAMING_TEXT, mFrameReader.getFraming());
+    ASSERT_FALSE(mFrameReader.hasBufferedData());
+}
+
+TEST_F(FrameReaderTest, FrameSplitAcrossReceivesIsExtractedOnceComplete)
+{
+    std::string content;
+
+    feed("1");
+    ASSERT_FALSE(extract(content));
+    feed("1hello");
+    ASSERT_FALSE(extract(content));
+    feed(" world");
+    ASSERT_TRUE(extract(content));
+    ASSERT_EQ("hello world", content);
+}
+
+TEST_F(FrameReaderTest, PipelinedFramesAreExtractedInOrder)
+{
+    feed("3one3two5three");
+
+    std::string content;
+    ASSERT_TRUE(extract(content));
+    ASSERT_EQ("one", content);
+    ASSERT_TRUE(extract(content));
+    ASSERT_EQ("two", content);
+    ASSERT_TRUE(extract(content));
+    ASSERT_EQ("three", content);
+    ASSERT_FALSE(extract(content));
+}
+
+TEST_F(FrameReaderTest, FrameLargerThanTheInitialBufferIsNotTruncated)
+{
+    std::string const payload(900, 'x');
+
+    for (std::size_t i = 0; i < payload.length(); i += 100)
+    {
+        feed(i == 0 ? "900" + payload.substr(0, 100) : payload.substr(i, 100));
+    }
+
+    std::string content;
+    ASSERT_TRUE(extract(content));
+    ASSERT_EQ(payload, content);
+}
+
+TEST_F(FrameReaderTest, FrameExceedingTheLimitIsMalformed)
+{
+    feed("1001x");
+
+    std::string content;
+    ASSERT_FALSE(extract(content));
+    ASSERT_TRUE(mFrameReader.isMalformed());
+}
+
+TEST_F(FrameReaderTest, MissingLengthIsMalformed)
+{
+    feed("<xml/>");
+
+    std::string content;
+    ASSERT_FALSE(extract(content));
+    ASSERT_TRUE(mFrameReader.isMalformed());
+}
+
+TEST_F(FrameReaderTest, LengthPrefixPaddedBeyondTheHeaderLimitIsMalformed)
+{
+    feed(std::string(100, ' ') + "3one");
+
+    std::string content;
+    ASSERT_FALSE(extract(content));
+    ASSERT_TRUE(mFrameReader.isMalformed());
+}
+
+TEST_F(FrameReaderTest, RoomIsLimitedToCompleteFrameOfMaximumLength)
+{
+    std::size_t const capacity = mFrameReader.getRoom();
+    ASSERT_LT(1000U, capacity);
+
+    feed("5hello");
+    ASSERT_EQ(capacity - 6, mFrameReader.getRoom());
+
+    std::string content;
+    ASSERT_TRUE(extract(content));
+    ASSERT_EQ(capacity, mFrameReader.getRoom());
+}
+
+TEST_F(FrameReaderTest, BinaryFramesCarryRequestIds)
+{
+    char header[BINARY_FRAME_HEADER_SIZE];
+    BinaryFrameHeader binaryHeader = {BINARY_FRAME_VERSION, 0, 3, 7};
+
+    encodeBinaryFrameHeader(binaryHeader, header);
+    feed(std::string(header, BINARY_FRAME_HEADER_SIZE) + "one");
+
+    binaryHeader.mRequestId = 5;
+    encodeBinaryFrameHeader(binaryHeader, header);
+    feed(std::string(header, BINARY_FRAME_HEADER_SIZE) + "two");
+
+    std::string content;
+    ASSERT_TRUE(extract(content));
+    ASSERT_EQ(FRAMING_BINARY, mFrameReader.getFraming());
+    ASSERT_EQ("one", content);
+    ASSERT_EQ(7, mFrameReader.getRequestId());
+    ASSERT_TRUE(extract(content));
+    ASSERT_EQ("two", content);
+    ASSERT_EQ(5, mFrameReader.getRequestId());
+}
+
+TEST_F(FrameReaderTest, BinaryFrameOfUnknownVersionIsMalformed)
+{
+    char header[BINARY_FRAME_HEADER_SIZE];
+    BinaryFrameHeader const binaryHeader = {BINARY_FRAME_VERSION + 1, 0, 3, 7};
+
+    encodeBinaryFrameHeader(binaryHeader, header);
+    feed(std::string(header, BINARY_FRAME_HEADER_SIZE) + "one");
+
+    std::string content;
+    ASSERT_FALSE(extract(content));
+    ASSERT_TRUE(mFrameReader.isMalformed());
+}
+
+TEST(BufferPoolTest, ReleasedBufferIsReused)
+{
+    BufferPool bufferPool(1, 1024);
+
+    BufferPool::Buffer buffer(512);
+    bufferPool.release(buffer);
+    ASSERT_TRUE(buffer.empty());
+
+    bufferPool.acquire(buffer);
+    ASSERT_EQ(512, buffer.size());
+}
+
+TEST(BufferPoolTest, OversizedBufferIsNotRetained)
+{
+    BufferPool bufferPool(1, 1024);
+
+    BufferPool::Buffer buffer(2048);
+    bufferPool.release(buffer);
+
+    bufferPool.acquire(buffer);
+    ASSERT_TRUE(buffer.empty());
+}
@@ -0,0 +1,127 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/FrameWriter.hpp>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace Server;
+
+class FrameWriterTest
+    : public ::testing::Test
+{
+protected:
+    FrameWriterTest()
+    {
+        ::socketpair(AF_UNIX, SOCK_STREAM, 0, mDescriptors);
+    }
+
+    ~FrameWriterTest()
+    {
+        ::close(mDescriptors[0]);
+        ::close(mDescriptors[1]);
+    }
+
+    /**
+     * @brief Reads everything that has been written so far.
+     *
+     * @return The bytes written.
+     */
+    std::string readAll()
+    {
+        ::shutdown(mDescriptors[0], SHUT_WR);
+
+        std::string result;
+        char chunk[256];
+        ssize_t received;
+
+        while ((received = ::recv(mDescriptors[1], chunk, sizeof(chunk), 0)) > 0)
+        {
+            result.append(chunk, received);
+        }
+
+        return result;
+    }
+
+    int mDescriptors[2];
+};
+
+TEST_F(FrameWriterTest, QueuedFramesAreWrittenWithLengthPrefixes)
+{
+    FrameWriter frameWriter;
+
+    std::string first("hello");
+    std::string second("world!");
+    frameWriter.queue(FRAMING_TEXT, 0, first);
+    frameWriter.queue(FRAMING_TEXT, 0, second);
+
+    ASSERT_TRUE(first.empty());
+    ASSERT_FALSE(frameWriter.isEmpty());
+    ASSERT_TRUE(frameWriter.send(mDescriptors[0]));
+    ASSERT_TRUE(frameWriter.isEmpty());
+    ASSERT_EQ("5hello6world!", readAll());
+}
+
+TEST_F(FrameWriterTest, SingleFrameIsWritten)
+{
+    ASSERT_TRUE(FrameWriter::write(mDescriptors[0], FRAMING_TEXT, 0, "<reply/>"));
+    ASSERT_EQ("8<reply/>", readAll());
+}
+
+TEST_F(FrameWriterTest, BinaryFrameCarriesTheRequestId)
+{
+    FrameWriter frameWriter;
+
+    std::string content("<reply/>");
+    frameWriter.queue(FRAMING_BINARY, 0x0102030405060708ULL, content);
+
+    ASSERT_TRUE(frameWriter.send(mDescriptors[0]));
+
+    std::string const written = readAll();
+    ASSERT_EQ(BINARY_FRAME_HEADER_SIZE + 8, written.length());
+
+    BinaryFrameHeader header;
+    ASSERT_TRUE(decodeBinaryFrameHeader(written.data(), header));
+    ASSERT_EQ(8, header.mLength);
+    ASSERT_EQ(0x0102030405060708ULL, header.mRequestId);
+    ASSERT_EQ("<reply/>", written.substr(BINARY_FRAME_HEADER_SIZE));
+}
+
+TEST_F(FrameWriterTest, BinaryFrameCarriesTheFlags)
+{
+    FrameWriter frameWriter;
+
+    std::string content("<indication/>");
+    frameWriter.queue(FRAMING_BINARY, 0, content, BINARY_FRAME_FLAG_INDICATION);
+
+    ASSERT_TRUE(frameWriter.send(mDescriptors[0]));
+
+    BinaryFrameHeader header;
+    ASSERT_TRUE(decodeBinaryFrameHeader(readAll().data(), header));
+    ASSERT_EQ(BINARY_FRAME_FLAG_INDICATION, header.mFlags);
+}
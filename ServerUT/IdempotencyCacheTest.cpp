@@ -0,0 +1,154 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/IdempotencyCache.hpp>
+#include <gtest/gtest.h>
+
+using namespace Server;
+
+namespace
+{
+
+unsigned int const TIMEOUT = 600000;
+
+unsigned short int const COMMAND_ID = 1;
+
+} // namespace
+
+TEST(IdempotencyCacheTest, UnknownKeyIsNew)
+{
+    IdempotencyCache cache(TIMEOUT, 16);
+    std::string reply;
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_NEW, cache.begin("Login", "Key", COMMAND_ID, reply));
+}
+
+TEST(IdempotencyCacheTest, RetryOfRequestInProgressIsReported)
+{
+    IdempotencyCache cache(TIMEOUT, 16);
+    std::string reply;
+
+    cache.begin("Login", "Key", COMMAND_ID, reply);
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_IN_PROGRESS, cache.begin("Login", "Key", COMMAND_ID, reply));
+}
+
+TEST(IdempotencyCacheTest, RetryOfCompletedRequestGetsOriginalReply)
+{
+    IdempotencyCache cache(TIMEOUT, 16);
+    std::string reply;
+
+    cache.begin("Login", "Key", COMMAND_ID, reply);
+    cache.complete("Login", "Key", COMMAND_ID, "Reply");
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_COMPLETED, cache.begin("Login", "Key", COMMAND_ID, reply));
+    ASSERT_STREQ("Reply", reply.c_str());
+}
+
+TEST(IdempotencyCacheTest, RetryOfAbandonedRequestIsNew)
+{
+    IdempotencyCache cache(TIMEOUT, 16);
+    std::string reply;
+
+    cache.begin("Login", "Key", COMMAND_ID, reply);
+    cache.abandon("Login", "Key", COMMAND_ID);
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_NEW, cache.begin("Login", "Key", COMMAND_ID, reply));
+}
+
+TEST(IdempotencyCacheTest, CompletedRequestCannotBeAbandoned)
+{
+    IdempotencyCache cache(TIMEOUT, 16);
+    std::string reply;
+
+    cache.begin("Login", "Key", COMMAND_ID, reply);
+    cache.complete("Login", "Key", COMMAND_ID, "Reply");
+    cache.abandon("Login", "Key", COMMAND_ID);
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_COMPLETED, cache.begin("Login", "Key", COMMAND_ID, reply));
+}
+
+TEST(IdempotencyCacheTest, KeysAreSeparatedByLogin)
+{
+    IdempotencyCache cache(TIMEOUT, 16);
+    std::string reply;
+
+    cache.begin("Login", "Key", COMMAND_ID, reply);
+    cache.complete("Login", "Key", COMMAND_ID, "Reply");
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_NEW, cache.begin("Other", "Key", COMMAND_ID, reply));
+}
+
+TEST(IdempotencyCacheTest, KeysAreSeparatedByCommand)
+{
+    IdempotencyCache cache(TIMEOUT, 16);
+    std::string reply;
+
+    cache.begin("Login", "Key", COMMAND_ID, reply);
+    cache.complete("Login", "Key", COMMAND_ID, "Reply");
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_NEW, cache.begin("Login", "Key", COMMAND_ID + 1, reply));
+}
+
+TEST(IdempotencyCacheTest, OldestRequestIsForgottenWhenFull)
+{
+    IdempotencyCache cache(TIMEOUT, 2);
+    std::string reply;
+
+    cache.begin("Login", "Key1", COMMAND_ID, reply);
+    cache.complete("Login", "Key1", COMMAND_ID, "Reply1");
+    cache.begin("Login", "Key2", COMMAND_ID, reply);
+    cache.complete("Login", "Key2", COMMAND_ID, "Reply2");
+    cache.begin("Login", "Key3", COMMAND_ID, reply);
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_COMPLETED, cache.begin("Login", "Key2", COMMAND_ID, reply));
+    ASSERT_STREQ("Reply2", reply.c_str());
+    ASSERT_EQ(IDEMPOTENCY_STATE_NEW, cache.begin("Login", "Key1", COMMAND_ID, reply));
+}
+
+TEST(IdempotencyCacheTest, CompletingForgottenRequestIsIgnored)
+{
+    IdempotencyCache cache(TIMEOUT, 1);
+    std::string reply;
+
+    cache.begin("Login", "Key1", COMMAND_ID, reply);
+    cache.begin("Login", "Key2", COMMAND_ID, reply);
+    cache.complete("Login", "Key1", COMMAND_ID, "Reply1");
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_IN_PROGRESS, cache.begin("Login", "Key2", COMMAND_ID, reply));
+}
+
+TEST(IdempotencyCacheTest, DisabledCacheTreatsEveryRequestAsNew)
+{
+    IdempotencyCache cache(0, 16);
+    std::string reply;
+
+    cache.begin("Login", "Key", COMMAND_ID, reply);
+    cache.complete("Login", "Key", COMMAND_ID, "Reply");
+
+    ASSERT_EQ(IDEMPOTENCY_STATE_NEW, cache.begin("Login", "Key", COMMAND_ID, reply));
+}
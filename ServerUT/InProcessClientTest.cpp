@@ -0,0 +1,177 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Game/GameServer/Common/Constants.hpp>
+#include <Language/Interface/Command.hpp>
+#include <Poco/Timestamp.h>
+#include <Server/include/Context.hpp>
+#include <Server/include/InProcessClient.hpp>
+#include <Server/include/RateLimiter.hpp>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace Server;
+
+namespace
+{
+
+/**
+ * @brief The context of the server with a single request per second allowed to each login.
+ */
+class ThrottlingContext
+    : public Context
+{
+public:
+    ThrottlingContext()
+        : mRateLimiter(new RateLimiter(RateLimit(1, 1), RateLimit(0, 0), RateLimit(0, 0), 16))
+    {
+    }
+
+    virtual RateLimiterShrPtr getRateLimiter() const
+    {
+        return mRateLimiter;
+    }
+
+private:
+    RateLimiterShrPtr const mRateLimiter;
+};
+
+Language::ICommand::Handle createRequest(
+    unsigned short int const   aId,
+    std::string        const & aLogin
+)
+{
+    Language::ICommand::Handle request(new Language::Command);
+    request->setID(aId);
+    request->setLogin(aLogin);
+    request->setPassword("Password");
+
+    return request;
+}
+
+} // namespace
+
+class InProcessClientTest
+    : public testing::Test
+{
+protected:
+    InProcessClientTest()
+        : mContext(new ThrottlingContext),
+          mInProcessClient(mContext)
+    {
+    }
+
+    /**
+     * @brief Takes the only token of a login, as an earlier request would.
+     *
+     * @param aLogin The login.
+     */
+    void exhaust(
+        std::string const & aLogin
+    )
+    {
+        Poco::Timestamp::TimeDiff retryAfter;
+
+        ASSERT_TRUE(
+            mContext->getRateLimiter()->admit(
+                aLogin, COMMAND_CLASS_READ, Poco::Timestamp().epochMicroseconds(), retryAfter
+            )
+        );
+    }
+
+    IContextShrPtr mContext;
+
+    InProcessClient mInProcessClient;
+};
+
+TEST_F(InProcessClientTest, ThrottledRequestGetsReplyWithRetryHint)
+{
+    exhaust("Login");
+
+    Language::ICommand::Handle const reply =
+        mInProcessClient.execute(createRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, "Login"));
+
+    ASSERT_EQ(Language::ID_COMMAND_GET_LANDS_REPLY, reply->getID());
+    ASSERT_EQ(Game::REPLY_STATUS_THROTTLED, reply->getCode());
+    ASSERT_EQ(0U, reply->getMessage().find("Retry after "));
+}
+
+TEST_F(InProcessClientTest, ThrottledReplyIsTheOneOfRequestsArrivingOnSockets)
+{
+    exhaust("Login");
+
+    Language::ICommand::Handle const request = createRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, "Login");
+    Language::ICommand::Handle const reply = mInProcessClient.execute(request);
+
+    // The hint is rounded up to whole milliseconds, a retry after a microsecond less gets the same one.
+    std::string const message = reply->getMessage();
+    Poco::Timestamp::TimeDiff const retryAfter =
+        std::atol(message.substr(std::string("Retry after ").length()).c_str()) * 1000;
+
+    RequestProcessor requestProcessor(mContext);
+
+    ASSERT_EQ(
+        requestProcessor.throttle(request, retryAfter, CODEC_XML).getContent(),
+        requestProcessor.encode(reply, CODEC_XML).getContent()
+    );
+}
+
+TEST_F(InProcessClientTest, ModeratorCommandWithoutSessionIsThrottled)
+{
+    exhaust("Moderator");
+
+    Language::ICommand::Handle const reply =
+        mInProcessClient.execute(createRequest(Language::ID_COMMAND_TICK_EPOCH_REQUEST, "Moderator"));
+
+    ASSERT_EQ(Game::REPLY_STATUS_THROTTLED, reply->getCode());
+}
+
+TEST_F(InProcessClientTest, ModeratorCommandWithUnknownSessionIsThrottled)
+{
+    exhaust("Moderator");
+
+    Language::ICommand::Handle const request = createRequest(Language::ID_COMMAND_TICK_EPOCH_REQUEST, "Moderator");
+    request->setSessionToken("Unknown");
+
+    ASSERT_EQ(Game::REPLY_STATUS_THROTTLED, mInProcessClient.execute(request)->getCode());
+}
+
+TEST_F(InProcessClientTest, RequestGetsDeadlineOfItsTimeout)
+{
+    exhaust("Login");
+
+    Language::ICommand::Handle const request = createRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, "Login");
+    request->setTimeout(5000);
+
+    unsigned long long int const before = Poco::Timestamp().epochMicroseconds();
+    mInProcessClient.execute(request);
+
+    ASSERT_LE(before + 5000 * 1000ULL, request->getDeadline());
+    ASSERT_GE(static_cast<unsigned long long int>(Poco::Timestamp().epochMicroseconds()) + 5000 * 1000ULL,
+              request->getDeadline());
+}
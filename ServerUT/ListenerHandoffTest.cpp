@@ -0,0 +1,124 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/ListenerHandoff.hpp>
+#include <csignal>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace Server;
+
+namespace
+{
+
+std::string const PATH = "/tmp/serverut_listener_handoff.sock";
+
+} // namespace
+
+TEST(ListenerHandoffTest, NothingIsTakenOverWithoutPredecessor)
+{
+    ::unlink(PATH.c_str());
+
+    std::vector<int> descriptors;
+
+    ASSERT_FALSE(ListenerHandoff::takeOver(PATH, descriptors));
+    ASSERT_TRUE(descriptors.empty());
+}
+
+TEST(ListenerHandoffTest, ListenersAreTakenOver)
+{
+    // The handoff requests the termination of the process, which is not the point here.
+    void (* const previousHandler)(int) = std::signal(SIGINT, SIG_IGN);
+
+    int const listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_LE(0, listener);
+
+    std::vector<int> offered(1, listener);
+    ListenerHandoff listenerHandoff(PATH, offered);
+    listenerHandoff.start();
+
+    std::vector<int> descriptors;
+    bool const takenOver = ListenerHandoff::takeOver(PATH, descriptors);
+
+    listenerHandoff.stop();
+    std::signal(SIGINT, previousHandler);
+
+    ASSERT_TRUE(takenOver);
+    ASSERT_TRUE(listenerHandoff.isHandedOff());
+    ASSERT_EQ(1U, descriptors.size());
+    ASSERT_NE(listener, descriptors.front());
+
+    // The path is released, so the successor may offer it in turn.
+    ASSERT_EQ(-1, ::access(PATH.c_str(), F_OK));
+
+    ::close(descriptors.front());
+    ::close(listener);
+}
+
+TEST(ListenerHandoffTest, PathIsAccessibleToOwnerOnly)
+{
+    int const listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_LE(0, listener);
+
+    std::vector<int> offered(1, listener);
+    ListenerHandoff listenerHandoff(PATH, offered);
+
+    struct stat status;
+    ASSERT_EQ(0, ::stat(PATH.c_str(), &status));
+    ASSERT_EQ(static_cast<mode_t>(S_IRUSR | S_IWUSR), status.st_mode & 0777);
+
+    ::close(listener);
+}
+
+TEST(ListenerHandoffTest, ForeignSuccessorIsRefused)
+{
+    int const listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_LE(0, listener);
+
+    // The test process poses as a foreign user by trusting another one.
+    std::vector<int> offered(1, listener);
+    ListenerHandoff listenerHandoff(PATH, offered, ::geteuid() + 1);
+    listenerHandoff.start();
+
+    std::vector<int> descriptors;
+    bool const takenOver = ListenerHandoff::takeOver(PATH, descriptors);
+
+    listenerHandoff.stop();
+
+    ASSERT_FALSE(takenOver);
+    ASSERT_TRUE(descriptors.empty());
+    ASSERT_FALSE(listenerHandoff.isHandedOff());
+
+    // The listener stays open and the path stays offered.
+    ASSERT_NE(-1, ::fcntl(listener, F_GETFD));
+    ASSERT_EQ(0, ::access(PATH.c_str(), F_OK));
+
+    ::close(listener);
+}
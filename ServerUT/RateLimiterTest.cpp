@@ -0,0 +1,126 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/RateLimiter.hpp>
+#include <gtest/gtest.h>
+
+using namespace Server;
+
+namespace
+{
+
+Poco::Timestamp::TimeVal const SECOND = 1000000;
+
+RateLimit const UNLIMITED(0, 0);
+
+} // namespace
+
+class RateLimiterTest
+    : public ::testing::Test
+{
+protected:
+    RateLimiterTest()
+        : mRetryAfter(0)
+    {
+    }
+
+    Poco::Timestamp::TimeDiff mRetryAfter;
+};
+
+TEST_F(RateLimiterTest, UnlimitedRequestsAreAdmitted)
+{
+    RateLimiter limiter(UNLIMITED, UNLIMITED, UNLIMITED, 16);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(limiter.admit("Login", COMMAND_CLASS_READ, 0, mRetryAfter));
+    }
+}
+
+TEST_F(RateLimiterTest, LoginIsThrottledWithRetryAfterHint)
+{
+    RateLimiter limiter(RateLimit(2, 1), UNLIMITED, UNLIMITED, 16);
+
+    ASSERT_TRUE(limiter.admit("Login", COMMAND_CLASS_READ, 0, mRetryAfter));
+    ASSERT_FALSE(limiter.admit("Login", COMMAND_CLASS_WRITE, 0, mRetryAfter));
+    ASSERT_EQ(SECOND / 2, mRetryAfter);
+    ASSERT_TRUE(limiter.admit("Login", COMMAND_CLASS_READ, SECOND / 2, mRetryAfter));
+}
+
+TEST_F(RateLimiterTest, LoginsAreLimitedSeparately)
+{
+    RateLimiter limiter(RateLimit(1, 1), UNLIMITED, UNLIMITED, 16);
+
+    ASSERT_TRUE(limiter.admit("Bot", COMMAND_CLASS_READ, 0, mRetryAfter));
+    ASSERT_FALSE(limiter.admit("Bot", COMMAND_CLASS_READ, 0, mRetryAfter));
+    ASSERT_TRUE(limiter.admit("Player", COMMAND_CLASS_READ, 0, mRetryAfter));
+}
+
+TEST_F(RateLimiterTest, CommandClassesAreLimitedSeparately)
+{
+    RateLimiter limiter(UNLIMITED, RateLimit(1, 1), UNLIMITED, 16);
+
+    ASSERT_TRUE(limiter.admit("Bot", COMMAND_CLASS_READ, 0, mRetryAfter));
+    ASSERT_FALSE(limiter.admit("Player", COMMAND_CLASS_READ, 0, mRetryAfter));
+    ASSERT_TRUE(limiter.admit("Player", COMMAND_CLASS_WRITE, 0, mRetryAfter));
+}
+
+TEST_F(RateLimiterTest, ModeratorRequestsAreNeverThrottled)
+{
+    RateLimiter limiter(RateLimit(1, 1), RateLimit(1, 1), RateLimit(1, 1), 16);
+
+    ASSERT_TRUE(limiter.admit("Moderator", COMMAND_CLASS_WRITE, 0, mRetryAfter));
+    ASSERT_TRUE(limiter.admit("Moderator", COMMAND_CLASS_MODERATOR, 0, mRetryAfter));
+    ASSERT_TRUE(limiter.admit("Moderator", COMMAND_CLASS_MODERATOR, 0, mRetryAfter));
+}
+
+TEST_F(RateLimiterTest, ThrottledRequestTakesNoToken)
+{
+    RateLimiter limiter(RateLimit(1, 1), RateLimit(1, 2), UNLIMITED, 16);
+
+    ASSERT_TRUE(limiter.admit("Bot", COMMAND_CLASS_READ, 0, mRetryAfter));
+    ASSERT_FALSE(limiter.admit("Bot", COMMAND_CLASS_READ, 0, mRetryAfter));
+    ASSERT_TRUE(limiter.admit("Player", COMMAND_CLASS_READ, 0, mRetryAfter));
+}
+
+TEST_F(RateLimiterTest, IdleLoginsAreForgottenToMakeRoom)
+{
+    RateLimiter limiter(RateLimit(1, 1), UNLIMITED, UNLIMITED, 1);
+
+    ASSERT_TRUE(limiter.admit("Bot", COMMAND_CLASS_READ, 0, mRetryAfter));
+    ASSERT_TRUE(limiter.admit("Player", COMMAND_CLASS_READ, SECOND, mRetryAfter));
+    ASSERT_FALSE(limiter.admit("Player", COMMAND_CLASS_READ, SECOND, mRetryAfter));
+}
+
+TEST_F(RateLimiterTest, UnauthenticatedRequestsShareBucket)
+{
+    RateLimiter limiter(RateLimit(1, 1), UNLIMITED, UNLIMITED, 16);
+
+    ASSERT_TRUE(limiter.admit("", COMMAND_CLASS_READ, 0, mRetryAfter));
+    ASSERT_FALSE(limiter.admit("", COMMAND_CLASS_WRITE, 0, mRetryAfter));
+    ASSERT_TRUE(limiter.admit("Player", COMMAND_CLASS_READ, 0, mRetryAfter));
+}
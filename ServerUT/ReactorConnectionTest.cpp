@@ -0,0 +1,378 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/ReactorConnection.hpp>
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace Server;
+
+class ReactorConnectionTest
+    : public ::testing::Test
+{
+protected:
+    ReactorConnectionTest()
+        : mBufferPool(new BufferPool(1, 1024))
+    {
+        ::socketpair(AF_UNIX, SOCK_STREAM, 0, mDescriptors);
+        ::fcntl(mDescriptors[0], F_SETFL, ::fcntl(mDescriptors[0], F_GETFL) | O_NONBLOCK);
+    }
+
+    ~ReactorConnectionTest()
+    {
+        ::close(mDescriptors[1]);
+    }
+
+    /**
+     * @brief Creates the connection owning the server side of the socket pair.
+     *
+     * @param aMaxPayload  The maximum length of a request.
+     * @param aMaxInFlight The maximum number of requests in progress concurrently.
+     *
+     * @return The connection.
+     */
+    ReactorConnectionShrPtr connect(
+        std::size_t  const aMaxPayload = 1000,
+        unsigned int const aMaxInFlight = 4
+    )
+    {
+        return ReactorConnectionShrPtr(
+            new ReactorConnection(mDescriptors[0], 1, mBufferPool, aMaxPayload, aMaxInFlight)
+        );
+    }
+
+    /**
+     * @brief Sends bytes from the client side.
+     *
+     * @param aData The bytes.
+     */
+    void send(
+        std::string const & aData
+    )
+    {
+        ASSERT_EQ(static_cast<ssize_t>(aData.length()), ::send(mDescriptors[1], aData.data(), aData.length(), 0));
+    }
+
+    /**
+     * @brief Makes a binary frame.
+     *
+     * @param aRequestId The identifier of the request.
+     * @param aContent   The content.
+     *
+     * @return The frame.
+     */
+    std::string frame(
+        unsigned long long int const   aRequestId,
+        std::string            const & aContent
+    ) const
+    {
+        char header[BINARY_FRAME_HEADER_SIZE];
+        BinaryFrameHeader const binaryHeader =
+            {BINARY_FRAME_VERSION, 0, static_cast<unsigned int>(aContent.length()), aRequestId};
+
+        encodeBinaryFrameHeader(binaryHeader, header);
+
+        return std::string(header, BINARY_FRAME_HEADER_SIZE) + aContent;
+    }
+
+    /**
+     * @brief Extracts and accepts the next request.
+     *
+     * @param aConnection The connection.
+     * @param aContent    The content of the request.
+     * @param aRequestId  The identifier of the request.
+     *
+     * @return True if a request has been extracted, false otherwise.
+     */
+    bool extract(
+        ReactorConnection      & aConnection,
+        std::string            & aContent,
+        unsigned long long int & aRequestId
+    )
+    {
+        char const * content;
+        std::size_t length;
+        unsigned char flags;
+
+        if (not aConnection.extractRequest(content, length, aRequestId, flags))
+        {
+            return false;
+        }
+
+        aContent.assign(content, length);
+        aConnection.acceptRequest();
+
+        return true;
+    }
+
+    /**
+     * @brief Receives everything the connection has written so far on the client side.
+     *
+     * @return The bytes received.
+     */
+    std::string receiveAll()
+    {
+        std::string result;
+        char chunk[4096];
+        ssize_t received;
+
+        while ((received = ::recv(mDescriptors[1], chunk, sizeof(chunk), MSG_DONTWAIT)) > 0)
+        {
+            result.append(chunk, received);
+        }
+
+        return result;
+    }
+
+    BufferPoolShrPtr mBufferPool;
+
+    int mDescriptors[2];
+};
+
+TEST_F(ReactorConnectionTest, RequestSplitAcrossReadsIsExtractedOnceComplete)
+{
+    ReactorConnectionShrPtr const connection = connect();
+    std::string content;
+    unsigned long long int requestId;
+
+    send("1");
+    ASSERT_TRUE(connection->receive());
+    ASSERT_FALSE(extract(*connection, content, requestId));
+
+    send("1hello");
+    ASSERT_TRUE(connection->receive());
+    ASSERT_FALSE(extract(*connection, content, requestId));
+
+    send(" world");
+    ASSERT_TRUE(connection->receive());
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_EQ("hello world", content);
+    ASSERT_TRUE(connection->isBusy());
+}
+
+TEST_F(ReactorConnectionTest, PipelinedTextRequestsAreServedOneByOne)
+{
+    ReactorConnectionShrPtr const connection = connect();
+    std::string content;
+    unsigned long long int requestId;
+
+    send("3one3two");
+    ASSERT_TRUE(connection->receive());
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_EQ("one", content);
+    ASSERT_FALSE(extract(*connection, content, requestId));
+
+    std::string reply("1");
+    connection->queueReply(requestId, reply);
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_EQ("two", content);
+    ASSERT_EQ(2, connection->getAccepted());
+}
+
+TEST_F(ReactorConnectionTest, PipelinedBinaryRequestsAreServedUpToTheLimit)
+{
+    ReactorConnectionShrPtr const connection = connect(1000, 2);
+    std::string content;
+    unsigned long long int requestId;
+
+    send(frame(7, "one") + frame(5, "two") + frame(9, "three"));
+    ASSERT_TRUE(connection->receive());
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_EQ(7, requestId);
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_EQ(5, requestId);
+    ASSERT_FALSE(extract(*connection, content, requestId));
+
+    std::string reply("2");
+    connection->queueReply(5, reply);
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_EQ(9, requestId);
+    ASSERT_EQ("three", content);
+}
+
+TEST_F(ReactorConnectionTest, InputIsNotReceivedWhileRequestIsInProgress)
+{
+    ReactorConnectionShrPtr const connection = connect();
+    std::string content;
+    unsigned long long int requestId;
+
+    send("3one");
+    ASSERT_TRUE(connection->receive());
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_FALSE(connection->isReceiving());
+
+    send("3two");
+    ASSERT_TRUE(connection->receive());
+
+    std::string reply("1");
+    connection->queueReply(requestId, reply);
+    ASSERT_TRUE(connection->isReceiving());
+    ASSERT_FALSE(extract(*connection, content, requestId));
+
+    ASSERT_TRUE(connection->receive());
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_EQ("two", content);
+}
+
+TEST_F(ReactorConnectionTest, PipelinedInputIsBufferedUpToCompleteFrameOfMaximumLength)
+{
+    ReactorConnectionShrPtr const connection = connect(10, 100);
+    std::string content;
+    unsigned long long int requestId;
+    std::string frames;
+
+    for (unsigned long long int i = 1; i <= 10; ++i)
+    {
+        frames += frame(i, "0123456789");
+    }
+
+    send(frames);
+    ASSERT_TRUE(connection->receive());
+    ASSERT_FALSE(connection->isReceiving());
+
+    unsigned long long int extracted = 0;
+
+    while (extract(*connection, content, requestId))
+    {
+        ASSERT_EQ(++extracted, requestId);
+    }
+
+    ASSERT_GT(10U, extracted);
+
+    while (extracted < 10)
+    {
+        ASSERT_TRUE(connection->receive());
+
+        while (extract(*connection, content, requestId))
+        {
+            ASSERT_EQ(++extracted, requestId);
+        }
+    }
+}
+
+TEST_F(ReactorConnectionTest, InputIsReceivedInLimitedPortions)
+{
+    ReactorConnectionShrPtr const connection = connect(1 << 20);
+    std::string content;
+    unsigned long long int requestId;
+
+    std::string const payload(100000, 'x');
+    send("100000" + payload);
+
+    ASSERT_TRUE(connection->receive());
+    ASSERT_FALSE(extract(*connection, content, requestId));
+
+    ASSERT_TRUE(connection->receive());
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_EQ(payload, content);
+}
+
+TEST_F(ReactorConnectionTest, PartOfStreamedReplyLeavesRequestInProgress)
+{
+    ReactorConnectionShrPtr const connection = connect();
+    std::string content;
+    unsigned long long int requestId;
+
+    send(frame(7, "one"));
+    ASSERT_TRUE(connection->receive());
+    ASSERT_TRUE(extract(*connection, content, requestId));
+
+    std::string part("part");
+    connection->queueReply(7, part, BINARY_FRAME_FLAG_CONTINUED);
+    ASSERT_TRUE(connection->isBusy());
+
+    std::string last("last");
+    connection->queueReply(7, last);
+    ASSERT_FALSE(connection->isBusy());
+}
+
+TEST_F(ReactorConnectionTest, OversizeRequestIsMalformed)
+{
+    ReactorConnectionShrPtr const connection = connect(10);
+    std::string content;
+    unsigned long long int requestId;
+
+    send("11hello world");
+    ASSERT_TRUE(connection->receive());
+    ASSERT_FALSE(extract(*connection, content, requestId));
+    ASSERT_TRUE(connection->isMalformed());
+}
+
+TEST_F(ReactorConnectionTest, ConnectionIsFinishedOnceEverythingReceivedHasBeenRepliedTo)
+{
+    ReactorConnectionShrPtr const connection = connect();
+    std::string content;
+    unsigned long long int requestId;
+
+    send("3one");
+    ::shutdown(mDescriptors[1], SHUT_WR);
+    ASSERT_TRUE(connection->receive());
+    ASSERT_TRUE(connection->isPeerClosed());
+    ASSERT_TRUE(extract(*connection, content, requestId));
+    ASSERT_FALSE(connection->isFinished());
+
+    std::string reply("reply");
+    connection->queueReply(requestId, reply);
+    ASSERT_FALSE(connection->isFinished());
+    ASSERT_TRUE(connection->send());
+    ASSERT_TRUE(connection->isFinished());
+    ASSERT_EQ("5reply", receiveAll());
+}
+
+TEST_F(ReactorConnectionTest, ReplyNotAcceptedBySocketIsKeptUntilWritable)
+{
+    int const bufferSize = 4096;
+    ::setsockopt(mDescriptors[0], SOL_SOCKET, SO_SNDBUF, &bufferSize, sizeof(bufferSize));
+
+    ReactorConnectionShrPtr const connection = connect();
+    std::string content;
+    unsigned long long int requestId;
+
+    send("3one");
+    ASSERT_TRUE(connection->receive());
+    ASSERT_TRUE(extract(*connection, content, requestId));
+
+    std::string const payload(1 << 20, 'x');
+    std::string reply(payload);
+    connection->queueReply(requestId, reply);
+    ASSERT_TRUE(connection->send());
+    ASSERT_TRUE(connection->hasPendingOutput());
+
+    std::string received;
+
+    while (connection->hasPendingOutput())
+    {
+        received += receiveAll();
+        ASSERT_TRUE(connection->send());
+    }
+
+    received += receiveAll();
+    ASSERT_EQ("1048576" + payload, received);
+}
@@ -0,0 +1,120 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/ReplyCompressor.hpp>
+#include <gtest/gtest.h>
+
+using namespace Server;
+
+namespace
+{
+
+std::string createRepetitiveContent(
+    std::size_t const aLength
+)
+{
+    std::string content;
+
+    while (content.length() < aLength)
+    {
+        content += "<object><param name=\"volume\" value=\"1\"/></object>";
+    }
+
+    return content;
+}
+
+} // namespace
+
+TEST(ReplyCompressorTest, ContentBelowThresholdIsLeftRaw)
+{
+    ReplyCompressor replyCompressor(1024, 1);
+    std::string const original = createRepetitiveContent(512);
+    std::string content = original;
+
+    ASSERT_FALSE(replyCompressor.compress(content));
+    ASSERT_EQ(original, content);
+}
+
+TEST(ReplyCompressorTest, ZeroThresholdDisablesCompression)
+{
+    ReplyCompressor replyCompressor(0, 1);
+    std::string const original = createRepetitiveContent(65536);
+    std::string content = original;
+
+    ASSERT_FALSE(replyCompressor.compress(content));
+    ASSERT_EQ(original, content);
+}
+
+TEST(ReplyCompressorTest, ContentAboveThresholdIsCompressed)
+{
+    ReplyCompressor replyCompressor(1024, 1);
+    std::string const original = createRepetitiveContent(65536);
+    std::string content = original;
+
+    ASSERT_TRUE(replyCompressor.compress(content));
+    ASSERT_LT(content.length(), original.length());
+}
+
+TEST(ReplyCompressorTest, CompressedContentIsDecompressed)
+{
+    ReplyCompressor replyCompressor(1024, 6);
+    std::string const original = createRepetitiveContent(65536);
+    std::string content = original;
+
+    ASSERT_TRUE(replyCompressor.compress(content));
+    ASSERT_TRUE(replyCompressor.decompress(content));
+    ASSERT_EQ(original, content);
+}
+
+TEST(ReplyCompressorTest, IncompressibleContentIsLeftRaw)
+{
+    ReplyCompressor replyCompressor(16, 1);
+    std::string original;
+
+    for (unsigned int i = 0, seed = 12345; i < 4096; ++i)
+    {
+        seed = seed * 1103515245U + 12345U;
+        original += static_cast<char>(seed >> 24);
+    }
+
+    std::string content = original;
+
+    ASSERT_FALSE(replyCompressor.compress(content));
+    ASSERT_EQ(original, content);
+}
+
+TEST(ReplyCompressorTest, CorruptedContentIsNotDecompressed)
+{
+    ReplyCompressor replyCompressor(1024, 1);
+    std::string content = createRepetitiveContent(65536);
+
+    ASSERT_TRUE(replyCompressor.compress(content));
+
+    content.resize(content.length() / 2);
+
+    ASSERT_FALSE(replyCompressor.decompress(content));
+}
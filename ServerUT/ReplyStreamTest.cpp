@@ -0,0 +1,149 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/ReplyBuilder.hpp>
+#include <Server/include/Context.hpp>
+#include <Server/include/Framing.hpp>
+#include <Server/include/ReplyStream.hpp>
+#include <Server/include/RequestProcessor.hpp>
+#include <boost/bind.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace Server;
+
+namespace
+{
+
+/**
+ * @brief Collects the parts written to it, or refuses them as a connection gone away does.
+ */
+class PartCollector
+{
+public:
+    explicit PartCollector(
+        bool const aUsable = true
+    )
+        : mUsable(aUsable)
+    {
+    }
+
+    bool write(
+        std::string   const & aContent,
+        unsigned char const   aFlags
+    )
+    {
+        mContents.push_back(aContent);
+        mFlags.push_back(aFlags);
+
+        return mUsable;
+    }
+
+    bool const mUsable;
+
+    std::vector<std::string> mContents;
+
+    std::vector<unsigned char> mFlags;
+};
+
+Language::ICommand::Handle createPart()
+{
+    Language::Rows lands(Language::LAND_ROWS);
+    lands.appendText(Language::LAND_COLUMN_LOGIN, "Login");
+    lands.appendText(Language::LAND_COLUMN_WORLD_NAME, "World");
+    lands.appendText(Language::LAND_COLUMN_LAND_NAME, "Land");
+    lands.appendBoolean(Language::LAND_COLUMN_GRANTED, true);
+
+    Language::ReplyBuilder replyBuilder;
+
+    return replyBuilder.buildGetLandsReply(1, "Lands have been got.", lands);
+}
+
+} // namespace
+
+class ReplyStreamTest
+    : public testing::Test
+{
+protected:
+    ReplyStreamTest()
+        : mContext(new Context),
+          mRequestProcessor(mContext)
+    {
+    }
+
+    IContextShrPtr mContext;
+
+    RequestProcessor mRequestProcessor;
+};
+
+TEST_F(ReplyStreamTest, RequestNotAcceptingStreamedReplyGetsNoStream)
+{
+    PartCollector collector;
+
+    IReplyStreamShrPtr const replyStream =
+        mRequestProcessor.openReplyStream(0, CODEC_XML, boost::bind(&PartCollector::write, &collector, _1, _2));
+
+    ASSERT_FALSE(replyStream);
+}
+
+TEST_F(ReplyStreamTest, RequestAcceptingStreamedReplyGetsStreamOfConfiguredPartSize)
+{
+    PartCollector collector;
+
+    IReplyStreamShrPtr const replyStream = mRequestProcessor.openReplyStream(
+        BINARY_FRAME_FLAG_ACCEPT_STREAMED, CODEC_XML, boost::bind(&PartCollector::write, &collector, _1, _2)
+    );
+
+    ASSERT_TRUE(replyStream);
+    ASSERT_EQ(mContext->getConfigurator()->getStreamPartSize(), replyStream->getPartSize());
+}
+
+TEST_F(ReplyStreamTest, PartIsWrittenEncodedAsReplyOfItsOwnCarryingContinuedFlag)
+{
+    PartCollector collector;
+    ReplyStream replyStream(mRequestProcessor, CODEC_XML, BINARY_FRAME_FLAG_ACCEPT_STREAMED, 1,
+                            boost::bind(&PartCollector::write, &collector, _1, _2));
+
+    replyStream.write(createPart());
+    replyStream.write(createPart());
+
+    ASSERT_EQ(2U, collector.mContents.size());
+    ASSERT_EQ(BINARY_FRAME_FLAG_CONTINUED, collector.mFlags[0]);
+    ASSERT_EQ(mRequestProcessor.encode(createPart(), CODEC_XML).getContent(), collector.mContents[0]);
+    ASSERT_EQ(collector.mContents[0], collector.mContents[1]);
+}
+
+TEST_F(ReplyStreamTest, PartThatCouldNotBeWrittenThrows)
+{
+    PartCollector collector(false);
+    ReplyStream replyStream(mRequestProcessor, CODEC_TLV, BINARY_FRAME_FLAG_ACCEPT_STREAMED, 1,
+                            boost::bind(&PartCollector::write, &collector, _1, _2));
+
+    ASSERT_THROW(replyStream.write(createPart()), std::runtime_error);
+}
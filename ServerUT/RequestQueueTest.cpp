@@ -0,0 +1,268 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/Command.hpp>
+#include <Server/include/RequestQueue.hpp>
+#include <gtest/gtest.h>
+
+using namespace Server;
+
+class RequestQueueTest
+    : public ::testing::Test
+{
+protected:
+    /**
+     * @brief Produces a queued request.
+     *
+     * @param aId           The identifier of the request.
+     * @param aConnectionId The identifier of the connection.
+     * @param aLogin        The login of the user, verified.
+     *
+     * @return The queued request.
+     */
+    QueuedRequest produceRequest(
+        unsigned short     int const   aId,
+        unsigned long long int const   aConnectionId,
+        std::string            const & aLogin = ""
+    ) const
+    {
+        QueuedRequest request;
+        request.mReplySink = NULL;
+        request.mConnectionId = aConnectionId;
+        request.mCommand.reset(new Language::Command);
+        request.mCommand->setID(aId);
+        request.mCommand->setLogin(aLogin);
+        request.mClass = CommandClassifier().classify(aId);
+        request.mIdentity = aLogin;
+        return request;
+    }
+
+    std::vector<QueuedRequest> mShedRequests;
+};
+
+TEST_F(RequestQueueTest, RequestsArePoppedInOrder)
+{
+    RequestQueue queue(2, 1, OVERLOAD_POLICY_REJECT);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_ECHO_REQUEST, 1), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_ECHO_REQUEST, 2), mShedRequests));
+
+    QueuedRequest request;
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(1, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(2, request.mConnectionId);
+}
+
+TEST_F(RequestQueueTest, RequestIsRejectedWhenQueueIsFull)
+{
+    RequestQueue queue(1, 1, OVERLOAD_POLICY_REJECT);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_ECHO_REQUEST, 1), mShedRequests));
+    ASSERT_FALSE(queue.push(produceRequest(Language::ID_COMMAND_ECHO_REQUEST, 2), mShedRequests));
+    ASSERT_TRUE(mShedRequests.empty());
+
+    RequestQueueStatistics const statistics = queue.collectStatistics();
+    ASSERT_EQ(1, statistics.mDepth);
+    ASSERT_EQ(1, statistics.mQueued);
+    ASSERT_EQ(1, statistics.mRejected);
+}
+
+TEST_F(RequestQueueTest, OldestReadRequestIsShedWhenQueueIsFull)
+{
+    RequestQueue queue(2, 1, OVERLOAD_POLICY_SHED_OLDEST_READ);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_CREATE_LAND_REQUEST, 1), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 2), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_CREATE_LAND_REQUEST, 3), mShedRequests));
+
+    ASSERT_EQ(1, mShedRequests.size());
+    ASSERT_EQ(2, mShedRequests.front().mConnectionId);
+
+    QueuedRequest request;
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(1, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(3, request.mConnectionId);
+}
+
+TEST_F(RequestQueueTest, WriteRequestIsRejectedWhenThereIsNoReadRequestToShed)
+{
+    RequestQueue queue(1, 1, OVERLOAD_POLICY_SHED_OLDEST_READ);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_CREATE_LAND_REQUEST, 1), mShedRequests));
+    ASSERT_FALSE(queue.push(produceRequest(Language::ID_COMMAND_CREATE_LAND_REQUEST, 2), mShedRequests));
+    ASSERT_TRUE(mShedRequests.empty());
+}
+
+TEST_F(RequestQueueTest, LoginsAreServedRoundRobin)
+{
+    RequestQueue queue(4, 1, OVERLOAD_POLICY_REJECT);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 1, "Bot"), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 2, "Bot"), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 3, "Bot"), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 4, "Player"), mShedRequests));
+
+    QueuedRequest request;
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(1, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(4, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(2, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(3, request.mConnectionId);
+}
+
+TEST_F(RequestQueueTest, UnauthenticatedRequestsShareFlow)
+{
+    RequestQueue queue(4, 1, OVERLOAD_POLICY_REJECT);
+
+    // The logins claimed by unauthenticated requests do not tell the flows apart.
+    QueuedRequest first = produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 1);
+    first.mCommand->setLogin("Bot1");
+    QueuedRequest second = produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 2);
+    second.mCommand->setLogin("Bot2");
+
+    ASSERT_TRUE(queue.push(first, mShedRequests));
+    ASSERT_TRUE(queue.push(second, mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 3, "Player"), mShedRequests));
+
+    QueuedRequest request;
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(1, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(3, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(2, request.mConnectionId);
+}
+
+TEST_F(RequestQueueTest, ReadRequestOfBusiestLoginIsShedWhenQueueIsFull)
+{
+    RequestQueue queue(3, 1, OVERLOAD_POLICY_SHED_OLDEST_READ);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 1, "Player"), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 2, "Bot"), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 3, "Bot"), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 4, "Player"), mShedRequests));
+
+    ASSERT_EQ(1, mShedRequests.size());
+    ASSERT_EQ(2, mShedRequests.front().mConnectionId);
+
+    QueuedRequest request;
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(1, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(3, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(4, request.mConnectionId);
+}
+
+TEST_F(RequestQueueTest, ModeratorRequestsArePoppedFirst)
+{
+    RequestQueue queue(2, 1, OVERLOAD_POLICY_REJECT);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 1), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_TICK_EPOCH_REQUEST, 2), mShedRequests));
+
+    QueuedRequest request;
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(2, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(1, request.mConnectionId);
+}
+
+TEST_F(RequestQueueTest, UnverifiedModeratorRequestWaitsWithOtherRequests)
+{
+    RequestQueue queue(2, 1, OVERLOAD_POLICY_REJECT);
+
+    QueuedRequest unverified = produceRequest(Language::ID_COMMAND_TICK_EPOCH_REQUEST, 2);
+    unverified.mClass = COMMAND_CLASS_WRITE;
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 1), mShedRequests));
+    ASSERT_TRUE(queue.push(unverified, mShedRequests));
+
+    RequestQueueStatistics const statistics = queue.collectStatistics();
+    ASSERT_EQ(2, statistics.mDepth);
+    ASSERT_EQ(0, statistics.mPriorityDepth);
+
+    QueuedRequest request;
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(1, request.mConnectionId);
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(2, request.mConnectionId);
+}
+
+TEST_F(RequestQueueTest, ModeratorRequestIsQueuedWhenQueueIsFull)
+{
+    RequestQueue queue(1, 1, OVERLOAD_POLICY_REJECT);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 1), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_TICK_EPOCH_REQUEST, 2), mShedRequests));
+    ASSERT_TRUE(mShedRequests.empty());
+
+    RequestQueueStatistics const statistics = queue.collectStatistics();
+    ASSERT_EQ(1, statistics.mDepth);
+    ASSERT_EQ(1, statistics.mPriorityDepth);
+}
+
+TEST_F(RequestQueueTest, ModeratorRequestIsRejectedWhenPriorityLaneIsFull)
+{
+    RequestQueue queue(1, 1, OVERLOAD_POLICY_SHED_OLDEST_READ);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_TICK_EPOCH_REQUEST, 1), mShedRequests));
+    ASSERT_FALSE(queue.push(produceRequest(Language::ID_COMMAND_ACTIVATE_EPOCH_REQUEST, 2), mShedRequests));
+    ASSERT_TRUE(mShedRequests.empty());
+}
+
+TEST_F(RequestQueueTest, PriorityOnlyPopLeavesOtherRequests)
+{
+    RequestQueue queue(2, 1, OVERLOAD_POLICY_REJECT);
+
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_GET_LANDS_REQUEST, 1), mShedRequests));
+    ASSERT_TRUE(queue.push(produceRequest(Language::ID_COMMAND_TICK_EPOCH_REQUEST, 2), mShedRequests));
+
+    queue.close();
+
+    QueuedRequest request;
+    ASSERT_TRUE(queue.pop(request, true));
+    ASSERT_EQ(2, request.mConnectionId);
+    ASSERT_FALSE(queue.pop(request, true));
+    ASSERT_TRUE(queue.pop(request));
+    ASSERT_EQ(1, request.mConnectionId);
+}
+
+TEST_F(RequestQueueTest, PopReturnsFalseWhenQueueIsClosedAndEmpty)
+{
+    RequestQueue queue(1, 1, OVERLOAD_POLICY_REJECT);
+
+    queue.close();
+
+    QueuedRequest request;
+    ASSERT_FALSE(queue.pop(request));
+}
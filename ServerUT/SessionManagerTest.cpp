@@ -0,0 +1,149 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/SessionManager.hpp>
+#include <gtest/gtest.h>
+
+using namespace Server;
+
+namespace
+{
+
+/**
+ * @brief A user of a given login.
+ */
+class FakeUser
+    : public GameServer::User::IUser
+{
+public:
+    explicit FakeUser(
+        std::string const & aLogin
+    )
+        : mLogin(aLogin)
+    {
+    }
+
+    virtual std::string getLogin() const
+    {
+        return mLogin;
+    }
+
+    virtual std::string getPassword() const
+    {
+        return "";
+    }
+
+    virtual bool isModerator() const
+    {
+        return false;
+    }
+
+private:
+    std::string const mLogin;
+};
+
+unsigned int const TIMEOUT = 60000U;
+
+} // namespace
+
+class SessionManagerTest
+    : public ::testing::Test
+{
+protected:
+    SessionManagerTest()
+        : mUser(new FakeUser("Login")),
+          mSessionManager(TIMEOUT, 2)
+    {
+    }
+
+    GameServer::User::IUserShrPtr mUser;
+
+    SessionManager mSessionManager;
+};
+
+TEST_F(SessionManagerTest, OpenReturnsNonEmptyToken)
+{
+    ASSERT_FALSE(mSessionManager.open(mUser).empty());
+}
+
+TEST_F(SessionManagerTest, OpenReturnsDistinctTokens)
+{
+    ASSERT_NE(mSessionManager.open(mUser), mSessionManager.open(mUser));
+}
+
+TEST_F(SessionManagerTest, ResolveReturnsUserOfOpenedSession)
+{
+    std::string const token = mSessionManager.open(mUser);
+
+    ASSERT_EQ(mUser, mSessionManager.resolve(token, "Login"));
+}
+
+TEST_F(SessionManagerTest, ResolveReturnsNullForUnknownToken)
+{
+    mSessionManager.open(mUser);
+
+    ASSERT_FALSE(mSessionManager.resolve("Unknown", "Login"));
+}
+
+TEST_F(SessionManagerTest, ResolveReturnsNullForAnotherLogin)
+{
+    std::string const token = mSessionManager.open(mUser);
+
+    ASSERT_FALSE(mSessionManager.resolve(token, "Another"));
+}
+
+TEST_F(SessionManagerTest, ResolveReturnsNullForClosedSession)
+{
+    std::string const token = mSessionManager.open(mUser);
+    mSessionManager.close(token);
+
+    ASSERT_FALSE(mSessionManager.resolve(token, "Login"));
+}
+
+TEST_F(SessionManagerTest, ResolveReturnsNullForExpiredSession)
+{
+    SessionManager session_manager(0, 2);
+    std::string const token = session_manager.open(mUser);
+
+    ASSERT_FALSE(session_manager.resolve(token, "Login"));
+}
+
+TEST_F(SessionManagerTest, OpenReturnsEmptyTokenIfFull)
+{
+    mSessionManager.open(mUser);
+    mSessionManager.open(mUser);
+
+    ASSERT_TRUE(mSessionManager.open(mUser).empty());
+}
+
+TEST_F(SessionManagerTest, OpenPurgesExpiredSessionsIfFull)
+{
+    SessionManager session_manager(0, 1);
+    session_manager.open(mUser);
+
+    ASSERT_FALSE(session_manager.open(mUser).empty());
+}
@@ -0,0 +1,196 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Language/Interface/IndicationBuilder.hpp>
+#include <Protocol/Binary/Cpp/BinaryToLanguageDecoder.hpp>
+#include <Server/include/SubscriptionRegistry.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace Server;
+
+namespace
+{
+
+/**
+ * @brief A subscriber recording the indications delivered to it.
+ */
+class FakeSubscriber
+    : public ISubscriber
+{
+public:
+    explicit FakeSubscriber(
+        bool  const aConnected = true,
+        Codec const aCodec = CODEC_XML
+    )
+        : mConnected(aConnected),
+          mCodec(aCodec),
+          mSubscribed(false)
+    {
+    }
+
+    virtual bool notify(
+        std::string const & aContent
+    )
+    {
+        mContents.push_back(aContent);
+
+        return mConnected;
+    }
+
+    virtual Codec getCodec() const
+    {
+        return mCodec;
+    }
+
+    virtual void markSubscribed()
+    {
+        mSubscribed = true;
+    }
+
+    bool mConnected;
+
+    Codec mCodec;
+
+    bool mSubscribed;
+
+    std::vector<std::string> mContents;
+};
+
+} // namespace
+
+class SubscriptionRegistryTest
+    : public ::testing::Test
+{
+protected:
+    SubscriptionRegistryTest()
+        : mSubscriber(new FakeSubscriber),
+          mOtherSubscriber(new FakeSubscriber)
+    {
+    }
+
+    Language::ICommand::Commands indicationsOf(
+        std::string const & aWorldName
+    ) const
+    {
+        Language::ICommand::Commands indications;
+        indications.push_back(mIndicationBuilder.buildTickCompletedIndication(aWorldName, "7"));
+        return indications;
+    }
+
+    Language::IndicationBuilder mIndicationBuilder;
+
+    SubscriptionRegistry mRegistry;
+
+    boost::shared_ptr<FakeSubscriber> mSubscriber;
+
+    boost::shared_ptr<FakeSubscriber> mOtherSubscriber;
+};
+
+TEST_F(SubscriptionRegistryTest, SubscriberIsSubscribedUntilItUnsubscribes)
+{
+    ASSERT_FALSE(mRegistry.isSubscribed(mSubscriber));
+
+    mRegistry.subscribe("World", mSubscriber);
+    ASSERT_TRUE(mRegistry.isSubscribed(mSubscriber));
+
+    mRegistry.unsubscribe(mSubscriber);
+    ASSERT_FALSE(mRegistry.isSubscribed(mSubscriber));
+}
+
+TEST_F(SubscriptionRegistryTest, SubscriberIsToldItHasBeenSubscribed)
+{
+    ASSERT_FALSE(mSubscriber->mSubscribed);
+
+    mRegistry.subscribe("World", mSubscriber);
+    ASSERT_TRUE(mSubscriber->mSubscribed);
+    ASSERT_FALSE(mOtherSubscriber->mSubscribed);
+}
+
+TEST_F(SubscriptionRegistryTest, IndicationsAreDeliveredToTheSubscribersOfTheirWorldOnly)
+{
+    mRegistry.subscribe("World", mSubscriber);
+    mRegistry.subscribe("OtherWorld", mOtherSubscriber);
+
+    mRegistry.publish(indicationsOf("World"));
+
+    ASSERT_EQ(1, mSubscriber->mContents.size());
+    ASSERT_NE(std::string::npos, mSubscriber->mContents.at(0).find("tick_completed"));
+    ASSERT_TRUE(mOtherSubscriber->mContents.empty());
+}
+
+TEST_F(SubscriptionRegistryTest, AllSubscribersOfTheWorldGetTheSameContent)
+{
+    mRegistry.subscribe("World", mSubscriber);
+    mRegistry.subscribe("World", mOtherSubscriber);
+
+    mRegistry.publish(indicationsOf("World"));
+
+    ASSERT_EQ(1, mSubscriber->mContents.size());
+    ASSERT_EQ(mSubscriber->mContents, mOtherSubscriber->mContents);
+}
+
+TEST_F(SubscriptionRegistryTest, RepeatedSubscriptionDeliversOnce)
+{
+    mRegistry.subscribe("World", mSubscriber);
+    mRegistry.subscribe("World", mSubscriber);
+
+    mRegistry.publish(indicationsOf("World"));
+
+    ASSERT_EQ(1, mSubscriber->mContents.size());
+}
+
+TEST_F(SubscriptionRegistryTest, SubscriberThatHasGoneAwayIsDropped)
+{
+    mSubscriber->mConnected = false;
+    mRegistry.subscribe("World", mSubscriber);
+
+    mRegistry.publish(indicationsOf("World"));
+
+    ASSERT_FALSE(mRegistry.isSubscribed(mSubscriber));
+}
+
+TEST_F(SubscriptionRegistryTest, SubscribersGetTheContentInTheirCodec)
+{
+    boost::shared_ptr<FakeSubscriber> const tlvSubscriber(new FakeSubscriber(true, CODEC_TLV));
+
+    mRegistry.subscribe("World", mSubscriber);
+    mRegistry.subscribe("World", tlvSubscriber);
+
+    mRegistry.publish(indicationsOf("World"));
+
+    ASSERT_EQ(1, tlvSubscriber->mContents.size());
+    ASSERT_NE(mSubscriber->mContents, tlvSubscriber->mContents);
+
+    std::string const & content = tlvSubscriber->mContents.at(0);
+    Language::ICommand::Handle const indication =
+        Protocol::BinaryToLanguageDecoder().decode(content.data(), content.size());
+
+    ASSERT_EQ(Language::ID_COMMAND_TICK_COMPLETED_INDICATION, indication->getID());
+    ASSERT_EQ("World", indication->getParam("world_name"));
+    ASSERT_EQ("7", indication->getParam("ticks"));
+}
@@ -0,0 +1,97 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/TokenBucket.hpp>
+#include <gtest/gtest.h>
+
+using namespace Server;
+
+namespace
+{
+
+Poco::Timestamp::TimeVal const SECOND = 1000000;
+
+} // namespace
+
+TEST(TokenBucketTest, NewBucketIsFull)
+{
+    TokenBucket bucket(1, 2, 0);
+
+    ASSERT_TRUE(bucket.isFull(0));
+}
+
+TEST(TokenBucketTest, TokensOfBurstAreAvailableRightAway)
+{
+    TokenBucket bucket(1, 2, 0);
+
+    ASSERT_EQ(0, bucket.getWait(0));
+    bucket.take();
+    ASSERT_EQ(0, bucket.getWait(0));
+    bucket.take();
+    ASSERT_FALSE(bucket.isFull(0));
+}
+
+TEST(TokenBucketTest, EmptyBucketReportsTimeUntilNextToken)
+{
+    TokenBucket bucket(4, 1, 0);
+
+    bucket.take();
+
+    ASSERT_EQ(SECOND / 4, bucket.getWait(0));
+    ASSERT_EQ(SECOND / 8, bucket.getWait(SECOND / 8));
+}
+
+TEST(TokenBucketTest, BucketIsRefilledAtRate)
+{
+    TokenBucket bucket(2, 1, 0);
+
+    bucket.take();
+
+    ASSERT_EQ(0, bucket.getWait(SECOND / 2));
+}
+
+TEST(TokenBucketTest, BucketIsNotRefilledAboveBurst)
+{
+    TokenBucket bucket(1000, 2, 0);
+
+    bucket.take();
+    bucket.take();
+
+    ASSERT_TRUE(bucket.isFull(1000 * SECOND));
+    bucket.take();
+    bucket.take();
+    ASSERT_LT(0, bucket.getWait(1000 * SECOND));
+}
+
+TEST(TokenBucketTest, ZeroBurstHoldsSingleToken)
+{
+    TokenBucket bucket(1, 0, 0);
+
+    ASSERT_EQ(0, bucket.getWait(0));
+    bucket.take();
+    ASSERT_EQ(SECOND, bucket.getWait(0));
+}
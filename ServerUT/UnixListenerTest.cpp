@@ -0,0 +1,191 @@
+// Copyright (C) 2010, 2011 and 2012 Marcin Arkadiusz Skrobiranda.
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+// 1. Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+// 3. Neither the name of the project nor the names of its contributors
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE PROJECT AND CONTRIBUTORS "AS IS" AND
+// ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE PROJECT OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+// LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+// OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+// SUCH DAMAGE.
+
+#include <Server/include/Context.hpp>
+#include <Server/include/Framing.hpp>
+#include <Server/include/Reactor.hpp>
+#include <Server/include/RequestQueue.hpp>
+#include <Server/include/UnixListener.hpp>
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace Server;
+
+namespace
+{
+
+std::string const PATH = "/tmp/serverut_unix_listener.sock";
+
+/**
+ * @brief Connects to a Unix domain socket, gives up on receiving after a second.
+ *
+ * @param aPath The path of the socket.
+ *
+ * @return The descriptor of the connected socket, -1 if the connection has failed.
+ */
+int connectTo(
+    std::string const & aPath
+)
+{
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, aPath.c_str(), aPath.length());
+
+    int const descriptor = ::socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (::connect(descriptor, reinterpret_cast<sockaddr const *>(&address), sizeof(address)) != 0)
+    {
+        ::close(descriptor);
+        return -1;
+    }
+
+    timeval timeout = {1, 0};
+    ::setsockopt(descriptor, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    return descriptor;
+}
+
+/**
+ * @brief Receives exactly the given number of bytes.
+ *
+ * @return The bytes, fewer if the peer has closed the connection or nothing has come for a second.
+ */
+std::string receive(
+    int         const aDescriptor,
+    std::size_t const aLength
+)
+{
+    std::string data;
+    char buffer[256];
+
+    while (data.length() < aLength)
+    {
+        ssize_t const received = ::recv(aDescriptor, buffer, std::min(sizeof(buffer), aLength - data.length()), 0);
+
+        if (received <= 0)
+        {
+            break;
+        }
+
+        data.append(buffer, static_cast<std::size_t>(received));
+    }
+
+    return data;
+}
+
+} // namespace
+
+class UnixListenerTest
+    : public testing::Test
+{
+protected:
+    ~UnixListenerTest()
+    {
+        ::unlink(PATH.c_str());
+    }
+};
+
+TEST_F(UnixListenerTest, ConnectionsAreAcceptedOnThePath)
+{
+    int const listener = openUnixListener(PATH);
+    int const client = connectTo(PATH);
+
+    ASSERT_LE(0, client);
+
+    int const accepted = ::accept(listener, NULL, NULL);
+
+    ASSERT_LE(0, accepted);
+
+    ::close(accepted);
+    ::close(client);
+    ::close(listener);
+}
+
+TEST_F(UnixListenerTest, StaleSocketFileIsReplaced)
+{
+    // A listener closed without unlinking its path leaves the socket file behind, as a crashed server does.
+    ::close(openUnixListener(PATH));
+    ASSERT_EQ(0, ::access(PATH.c_str(), F_OK));
+    ASSERT_EQ(-1, connectTo(PATH));
+
+    int const listener = openUnixListener(PATH);
+    int const client = connectTo(PATH);
+
+    ASSERT_LE(0, client);
+
+    ::close(client);
+    ::close(listener);
+}
+
+TEST_F(UnixListenerTest, TooLongPathIsRejected)
+{
+    ASSERT_THROW(openUnixListener("/tmp/" + std::string(sizeof(sockaddr_un().sun_path), 'x')), std::runtime_error);
+}
+
+TEST_F(UnixListenerTest, ReactorServesConnectionsOfUnixDomainSocket)
+{
+    IContextShrPtr const context(new Context);
+    RequestQueue requestQueue(1, 1, OVERLOAD_POLICY_REJECT);
+    int const listener = openUnixListener(PATH);
+
+    Reactor reactor(context, listener, requestQueue, 0, CpuSet());
+    reactor.start();
+
+    int const client = connectTo(PATH);
+    ASSERT_LE(0, client);
+
+    // The handshake is answered by the reactor itself, no worker is needed.
+    std::string const codecName = getCodecName(CODEC_TLV);
+    char header[BINARY_FRAME_HEADER_SIZE];
+    BinaryFrameHeader const requestHeader =
+        {BINARY_FRAME_VERSION, BINARY_FRAME_FLAG_NEGOTIATE, static_cast<unsigned int>(codecName.length()), 7};
+    encodeBinaryFrameHeader(requestHeader, header);
+
+    std::string const request = std::string(header, BINARY_FRAME_HEADER_SIZE) + codecName;
+    ASSERT_EQ(static_cast<ssize_t>(request.length()), ::send(client, request.data(), request.length(), 0));
+
+    std::string const replyHeaderBytes = receive(client, BINARY_FRAME_HEADER_SIZE);
+    ASSERT_EQ(BINARY_FRAME_HEADER_SIZE, replyHeaderBytes.length());
+
+    BinaryFrameHeader replyHeader;
+    ASSERT_TRUE(decodeBinaryFrameHeader(replyHeaderBytes.data(), replyHeader));
+    ASSERT_EQ(7U, replyHeader.mRequestId);
+    ASSERT_TRUE(replyHeader.mFlags & BINARY_FRAME_FLAG_NEGOTIATE);
+    ASSERT_EQ(codecName, receive(client, replyHeader.mLength));
+
+    ::close(client);
+    reactor.stop();
+    ::close(listener);
+}
@@ -63,7 +63,7 @@ private:
 
         GameServer::Persistence::TransactionPostgresqlShrPtr transaction_postgresql =
             boost::shared_dynamic_cast<GameServer::Persistence::TransactionPostgresql>(transaction);
-        pqxx::transaction<> & backboneTransaction = transaction_postgresql->getBackboneTransaction();
+        pqxx::dbtransaction & backboneTransaction = transaction_postgresql->getBackboneTransaction();
 
         try
         {